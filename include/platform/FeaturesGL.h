@@ -560,6 +560,28 @@ struct FeaturesGL : FeatureSetBase
         "emulate_immutable_compressed_texture_3d", FeatureCategory::OpenGLWorkarounds,
         "Use non-immutable texture allocation to work around a driver bug.", &members,
         "https://crbug.com/1060012"};
+
+    // Streaming client-side vertex and index data by re-specifying or re-mapping a single buffer
+    // forces the driver to orphan it or wait for the previous draw calls. When buffer storage is
+    // available, stream through a persistently mapped ring buffer recycled with fences instead.
+    Feature usePersistentMappedStreamingBuffers = {
+        "use_persistent_mapped_streaming_buffers", FeatureCategory::OpenGLWorkarounds,
+        "Stream client-side vertex arrays through a persistently mapped ring buffer.", &members};
+
+    // Consecutive draw calls with no state changes in between can be coalesced into a single
+    // glMultiDrawArrays/glMultiDrawElements call, which reduces driver overhead for workloads that
+    // issue many small draws.
+    Feature batchDrawCallsWithMultiDraw = {
+        "batch_draw_calls_with_multi_draw", FeatureCategory::OpenGLWorkarounds,
+        "Coalesce consecutive draw calls without state changes into native multi-draw calls.",
+        &members};
+
+    // ANGLE's own program cache is invalidated by every ANGLE update and is bypassed for some
+    // programs, in which case the translated shaders are relinked natively.  Cache the native
+    // program binaries separately, keyed by the translated sources and the native driver.
+    Feature cacheNativeProgramBinaries = {
+        "cache_native_program_binaries", FeatureCategory::OpenGLWorkarounds,
+        "Cache native program binaries in the blob cache to skip native linking.", &members};
 };
 
 inline FeaturesGL::FeaturesGL()  = default;
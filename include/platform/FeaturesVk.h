@@ -90,6 +90,33 @@ struct FeaturesVk : FeatureSetBase
         "supportsIncrementalPresent", FeatureCategory::VulkanFeatures,
         "VkDevice supports the VK_KHR_incremental_present extension", &members};
 
+    // Whether the VkDevice supports the VK_KHR_present_id and VK_KHR_present_wait extensions, with
+    // which the CPU can wait until a present is displayed.
+    Feature supportsPresentWait = {
+        "supportsPresentWait", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_present_id and VK_KHR_present_wait extensions", &members};
+
+    // Whether the VkDevice supports the VK_KHR_timeline_semaphore extension.  The command queue
+    // then signals a timeline semaphore with the serial of each submission instead of a fence.
+    Feature supportsTimelineSemaphore = {
+        "supportsTimelineSemaphore", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_timeline_semaphore extension", &members};
+
+    // Whether the VkDevice supports the VK_KHR_maintenance2 extension (or Vulkan 1.1), which allows
+    // images to be created with usages that are only supported by the formats of their views.  This
+    // is used to generate mipmaps of sRGB images with compute through a linear view.
+    Feature supportsImageExtendedUsage = {
+        "supportsImageExtendedUsage", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_maintenance2 extension", &members};
+
+    // Whether the VkDevice supports the VK_KHR_imageless_framebuffer extension.  Framebuffers are
+    // then created from the properties of their attachments instead of the image views, which are
+    // only provided when the render pass begins.  A single framebuffer object thus serves every
+    // set of compatible attachments.
+    Feature supportsImagelessFramebuffer = {
+        "supportsImagelessFramebuffer", FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_imageless_framebuffer extension", &members};
+
     // Whether the VkDevice supports the VK_ANDROID_external_memory_android_hardware_buffer
     // extension, on which the EGL_ANDROID_image_native_buffer extension can be layered.
     Feature supportsAndroidHardwareBuffer = {
@@ -367,6 +394,12 @@ struct FeaturesVk : FeatureSetBase
                                  "Use CommandQueue worker thread to dispatch work to GPU.",
                                  &members, "http://anglebug.com/4324"};
 
+    // Tell the Vulkan back-end to destroy garbage in a worker thread once the GPU is done with it.
+    // Otherwise the garbage is destroyed at flush and finish time on the thread that submits.
+    Feature asyncGarbageCleanup = {"asyncGarbageCleanup", FeatureCategory::VulkanFeatures,
+                                   "Use a worker thread to destroy garbage Vulkan objects.",
+                                   &members};
+
     // Whether the VkDevice supports the VK_KHR_shader_float16_int8 extension and has the
     // shaderFloat16 feature.
     Feature supportsShaderFloat16 = {"supportsShaderFloat16", FeatureCategory::VulkanFeatures,
@@ -570,6 +603,14 @@ struct FeaturesVk : FeatureSetBase
     Feature supportsSurfaceProtectedSwapchains = {
         "supportsSurfaceProtectedSwapchains", FeatureCategory::VulkanFeatures,
         "VkSurface supportsProtected for protected swapchains", &members};
+
+    // Interactive applications may prefer a shorter latency from input to display over
+    // throughput.  Window surfaces then wait for the previous frame to be presented before
+    // acquiring the next swapchain image, which leaves at most one frame in flight.
+    Feature lowLatencyFramePacing = {
+        "lowLatencyFramePacing", FeatureCategory::VulkanFeatures,
+        "Wait for the previous frame to be presented before acquiring the next swapchain image",
+        &members};
 };
 
 inline FeaturesVk::FeaturesVk()  = default;
@@ -51,7 +51,7 @@ INIT_DICT = {
 }
 
 # Strip these suffixes from Context entry point names. NV is excluded (for now).
-STRIP_SUFFIXES = ["ANDROID", "ANGLE", "EXT", "KHR", "OES", "CHROMIUM", "OVR"]
+STRIP_SUFFIXES = ["AMD", "ANDROID", "ANGLE", "EXT", "KHR", "OES", "CHROMIUM", "OVR"]
 
 TEMPLATE_ENTRY_POINT_HEADER = """\
 // GENERATED FILE - DO NOT EDIT.
@@ -56,6 +56,7 @@ gles1_extensions = [
 
 gles_extensions = [
     # ES2+
+    "GL_AMD_performance_monitor",
     "GL_ANGLE_base_vertex_base_instance",
     "GL_ANGLE_framebuffer_blit",
     "GL_ANGLE_framebuffer_multisample",
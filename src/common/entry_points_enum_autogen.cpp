@@ -468,6 +468,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glBegin";
         case EntryPoint::GLBeginConditionalRender:
             return "glBeginConditionalRender";
+        case EntryPoint::GLBeginPerfMonitorAMD:
+            return "glBeginPerfMonitorAMD";
         case EntryPoint::GLBeginQuery:
             return "glBeginQuery";
         case EntryPoint::GLBeginQueryEXT:
@@ -882,6 +884,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glDeleteLists";
         case EntryPoint::GLDeleteMemoryObjectsEXT:
             return "glDeleteMemoryObjectsEXT";
+        case EntryPoint::GLDeletePerfMonitorsAMD:
+            return "glDeletePerfMonitorsAMD";
         case EntryPoint::GLDeleteProgram:
             return "glDeleteProgram";
         case EntryPoint::GLDeleteProgramPipelines:
@@ -1066,6 +1070,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glEndConditionalRender";
         case EntryPoint::GLEndList:
             return "glEndList";
+        case EntryPoint::GLEndPerfMonitorAMD:
+            return "glEndPerfMonitorAMD";
         case EntryPoint::GLEndQuery:
             return "glEndQuery";
         case EntryPoint::GLEndQueryEXT:
@@ -1184,6 +1190,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glGenFramebuffersOES";
         case EntryPoint::GLGenLists:
             return "glGenLists";
+        case EntryPoint::GLGenPerfMonitorsAMD:
+            return "glGenPerfMonitorsAMD";
         case EntryPoint::GLGenProgramPipelines:
             return "glGenProgramPipelines";
         case EntryPoint::GLGenProgramPipelinesEXT:
@@ -1390,6 +1398,18 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glGetObjectPtrLabel";
         case EntryPoint::GLGetObjectPtrLabelKHR:
             return "glGetObjectPtrLabelKHR";
+        case EntryPoint::GLGetPerfMonitorCounterDataAMD:
+            return "glGetPerfMonitorCounterDataAMD";
+        case EntryPoint::GLGetPerfMonitorCounterInfoAMD:
+            return "glGetPerfMonitorCounterInfoAMD";
+        case EntryPoint::GLGetPerfMonitorCounterStringAMD:
+            return "glGetPerfMonitorCounterStringAMD";
+        case EntryPoint::GLGetPerfMonitorCountersAMD:
+            return "glGetPerfMonitorCountersAMD";
+        case EntryPoint::GLGetPerfMonitorGroupStringAMD:
+            return "glGetPerfMonitorGroupStringAMD";
+        case EntryPoint::GLGetPerfMonitorGroupsAMD:
+            return "glGetPerfMonitorGroupsAMD";
         case EntryPoint::GLGetPixelMapfv:
             return "glGetPixelMapfv";
         case EntryPoint::GLGetPixelMapuiv:
@@ -2598,6 +2618,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glSecondaryColorPointer";
         case EntryPoint::GLSelectBuffer:
             return "glSelectBuffer";
+        case EntryPoint::GLSelectPerfMonitorCountersAMD:
+            return "glSelectPerfMonitorCountersAMD";
         case EntryPoint::GLSemaphoreParameterui64vEXT:
             return "glSemaphoreParameterui64vEXT";
         case EntryPoint::GLSetFenceNV:
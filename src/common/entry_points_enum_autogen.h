@@ -240,6 +240,7 @@ enum class EntryPoint
     GLAttachShader,
     GLBegin,
     GLBeginConditionalRender,
+    GLBeginPerfMonitorAMD,
     GLBeginQuery,
     GLBeginQueryEXT,
     GLBeginQueryIndexed,
@@ -447,6 +448,7 @@ enum class EntryPoint
     GLDeleteFramebuffersOES,
     GLDeleteLists,
     GLDeleteMemoryObjectsEXT,
+    GLDeletePerfMonitorsAMD,
     GLDeleteProgram,
     GLDeleteProgramPipelines,
     GLDeleteProgramPipelinesEXT,
@@ -539,6 +541,7 @@ enum class EntryPoint
     GLEnd,
     GLEndConditionalRender,
     GLEndList,
+    GLEndPerfMonitorAMD,
     GLEndQuery,
     GLEndQueryEXT,
     GLEndQueryIndexed,
@@ -598,6 +601,7 @@ enum class EntryPoint
     GLGenFramebuffers,
     GLGenFramebuffersOES,
     GLGenLists,
+    GLGenPerfMonitorsAMD,
     GLGenProgramPipelines,
     GLGenProgramPipelinesEXT,
     GLGenQueries,
@@ -701,6 +705,12 @@ enum class EntryPoint
     GLGetObjectLabelKHR,
     GLGetObjectPtrLabel,
     GLGetObjectPtrLabelKHR,
+    GLGetPerfMonitorCounterDataAMD,
+    GLGetPerfMonitorCounterInfoAMD,
+    GLGetPerfMonitorCounterStringAMD,
+    GLGetPerfMonitorCountersAMD,
+    GLGetPerfMonitorGroupStringAMD,
+    GLGetPerfMonitorGroupsAMD,
     GLGetPixelMapfv,
     GLGetPixelMapuiv,
     GLGetPixelMapusv,
@@ -1305,6 +1315,7 @@ enum class EntryPoint
     GLSecondaryColorP3uiv,
     GLSecondaryColorPointer,
     GLSelectBuffer,
+    GLSelectPerfMonitorCountersAMD,
     GLSemaphoreParameterui64vEXT,
     GLSetFenceNV,
     GLShadeModel,
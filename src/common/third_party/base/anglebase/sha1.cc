@@ -23,51 +23,10 @@ namespace base
 // also find a description of the algorithm:
 // http://csrc.nist.gov/publications/fips/fips180-3/fips180-3_final.pdf
 
-// Usage example:
-//
-// SecureHashAlgorithm sha;
-// while(there is data to hash)
-//   sha.Update(moredata, size of data);
-// sha.Final();
-// memcpy(somewhere, sha.Digest(), 20);
-//
-// to reuse the instance of sha, call sha.Init();
-
 // TODO(jhawkins): Replace this implementation with a per-platform
 // implementation using each platform's crypto library.  See
 // http://crbug.com/47218
 
-class SecureHashAlgorithm
-{
-  public:
-    SecureHashAlgorithm() { Init(); }
-
-    static const int kDigestSizeBytes;
-
-    void Init();
-    void Update(const void *data, size_t nbytes);
-    void Final();
-
-    // 20 bytes of message digest.
-    const unsigned char *Digest() const { return reinterpret_cast<const unsigned char *>(H); }
-
-  private:
-    void Pad();
-    void Process();
-
-    uint32_t A, B, C, D, E;
-
-    uint32_t H[5];
-
-    union {
-        uint32_t W[80];
-        uint8_t M[64];
-    };
-
-    uint32_t cursor;
-    uint64_t l;
-};
-
 static inline uint32_t f(uint32_t t, uint32_t B, uint32_t C, uint32_t D)
 {
     if (t < 20)
@@ -6,6 +6,7 @@
 #define ANGLEBASE_SHA1_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <string>
 
@@ -21,6 +22,49 @@ namespace base
 
 static const size_t kSHA1Length = 20;  // Length in bytes of a SHA-1 hash.
 
+// Incremental SHA-1 hasher, for callers that want to hash data as it is produced rather than
+// concatenating it into a single buffer first.
+//
+// Usage example:
+//
+// SecureHashAlgorithm sha;
+// while(there is data to hash)
+//   sha.Update(moredata, size of data);
+// sha.Final();
+// memcpy(somewhere, sha.Digest(), 20);
+//
+// to reuse the instance of sha, call sha.Init();
+class ANGLEBASE_EXPORT SecureHashAlgorithm
+{
+  public:
+    SecureHashAlgorithm() { Init(); }
+
+    static const int kDigestSizeBytes;
+
+    void Init();
+    void Update(const void *data, size_t nbytes);
+    void Final();
+
+    // 20 bytes of message digest.
+    const unsigned char *Digest() const { return reinterpret_cast<const unsigned char *>(H); }
+
+  private:
+    void Pad();
+    void Process();
+
+    uint32_t A, B, C, D, E;
+
+    uint32_t H[5];
+
+    union {
+        uint32_t W[80];
+        uint8_t M[64];
+    };
+
+    uint32_t cursor;
+    uint64_t l;
+};
+
 // Computes the SHA-1 hash of the input string |str| and returns the full
 // hash.
 ANGLEBASE_EXPORT std::string SHA1HashString(const std::string &str);
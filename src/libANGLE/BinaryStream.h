@@ -57,10 +57,25 @@ class BinaryInputStream : angle::NonCopyable
         *outValue = readInt<IntT>();
     }
 
+    // Reads the element count of a serialized container.  Every element takes at least one byte,
+    // so a count larger than the remaining data means the stream is corrupt; that is flagged as an
+    // error instead of letting the caller size a container with it.
+    size_t readElementCount()
+    {
+        size_t count = readInt<size_t>();
+        if (count > remainingSize())
+        {
+            mError = true;
+            return 0;
+        }
+        return count;
+    }
+
     template <class IntT, class VectorElementT>
     void readIntVector(std::vector<VectorElementT> *param)
     {
-        size_t size = readInt<size_t>();
+        size_t size = readElementCount();
+        param->reserve(param->size() + size);
         for (size_t index = 0; index < size; ++index)
         {
             param->push_back(readInt<IntT>());
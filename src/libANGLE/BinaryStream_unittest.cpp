@@ -85,4 +85,28 @@ TEST(BinaryStream, IntVector)
         ASSERT_EQ(writeData[i], readData[i]);
     }
 }
+
+// Test that element counts larger than the remaining data are flagged as errors.
+TEST(BinaryStream, ElementCountOverflow)
+{
+    {
+        gl::BinaryOutputStream out;
+        out.writeInt<size_t>(4);
+        out.writeInt(1);
+
+        gl::BinaryInputStream in(out.data(), out.length());
+        EXPECT_EQ(4u, in.readElementCount());
+        EXPECT_FALSE(in.error());
+    }
+
+    {
+        gl::BinaryOutputStream out;
+        out.writeInt(std::numeric_limits<size_t>::max());
+        out.writeInt(1);
+
+        gl::BinaryInputStream in(out.data(), out.length());
+        EXPECT_EQ(0u, in.readElementCount());
+        EXPECT_TRUE(in.error());
+    }
+}
 }  // namespace angle
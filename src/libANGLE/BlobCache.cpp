@@ -101,16 +101,38 @@ bool DecompressBlobCacheData(const uint8_t *compressedData,
 }
 
 BlobCache::BlobCache(size_t maxCacheSizeBytes)
-    : mBlobCache(maxCacheSizeBytes), mSetBlobFunc(nullptr), mGetBlobFunc(nullptr)
-{}
+    : mMaxCacheSizeBytes(0), mSetBlobFunc(nullptr), mGetBlobFunc(nullptr)
+{
+    createShards(maxCacheSizeBytes);
+}
 
 BlobCache::~BlobCache() {}
 
+void BlobCache::createShards(size_t maxCacheSizeBytes)
+{
+    const size_t shardCount =
+        std::max<size_t>(1, std::min(kMaxShardCount, maxCacheSizeBytes / kMinShardSizeBytes));
+
+    mShards.clear();
+    for (size_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+    {
+        mShards.emplace_back(new CacheShard(maxCacheSizeBytes / shardCount));
+    }
+    mMaxCacheSizeBytes = maxCacheSizeBytes;
+}
+
+BlobCache::CacheShard &BlobCache::getShard(const BlobCache::Key &key) const
+{
+    // Keys are SHA-1 hashes, so any of their bytes is uniformly distributed.
+    return *mShards[key[0] % mShards.size()];
+}
+
 void BlobCache::put(const BlobCache::Key &key, angle::MemoryBuffer &&value)
 {
     if (areBlobCacheFuncsSet())
     {
         // Store the result in the application's cache
+        std::lock_guard<std::mutex> lock(mBlobCacheMutex);
         mSetBlobFunc(key.data(), key.size(), value.data(), value.size());
     }
     else
@@ -135,7 +157,9 @@ void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value,
     newEntry.second = source;
 
     // Cache it inside blob cache only if caching inside the application is not possible.
-    mBlobCache.put(key, std::move(newEntry), newEntry.first.size());
+    CacheShard &shard = getShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.cache.put(key, std::move(newEntry), newEntry.first.size());
 }
 
 bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
@@ -180,8 +204,11 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
     }
 
     // Otherwise we are doing caching internally, so try to find it there
+    CacheShard &shard = getShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
     const CacheEntry *entry;
-    bool result = mBlobCache.get(key, &entry);
+    bool result = shard.cache.get(key, &entry);
 
     if (result)
     {
@@ -196,8 +223,25 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
                                         kCacheResultMax);
         }
 
-        *valueOut      = BlobCache::Value(entry->first.data(), entry->first.size());
-        *bufferSizeOut = entry->first.size();
+        const angle::MemoryBuffer &blob = entry->first;
+        if (scratchBuffer != nullptr)
+        {
+            // Entries may be evicted by another thread once the shard lock is released, so hand
+            // out a copy.
+            angle::MemoryBuffer *scratchMemory;
+            if (!scratchBuffer->get(blob.size(), &scratchMemory))
+            {
+                ERR() << "Failed to allocate memory for binary blob";
+                return false;
+            }
+            memcpy(scratchMemory->data(), blob.data(), blob.size());
+            *valueOut = BlobCache::Value(scratchMemory->data(), blob.size());
+        }
+        else
+        {
+            *valueOut = BlobCache::Value(blob.data(), blob.size());
+        }
+        *bufferSizeOut = blob.size();
     }
     else
     {
@@ -210,18 +254,98 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
 
 bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Value *valueOut)
 {
-    const CacheEntry *valueBuf;
-    bool result = mBlobCache.getAt(index, keyOut, &valueBuf);
-    if (result)
+    for (std::unique_ptr<CacheShard> &shard : mShards)
     {
-        *valueOut = BlobCache::Value(valueBuf->first.data(), valueBuf->first.size());
+        std::lock_guard<std::mutex> lock(shard->mutex);
+
+        const size_t shardEntryCount = shard->cache.entryCount();
+        if (index >= shardEntryCount)
+        {
+            index -= shardEntryCount;
+            continue;
+        }
+
+        const CacheEntry *valueBuf;
+        bool result = shard->cache.getAt(index, keyOut, &valueBuf);
+        if (result)
+        {
+            *valueOut = BlobCache::Value(valueBuf->first.data(), valueBuf->first.size());
+        }
+        return result;
     }
-    return result;
+    return false;
 }
 
 void BlobCache::remove(const BlobCache::Key &key)
 {
-    mBlobCache.eraseByKey(key);
+    CacheShard &shard = getShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.cache.eraseByKey(key);
+}
+
+void BlobCache::clear()
+{
+    for (std::unique_ptr<CacheShard> &shard : mShards)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->cache.clear();
+    }
+}
+
+void BlobCache::resize(size_t maxCacheSizeBytes)
+{
+    // The shard layout depends on the cache size.  Resizing discards the contents anyway, so the
+    // shards are simply recreated.  The caller must ensure no other thread is using the cache.
+    createShards(maxCacheSizeBytes);
+}
+
+size_t BlobCache::entryCount() const
+{
+    size_t count = 0;
+    for (const std::unique_ptr<CacheShard> &shard : mShards)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        count += shard->cache.entryCount();
+    }
+    return count;
+}
+
+size_t BlobCache::trim(size_t limit)
+{
+    // Give each shard an equal share of the limit.
+    const size_t shardLimit = limit / mShards.size();
+
+    size_t bytesFreed = 0;
+    for (std::unique_ptr<CacheShard> &shard : mShards)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        bytesFreed += shard->cache.shrinkToSize(shardLimit);
+    }
+    return bytesFreed;
+}
+
+size_t BlobCache::size() const
+{
+    size_t totalSize = 0;
+    for (const std::unique_ptr<CacheShard> &shard : mShards)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        totalSize += shard->cache.size();
+    }
+    return totalSize;
+}
+
+bool BlobCache::empty() const
+{
+    for (const std::unique_ptr<CacheShard> &shard : mShards)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        if (!shard->cache.empty())
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
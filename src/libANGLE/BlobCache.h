@@ -12,6 +12,9 @@
 
 #include <array>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include <anglebase/sha1.h>
 #include "common/MemoryBuffer.h"
@@ -93,7 +96,9 @@ class BlobCache final : angle::NonCopyable
     ~BlobCache();
 
     // Store a key-blob pair in the cache.  If application callbacks are set, the application cache
-    // will be used.  Otherwise the value is cached in this object.
+    // will be used.  Otherwise the value is cached in this object, and only the shard the key maps
+    // to is locked.  Safe to call from worker threads, as the calls to the application are
+    // serialized.
     void put(const BlobCache::Key &key, angle::MemoryBuffer &&value);
 
     // Store a key-blob pair in the application cache, only if application callbacks are set.
@@ -106,13 +111,16 @@ class BlobCache final : angle::NonCopyable
                   CacheSource source = CacheSource::Disk);
 
     // Check if the cache contains the blob corresponding to this key.  If application callbacks are
-    // set, those will be used.  Otherwise they key is looked up in this object's cache.
+    // set, those will be used.  Otherwise they key is looked up in this object's cache.  When a
+    // scratch buffer is provided, the blob is copied into it so that the returned value stays valid
+    // even if another thread evicts the entry.
     ANGLE_NO_DISCARD bool get(angle::ScratchBuffer *scratchBuffer,
                               const BlobCache::Key &key,
                               BlobCache::Value *valueOut,
                               size_t *bufferSizeOut);
 
-    // For querying the contents of the cache.
+    // For querying the contents of the cache.  Indices span all shards.  The returned pointers are
+    // only valid while no other thread is modifying the cache.
     ANGLE_NO_DISCARD bool getAt(size_t index,
                                 const BlobCache::Key **keyOut,
                                 BlobCache::Value *valueOut);
@@ -121,25 +129,25 @@ class BlobCache final : angle::NonCopyable
     void remove(const BlobCache::Key &key);
 
     // Empty the cache.
-    void clear() { mBlobCache.clear(); }
+    void clear();
 
     // Resize the cache. Discards current contents.
-    void resize(size_t maxCacheSizeBytes) { mBlobCache.resize(maxCacheSizeBytes); }
+    void resize(size_t maxCacheSizeBytes);
 
     // Returns the number of entries in the cache.
-    size_t entryCount() const { return mBlobCache.entryCount(); }
+    size_t entryCount() const;
 
     // Reduces the current cache size and returns the number of bytes freed.
-    size_t trim(size_t limit) { return mBlobCache.shrinkToSize(limit); }
+    size_t trim(size_t limit);
 
     // Returns the current cache size in bytes.
-    size_t size() const { return mBlobCache.size(); }
+    size_t size() const;
 
     // Returns whether the cache is empty
-    bool empty() const { return mBlobCache.empty(); }
+    bool empty() const;
 
     // Returns the maximum cache size in bytes.
-    size_t maxSize() const { return mBlobCache.maxSize(); }
+    size_t maxSize() const { return mMaxCacheSizeBytes; }
 
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
 
@@ -151,8 +159,27 @@ class BlobCache final : angle::NonCopyable
     // This internal cache is used only if the application is not providing caching callbacks
     using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
 
+    // The internal cache is split into shards by key, each with its own lock and an equal share of
+    // the total size, so that threads storing or loading different blobs don't contend.  Small
+    // caches use a single shard, to avoid making blobs that would fit in the cache too large for
+    // a shard.
+    static constexpr size_t kMaxShardCount     = 8;
+    static constexpr size_t kMinShardSizeBytes = 1024 * 1024;
+
+    struct CacheShard final : angle::NonCopyable
+    {
+        explicit CacheShard(size_t maxShardSizeBytes) : cache(maxShardSizeBytes) {}
+
+        mutable std::mutex mutex;
+        angle::SizedMRUCache<BlobCache::Key, CacheEntry> cache;
+    };
+
+    void createShards(size_t maxCacheSizeBytes);
+    CacheShard &getShard(const BlobCache::Key &key) const;
+
     std::mutex mBlobCacheMutex;
-    angle::SizedMRUCache<BlobCache::Key, CacheEntry> mBlobCache;
+    std::vector<std::unique_ptr<CacheShard>> mShards;
+    size_t mMaxCacheSizeBytes;
 
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
@@ -6,6 +6,8 @@
 // BlobCache_unittest.h: Unit tests for the blob cache.
 
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 #include "libANGLE/BlobCache.h"
 
@@ -131,4 +133,83 @@ TEST(BlobCacheTest, OversizeValue)
     EXPECT_FALSE(blobCache.get(nullptr, MakeKey(5), &qvalue, &blobSize));
 }
 
+// Tests that a cache large enough to be sharded stores and finds values across all shards, and
+// that the entries are all reachable through getAt.
+TEST(BlobCacheTest, ShardedValues)
+{
+    constexpr size_t kSize       = 16 * 1024 * 1024;
+    constexpr size_t kValueCount = 64;
+    BlobCache blobCache(kSize);
+
+    for (size_t value = 0; value < kValueCount; ++value)
+    {
+        blobCache.populate(MakeKey(static_cast<uint8_t>(value)),
+                           MakeBlob(4, static_cast<uint8_t>(value)));
+    }
+
+    EXPECT_EQ(kValueCount, blobCache.entryCount());
+    EXPECT_EQ(kValueCount * 4, blobCache.size());
+
+    for (size_t value = 0; value < kValueCount; ++value)
+    {
+        Blob qvalue;
+        size_t blobSize;
+        EXPECT_TRUE(
+            blobCache.get(nullptr, MakeKey(static_cast<uint8_t>(value)), &qvalue, &blobSize));
+        EXPECT_EQ(4u, blobSize);
+        if (qvalue.size() > 0)
+        {
+            EXPECT_EQ(value, qvalue[0]);
+        }
+    }
+
+    size_t foundCount = 0;
+    const Key *key    = nullptr;
+    Blob qvalue;
+    while (blobCache.getAt(foundCount, &key, &qvalue))
+    {
+        EXPECT_EQ((*key)[0], qvalue[0]);
+        ++foundCount;
+    }
+    EXPECT_EQ(kValueCount, foundCount);
+
+    EXPECT_EQ(kValueCount * 4, blobCache.trim(0));
+    EXPECT_TRUE(blobCache.empty());
+}
+
+// Tests that populating and querying the cache from multiple threads is safe.
+TEST(BlobCacheTest, ConcurrentAccess)
+{
+    constexpr size_t kSize            = 16 * 1024 * 1024;
+    constexpr size_t kThreadCount     = 4;
+    constexpr size_t kValuesPerThread = 256;
+    BlobCache blobCache(kSize);
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&blobCache, threadIndex]() {
+            angle::ScratchBuffer scratchBuffer(1);
+            for (size_t value = 0; value < kValuesPerThread; ++value)
+            {
+                Key key = MakeKey(static_cast<uint8_t>(value));
+                key[1]  = static_cast<uint8_t>(threadIndex);
+                blobCache.populate(key, MakeBlob(16, static_cast<uint8_t>(value)));
+
+                Blob qvalue;
+                size_t blobSize;
+                EXPECT_TRUE(blobCache.get(&scratchBuffer, key, &qvalue, &blobSize));
+                EXPECT_EQ(16u, blobSize);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(kThreadCount * kValuesPerThread, blobCache.entryCount());
+}
+
 }  // namespace egl
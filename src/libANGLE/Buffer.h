@@ -46,6 +46,7 @@ class BufferState final : angle::NonCopyable
     GLint64 getMapLength() const { return mMapLength; }
     GLint64 getSize() const { return mSize; }
     bool isBoundForTransformFeedback() const { return mTransformFeedbackIndexedBindingCount != 0; }
+    int getBindingCount() const { return mBindingCount; }
     std::string getLabel() const { return mLabel; }
 
   private:
@@ -131,7 +131,6 @@ void Event::callback(cl_int commandStatus)
 EventPtrs Event::Cast(cl_uint numEvents, const cl_event *eventList)
 {
     EventPtrs events;
-    events.reserve(numEvents);
     while (numEvents-- != 0u)
     {
         events.emplace_back(&(*eventList++)->cast<Event>());
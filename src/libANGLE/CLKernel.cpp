@@ -15,6 +15,26 @@
 namespace cl
 {
 
+namespace
+{
+
+struct ImageTypeName
+{
+    const char *typeName;
+    MemObjectType type;
+};
+
+constexpr ImageTypeName kImageTypeNames[] = {
+    {"image1d_t", MemObjectType::Image1D},
+    {"image2d_t", MemObjectType::Image2D},
+    {"image3d_t", MemObjectType::Image3D},
+    {"image1d_array_t", MemObjectType::Image1D_Array},
+    {"image2d_array_t", MemObjectType::Image2D_Array},
+    {"image1d_buffer_t", MemObjectType::Image1D_Buffer},
+};
+
+}  // namespace
+
 cl_int Kernel::setArg(cl_uint argIndex, size_t argSize, const void *argValue)
 {
     return mImpl->setArg(argIndex, argSize, argValue);
@@ -221,12 +241,66 @@ Kernel::Kernel(Program &program, const char *name, cl_int &errorCode)
       mInfo(mImpl ? mImpl->createInfo(errorCode) : rx::CLKernelImpl::Info{})
 {
     ++mProgram->mNumAttachedKernels;
+    initArgTypes();
 }
 
 Kernel::Kernel(Program &program, const rx::CLKernelImpl::CreateFunc &createFunc, cl_int &errorCode)
     : mProgram(&program), mImpl(createFunc(*this)), mInfo(mImpl->createInfo(errorCode))
 {
     ++mProgram->mNumAttachedKernels;
+    initArgTypes();
+}
+
+void Kernel::initArgTypes()
+{
+    mArgTypes.resize(mInfo.args.size(), ArgType::Unknown);
+    mArgImageTypes.resize(mInfo.args.size(), MemObjectType::InvalidEnum);
+
+    for (size_t index = 0u; index < mInfo.args.size(); ++index)
+    {
+        const rx::CLKernelImpl::ArgInfo &arg = mInfo.args[index];
+        if (arg.typeName.empty())
+        {
+            continue;
+        }
+
+        ArgType &type = mArgTypes[index];
+        for (const ImageTypeName &image : kImageTypeNames)
+        {
+            if (arg.typeName == image.typeName)
+            {
+                type                  = ArgType::Image;
+                mArgImageTypes[index] = image.type;
+            }
+        }
+        if (type == ArgType::Image)
+        {
+            continue;
+        }
+
+        if (arg.typeName == "sampler_t")
+        {
+            type = ArgType::Sampler;
+        }
+        else if (arg.typeName == "queue_t")
+        {
+            type = ArgType::DeviceQueue;
+        }
+        else if ((arg.typeQualifier & CL_KERNEL_ARG_TYPE_PIPE) != 0u ||
+                 arg.addressQualifier == CL_KERNEL_ARG_ADDRESS_GLOBAL ||
+                 arg.addressQualifier == CL_KERNEL_ARG_ADDRESS_CONSTANT)
+        {
+            type = ArgType::Memory;
+        }
+        else if (arg.addressQualifier == CL_KERNEL_ARG_ADDRESS_LOCAL)
+        {
+            type = ArgType::Local;
+        }
+        else
+        {
+            type = ArgType::Value;
+        }
+    }
 }
 
 }  // namespace cl
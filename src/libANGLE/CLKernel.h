@@ -36,11 +36,29 @@ class Kernel final : public _cl_kernel, public Object
                       size_t *valueSizeRet) const;
 
   public:
+    // The kind of an argument, classified once from its argument info, so that setting an argument
+    // doesn't have to compare type names. Unknown without argument info.
+    enum class ArgType : uint8_t
+    {
+        Unknown,
+        Value,
+        Local,
+        // A buffer or a pipe.
+        Memory,
+        Image,
+        Sampler,
+        DeviceQueue,
+    };
+
     ~Kernel() override;
 
     const Program &getProgram() const;
     const rx::CLKernelImpl::Info &getInfo() const;
 
+    ArgType getArgType(cl_uint argIndex) const;
+    // Returns the image type of an image argument.
+    MemObjectType getArgImageType(cl_uint argIndex) const;
+
     template <typename T = rx::CLKernelImpl>
     T &getImpl() const;
 
@@ -48,9 +66,13 @@ class Kernel final : public _cl_kernel, public Object
     Kernel(Program &program, const char *name, cl_int &errorCode);
     Kernel(Program &program, const rx::CLKernelImpl::CreateFunc &createFunc, cl_int &errorCode);
 
+    void initArgTypes();
+
     const ProgramPtr mProgram;
     const rx::CLKernelImpl::Ptr mImpl;
     const rx::CLKernelImpl::Info mInfo;
+    std::vector<ArgType> mArgTypes;
+    std::vector<MemObjectType> mArgImageTypes;
 
     friend class Object;
     friend class Program;
@@ -66,6 +88,17 @@ inline const rx::CLKernelImpl::Info &Kernel::getInfo() const
     return mInfo;
 }
 
+inline Kernel::ArgType Kernel::getArgType(cl_uint argIndex) const
+{
+    return argIndex < mArgTypes.size() ? mArgTypes[argIndex] : ArgType::Unknown;
+}
+
+inline MemObjectType Kernel::getArgImageType(cl_uint argIndex) const
+{
+    ASSERT(getArgType(argIndex) == ArgType::Image);
+    return mArgImageTypes[argIndex];
+}
+
 template <typename T>
 inline T &Kernel::getImpl() const
 {
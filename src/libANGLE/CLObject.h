@@ -24,16 +24,18 @@ class Object
 
     cl_uint getRefCount() const noexcept { return mRefCount; }
 
-    void retain() noexcept { ++mRefCount; }
+    // A new reference is always taken from an existing one, so retaining doesn't need to order
+    // memory accesses. The last release has to see all accesses of the other references.
+    void retain() noexcept { mRefCount.fetch_add(1u, std::memory_order_relaxed); }
 
     bool release()
     {
-        if (mRefCount == 0u)
+        if (mRefCount.load(std::memory_order_relaxed) == 0u)
         {
             WARN() << "Unreferenced object without references";
             return true;
         }
-        return --mRefCount == 0u;
+        return mRefCount.fetch_sub(1u, std::memory_order_acq_rel) == 1u;
     }
 
     template <typename T, typename... Args>
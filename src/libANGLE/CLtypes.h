@@ -12,6 +12,7 @@
 #include "libANGLE/CLRefPointer.h"
 #include "libANGLE/Debug.h"
 
+#include "common/FastVector.h"
 #include "common/PackedCLEnums_autogen.h"
 #include "common/angleutils.h"
 
@@ -64,12 +65,16 @@ using SamplerPtr      = RefPointer<Sampler>;
 
 using BufferPtrs   = std::vector<BufferPtr>;
 using DevicePtrs   = std::vector<DevicePtr>;
-using EventPtrs    = std::vector<EventPtr>;
 using KernelPtrs   = std::vector<KernelPtr>;
 using MemoryPtrs   = std::vector<MemoryPtr>;
 using PlatformPtrs = std::vector<PlatformPtr>;
 using ProgramPtrs  = std::vector<ProgramPtr>;
 
+// Event wait lists are cast for every enqueued command and are usually short, so they are kept
+// inline to not allocate memory per command.
+constexpr size_t kInlineEventCount = 8;
+using EventPtrs                    = angle::FastVector<EventPtr, kInlineEventCount>;
+
 struct ImageDescriptor
 {
     MemObjectType type;
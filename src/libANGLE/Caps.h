@@ -747,6 +747,9 @@ struct Extensions
 
     // GL_EXT_EGL_image_storage
     bool eglImageStorageEXT = false;
+
+    // GL_AMD_performance_monitor
+    bool performanceMonitorAMD = false;
 };
 
 // Pointer to a boolean memeber of the Extensions struct
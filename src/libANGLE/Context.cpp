@@ -7436,6 +7436,22 @@ bool Context::isQueryGenerated(QueryID query) const
     return mQueryMap.contains(query);
 }
 
+const angle::PerfMonitorCounterGroups &Context::getPerfMonitorCounterGroups() const
+{
+    return mImplementation->getPerfMonitorCounters();
+}
+
+bool Context::isPerfMonitorGenerated(GLuint monitor) const
+{
+    return mPerfMonitors.count(monitor) != 0;
+}
+
+bool Context::isPerfMonitorActive(GLuint monitor) const
+{
+    auto iter = mPerfMonitors.find(monitor);
+    return iter != mPerfMonitors.end() && iter->second.active;
+}
+
 GLboolean Context::isQuery(QueryID id) const
 {
     return ConvertToGLBoolean(getQuery(id) != nullptr);
@@ -8685,6 +8701,229 @@ void Context::framebufferFetchBarrier()
     mImplementation->framebufferFetchBarrier();
 }
 
+Context::PerfMonitor::PerfMonitor() : active(false), resultAvailable(false) {}
+
+Context::PerfMonitor::PerfMonitor(const PerfMonitor &other) = default;
+
+Context::PerfMonitor::~PerfMonitor() = default;
+
+void Context::beginPerfMonitor(GLuint monitor)
+{
+    const angle::PerfMonitorCounterGroups &groups = getPerfMonitorCounterGroups();
+    PerfMonitor &perfMonitor                      = mPerfMonitors[monitor];
+
+    perfMonitor.beginValues.clear();
+    for (const std::pair<GLuint, GLuint> &counter : perfMonitor.selectedCounters)
+    {
+        perfMonitor.beginValues.push_back(groups[counter.first].counters[counter.second].value);
+    }
+
+    perfMonitor.result.clear();
+    perfMonitor.active          = true;
+    perfMonitor.resultAvailable = false;
+}
+
+void Context::deletePerfMonitors(GLsizei n, GLuint *monitors)
+{
+    for (GLsizei i = 0; i < n; i++)
+    {
+        if (mPerfMonitors.erase(monitors[i]) != 0)
+        {
+            mPerfMonitorHandleAllocator.release(monitors[i]);
+        }
+    }
+}
+
+void Context::endPerfMonitor(GLuint monitor)
+{
+    const angle::PerfMonitorCounterGroups &groups = getPerfMonitorCounterGroups();
+    PerfMonitor &perfMonitor                      = mPerfMonitors[monitor];
+
+    // The counters only ever increase, so the result is the difference since the monitor began.
+    size_t counterIndex = 0;
+    for (const std::pair<GLuint, GLuint> &counter : perfMonitor.selectedCounters)
+    {
+        const uint64_t endValue = groups[counter.first].counters[counter.second].value;
+        perfMonitor.result.push_back(
+            {counter.first, counter.second, endValue - perfMonitor.beginValues[counterIndex++]});
+    }
+
+    perfMonitor.active          = false;
+    perfMonitor.resultAvailable = true;
+}
+
+void Context::genPerfMonitors(GLsizei n, GLuint *monitors)
+{
+    for (GLsizei i = 0; i < n; i++)
+    {
+        GLuint handle = mPerfMonitorHandleAllocator.allocate();
+        mPerfMonitors.emplace(handle, PerfMonitor());
+        monitors[i] = handle;
+    }
+}
+
+void Context::getPerfMonitorCounterData(GLuint monitor,
+                                        GLenum pname,
+                                        GLsizei dataSize,
+                                        GLuint *data,
+                                        GLint *bytesWritten)
+{
+    const PerfMonitor &perfMonitor = mPerfMonitors[monitor];
+    size_t writeSize               = 0;
+
+    switch (pname)
+    {
+        case GL_PERFMON_RESULT_AVAILABLE_AMD:
+            if (static_cast<size_t>(dataSize) >= sizeof(GLuint))
+            {
+                *data     = perfMonitor.resultAvailable ? GL_TRUE : GL_FALSE;
+                writeSize = sizeof(GLuint);
+            }
+            break;
+        case GL_PERFMON_RESULT_SIZE_AMD:
+            if (static_cast<size_t>(dataSize) >= sizeof(GLuint))
+            {
+                const size_t resultSize =
+                    perfMonitor.selectedCounters.size() * sizeof(angle::PerfMonitorTriplet);
+                *data     = static_cast<GLuint>(resultSize);
+                writeSize = sizeof(GLuint);
+            }
+            break;
+        case GL_PERFMON_RESULT_AMD:
+        {
+            const size_t tripletCount = std::min(
+                perfMonitor.result.size(),
+                static_cast<size_t>(dataSize) / sizeof(angle::PerfMonitorTriplet));
+            writeSize = tripletCount * sizeof(angle::PerfMonitorTriplet);
+            if (writeSize > 0)
+            {
+                memcpy(data, perfMonitor.result.data(), writeSize);
+            }
+            break;
+        }
+        default:
+            UNREACHABLE();
+    }
+
+    if (bytesWritten != nullptr)
+    {
+        *bytesWritten = static_cast<GLint>(writeSize);
+    }
+}
+
+void Context::getPerfMonitorCounterInfo(GLuint group, GLuint counter, GLenum pname, void *data)
+{
+    switch (pname)
+    {
+        case GL_COUNTER_TYPE_AMD:
+            *static_cast<GLenum *>(data) = GL_UNSIGNED_INT64_AMD;
+            break;
+        case GL_COUNTER_RANGE_AMD:
+        {
+            GLuint64 *range = static_cast<GLuint64 *>(data);
+            range[0]        = 0;
+            range[1]        = std::numeric_limits<GLuint64>::max();
+            break;
+        }
+        default:
+            UNREACHABLE();
+    }
+}
+
+void Context::getPerfMonitorCounterString(GLuint group,
+                                          GLuint counter,
+                                          GLsizei bufSize,
+                                          GLsizei *length,
+                                          GLchar *counterString)
+{
+    const angle::PerfMonitorCounterGroups &groups = getPerfMonitorCounterGroups();
+    GetObjectLabelBase(groups[group].counters[counter].name, bufSize, length, counterString);
+}
+
+void Context::getPerfMonitorCounters(GLuint group,
+                                     GLint *numCounters,
+                                     GLint *maxActiveCounters,
+                                     GLsizei counterSize,
+                                     GLuint *counters)
+{
+    const angle::PerfMonitorCounters &groupCounters =
+        getPerfMonitorCounterGroups()[group].counters;
+    const GLint counterCount = static_cast<GLint>(groupCounters.size());
+
+    if (numCounters != nullptr)
+    {
+        *numCounters = counterCount;
+    }
+
+    // All of the counters can be sampled at once.
+    if (maxActiveCounters != nullptr)
+    {
+        *maxActiveCounters = counterCount;
+    }
+
+    if (counters != nullptr)
+    {
+        for (GLint counterIndex = 0; counterIndex < std::min(counterSize, counterCount);
+             ++counterIndex)
+        {
+            counters[counterIndex] = static_cast<GLuint>(counterIndex);
+        }
+    }
+}
+
+void Context::getPerfMonitorGroupString(GLuint group,
+                                        GLsizei bufSize,
+                                        GLsizei *length,
+                                        GLchar *groupString)
+{
+    const angle::PerfMonitorCounterGroups &groups = getPerfMonitorCounterGroups();
+    GetObjectLabelBase(groups[group].name, bufSize, length, groupString);
+}
+
+void Context::getPerfMonitorGroups(GLint *numGroups, GLsizei groupsSize, GLuint *groups)
+{
+    const GLint groupCount = static_cast<GLint>(getPerfMonitorCounterGroups().size());
+
+    if (numGroups != nullptr)
+    {
+        *numGroups = groupCount;
+    }
+
+    if (groups != nullptr)
+    {
+        for (GLint groupIndex = 0; groupIndex < std::min(groupsSize, groupCount); ++groupIndex)
+        {
+            groups[groupIndex] = static_cast<GLuint>(groupIndex);
+        }
+    }
+}
+
+void Context::selectPerfMonitorCounters(GLuint monitor,
+                                        GLboolean enable,
+                                        GLuint group,
+                                        GLint numCounters,
+                                        GLuint *counterList)
+{
+    PerfMonitor &perfMonitor = mPerfMonitors[monitor];
+
+    for (GLint counterIndex = 0; counterIndex < numCounters; ++counterIndex)
+    {
+        const std::pair<GLuint, GLuint> counter(group, counterList[counterIndex]);
+        if (enable)
+        {
+            perfMonitor.selectedCounters.insert(counter);
+        }
+        else
+        {
+            perfMonitor.selectedCounters.erase(counter);
+        }
+    }
+
+    // Changing the selection discards the last result of the monitor.
+    perfMonitor.result.clear();
+    perfMonitor.resultAvailable = false;
+}
+
 void Context::texStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
 {
     UNIMPLEMENTED();
@@ -9070,6 +9309,8 @@ egl::Error Context::unsetDefaultFramebuffer()
 
 void Context::onPreSwap() const
 {
+    mImplementation->onPreSwap(this);
+
     // Dump frame capture if enabled.
     getShareGroup()->getFrameCaptureShared()->onEndFrame(this);
 }
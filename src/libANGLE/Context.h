@@ -563,6 +563,11 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool isProgramPipelineGenerated(ProgramPipelineID pipeline) const;
     bool isQueryGenerated(QueryID query) const;
 
+    // GL_AMD_performance_monitor
+    const angle::PerfMonitorCounterGroups &getPerfMonitorCounterGroups() const;
+    bool isPerfMonitorGenerated(GLuint monitor) const;
+    bool isPerfMonitorActive(GLuint monitor) const;
+
     bool usingDisplayTextureShareGroup() const;
     bool usingDisplaySemaphoreShareGroup() const;
 
@@ -729,6 +734,25 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     TransformFeedbackMap mTransformFeedbackMap;
     HandleAllocator mTransformFeedbackHandleAllocator;
 
+    // GL_AMD_performance_monitor monitors.  The back end's counters are sampled on the CPU, so the
+    // result of a monitor is available as soon as it ends.
+    struct PerfMonitor
+    {
+        PerfMonitor();
+        PerfMonitor(const PerfMonitor &other);
+        ~PerfMonitor();
+
+        // The selected (group, counter) pairs, in the order their results are returned in.
+        std::set<std::pair<GLuint, GLuint>> selectedCounters;
+        // The values of the selected counters when the monitor began.
+        std::vector<uint64_t> beginValues;
+        std::vector<angle::PerfMonitorTriplet> result;
+        bool active;
+        bool resultAvailable;
+    };
+    angle::HashMap<GLuint, PerfMonitor> mPerfMonitors;
+    HandleAllocator mPerfMonitorHandleAllocator;
+
     const char *mVersionString;
     const char *mShadingLanguageString;
     const char *mRendererString;
@@ -309,6 +309,9 @@ MSG kInvalidName = "Invalid name.";
 MSG kInvalidNameCharacters = "Name contains invalid characters.";
 MSG kInvalidOriginEnum = "Invalid origin enum.";
 MSG kInvalidPackParametersForWebGL = "Invalid combination of pack parameters for WebGL.";
+MSG kInvalidPerfMonitor = "Invalid performance monitor.";
+MSG kInvalidPerfMonitorCounter = "Invalid performance monitor counter.";
+MSG kInvalidPerfMonitorGroup = "Invalid performance monitor counter group.";
 MSG kInvalidPname = "Invalid pname.";
 MSG kInvalidPointerQuery = "Invalid pointer query.";
 MSG kInvalidPointParameter = "Invalid point parameter.";
@@ -463,6 +466,8 @@ MSG kOffsetOverflow = "Offset overflows texture dimensions.";
 MSG kOtherQueryActive = "Other query is active.";
 MSG kOutsideOfBounds = "Parameter outside of bounds.";
 MSG kParamOverflow = "The provided parameters overflow with the provided buffer.";
+MSG kPerfMonitorActive = "Performance monitor is active.";
+MSG kPerfMonitorNotActive = "Performance monitor is not active.";
 MSG kPixelDataNotNull = "Pixel data must be null.";
 MSG kPixelDataNull = "Pixel data cannot be null.";
 MSG kPixelPackBufferBoundForTransformFeedback = "It is undefined behavior to use a pixel pack buffer that is bound for transform feedback.";
@@ -13,6 +13,7 @@
 #include <sstream>
 #include <vector>
 
+#include "common/hash_utils.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Context.inl.h"
 #include "libANGLE/Program.h"
@@ -24,11 +25,87 @@
 namespace
 {
 #include "libANGLE/GLES1Shaders.inc"
+
+void AddConstantBool(std::stringstream *outStream, const char *name, bool value)
+{
+    *outStream << "const bool " << name << " = " << (value ? "true" : "false") << ";\n";
+}
+
+template <typename BitSetT>
+void AddConstantBoolArray(std::stringstream *outStream,
+                          const char *name,
+                          const BitSetT &values,
+                          size_t count)
+{
+    *outStream << "const bool " << name << "[" << count << "] = bool[" << count << "](";
+    for (size_t index = 0; index < count; ++index)
+    {
+        *outStream << (index > 0 ? ", " : "") << (values.test(index) ? "true" : "false");
+    }
+    *outStream << ");\n";
+}
+
+void AddConstantInt(std::stringstream *outStream, const char *name, GLenum value)
+{
+    *outStream << "const int " << name << " = " << value << ";\n";
+}
+
+template <typename T, size_t N>
+void AddConstantIntArray(std::stringstream *outStream,
+                         const char *name,
+                         const std::array<T, N> &values)
+{
+    *outStream << "const int " << name << "[" << N << "] = int[" << N << "](";
+    for (size_t index = 0; index < N; ++index)
+    {
+        *outStream << (index > 0 ? ", " : "") << ToGLenum(values[index]);
+    }
+    *outStream << ");\n";
+}
 }  // anonymous namespace
 
 namespace gl
 {
 
+GLES1Renderer::GLES1ShaderState::GLES1ShaderState()
+    : alphaTestFunc(AlphaTestFunc::AlwaysPass), fogMode(FogMode::Exp)
+{
+    texEnvModes.fill(TextureEnvMode::Modulate);
+}
+
+bool GLES1Renderer::GLES1ShaderState::operator==(const GLES1ShaderState &other) const
+{
+    return enables == other.enables && tex2DEnables == other.tex2DEnables &&
+           texCubeEnables == other.texCubeEnables &&
+           pointSpriteCoordReplaces == other.pointSpriteCoordReplaces &&
+           lightEnables == other.lightEnables && clipPlaneEnables == other.clipPlaneEnables &&
+           texEnvModes == other.texEnvModes && alphaTestFunc == other.alphaTestFunc &&
+           fogMode == other.fogMode;
+}
+
+size_t GLES1Renderer::GLES1ShaderStateHash::operator()(const GLES1ShaderState &state) const
+{
+    static_assert(static_cast<size_t>(GLES1StateEnables::EnumCount) + 3 * kTexUnitCount +
+                          kClipPlaneCount <=
+                      32,
+                  "GLES1 shader state doesn't fit in the packed key");
+
+    std::array<uint32_t, 3> key = {};
+    key[0] = static_cast<uint32_t>(state.enables.bits());
+    key[0] |= static_cast<uint32_t>(state.tex2DEnables.bits()) << 10;
+    key[0] |= static_cast<uint32_t>(state.texCubeEnables.bits()) << 14;
+    key[0] |= static_cast<uint32_t>(state.pointSpriteCoordReplaces.bits()) << 18;
+    key[0] |= static_cast<uint32_t>(state.clipPlaneEnables.bits()) << 22;
+    key[1] = static_cast<uint32_t>(state.lightEnables.bits());
+    key[1] |= static_cast<uint32_t>(state.alphaTestFunc) << 8;
+    key[1] |= static_cast<uint32_t>(state.fogMode) << 16;
+    for (int i = 0; i < kTexUnitCount; i++)
+    {
+        key[2] |= static_cast<uint32_t>(state.texEnvModes[i]) << (i * 8);
+    }
+    return angle::ComputeGenericHash(key);
+}
+
 GLES1Renderer::GLES1Renderer() : mRendererProgramInitialized(false) {}
 
 void GLES1Renderer::onDestroy(Context *context, State *state)
@@ -37,7 +114,13 @@ void GLES1Renderer::onDestroy(Context *context, State *state)
     {
         (void)state->setProgram(context, 0);
 
-        mShaderPrograms->deleteProgram(context, {mProgramState.program});
+        for (const auto &programState : mProgramStates)
+        {
+            mShaderPrograms->deleteProgram(context, {programState.second.program});
+        }
+        mProgramStates.clear();
+        mCurrentProgramState = nullptr;
+
         mShaderPrograms->release(context);
         mShaderPrograms             = nullptr;
         mRendererProgramInitialized = false;
@@ -46,76 +129,158 @@ void GLES1Renderer::onDestroy(Context *context, State *state)
 
 GLES1Renderer::~GLES1Renderer() = default;
 
+void GLES1Renderer::updateShaderState(const State *glState)
+{
+    const GLES1State &gles1State = glState->gles1();
+
+    // The draw texture enable isn't tracked by a dirty bit.
+    mShaderState.enables.set(GLES1StateEnables::DrawTexture, mDrawTextureEnabled);
+
+    if (mCurrentProgramState != nullptr &&
+        !gles1State.isDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE) &&
+        !gles1State.isDirty(GLES1State::DIRTY_GLES1_TEXTURE_UNIT_ENABLE) &&
+        !gles1State.isDirty(GLES1State::DIRTY_GLES1_TEXTURE_ENVIRONMENT) &&
+        !gles1State.isDirty(GLES1State::DIRTY_GLES1_ALPHA_TEST) &&
+        !gles1State.isDirty(GLES1State::DIRTY_GLES1_FOG) &&
+        !gles1State.isDirty(GLES1State::DIRTY_GLES1_SHADE_MODEL))
+    {
+        return;
+    }
+
+    // State that has no effect on rendering is canonicalized so that it doesn't produce
+    // redundant shader variants.
+    angle::PackedEnumBitSet<GLES1StateEnables> &enables = mShaderState.enables;
+    enables.set(GLES1StateEnables::Lighting, glState->getEnableFeature(GL_LIGHTING));
+    enables.set(GLES1StateEnables::Fog, glState->getEnableFeature(GL_FOG));
+    enables.set(GLES1StateEnables::PointSprite, glState->getEnableFeature(GL_POINT_SPRITE_OES));
+    enables.set(GLES1StateEnables::RescaleNormal, glState->getEnableFeature(GL_RESCALE_NORMAL));
+    enables.set(GLES1StateEnables::Normalize, glState->getEnableFeature(GL_NORMALIZE));
+    enables.set(GLES1StateEnables::AlphaTest, glState->getEnableFeature(GL_ALPHA_TEST));
+    enables.set(GLES1StateEnables::ShadeModelFlat, gles1State.mShadeModel == ShadingModel::Flat);
+    enables.set(GLES1StateEnables::ColorMaterial, glState->getEnableFeature(GL_COLOR_MATERIAL));
+
+    for (int i = 0; i < kTexUnitCount; i++)
+    {
+        // GL_OES_cube_map allows only one of TEXTURE_2D / TEXTURE_CUBE_MAP
+        // to be enabled per unit, thankfully. From the extension text:
+        //
+        //  --  Section 3.8.10 "Texture Application"
+        //
+        //      Replace the beginning sentences of the first paragraph (page 138)
+        //      with:
+        //
+        //      "Texturing is enabled or disabled using the generic Enable
+        //      and Disable commands, respectively, with the symbolic constants
+        //      TEXTURE_2D or TEXTURE_CUBE_MAP_OES to enable the two-dimensional or cube
+        //      map texturing respectively.  If the cube map texture and the two-
+        //      dimensional texture are enabled, then cube map texturing is used.  If
+        //      texturing is disabled, a rasterized fragment is passed on unaltered to the
+        //      next stage of the GL (although its texture coordinates may be discarded).
+        //      Otherwise, a texture value is found according to the parameter values of
+        //      the currently bound texture image of the appropriate dimensionality.
+
+        const bool cubeEnabled = gles1State.isTextureTargetEnabled(i, TextureType::CubeMap);
+        const bool tex2DEnabled =
+            !cubeEnabled && gles1State.isTextureTargetEnabled(i, TextureType::_2D);
+        const bool unitEnabled = cubeEnabled || tex2DEnabled;
+
+        mShaderState.texCubeEnables.set(i, cubeEnabled);
+        mShaderState.tex2DEnables.set(i, tex2DEnabled);
+
+        const TextureEnvironmentParameters &env = gles1State.textureEnvironment(i);
+        mShaderState.texEnvModes[i] = unitEnabled ? env.mode : TextureEnvMode::Modulate;
+        mShaderState.pointSpriteCoordReplaces.set(
+            i, unitEnabled && enables.test(GLES1StateEnables::PointSprite) &&
+                   env.pointSpriteCoordReplace);
+    }
+
+    mShaderState.alphaTestFunc = enables.test(GLES1StateEnables::AlphaTest)
+                                     ? gles1State.mAlphaTestFunc
+                                     : AlphaTestFunc::AlwaysPass;
+    mShaderState.fogMode =
+        enables.test(GLES1StateEnables::Fog) ? gles1State.fogParameters().mode : FogMode::Exp;
+
+    for (int i = 0; i < kLightCount; i++)
+    {
+        mShaderState.lightEnables.set(
+            i, enables.test(GLES1StateEnables::Lighting) && gles1State.mLights[i].enabled);
+    }
+
+    for (int i = 0; i < kClipPlaneCount; i++)
+    {
+        mShaderState.clipPlaneEnables.set(i, glState->getEnableFeature(GL_CLIP_PLANE0 + i));
+    }
+    enables.set(GLES1StateEnables::ClipPlanes, mShaderState.clipPlaneEnables.any());
+}
+
+void GLES1Renderer::addShaderConstants(std::stringstream *outStream) const
+{
+    const angle::PackedEnumBitSet<GLES1StateEnables> &enables = mShaderState.enables;
+
+    *outStream << "\n";
+    AddConstantBool(outStream, "enable_lighting", enables.test(GLES1StateEnables::Lighting));
+    AddConstantBool(outStream, "enable_fog", enables.test(GLES1StateEnables::Fog));
+    AddConstantBool(outStream, "enable_clip_planes", enables.test(GLES1StateEnables::ClipPlanes));
+    AddConstantBool(outStream, "enable_draw_texture",
+                    enables.test(GLES1StateEnables::DrawTexture));
+    AddConstantBool(outStream, "point_sprite_enabled",
+                    enables.test(GLES1StateEnables::PointSprite));
+    AddConstantBool(outStream, "enable_rescale_normal",
+                    enables.test(GLES1StateEnables::RescaleNormal));
+    AddConstantBool(outStream, "enable_normalize", enables.test(GLES1StateEnables::Normalize));
+    AddConstantBool(outStream, "enable_alpha_test", enables.test(GLES1StateEnables::AlphaTest));
+    AddConstantBool(outStream, "shade_model_flat",
+                    enables.test(GLES1StateEnables::ShadeModelFlat));
+    AddConstantBool(outStream, "enable_color_material",
+                    enables.test(GLES1StateEnables::ColorMaterial));
+
+    AddConstantBoolArray(outStream, "enable_texture_2d", mShaderState.tex2DEnables,
+                         kTexUnitCount);
+    AddConstantBoolArray(outStream, "enable_texture_cube_map", mShaderState.texCubeEnables,
+                         kTexUnitCount);
+    AddConstantBoolArray(outStream, "point_sprite_coord_replace",
+                         mShaderState.pointSpriteCoordReplaces, kTexUnitCount);
+    AddConstantBoolArray(outStream, "light_enables", mShaderState.lightEnables, kLightCount);
+    AddConstantBoolArray(outStream, "clip_plane_enables", mShaderState.clipPlaneEnables,
+                         kClipPlaneCount);
+
+    AddConstantIntArray(outStream, "texture_env_mode", mShaderState.texEnvModes);
+    AddConstantInt(outStream, "alpha_func", ToGLenum(mShaderState.alphaTestFunc));
+    AddConstantInt(outStream, "fog_mode", ToGLenum(mShaderState.fogMode));
+}
+
 angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context, State *glState)
 {
+    updateShaderState(glState);
     ANGLE_TRY(initializeRendererProgram(context, glState));
 
     GLES1State &gles1State = glState->gles1();
 
-    Program *programObject = getProgram(mProgramState.program);
+    GLES1ProgramState &programState = *mCurrentProgramState;
+    Program *programObject          = getProgram(programState.program);
 
     GLES1UniformBuffers &uniformBuffers = mUniformBuffers;
 
-    // If anything is dirty in gles1 or the common parts of gles1/2, just redo these parts
-    // completely for now.
-
-    // Feature enables
-    {
-        setUniform1i(context, programObject, mProgramState.enableAlphaTestLoc,
-                     glState->getEnableFeature(GL_ALPHA_TEST));
-        setUniform1i(context, programObject, mProgramState.enableLightingLoc,
-                     glState->getEnableFeature(GL_LIGHTING));
-        setUniform1i(context, programObject, mProgramState.enableRescaleNormalLoc,
-                     glState->getEnableFeature(GL_RESCALE_NORMAL));
-        setUniform1i(context, programObject, mProgramState.enableNormalizeLoc,
-                     glState->getEnableFeature(GL_NORMALIZE));
-        setUniform1i(context, programObject, mProgramState.enableColorMaterialLoc,
-                     glState->getEnableFeature(GL_COLOR_MATERIAL));
-        setUniform1i(context, programObject, mProgramState.fogEnableLoc,
-                     glState->getEnableFeature(GL_FOG));
-
-        bool enableClipPlanes = false;
-        for (int i = 0; i < kClipPlaneCount; i++)
-        {
-            uniformBuffers.clipPlaneEnables[i] = glState->getEnableFeature(GL_CLIP_PLANE0 + i);
-            enableClipPlanes = enableClipPlanes || uniformBuffers.clipPlaneEnables[i];
-        }
+    // Only the groups of state that changed since the last draw are uploaded.  Uniforms that
+    // depend on texture bindings aren't covered by the GLES1 dirty bits, so they are compared
+    // against the values last uploaded to the program instead.
 
-        setUniform1i(context, programObject, mProgramState.enableClipPlanesLoc, enableClipPlanes);
-    }
-
-    // Texture unit enables and format info
+    // Texture format info
     {
-        std::array<GLint, kTexUnitCount> &tex2DEnables   = uniformBuffers.tex2DEnables;
-        std::array<GLint, kTexUnitCount> &texCubeEnables = uniformBuffers.texCubeEnables;
+        const bool drawTextureEnabled = mShaderState.enables.test(GLES1StateEnables::DrawTexture);
 
-        std::vector<int> tex2DFormats = {GL_RGBA, GL_RGBA, GL_RGBA, GL_RGBA};
+        std::array<GLint, kTexUnitCount> tex2DFormats;
+        tex2DFormats.fill(GL_RGBA);
 
         Vec4Uniform *cropRectBuffer = uniformBuffers.texCropRects.data();
 
         for (int i = 0; i < kTexUnitCount; i++)
         {
-            // GL_OES_cube_map allows only one of TEXTURE_2D / TEXTURE_CUBE_MAP
-            // to be enabled per unit, thankfully. From the extension text:
-            //
-            //  --  Section 3.8.10 "Texture Application"
-            //
-            //      Replace the beginning sentences of the first paragraph (page 138)
-            //      with:
-            //
-            //      "Texturing is enabled or disabled using the generic Enable
-            //      and Disable commands, respectively, with the symbolic constants
-            //      TEXTURE_2D or TEXTURE_CUBE_MAP_OES to enable the two-dimensional or cube
-            //      map texturing respectively.  If the cube map texture and the two-
-            //      dimensional texture are enabled, then cube map texturing is used.  If
-            //      texturing is disabled, a rasterized fragment is passed on unaltered to the
-            //      next stage of the GL (although its texture coordinates may be discarded).
-            //      Otherwise, a texture value is found according to the parameter values of
-            //      the currently bound texture image of the appropriate dimensionality.
-
-            texCubeEnables[i] = gles1State.isTextureTargetEnabled(i, TextureType::CubeMap);
-            tex2DEnables[i] =
-                !texCubeEnables[i] && (gles1State.isTextureTargetEnabled(i, TextureType::_2D));
+            // The format and crop rectangle aren't read for disabled units.
+            if (!mShaderState.tex2DEnables[i] && !mShaderState.texCubeEnables[i])
+            {
+                continue;
+            }
 
             Texture *curr2DTexture = glState->getSamplerTexture(i, TextureType::_2D);
             if (curr2DTexture)
@@ -123,6 +288,11 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
                 tex2DFormats[i] = gl::GetUnsizedFormat(
                     curr2DTexture->getFormat(TextureTarget::_2D, 0).info->internalFormat);
 
+                if (!drawTextureEnabled)
+                {
+                    continue;
+                }
+
                 const gl::Rectangle &cropRect = curr2DTexture->getCrop();
 
                 GLfloat textureWidth =
@@ -140,21 +310,29 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
             }
         }
 
-        setUniform1iv(context, programObject, mProgramState.enableTexture2DLoc, kTexUnitCount,
-                      tex2DEnables.data());
-        setUniform1iv(context, programObject, mProgramState.enableTextureCubeMapLoc, kTexUnitCount,
-                      texCubeEnables.data());
-
-        setUniform1iv(context, programObject, mProgramState.textureFormatLoc, kTexUnitCount,
-                      tex2DFormats.data());
+        if (tex2DFormats != programState.textureFormats)
+        {
+            programState.textureFormats = tex2DFormats;
+            setUniform1iv(context, programObject, programState.textureFormatLoc, kTexUnitCount,
+                          tex2DFormats.data());
+        }
 
-        setUniform4fv(programObject, mProgramState.drawTextureNormalizedCropRectLoc, kTexUnitCount,
-                      reinterpret_cast<GLfloat *>(cropRectBuffer));
+        if (drawTextureEnabled &&
+            memcmp(cropRectBuffer, programState.drawTextureNormalizedCropRects.data(),
+                   sizeof(programState.drawTextureNormalizedCropRects)) != 0)
+        {
+            memcpy(programState.drawTextureNormalizedCropRects.data(), cropRectBuffer,
+                   sizeof(programState.drawTextureNormalizedCropRects));
+            setUniform4fv(programObject, programState.drawTextureNormalizedCropRectLoc,
+                          kTexUnitCount, reinterpret_cast<GLfloat *>(cropRectBuffer));
+        }
     }
 
-    // Client state / current vector enables
+    // Client state / current vector enables.  The current point size is part of the point
+    // parameters.
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_CLIENT_STATE_ENABLE) ||
-        gles1State.isDirty(GLES1State::DIRTY_GLES1_CURRENT_VECTOR))
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_CURRENT_VECTOR) ||
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_POINT_PARAMETERS))
     {
         if (!gles1State.isClientStateEnabled(ClientVertexArrayType::Normal))
         {
@@ -187,28 +365,34 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     }
 
     // Matrices
-    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_MATRICES))
+    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_PROJECTION_MATRIX))
     {
-        angle::Mat4 proj = gles1State.mProjectionMatrices.back();
-        setUniformMatrix4fv(programObject, mProgramState.projMatrixLoc, 1, GL_FALSE, proj.data());
+        const angle::Mat4 &proj = gles1State.mProjectionMatrices.back();
+        setUniformMatrix4fv(programObject, programState.projMatrixLoc, 1, GL_FALSE, proj.constData());
+    }
 
-        angle::Mat4 modelview = gles1State.mModelviewMatrices.back();
-        setUniformMatrix4fv(programObject, mProgramState.modelviewMatrixLoc, 1, GL_FALSE,
-                            modelview.data());
+    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_MODELVIEW_MATRIX))
+    {
+        const angle::Mat4 &modelview = gles1State.mModelviewMatrices.back();
+        setUniformMatrix4fv(programObject, programState.modelviewMatrixLoc, 1, GL_FALSE,
+                            modelview.constData());
 
-        angle::Mat4 modelviewInvTr = modelview.transpose().inverse();
-        setUniformMatrix4fv(programObject, mProgramState.modelviewInvTrLoc, 1, GL_FALSE,
-                            modelviewInvTr.data());
+        const angle::Mat4 &modelviewInvTr = gles1State.getModelviewInvTrMatrix();
+        setUniformMatrix4fv(programObject, programState.modelviewInvTrLoc, 1, GL_FALSE,
+                            modelviewInvTr.constData());
+    }
 
+    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_TEXTURE_MATRIX))
+    {
         Mat4Uniform *textureMatrixBuffer = uniformBuffers.textureMatrices.data();
 
         for (int i = 0; i < kTexUnitCount; i++)
         {
-            angle::Mat4 textureMatrix = gles1State.mTextureMatrices[i].back();
-            memcpy(textureMatrixBuffer + i, textureMatrix.data(), sizeof(Mat4Uniform));
+            const angle::Mat4 &textureMatrix = gles1State.mTextureMatrices[i].back();
+            memcpy(textureMatrixBuffer + i, textureMatrix.constData(), sizeof(Mat4Uniform));
         }
 
-        setUniformMatrix4fv(programObject, mProgramState.textureMatrixLoc, kTexUnitCount, GL_FALSE,
+        setUniformMatrix4fv(programObject, programState.textureMatrixLoc, kTexUnitCount, GL_FALSE,
                             reinterpret_cast<float *>(uniformBuffers.textureMatrices.data()));
     }
 
@@ -218,7 +402,6 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
         {
             const auto &env = gles1State.textureEnvironment(i);
 
-            uniformBuffers.texEnvModes[i]      = ToGLenum(env.mode);
             uniformBuffers.texCombineRgbs[i]   = ToGLenum(env.combineRgb);
             uniformBuffers.texCombineAlphas[i] = ToGLenum(env.combineAlpha);
 
@@ -243,80 +426,65 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
 
             uniformBuffers.texEnvRgbScales[i]   = env.rgbScale;
             uniformBuffers.texEnvAlphaScales[i] = env.alphaScale;
-
-            uniformBuffers.pointSpriteCoordReplaces[i] = env.pointSpriteCoordReplace;
         }
 
-        setUniform1iv(context, programObject, mProgramState.textureEnvModeLoc, kTexUnitCount,
-                      uniformBuffers.texEnvModes.data());
-        setUniform1iv(context, programObject, mProgramState.combineRgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.combineRgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineRgbs.data());
-        setUniform1iv(context, programObject, mProgramState.combineAlphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.combineAlphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineAlphas.data());
 
-        setUniform1iv(context, programObject, mProgramState.src0rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src0rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc0Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.src0alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src0alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc0Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.src1rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src1rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc1Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.src1alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src1alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc1Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.src2rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src2rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc2Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.src2alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.src2alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc2Alphas.data());
 
-        setUniform1iv(context, programObject, mProgramState.op0rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op0rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp0Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.op0alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op0alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp0Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.op1rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op1rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp1Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.op1alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op1alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp1Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.op2rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op2rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp2Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.op2alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, programState.op2alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp2Alphas.data());
 
-        setUniform4fv(programObject, mProgramState.textureEnvColorLoc, kTexUnitCount,
+        setUniform4fv(programObject, programState.textureEnvColorLoc, kTexUnitCount,
                       reinterpret_cast<float *>(uniformBuffers.texEnvColors.data()));
-        setUniform1fv(programObject, mProgramState.rgbScaleLoc, kTexUnitCount,
+        setUniform1fv(programObject, programState.rgbScaleLoc, kTexUnitCount,
                       uniformBuffers.texEnvRgbScales.data());
-        setUniform1fv(programObject, mProgramState.alphaScaleLoc, kTexUnitCount,
+        setUniform1fv(programObject, programState.alphaScaleLoc, kTexUnitCount,
                       uniformBuffers.texEnvAlphaScales.data());
-
-        setUniform1iv(context, programObject, mProgramState.pointSpriteCoordReplaceLoc,
-                      kTexUnitCount, uniformBuffers.pointSpriteCoordReplaces.data());
     }
 
     // Alpha test
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_ALPHA_TEST))
     {
-        setUniform1i(context, programObject, mProgramState.alphaFuncLoc,
-                     ToGLenum(gles1State.mAlphaTestFunc));
-        setUniform1f(programObject, mProgramState.alphaTestRefLoc, gles1State.mAlphaTestRef);
-    }
-
-    // Shading, materials, and lighting
-    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_SHADE_MODEL))
-    {
-        setUniform1i(context, programObject, mProgramState.shadeModelFlatLoc,
-                     gles1State.mShadeModel == ShadingModel::Flat);
+        setUniform1f(programObject, programState.alphaTestRefLoc, gles1State.mAlphaTestRef);
     }
 
+    // Materials and lighting
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_MATERIAL))
     {
         const auto &material = gles1State.mMaterial;
 
-        setUniform4fv(programObject, mProgramState.materialAmbientLoc, 1, material.ambient.data());
-        setUniform4fv(programObject, mProgramState.materialDiffuseLoc, 1, material.diffuse.data());
-        setUniform4fv(programObject, mProgramState.materialSpecularLoc, 1,
+        setUniform4fv(programObject, programState.materialAmbientLoc, 1, material.ambient.data());
+        setUniform4fv(programObject, programState.materialDiffuseLoc, 1, material.diffuse.data());
+        setUniform4fv(programObject, programState.materialSpecularLoc, 1,
                       material.specular.data());
-        setUniform4fv(programObject, mProgramState.materialEmissiveLoc, 1,
+        setUniform4fv(programObject, programState.materialEmissiveLoc, 1,
                       material.emissive.data());
-        setUniform1f(programObject, mProgramState.materialSpecularExponentLoc,
+        setUniform1f(programObject, programState.materialSpecularExponentLoc,
                      material.specularExponent);
     }
 
@@ -324,16 +492,15 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     {
         const auto &lightModel = gles1State.mLightModel;
 
-        setUniform4fv(programObject, mProgramState.lightModelSceneAmbientLoc, 1,
+        setUniform4fv(programObject, programState.lightModelSceneAmbientLoc, 1,
                       lightModel.color.data());
 
         // TODO (lfy@google.com): Implement two-sided lighting model
-        // gl->uniform1i(mProgramState.lightModelTwoSidedLoc, lightModel.twoSided);
+        // gl->uniform1i(programState.lightModelTwoSidedLoc, lightModel.twoSided);
 
         for (int i = 0; i < kLightCount; i++)
         {
-            const auto &light              = gles1State.mLights[i];
-            uniformBuffers.lightEnables[i] = light.enabled;
+            const auto &light = gles1State.mLights[i];
             memcpy(uniformBuffers.lightAmbients.data() + i, light.ambient.data(),
                    sizeof(Vec4Uniform));
             memcpy(uniformBuffers.lightDiffuses.data() + i, light.diffuse.data(),
@@ -351,79 +518,74 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
             uniformBuffers.attenuationQuadratics[i] = light.attenuationQuadratic;
         }
 
-        setUniform1iv(context, programObject, mProgramState.lightEnablesLoc, kLightCount,
-                      uniformBuffers.lightEnables.data());
-        setUniform4fv(programObject, mProgramState.lightAmbientsLoc, kLightCount,
+        setUniform4fv(programObject, programState.lightAmbientsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.lightAmbients.data()));
-        setUniform4fv(programObject, mProgramState.lightDiffusesLoc, kLightCount,
+        setUniform4fv(programObject, programState.lightDiffusesLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.lightDiffuses.data()));
-        setUniform4fv(programObject, mProgramState.lightSpecularsLoc, kLightCount,
+        setUniform4fv(programObject, programState.lightSpecularsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.lightSpeculars.data()));
-        setUniform4fv(programObject, mProgramState.lightPositionsLoc, kLightCount,
+        setUniform4fv(programObject, programState.lightPositionsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.lightPositions.data()));
-        setUniform3fv(programObject, mProgramState.lightDirectionsLoc, kLightCount,
+        setUniform3fv(programObject, programState.lightDirectionsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.lightDirections.data()));
-        setUniform1fv(programObject, mProgramState.lightSpotlightExponentsLoc, kLightCount,
+        setUniform1fv(programObject, programState.lightSpotlightExponentsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.spotlightExponents.data()));
-        setUniform1fv(programObject, mProgramState.lightSpotlightCutoffAnglesLoc, kLightCount,
+        setUniform1fv(programObject, programState.lightSpotlightCutoffAnglesLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.spotlightCutoffAngles.data()));
-        setUniform1fv(programObject, mProgramState.lightAttenuationConstsLoc, kLightCount,
+        setUniform1fv(programObject, programState.lightAttenuationConstsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.attenuationConsts.data()));
-        setUniform1fv(programObject, mProgramState.lightAttenuationLinearsLoc, kLightCount,
+        setUniform1fv(programObject, programState.lightAttenuationLinearsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.attenuationLinears.data()));
-        setUniform1fv(programObject, mProgramState.lightAttenuationQuadraticsLoc, kLightCount,
+        setUniform1fv(programObject, programState.lightAttenuationQuadraticsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.attenuationQuadratics.data()));
     }
 
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_FOG))
     {
         const FogParameters &fog = gles1State.fogParameters();
-        setUniform1i(context, programObject, mProgramState.fogModeLoc, ToGLenum(fog.mode));
-        setUniform1f(programObject, mProgramState.fogDensityLoc, fog.density);
-        setUniform1f(programObject, mProgramState.fogStartLoc, fog.start);
-        setUniform1f(programObject, mProgramState.fogEndLoc, fog.end);
-        setUniform4fv(programObject, mProgramState.fogColorLoc, 1, fog.color.data());
+        setUniform1f(programObject, programState.fogDensityLoc, fog.density);
+        setUniform1f(programObject, programState.fogStartLoc, fog.start);
+        setUniform1f(programObject, programState.fogEndLoc, fog.end);
+        setUniform4fv(programObject, programState.fogColorLoc, 1, fog.color.data());
     }
 
     // Clip planes
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_CLIP_PLANES))
     {
-        bool enableClipPlanes = false;
         for (int i = 0; i < kClipPlaneCount; i++)
         {
-            uniformBuffers.clipPlaneEnables[i] = glState->getEnableFeature(GL_CLIP_PLANE0 + i);
-            enableClipPlanes = enableClipPlanes || uniformBuffers.clipPlaneEnables[i];
             gles1State.getClipPlane(
                 i, reinterpret_cast<float *>(uniformBuffers.clipPlanes.data() + i));
         }
 
-        setUniform1i(context, programObject, mProgramState.enableClipPlanesLoc, enableClipPlanes);
-        setUniform1iv(context, programObject, mProgramState.clipPlaneEnablesLoc, kClipPlaneCount,
-                      uniformBuffers.clipPlaneEnables.data());
-        setUniform4fv(programObject, mProgramState.clipPlanesLoc, kClipPlaneCount,
+        setUniform4fv(programObject, programState.clipPlanesLoc, kClipPlaneCount,
                       reinterpret_cast<float *>(uniformBuffers.clipPlanes.data()));
     }
 
     // Point rasterization
+    const bool pointRasterization = mode == PrimitiveMode::Points;
+    if (pointRasterization != programState.pointRasterization)
+    {
+        programState.pointRasterization = pointRasterization;
+        setUniform1i(context, programObject, programState.pointRasterizationLoc,
+                     pointRasterization);
+    }
+
+    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_POINT_PARAMETERS))
     {
         const PointParameters &pointParams = gles1State.mPointParameters;
 
-        setUniform1i(context, programObject, mProgramState.pointRasterizationLoc,
-                     mode == PrimitiveMode::Points);
-        setUniform1i(context, programObject, mProgramState.pointSpriteEnabledLoc,
-                     glState->getEnableFeature(GL_POINT_SPRITE_OES));
-        setUniform1f(programObject, mProgramState.pointSizeMinLoc, pointParams.pointSizeMin);
-        setUniform1f(programObject, mProgramState.pointSizeMaxLoc, pointParams.pointSizeMax);
-        setUniform3fv(programObject, mProgramState.pointDistanceAttenuationLoc, 1,
+        setUniform1f(programObject, programState.pointSizeMinLoc, pointParams.pointSizeMin);
+        setUniform1f(programObject, programState.pointSizeMaxLoc, pointParams.pointSizeMax);
+        setUniform3fv(programObject, programState.pointDistanceAttenuationLoc, 1,
                       pointParams.pointDistanceAttenuation.data());
     }
 
-    // Draw texture
+    // Draw texture.  The coordinates are only read by variants that draw textures.
+    if (mShaderState.enables.test(GLES1StateEnables::DrawTexture))
     {
-        setUniform1i(context, programObject, mProgramState.enableDrawTextureLoc,
-                     mDrawTextureEnabled ? 1 : 0);
-        setUniform4fv(programObject, mProgramState.drawTextureCoordsLoc, 1, mDrawTextureCoords);
-        setUniform2fv(programObject, mProgramState.drawTextureDimsLoc, 1, mDrawTextureDims);
+        setUniform4fv(programObject, programState.drawTextureCoordsLoc, 1, mDrawTextureCoords);
+        setUniform2fv(programObject, programState.drawTextureDimsLoc, 1, mDrawTextureDims);
     }
 
     gles1State.clearDirty();
@@ -616,28 +778,52 @@ angle::Result GLES1Renderer::linkProgram(Context *context,
 
 angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *glState)
 {
-    if (mRendererProgramInitialized)
+    GLES1State &gles1State = glState->gles1();
+
+    auto programIter = mProgramStates.find(mShaderState);
+    if (programIter != mProgramStates.end())
     {
-        // If we're already done the initialization/compilation, but there has been some
-        // state change, just reload the compiled program.
-        GLES1State &gles1State = glState->gles1();
-        if (gles1State.shouldHandleDirtyProgram())
+        GLES1ProgramState *programState = &programIter->second;
+        if (programState != mCurrentProgramState)
+        {
+            // Uniforms are per program, so everything has to be uploaded again after switching
+            // variants.
+            mCurrentProgramState = programState;
+            gles1State.setAllDirty();
+            ANGLE_TRY(glState->setProgram(context, getProgram(programState->program)));
+        }
+        else if (gles1State.shouldHandleDirtyProgram())
         {
-            Program *programObject = getProgram(mProgramState.program);
-            ANGLE_TRY(glState->setProgram(context, programObject));
+            // If the variant is already compiled, but there has been some state change, just
+            // reload the compiled program.
+            ANGLE_TRY(glState->setProgram(context, getProgram(programState->program)));
         }
         return angle::Result::Continue;
     }
 
-    mShaderPrograms = new ShaderProgramManager();
+    if (!mRendererProgramInitialized)
+    {
+        mShaderPrograms             = new ShaderProgramManager();
+        mRendererProgramInitialized = true;
+    }
+
+    std::stringstream shaderConstants;
+    addShaderConstants(&shaderConstants);
 
     ShaderProgramID vertexShader;
     ShaderProgramID fragmentShader;
 
-    ANGLE_TRY(compileShader(context, ShaderType::Vertex, kGLES1DrawVShader, &vertexShader));
+    std::stringstream vertexStream;
+    vertexStream << kGLES1DrawVShaderHeader;
+    vertexStream << shaderConstants.str();
+    vertexStream << kGLES1DrawVShader;
+
+    ANGLE_TRY(
+        compileShader(context, ShaderType::Vertex, vertexStream.str().c_str(), &vertexShader));
 
     std::stringstream fragmentStream;
     fragmentStream << kGLES1DrawFShaderHeader;
+    fragmentStream << shaderConstants.str();
     fragmentStream << kGLES1DrawFShaderUniformDefs;
     fragmentStream << kGLES1DrawFShaderFunctions;
     fragmentStream << kGLES1DrawFShaderMultitexturing;
@@ -660,18 +846,21 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
         attribLocs[kTextureCoordAttribIndexBase + i] = ss.str();
     }
 
-    ANGLE_TRY(linkProgram(context, glState, vertexShader, fragmentShader, attribLocs,
-                          &mProgramState.program));
+    ShaderProgramID program;
+    ANGLE_TRY(linkProgram(context, glState, vertexShader, fragmentShader, attribLocs, &program));
 
     mShaderPrograms->deleteShader(context, vertexShader);
     mShaderPrograms->deleteShader(context, fragmentShader);
 
-    Program *programObject = getProgram(mProgramState.program);
+    GLES1ProgramState &programState = mProgramStates[mShaderState];
+    programState.program            = program;
+
+    Program *programObject = getProgram(programState.program);
 
-    mProgramState.projMatrixLoc      = programObject->getUniformLocation("projection");
-    mProgramState.modelviewMatrixLoc = programObject->getUniformLocation("modelview");
-    mProgramState.textureMatrixLoc   = programObject->getUniformLocation("texture_matrix");
-    mProgramState.modelviewInvTrLoc  = programObject->getUniformLocation("modelview_invtr");
+    programState.projMatrixLoc      = programObject->getUniformLocation("projection");
+    programState.modelviewMatrixLoc = programObject->getUniformLocation("modelview");
+    programState.textureMatrixLoc   = programObject->getUniformLocation("texture_matrix");
+    programState.modelviewInvTrLoc  = programObject->getUniformLocation("modelview_invtr");
 
     for (int i = 0; i < kTexUnitCount; i++)
     {
@@ -681,114 +870,91 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
         ss2d << "tex_sampler" << i;
         sscube << "tex_cube_sampler" << i;
 
-        mProgramState.tex2DSamplerLocs[i] = programObject->getUniformLocation(ss2d.str().c_str());
-        mProgramState.texCubeSamplerLocs[i] =
+        programState.tex2DSamplerLocs[i] = programObject->getUniformLocation(ss2d.str().c_str());
+        programState.texCubeSamplerLocs[i] =
             programObject->getUniformLocation(sscube.str().c_str());
     }
 
-    mProgramState.enableTexture2DLoc = programObject->getUniformLocation("enable_texture_2d");
-    mProgramState.enableTextureCubeMapLoc =
-        programObject->getUniformLocation("enable_texture_cube_map");
-
-    mProgramState.textureFormatLoc   = programObject->getUniformLocation("texture_format");
-    mProgramState.textureEnvModeLoc  = programObject->getUniformLocation("texture_env_mode");
-    mProgramState.combineRgbLoc      = programObject->getUniformLocation("combine_rgb");
-    mProgramState.combineAlphaLoc    = programObject->getUniformLocation("combine_alpha");
-    mProgramState.src0rgbLoc         = programObject->getUniformLocation("src0_rgb");
-    mProgramState.src0alphaLoc       = programObject->getUniformLocation("src0_alpha");
-    mProgramState.src1rgbLoc         = programObject->getUniformLocation("src1_rgb");
-    mProgramState.src1alphaLoc       = programObject->getUniformLocation("src1_alpha");
-    mProgramState.src2rgbLoc         = programObject->getUniformLocation("src2_rgb");
-    mProgramState.src2alphaLoc       = programObject->getUniformLocation("src2_alpha");
-    mProgramState.op0rgbLoc          = programObject->getUniformLocation("op0_rgb");
-    mProgramState.op0alphaLoc        = programObject->getUniformLocation("op0_alpha");
-    mProgramState.op1rgbLoc          = programObject->getUniformLocation("op1_rgb");
-    mProgramState.op1alphaLoc        = programObject->getUniformLocation("op1_alpha");
-    mProgramState.op2rgbLoc          = programObject->getUniformLocation("op2_rgb");
-    mProgramState.op2alphaLoc        = programObject->getUniformLocation("op2_alpha");
-    mProgramState.textureEnvColorLoc = programObject->getUniformLocation("texture_env_color");
-    mProgramState.rgbScaleLoc        = programObject->getUniformLocation("texture_env_rgb_scale");
-    mProgramState.alphaScaleLoc      = programObject->getUniformLocation("texture_env_alpha_scale");
-    mProgramState.pointSpriteCoordReplaceLoc =
-        programObject->getUniformLocation("point_sprite_coord_replace");
-
-    mProgramState.enableAlphaTestLoc = programObject->getUniformLocation("enable_alpha_test");
-    mProgramState.alphaFuncLoc       = programObject->getUniformLocation("alpha_func");
-    mProgramState.alphaTestRefLoc    = programObject->getUniformLocation("alpha_test_ref");
-
-    mProgramState.shadeModelFlatLoc = programObject->getUniformLocation("shade_model_flat");
-    mProgramState.enableLightingLoc = programObject->getUniformLocation("enable_lighting");
-    mProgramState.enableRescaleNormalLoc =
-        programObject->getUniformLocation("enable_rescale_normal");
-    mProgramState.enableNormalizeLoc = programObject->getUniformLocation("enable_normalize");
-    mProgramState.enableColorMaterialLoc =
-        programObject->getUniformLocation("enable_color_material");
-
-    mProgramState.materialAmbientLoc  = programObject->getUniformLocation("material_ambient");
-    mProgramState.materialDiffuseLoc  = programObject->getUniformLocation("material_diffuse");
-    mProgramState.materialSpecularLoc = programObject->getUniformLocation("material_specular");
-    mProgramState.materialEmissiveLoc = programObject->getUniformLocation("material_emissive");
-    mProgramState.materialSpecularExponentLoc =
+    programState.textureFormatLoc   = programObject->getUniformLocation("texture_format");
+    programState.combineRgbLoc      = programObject->getUniformLocation("combine_rgb");
+    programState.combineAlphaLoc    = programObject->getUniformLocation("combine_alpha");
+    programState.src0rgbLoc         = programObject->getUniformLocation("src0_rgb");
+    programState.src0alphaLoc       = programObject->getUniformLocation("src0_alpha");
+    programState.src1rgbLoc         = programObject->getUniformLocation("src1_rgb");
+    programState.src1alphaLoc       = programObject->getUniformLocation("src1_alpha");
+    programState.src2rgbLoc         = programObject->getUniformLocation("src2_rgb");
+    programState.src2alphaLoc       = programObject->getUniformLocation("src2_alpha");
+    programState.op0rgbLoc          = programObject->getUniformLocation("op0_rgb");
+    programState.op0alphaLoc        = programObject->getUniformLocation("op0_alpha");
+    programState.op1rgbLoc          = programObject->getUniformLocation("op1_rgb");
+    programState.op1alphaLoc        = programObject->getUniformLocation("op1_alpha");
+    programState.op2rgbLoc          = programObject->getUniformLocation("op2_rgb");
+    programState.op2alphaLoc        = programObject->getUniformLocation("op2_alpha");
+    programState.textureEnvColorLoc = programObject->getUniformLocation("texture_env_color");
+    programState.rgbScaleLoc        = programObject->getUniformLocation("texture_env_rgb_scale");
+    programState.alphaScaleLoc      = programObject->getUniformLocation("texture_env_alpha_scale");
+
+    programState.alphaTestRefLoc = programObject->getUniformLocation("alpha_test_ref");
+
+    programState.materialAmbientLoc  = programObject->getUniformLocation("material_ambient");
+    programState.materialDiffuseLoc  = programObject->getUniformLocation("material_diffuse");
+    programState.materialSpecularLoc = programObject->getUniformLocation("material_specular");
+    programState.materialEmissiveLoc = programObject->getUniformLocation("material_emissive");
+    programState.materialSpecularExponentLoc =
         programObject->getUniformLocation("material_specular_exponent");
 
-    mProgramState.lightModelSceneAmbientLoc =
+    programState.lightModelSceneAmbientLoc =
         programObject->getUniformLocation("light_model_scene_ambient");
-    mProgramState.lightModelTwoSidedLoc =
+    programState.lightModelTwoSidedLoc =
         programObject->getUniformLocation("light_model_two_sided");
 
-    mProgramState.lightEnablesLoc    = programObject->getUniformLocation("light_enables");
-    mProgramState.lightAmbientsLoc   = programObject->getUniformLocation("light_ambients");
-    mProgramState.lightDiffusesLoc   = programObject->getUniformLocation("light_diffuses");
-    mProgramState.lightSpecularsLoc  = programObject->getUniformLocation("light_speculars");
-    mProgramState.lightPositionsLoc  = programObject->getUniformLocation("light_positions");
-    mProgramState.lightDirectionsLoc = programObject->getUniformLocation("light_directions");
-    mProgramState.lightSpotlightExponentsLoc =
+    programState.lightAmbientsLoc   = programObject->getUniformLocation("light_ambients");
+    programState.lightDiffusesLoc   = programObject->getUniformLocation("light_diffuses");
+    programState.lightSpecularsLoc  = programObject->getUniformLocation("light_speculars");
+    programState.lightPositionsLoc  = programObject->getUniformLocation("light_positions");
+    programState.lightDirectionsLoc = programObject->getUniformLocation("light_directions");
+    programState.lightSpotlightExponentsLoc =
         programObject->getUniformLocation("light_spotlight_exponents");
-    mProgramState.lightSpotlightCutoffAnglesLoc =
+    programState.lightSpotlightCutoffAnglesLoc =
         programObject->getUniformLocation("light_spotlight_cutoff_angles");
-    mProgramState.lightAttenuationConstsLoc =
+    programState.lightAttenuationConstsLoc =
         programObject->getUniformLocation("light_attenuation_consts");
-    mProgramState.lightAttenuationLinearsLoc =
+    programState.lightAttenuationLinearsLoc =
         programObject->getUniformLocation("light_attenuation_linears");
-    mProgramState.lightAttenuationQuadraticsLoc =
+    programState.lightAttenuationQuadraticsLoc =
         programObject->getUniformLocation("light_attenuation_quadratics");
 
-    mProgramState.fogEnableLoc  = programObject->getUniformLocation("enable_fog");
-    mProgramState.fogModeLoc    = programObject->getUniformLocation("fog_mode");
-    mProgramState.fogDensityLoc = programObject->getUniformLocation("fog_density");
-    mProgramState.fogStartLoc   = programObject->getUniformLocation("fog_start");
-    mProgramState.fogEndLoc     = programObject->getUniformLocation("fog_end");
-    mProgramState.fogColorLoc   = programObject->getUniformLocation("fog_color");
-
-    mProgramState.enableClipPlanesLoc = programObject->getUniformLocation("enable_clip_planes");
-    mProgramState.clipPlaneEnablesLoc = programObject->getUniformLocation("clip_plane_enables");
-    mProgramState.clipPlanesLoc       = programObject->getUniformLocation("clip_planes");
-
-    mProgramState.pointRasterizationLoc = programObject->getUniformLocation("point_rasterization");
-    mProgramState.pointSizeMinLoc       = programObject->getUniformLocation("point_size_min");
-    mProgramState.pointSizeMaxLoc       = programObject->getUniformLocation("point_size_max");
-    mProgramState.pointDistanceAttenuationLoc =
+    programState.fogDensityLoc = programObject->getUniformLocation("fog_density");
+    programState.fogStartLoc   = programObject->getUniformLocation("fog_start");
+    programState.fogEndLoc     = programObject->getUniformLocation("fog_end");
+    programState.fogColorLoc   = programObject->getUniformLocation("fog_color");
+
+    programState.clipPlanesLoc = programObject->getUniformLocation("clip_planes");
+
+    programState.pointRasterizationLoc = programObject->getUniformLocation("point_rasterization");
+    programState.pointSizeMinLoc       = programObject->getUniformLocation("point_size_min");
+    programState.pointSizeMaxLoc       = programObject->getUniformLocation("point_size_max");
+    programState.pointDistanceAttenuationLoc =
         programObject->getUniformLocation("point_distance_attenuation");
-    mProgramState.pointSpriteEnabledLoc = programObject->getUniformLocation("point_sprite_enabled");
 
-    mProgramState.enableDrawTextureLoc = programObject->getUniformLocation("enable_draw_texture");
-    mProgramState.drawTextureCoordsLoc = programObject->getUniformLocation("draw_texture_coords");
-    mProgramState.drawTextureDimsLoc   = programObject->getUniformLocation("draw_texture_dims");
-    mProgramState.drawTextureNormalizedCropRectLoc =
+    programState.drawTextureCoordsLoc = programObject->getUniformLocation("draw_texture_coords");
+    programState.drawTextureDimsLoc   = programObject->getUniformLocation("draw_texture_dims");
+    programState.drawTextureNormalizedCropRectLoc =
         programObject->getUniformLocation("draw_texture_normalized_crop_rect");
 
     ANGLE_TRY(glState->setProgram(context, programObject));
 
     for (int i = 0; i < kTexUnitCount; i++)
     {
-        setUniform1i(context, programObject, mProgramState.tex2DSamplerLocs[i], i);
-        setUniform1i(context, programObject, mProgramState.texCubeSamplerLocs[i],
+        setUniform1i(context, programObject, programState.tex2DSamplerLocs[i], i);
+        setUniform1i(context, programObject, programState.texCubeSamplerLocs[i],
                      i + kTexUnitCount);
     }
 
     glState->setObjectDirty(GL_PROGRAM);
 
-    mRendererProgramInitialized = true;
+    mCurrentProgramState = &programState;
+    gles1State.setAllDirty();
     return angle::Result::Continue;
 }
 
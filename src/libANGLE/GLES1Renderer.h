@@ -15,6 +15,7 @@
 #include "libANGLE/angletypes.h"
 
 #include <memory>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 
@@ -27,6 +28,24 @@ class State;
 class Shader;
 class ShaderProgramManager;
 
+// Fixed-function features the GLES1 emulation shaders are specialized on.
+enum class GLES1StateEnables : uint32_t
+{
+    Lighting       = 0,
+    Fog            = 1,
+    ClipPlanes     = 2,
+    DrawTexture    = 3,
+    PointSprite    = 4,
+    RescaleNormal  = 5,
+    Normalize      = 6,
+    AlphaTest      = 7,
+    ShadeModelFlat = 8,
+    ColorMaterial  = 9,
+
+    InvalidEnum = 10,
+    EnumCount   = 10,
+};
+
 class GLES1Renderer final : angle::NonCopyable
 {
   public:
@@ -70,6 +89,8 @@ class GLES1Renderer final : angle::NonCopyable
                               const angle::HashMap<GLint, std::string> &attribLocs,
                               ShaderProgramID *programOut);
     angle::Result initializeRendererProgram(Context *context, State *glState);
+    void updateShaderState(const State *glState);
+    void addShaderConstants(std::stringstream *outStream) const;
 
     void setUniform1i(Context *context,
                       Program *programObject,
@@ -117,6 +138,30 @@ class GLES1Renderer final : angle::NonCopyable
     bool mRendererProgramInitialized;
     ShaderProgramManager *mShaderPrograms;
 
+    // The fixed-function state that selects the shader variant.  The corresponding branches in
+    // the shaders are resolved at compile time, and the state isn't uploaded as uniforms.
+    struct GLES1ShaderState
+    {
+        GLES1ShaderState();
+
+        bool operator==(const GLES1ShaderState &other) const;
+
+        angle::PackedEnumBitSet<GLES1StateEnables> enables;
+        angle::BitSet<kTexUnitCount> tex2DEnables;
+        angle::BitSet<kTexUnitCount> texCubeEnables;
+        angle::BitSet<kTexUnitCount> pointSpriteCoordReplaces;
+        angle::BitSet<kLightCount> lightEnables;
+        angle::BitSet<kClipPlaneCount> clipPlaneEnables;
+        std::array<TextureEnvMode, kTexUnitCount> texEnvModes;
+        AlphaTestFunc alphaTestFunc;
+        FogMode fogMode;
+    };
+
+    struct GLES1ShaderStateHash
+    {
+        size_t operator()(const GLES1ShaderState &state) const;
+    };
+
     struct GLES1ProgramState
     {
         ShaderProgramID program;
@@ -127,14 +172,11 @@ class GLES1Renderer final : angle::NonCopyable
         UniformLocation modelviewInvTrLoc;
 
         // Texturing
-        UniformLocation enableTexture2DLoc;
-        UniformLocation enableTextureCubeMapLoc;
         std::array<UniformLocation, kTexUnitCount> tex2DSamplerLocs;
         std::array<UniformLocation, kTexUnitCount> texCubeSamplerLocs;
 
         UniformLocation textureFormatLoc;
 
-        UniformLocation textureEnvModeLoc;
         UniformLocation combineRgbLoc;
         UniformLocation combineAlphaLoc;
         UniformLocation src0rgbLoc;
@@ -152,20 +194,11 @@ class GLES1Renderer final : angle::NonCopyable
         UniformLocation textureEnvColorLoc;
         UniformLocation rgbScaleLoc;
         UniformLocation alphaScaleLoc;
-        UniformLocation pointSpriteCoordReplaceLoc;
 
         // Alpha test
-        UniformLocation enableAlphaTestLoc;
-        UniformLocation alphaFuncLoc;
         UniformLocation alphaTestRefLoc;
 
         // Shading, materials, and lighting
-        UniformLocation shadeModelFlatLoc;
-        UniformLocation enableLightingLoc;
-        UniformLocation enableRescaleNormalLoc;
-        UniformLocation enableNormalizeLoc;
-        UniformLocation enableColorMaterialLoc;
-
         UniformLocation materialAmbientLoc;
         UniformLocation materialDiffuseLoc;
         UniformLocation materialSpecularLoc;
@@ -175,7 +208,6 @@ class GLES1Renderer final : angle::NonCopyable
         UniformLocation lightModelSceneAmbientLoc;
         UniformLocation lightModelTwoSidedLoc;
 
-        UniformLocation lightEnablesLoc;
         UniformLocation lightAmbientsLoc;
         UniformLocation lightDiffusesLoc;
         UniformLocation lightSpecularsLoc;
@@ -188,16 +220,12 @@ class GLES1Renderer final : angle::NonCopyable
         UniformLocation lightAttenuationQuadraticsLoc;
 
         // Fog
-        UniformLocation fogEnableLoc;
-        UniformLocation fogModeLoc;
         UniformLocation fogDensityLoc;
         UniformLocation fogStartLoc;
         UniformLocation fogEndLoc;
         UniformLocation fogColorLoc;
 
         // Clip planes
-        UniformLocation enableClipPlanesLoc;
-        UniformLocation clipPlaneEnablesLoc;
         UniformLocation clipPlanesLoc;
 
         // Point rasterization
@@ -205,22 +233,23 @@ class GLES1Renderer final : angle::NonCopyable
         UniformLocation pointSizeMinLoc;
         UniformLocation pointSizeMaxLoc;
         UniformLocation pointDistanceAttenuationLoc;
-        UniformLocation pointSpriteEnabledLoc;
 
         // Draw texture
-        UniformLocation enableDrawTextureLoc;
         UniformLocation drawTextureCoordsLoc;
         UniformLocation drawTextureDimsLoc;
         UniformLocation drawTextureNormalizedCropRectLoc;
+
+        // Values last uploaded for uniforms that aren't covered by the GLES1 dirty bits.  They
+        // start out zeroed like the uniforms of a newly linked program.
+        std::array<GLint, kTexUnitCount> textureFormats;
+        std::array<Vec4Uniform, kTexUnitCount> drawTextureNormalizedCropRects;
+        bool pointRasterization;
     };
 
     struct GLES1UniformBuffers
     {
         std::array<Mat4Uniform, kTexUnitCount> textureMatrices;
-        std::array<GLint, kTexUnitCount> tex2DEnables;
-        std::array<GLint, kTexUnitCount> texCubeEnables;
 
-        std::array<GLint, kTexUnitCount> texEnvModes;
         std::array<GLint, kTexUnitCount> texCombineRgbs;
         std::array<GLint, kTexUnitCount> texCombineAlphas;
 
@@ -239,10 +268,8 @@ class GLES1Renderer final : angle::NonCopyable
         std::array<Vec4Uniform, kTexUnitCount> texEnvColors;
         std::array<GLfloat, kTexUnitCount> texEnvRgbScales;
         std::array<GLfloat, kTexUnitCount> texEnvAlphaScales;
-        std::array<GLint, kTexUnitCount> pointSpriteCoordReplaces;
 
         // Lighting
-        std::array<GLint, kLightCount> lightEnables;
         std::array<Vec4Uniform, kLightCount> lightAmbients;
         std::array<Vec4Uniform, kLightCount> lightDiffuses;
         std::array<Vec4Uniform, kLightCount> lightSpeculars;
@@ -255,7 +282,6 @@ class GLES1Renderer final : angle::NonCopyable
         std::array<GLfloat, kLightCount> attenuationQuadratics;
 
         // Clip planes
-        std::array<GLint, kClipPlaneCount> clipPlaneEnables;
         std::array<Vec4Uniform, kClipPlaneCount> clipPlanes;
 
         // Texture crop rectangles
@@ -263,7 +289,12 @@ class GLES1Renderer final : angle::NonCopyable
     };
 
     GLES1UniformBuffers mUniformBuffers;
-    GLES1ProgramState mProgramState;
+
+    // One program per shader variant that has been used.  Uniforms are per program, so all of the
+    // state is uploaded again when switching to a different variant.
+    GLES1ShaderState mShaderState;
+    std::unordered_map<GLES1ShaderState, GLES1ProgramState, GLES1ShaderStateHash> mProgramStates;
+    GLES1ProgramState *mCurrentProgramState = nullptr;
 
     bool mDrawTextureEnabled      = false;
     GLfloat mDrawTextureCoords[4] = {0.0f, 0.0f, 0.0f, 0.0f};
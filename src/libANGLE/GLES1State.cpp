@@ -74,6 +74,7 @@ GLES1State::GLES1State()
       mCurrentNormal({0.0f, 0.0f, 0.0f}),
       mClientActiveTexture(0),
       mMatrixMode(MatrixType::Modelview),
+      mModelviewInvTrDirty(true),
       mShadeModel(ShadingModel::Smooth),
       mAlphaTestFunc(AlphaTestFunc::AlwaysPass),
       mAlphaTestRef(0.0f),
@@ -239,7 +240,6 @@ const TextureCoordF &GLES1State::getCurrentTextureCoords(unsigned int unit) cons
 
 void GLES1State::setMatrixMode(MatrixType mode)
 {
-    setDirty(DIRTY_GLES1_MATRICES);
     mMatrixMode = mode;
 }
 
@@ -266,22 +266,26 @@ GLint GLES1State::getCurrentMatrixStackDepth(GLenum queryType) const
 
 void GLES1State::pushMatrix()
 {
-    setDirty(DIRTY_GLES1_MATRICES);
-    auto &stack = currentMatrixStack();
+    // Pushing doesn't change the top of the stack, so nothing needs to be uploaded again.
+    auto &stack = getMatrixStack(mMatrixMode);
     stack.push_back(stack.back());
 }
 
 void GLES1State::popMatrix()
 {
-    setDirty(DIRTY_GLES1_MATRICES);
     auto &stack = currentMatrixStack();
     stack.pop_back();
 }
 
 GLES1State::MatrixStack &GLES1State::currentMatrixStack()
 {
-    setDirty(DIRTY_GLES1_MATRICES);
-    switch (mMatrixMode)
+    setMatrixDirty(mMatrixMode);
+    return getMatrixStack(mMatrixMode);
+}
+
+GLES1State::MatrixStack &GLES1State::getMatrixStack(MatrixType mode)
+{
+    switch (mode)
     {
         case MatrixType::Modelview:
             return mModelviewMatrices;
@@ -295,11 +299,41 @@ GLES1State::MatrixStack &GLES1State::currentMatrixStack()
     }
 }
 
+void GLES1State::setMatrixDirty(MatrixType mode)
+{
+    switch (mode)
+    {
+        case MatrixType::Modelview:
+            setDirty(DIRTY_GLES1_MODELVIEW_MATRIX);
+            mModelviewInvTrDirty = true;
+            break;
+        case MatrixType::Projection:
+            setDirty(DIRTY_GLES1_PROJECTION_MATRIX);
+            break;
+        case MatrixType::Texture:
+            setDirty(DIRTY_GLES1_TEXTURE_MATRIX);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
 const angle::Mat4 &GLES1State::getModelviewMatrix() const
 {
     return mModelviewMatrices.back();
 }
 
+const angle::Mat4 &GLES1State::getModelviewInvTrMatrix() const
+{
+    if (mModelviewInvTrDirty)
+    {
+        mModelviewInvTr      = mModelviewMatrices.back().transpose().inverse();
+        mModelviewInvTrDirty = false;
+    }
+    return mModelviewInvTr;
+}
+
 const GLES1State::MatrixStack &GLES1State::getMatrixStack(MatrixType mode) const
 {
     switch (mode)
@@ -323,15 +357,13 @@ const GLES1State::MatrixStack &GLES1State::currentMatrixStack() const
 
 void GLES1State::loadMatrix(const angle::Mat4 &m)
 {
-    setDirty(DIRTY_GLES1_MATRICES);
     currentMatrixStack().back() = m;
 }
 
 void GLES1State::multMatrix(const angle::Mat4 &m)
 {
-    setDirty(DIRTY_GLES1_MATRICES);
-    angle::Mat4 currentMatrix   = currentMatrixStack().back();
-    currentMatrixStack().back() = currentMatrix.product(m);
+    MatrixStack &stack = currentMatrixStack();
+    stack.back()       = stack.back().product(m);
 }
 
 void GLES1State::setLogicOp(LogicalOperation opcodePacked)
@@ -180,6 +180,8 @@ class GLES1State final : angle::NonCopyable
     const MatrixStack &getMatrixStack(MatrixType mode) const;
 
     const angle::Mat4 &getModelviewMatrix() const;
+    // Inverse transpose of the top of the modelview stack, cached until the stack changes.
+    const angle::Mat4 &getModelviewInvTrMatrix() const;
 
     void loadMatrix(const angle::Mat4 &m);
     void multMatrix(const angle::Mat4 &m);
@@ -231,7 +233,9 @@ class GLES1State final : angle::NonCopyable
         DIRTY_GLES1_FEATURE_ENABLE,
         DIRTY_GLES1_CURRENT_VECTOR,
         DIRTY_GLES1_CLIENT_ACTIVE_TEXTURE,
-        DIRTY_GLES1_MATRICES,
+        DIRTY_GLES1_PROJECTION_MATRIX,
+        DIRTY_GLES1_MODELVIEW_MATRIX,
+        DIRTY_GLES1_TEXTURE_MATRIX,
         DIRTY_GLES1_TEXTURE_ENVIRONMENT,
         DIRTY_GLES1_MATERIAL,
         DIRTY_GLES1_LIGHTS,
@@ -263,6 +267,9 @@ class GLES1State final : angle::NonCopyable
     void clearDirtyBits(const DirtyGles1Type &bitset) { mDirtyBits &= ~bitset; }
     bool isDirty(DirtyGles1Type type) const { return mDirtyBits.test(type); }
 
+    MatrixStack &getMatrixStack(MatrixType mode);
+    void setMatrixDirty(MatrixType mode);
+
     // All initial state values come from the
     // OpenGL ES 1.1 spec.
     std::vector<angle::PackedEnumBitSet<TextureType>> mTexUnitEnables;
@@ -301,6 +308,8 @@ class GLES1State final : angle::NonCopyable
     MatrixStack mProjectionMatrices;
     MatrixStack mModelviewMatrices;
     std::vector<MatrixStack> mTextureMatrices;
+    mutable angle::Mat4 mModelviewInvTr;
+    mutable bool mModelviewInvTrDirty;
 
     // Table 6.15
     using TextureEnvironments = std::vector<TextureEnvironmentParameters>;
@@ -13,6 +13,8 @@
 
 #include "libANGLE/MemoryProgramCache.h"
 
+#include <algorithm>
+
 #include <GLSLANG/ShaderVars.h>
 #include <anglebase/sha1.h>
 
@@ -21,9 +23,11 @@
 #include "libANGLE/BinaryStream.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Uniform.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/capture/FrameCapture.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/ProgramImpl.h"
+#include "libANGLE/trace.h"
 #include "platform/PlatformMethods.h"
 
 namespace gl
@@ -33,36 +37,77 @@ namespace
 {
 constexpr unsigned int kWarningLimit = 3;
 
+// Feeds the program key directly into an incremental SHA-1 hasher, so computing the key does not
+// materialize the shader sources and link state into an intermediate string.  Variable-length data
+// is prefixed with its length to keep the encoding unambiguous.
 class HashStream final : angle::NonCopyable
 {
   public:
-    std::string str() { return mStringStream.str(); }
+    void getDigest(egl::BlobCache::Key *hashOut)
+    {
+        mHasher.Final();
+        memcpy(hashOut->data(), mHasher.Digest(), hashOut->size());
+    }
 
     template <typename T>
     HashStream &operator<<(T value)
     {
-        mStringStream << value << kSeparator;
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "Only scalar values can be hashed directly");
+        mHasher.Update(&value, sizeof(value));
+        return *this;
+    }
+
+    HashStream &operator<<(const char *str)
+    {
+        writeBytes(str, strlen(str));
+        return *this;
+    }
+
+    HashStream &operator<<(const std::string &str)
+    {
+        writeBytes(str.c_str(), str.length());
+        return *this;
+    }
+
+    HashStream &operator<<(const ShaderHash &hash)
+    {
+        mHasher.Update(hash.data(), hash.size());
         return *this;
     }
 
   private:
-    static constexpr char kSeparator = ':';
-    std::ostringstream mStringStream;
+    void writeBytes(const char *data, size_t length)
+    {
+        *this << length;
+        mHasher.Update(data, length);
+    }
+
+    angle::base::SecureHashAlgorithm mHasher;
 };
 
 HashStream &operator<<(HashStream &stream, Shader *shader)
 {
+    // The per-shader hashes are computed when the source is set and when the shader is compiled.
+    stream << (shader != nullptr);
     if (shader)
     {
-        stream << shader->getSourceString().c_str() << shader->getSourceString().length()
-               << shader->getCompilerResourcesString().c_str();
+        stream << shader->getState().getSourceHash() << shader->getCompilerResourcesHash();
     }
     return stream;
 }
 
 HashStream &operator<<(HashStream &stream, const ProgramBindings &bindings)
 {
-    for (const auto &binding : bindings.getStableIterationMap())
+    // Most programs don't have any bindings; avoid building the sorted map for them.
+    if (bindings.begin() == bindings.end())
+    {
+        return stream << size_t(0);
+    }
+
+    const std::map<std::string, GLuint> stableBindings = bindings.getStableIterationMap();
+    stream << stableBindings.size();
+    for (const auto &binding : stableBindings)
     {
         stream << binding.first << binding.second;
     }
@@ -71,7 +116,14 @@ HashStream &operator<<(HashStream &stream, const ProgramBindings &bindings)
 
 HashStream &operator<<(HashStream &stream, const ProgramAliasedBindings &bindings)
 {
-    for (const auto &binding : bindings.getStableIterationMap())
+    if (bindings.begin() == bindings.end())
+    {
+        return stream << size_t(0);
+    }
+
+    const std::map<std::string, ProgramBinding> stableBindings = bindings.getStableIterationMap();
+    stream << stableBindings.size();
+    for (const auto &binding : stableBindings)
     {
         stream << binding.first << binding.second.location;
     }
@@ -80,6 +132,7 @@ HashStream &operator<<(HashStream &stream, const ProgramAliasedBindings &binding
 
 HashStream &operator<<(HashStream &stream, const std::vector<std::string> &strings)
 {
+    stream << strings.size();
     for (const auto &str : strings)
     {
         stream << str;
@@ -89,6 +142,7 @@ HashStream &operator<<(HashStream &stream, const std::vector<std::string> &strin
 
 HashStream &operator<<(HashStream &stream, const std::vector<gl::VariableLocation> &locations)
 {
+    stream << locations.size();
     for (const auto &loc : locations)
     {
         stream << loc.index << loc.arrayIndex << loc.ignored;
@@ -96,19 +150,168 @@ HashStream &operator<<(HashStream &stream, const std::vector<gl::VariableLocatio
     return stream;
 }
 
+bool CompressProgram(const angle::MemoryBuffer &serializedProgram,
+                     angle::MemoryBuffer *compressedDataOut)
+{
+    if (!egl::CompressBlobCacheData(serializedProgram.size(), serializedProgram.data(),
+                                    compressedDataOut))
+    {
+        ERR() << "Error compressing binary data.";
+        return false;
+    }
+    return true;
+}
+
 }  // anonymous namespace
 
+struct MemoryProgramCache::PendingStore
+{
+    egl::BlobCache::Key programHash;
+    // Shared with the worker thread, and with lookups of the program while it is compressed.
+    std::shared_ptr<const angle::MemoryBuffer> serializedProgram;
+    std::shared_ptr<angle::WaitableEvent> compressEvent;
+    // Set if the program was removed from the cache, or the cache was cleared, meanwhile.
+    bool removed;
+};
+
+// Compresses a serialized program in a worker thread and stores it in the blob cache.  Storing it
+// also evicts the least recently used programs from the internal cache when it is full, so the
+// linking thread does neither.  The blob cache serializes the calls to the application's callback.
+class MemoryProgramCache::CompressAndStoreTask : public angle::Closure
+{
+  public:
+    CompressAndStoreTask(MemoryProgramCache *cache,
+                         const egl::BlobCache::Key &programHash,
+                         std::shared_ptr<const angle::MemoryBuffer> serializedProgram)
+        : mCache(cache), mProgramHash(programHash), mSerializedProgram(std::move(serializedProgram))
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "CompressAndStoreTask");
+        angle::MemoryBuffer compressedData;
+        if (CompressProgram(*mSerializedProgram, &compressedData) &&
+            !mCache->isPendingStoreRemoved(mSerializedProgram.get()))
+        {
+            mCache->storeProgram(mProgramHash, std::move(compressedData));
+        }
+        mCache->endPendingStore(mSerializedProgram.get());
+    }
+
+  private:
+    MemoryProgramCache *mCache;
+    egl::BlobCache::Key mProgramHash;
+    std::shared_ptr<const angle::MemoryBuffer> mSerializedProgram;
+};
+
 MemoryProgramCache::MemoryProgramCache(egl::BlobCache &blobCache)
     : mBlobCache(blobCache), mIssuedWarnings(0)
 {}
 
-MemoryProgramCache::~MemoryProgramCache() {}
+MemoryProgramCache::~MemoryProgramCache()
+{
+    waitForPendingStores();
+}
+
+void MemoryProgramCache::storeProgram(const egl::BlobCache::Key &programHash,
+                                      angle::MemoryBuffer &&compressedData) const
+{
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ProgramCache.ProgramBinarySizeBytes",
+                           static_cast<int>(compressedData.size()));
+
+    // TODO(syoussefi): to be removed.  Compatibility for Chrome until it supports
+    // EGL_ANDROID_blob_cache. http://anglebug.com/2516
+    auto *platform = ANGLEPlatformCurrent();
+    platform->cacheProgram(platform, programHash, compressedData.size(), compressedData.data());
+
+    mBlobCache.put(programHash, std::move(compressedData));
+}
+
+std::shared_ptr<const angle::MemoryBuffer> MemoryProgramCache::getPendingProgram(
+    const egl::BlobCache::Key &programHash) const
+{
+    std::lock_guard<std::mutex> lock(mPendingStoresMutex);
+    for (const PendingStore &pendingStore : mPendingStores)
+    {
+        if (pendingStore.programHash == programHash && !pendingStore.removed)
+        {
+            return pendingStore.serializedProgram;
+        }
+    }
+    return nullptr;
+}
+
+void MemoryProgramCache::removePendingStores(const egl::BlobCache::Key *programHash)
+{
+    std::lock_guard<std::mutex> lock(mPendingStoresMutex);
+    for (PendingStore &pendingStore : mPendingStores)
+    {
+        if (programHash == nullptr || pendingStore.programHash == *programHash)
+        {
+            pendingStore.removed = true;
+        }
+    }
+}
+
+bool MemoryProgramCache::isPendingStoreRemoved(const angle::MemoryBuffer *serializedProgram) const
+{
+    std::lock_guard<std::mutex> lock(mPendingStoresMutex);
+    for (const PendingStore &pendingStore : mPendingStores)
+    {
+        if (pendingStore.serializedProgram.get() == serializedProgram)
+        {
+            return pendingStore.removed;
+        }
+    }
+    UNREACHABLE();
+    return true;
+}
+
+void MemoryProgramCache::endPendingStore(const angle::MemoryBuffer *serializedProgram)
+{
+    egl::BlobCache::Key programHash;
+    bool removed = false;
+    {
+        std::lock_guard<std::mutex> lock(mPendingStoresMutex);
+        auto pendingIter =
+            std::find_if(mPendingStores.begin(), mPendingStores.end(),
+                         [serializedProgram](const PendingStore &pendingStore) {
+                             return pendingStore.serializedProgram.get() == serializedProgram;
+                         });
+        ASSERT(pendingIter != mPendingStores.end());
+        programHash = pendingIter->programHash;
+        removed     = pendingIter->removed;
+        mPendingStores.erase(pendingIter);
+    }
+
+    // The program may have been removed after it was stored.
+    if (removed)
+    {
+        mBlobCache.remove(programHash);
+    }
+}
+
+void MemoryProgramCache::waitForPendingStores() const
+{
+    std::vector<std::shared_ptr<angle::WaitableEvent>> compressEvents;
+    {
+        std::lock_guard<std::mutex> lock(mPendingStoresMutex);
+        for (const PendingStore &pendingStore : mPendingStores)
+        {
+            compressEvents.push_back(pendingStore.compressEvent);
+        }
+    }
+    for (const std::shared_ptr<angle::WaitableEvent> &compressEvent : compressEvents)
+    {
+        compressEvent->wait();
+    }
+}
 
 void MemoryProgramCache::ComputeHash(const Context *context,
                                      const Program *program,
                                      egl::BlobCache::Key *hashOut)
 {
-    // Compute the program hash. Start with the shader hashes and resource strings.
+    // Compute the program hash. Start with the shader source and resource string hashes.
     HashStream hashStream;
     for (ShaderType shaderType : AllShaderTypes())
     {
@@ -117,7 +320,8 @@ void MemoryProgramCache::ComputeHash(const Context *context,
 
     // Add some ANGLE metadata and Context properties, such as version and back-end.
     hashStream << ANGLE_COMMIT_HASH << context->getClientMajorVersion()
-               << context->getClientMinorVersion() << context->getString(GL_RENDERER);
+               << context->getClientMinorVersion()
+               << reinterpret_cast<const char *>(context->getString(GL_RENDERER));
 
     // Hash pre-link program properties.
     hashStream << program->getAttributeBindings() << program->getUniformLocationBindings()
@@ -130,10 +334,7 @@ void MemoryProgramCache::ComputeHash(const Context *context,
     // Include the status of FrameCapture, which adds source strings to the binary
     hashStream << context->getShareGroup()->getFrameCaptureShared()->enabled();
 
-    // Call the secure SHA hashing function.
-    const std::string &programKey = hashStream.str();
-    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(programKey.c_str()),
-                               programKey.length(), hashOut->data());
+    hashStream.getDigest(hashOut);
 }
 
 angle::Result MemoryProgramCache::getProgram(const Context *context,
@@ -147,20 +348,34 @@ angle::Result MemoryProgramCache::getProgram(const Context *context,
     }
 
     ComputeHash(context, program, hashOut);
+
     egl::BlobCache::Value binaryProgram;
     size_t programSize = 0;
+    angle::MemoryBuffer uncompressedData;
+    std::shared_ptr<const angle::MemoryBuffer> pendingProgram;
+    const angle::MemoryBuffer *serializedProgram = nullptr;
     if (get(context, *hashOut, &binaryProgram, &programSize))
     {
-        angle::MemoryBuffer uncompressedData;
         if (!egl::DecompressBlobCacheData(binaryProgram.data(), programSize, &uncompressedData))
         {
             ERR() << "Error decompressing binary data.";
             return angle::Result::Incomplete;
         }
+        serializedProgram = &uncompressedData;
+    }
+    else
+    {
+        // A program that was just linked may still be compressing, in which case its serialized
+        // form is loaded without waiting.
+        pendingProgram    = getPendingProgram(*hashOut);
+        serializedProgram = pendingProgram.get();
+    }
 
+    if (serializedProgram != nullptr)
+    {
         angle::Result result =
-            program->loadBinary(context, GL_PROGRAM_BINARY_ANGLE, uncompressedData.data(),
-                                static_cast<int>(uncompressedData.size()));
+            program->loadBinary(context, GL_PROGRAM_BINARY_ANGLE, serializedProgram->data(),
+                                static_cast<int>(serializedProgram->size()));
         ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.ProgramCache.LoadBinarySuccess",
                                 result == angle::Result::Continue);
         ANGLE_TRY(result);
@@ -201,6 +416,7 @@ bool MemoryProgramCache::getAt(size_t index,
 
 void MemoryProgramCache::remove(const egl::BlobCache::Key &programHash)
 {
+    removePendingStores(&programHash);
     mBlobCache.remove(programHash);
 }
 
@@ -217,23 +433,27 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
     angle::MemoryBuffer serializedProgram;
     ANGLE_TRY(program->serialize(context, &serializedProgram));
 
-    angle::MemoryBuffer compressedData;
-    if (!egl::CompressBlobCacheData(serializedProgram.size(), serializedProgram.data(),
-                                    &compressedData))
+    std::shared_ptr<angle::WorkerThreadPool> workerPool = context->getWorkerThreadPool();
+    if (!workerPool->isAsync())
     {
-        ERR() << "Error compressing binary data.";
-        return angle::Result::Incomplete;
+        angle::MemoryBuffer compressedData;
+        if (!CompressProgram(serializedProgram, &compressedData))
+        {
+            return angle::Result::Incomplete;
+        }
+        storeProgram(programHash, std::move(compressedData));
+        return angle::Result::Continue;
     }
 
-    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ProgramCache.ProgramBinarySizeBytes",
-                           static_cast<int>(compressedData.size()));
+    // Only serialization needs the program; compression and storage are done off the linking
+    // thread.  The task can't end its pending store before the store is added.
+    auto sharedProgram = std::make_shared<const angle::MemoryBuffer>(std::move(serializedProgram));
+    auto compressTask  = std::make_shared<CompressAndStoreTask>(this, programHash, sharedProgram);
+    std::lock_guard<std::mutex> lock(mPendingStoresMutex);
+    std::shared_ptr<angle::WaitableEvent> compressEvent =
+        angle::WorkerThreadPool::PostWorkerTask(workerPool, compressTask);
+    mPendingStores.push_back({programHash, std::move(sharedProgram), compressEvent, false});
 
-    // TODO(syoussefi): to be removed.  Compatibility for Chrome until it supports
-    // EGL_ANDROID_blob_cache. http://anglebug.com/2516
-    auto *platform = ANGLEPlatformCurrent();
-    platform->cacheProgram(platform, programHash, compressedData.size(), compressedData.data());
-
-    mBlobCache.put(programHash, std::move(compressedData));
     return angle::Result::Continue;
 }
 
@@ -264,17 +484,22 @@ bool MemoryProgramCache::putBinary(const egl::BlobCache::Key &programHash,
 
 void MemoryProgramCache::clear()
 {
+    removePendingStores(nullptr);
     mBlobCache.clear();
     mIssuedWarnings = 0;
 }
 
 void MemoryProgramCache::resize(size_t maxCacheSizeBytes)
 {
+    removePendingStores(nullptr);
     mBlobCache.resize(maxCacheSizeBytes);
 }
 
 size_t MemoryProgramCache::entryCount() const
 {
+    // The entries are enumerated with getAt after they are counted, which includes the programs
+    // that were linked before.
+    waitForPendingStores();
     return mBlobCache.entryCount();
 }
 
@@ -11,11 +11,19 @@
 #define LIBANGLE_MEMORY_PROGRAM_CACHE_H_
 
 #include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "common/MemoryBuffer.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/Error.h"
 
+namespace angle
+{
+class WaitableEvent;
+}  // namespace angle
+
 namespace gl
 {
 class Context;
@@ -46,7 +54,9 @@ class MemoryProgramCache final : angle::NonCopyable
     // Evict a program from the binary cache.
     void remove(const egl::BlobCache::Key &programHash);
 
-    // Helper method that serializes a program.
+    // Helper method that serializes a program.  When the context's worker thread pool is
+    // asynchronous, the serialized program is compressed and stored in the blob cache by a worker
+    // thread, which also calls the application's blob cache callback.
     angle::Result putProgram(const egl::BlobCache::Key &programHash,
                              const Context *context,
                              const Program *program);
@@ -72,7 +82,7 @@ class MemoryProgramCache final : angle::NonCopyable
     // Resize the cache. Discards current contents.
     void resize(size_t maxCacheSizeBytes);
 
-    // Returns the number of entries in the cache.
+    // Returns the number of entries in the cache, once the pending stores are done.
     size_t entryCount() const;
 
     // Reduces the current cache size and returns the number of bytes freed.
@@ -85,8 +95,30 @@ class MemoryProgramCache final : angle::NonCopyable
     size_t maxSize() const;
 
   private:
+    struct PendingStore;
+    class CompressAndStoreTask;
+
+    void storeProgram(const egl::BlobCache::Key &programHash,
+                      angle::MemoryBuffer &&compressedData) const;
+
+    // Returns the serialized program of a pending store of |programHash|, or null if there is none.
+    std::shared_ptr<const angle::MemoryBuffer> getPendingProgram(
+        const egl::BlobCache::Key &programHash) const;
+    // Keeps the pending stores of |programHash|, or all of them if null, out of the blob cache.
+    void removePendingStores(const egl::BlobCache::Key *programHash);
+    // Returns whether the pending store of |serializedProgram| was removed.
+    bool isPendingStoreRemoved(const angle::MemoryBuffer *serializedProgram) const;
+    // Called by the worker thread once the pending store of |serializedProgram| is done.
+    void endPendingStore(const angle::MemoryBuffer *serializedProgram);
+    // Waits for the worker threads to finish the pending stores.  The lock is not held while
+    // waiting, so other threads can still use the cache.
+    void waitForPendingStores() const;
+
     egl::BlobCache &mBlobCache;
     unsigned int mIssuedWarnings;
+
+    mutable std::mutex mPendingStoresMutex;
+    mutable std::vector<PendingStore> mPendingStores;
 };
 
 }  // namespace gl
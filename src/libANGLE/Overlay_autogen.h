@@ -32,6 +32,12 @@ enum class WidgetId
     VulkanShaderBufferDSHitRate,
     // Buffer Allocations Made By vk::DynamicBuffer.
     VulkanDynamicBufferAllocations,
+    // Time waited before a swapchain image is acquired (Microseconds).
+    VulkanAcquireWaitTime,
+    // Time spent throttling and queueing a present (Microseconds).
+    VulkanPresentQueueTime,
+    // Number of VkFramebuffers created in a frame (Count).
+    VulkanFramebufferCreations,
 
     InvalidEnum,
     EnumCount = InvalidEnum,
@@ -48,6 +54,9 @@ enum class WidgetId
     PROC(VulkanWriteDescriptorSetCount)         \
     PROC(VulkanDescriptorSetAllocations)        \
     PROC(VulkanShaderBufferDSHitRate)           \
-    PROC(VulkanDynamicBufferAllocations)
+    PROC(VulkanDynamicBufferAllocations)        \
+    PROC(VulkanAcquireWaitTime)                 \
+    PROC(VulkanPresentQueueTime)                \
+    PROC(VulkanFramebufferCreations)
 
 }  // namespace gl
@@ -15,6 +15,7 @@
 #include "common/angle_version.h"
 #include "common/bitset_utils.h"
 #include "common/debug.h"
+#include "common/hash_utils.h"
 #include "common/platform.h"
 #include "common/string_utils.h"
 #include "common/utilities.h"
@@ -41,6 +42,11 @@ namespace gl
 
 namespace
 {
+// Version of the frontend program binary layout.  Builds without a commit hash all share the same
+// placeholder hash, so bump this whenever the layout of serialize()/deserialize() changes.
+//
+// Version 2: buffer variables are stored in a size-prefixed section whose parsing is deferred.
+constexpr uint32_t kProgramBinaryFormatVersion = 2;
 
 // This simplified cast function doesn't need to worry about advanced concepts like
 // depth range values, or casting to bool.
@@ -769,6 +775,13 @@ void LoadBufferVariable(BinaryInputStream *stream, BufferVariable *var)
     }
 }
 
+// Checksum of a serialized buffer variable section, so that loading a binary can check the section
+// without parsing it.
+uint64_t ComputeBufferVariablesChecksum(const uint8_t *data, size_t size)
+{
+    return XXH64(data, size, 0);
+}
+
 void WriteInterfaceBlock(BinaryOutputStream *stream, const InterfaceBlock &block)
 {
     stream->writeString(block.name);
@@ -1259,7 +1272,26 @@ GLuint ProgramState::getUniformIndexFromName(const std::string &name) const
 
 GLuint ProgramState::getBufferVariableIndexFromName(const std::string &name) const
 {
-    return GetResourceIndexFromName(mBufferVariables, name);
+    return GetResourceIndexFromName(getBufferVariables(), name);
+}
+
+void ProgramState::resolvePendingBufferVariables() const
+{
+    ASSERT(mBufferVariables.empty());
+
+    BinaryInputStream stream(mPendingBufferVariablesData.data(),
+                             mPendingBufferVariablesData.size());
+    const size_t bufferVariableCount = stream.readElementCount();
+    mBufferVariables.resize(bufferVariableCount);
+    for (BufferVariable &bufferVariable : mBufferVariables)
+    {
+        LoadBufferVariable(&stream, &bufferVariable);
+    }
+    // The checksum of the data was checked when the binary was loaded.
+    ASSERT(!stream.error() && stream.endOfStream());
+
+    mPendingBufferVariablesData.clear();
+    mPendingBufferVariablesData.shrink_to_fit();
 }
 
 GLuint ProgramState::getUniformIndexFromLocation(UniformLocation location) const
@@ -1853,6 +1885,7 @@ void Program::unlink()
 
     mState.mUniformLocations.clear();
     mState.mBufferVariables.clear();
+    mState.mPendingBufferVariablesData.clear();
     mState.mOutputVariableTypes.clear();
     mState.mDrawBufferTypeMask.reset();
     mState.mYUVOutput = false;
@@ -2406,8 +2439,8 @@ void Program::getBufferVariableResourceName(GLuint index,
                                             GLchar *name) const
 {
     ASSERT(!mLinkingState);
-    ASSERT(index < mState.mBufferVariables.size());
-    getResourceName(mState.mBufferVariables[index].name, bufSize, length, name);
+    ASSERT(index < mState.getBufferVariables().size());
+    getResourceName(mState.getBufferVariables()[index].name, bufSize, length, name);
 }
 
 const std::string Program::getResourceName(const sh::ShaderVariable &resource) const
@@ -2565,7 +2598,7 @@ GLint Program::getActiveUniformCount() const
 size_t Program::getActiveBufferVariableCount() const
 {
     ASSERT(!mLinkingState);
-    return mLinked ? mState.mBufferVariables.size() : 0;
+    return mLinked ? mState.getBufferVariables().size() : 0;
 }
 
 GLint Program::getActiveUniformMaxLength() const
@@ -2620,8 +2653,8 @@ const VariableLocation &Program::getUniformLocation(UniformLocation location) co
 const BufferVariable &Program::getBufferVariableByIndex(GLuint index) const
 {
     ASSERT(!mLinkingState);
-    ASSERT(index < static_cast<size_t>(mState.mBufferVariables.size()));
-    return mState.mBufferVariables[index];
+    ASSERT(index < static_cast<size_t>(mState.getBufferVariables().size()));
+    return mState.getBufferVariables()[index];
 }
 
 UniformLocation Program::getUniformLocation(const std::string &name) const
@@ -4639,6 +4672,7 @@ angle::Result Program::serialize(const Context *context, angle::MemoryBuffer *bi
 
     stream.writeBytes(reinterpret_cast<const unsigned char *>(ANGLE_COMMIT_HASH),
                       ANGLE_COMMIT_HASH_SIZE);
+    stream.writeInt(kProgramBinaryFormatVersion);
 
     // nullptr context is supported when computing binary length.
     if (context)
@@ -4675,10 +4709,22 @@ angle::Result Program::serialize(const Context *context, angle::MemoryBuffer *bi
         stream.writeBool(variable.ignored);
     }
 
-    stream.writeInt(mState.getBufferVariables().size());
-    for (const BufferVariable &bufferVariable : mState.getBufferVariables())
+    // Buffer variables are written as a section prefixed with its size and checksum, so loading
+    // can defer parsing them.
+    const std::vector<BufferVariable> &bufferVariables = mState.getBufferVariables();
+    stream.writeInt(bufferVariables.size());
+    if (!bufferVariables.empty())
     {
-        WriteBufferVariable(&stream, bufferVariable);
+        BinaryOutputStream bufferVariableStream;
+        bufferVariableStream.writeInt(bufferVariables.size());
+        for (const BufferVariable &bufferVariable : bufferVariables)
+        {
+            WriteBufferVariable(&bufferVariableStream, bufferVariable);
+        }
+        stream.writeInt(bufferVariableStream.length());
+        stream.writeInt(ComputeBufferVariablesChecksum(bufferVariableStream.getData().data(),
+                                                       bufferVariableStream.length()));
+        stream.writeBytes(bufferVariableStream.getData().data(), bufferVariableStream.length());
     }
 
     // Warn the app layer if saving a binary with unsupported transform feedback.
@@ -4755,6 +4801,12 @@ angle::Result Program::deserialize(const Context *context,
         return angle::Result::Stop;
     }
 
+    if (stream.readInt<uint32_t>() != kProgramBinaryFormatVersion)
+    {
+        infoLog << "Invalid program binary format version.";
+        return angle::Result::Stop;
+    }
+
     int majorVersion = stream.readInt<int>();
     int minorVersion = stream.readInt<int>();
     if (majorVersion != context->getClientMajorVersion() ||
@@ -4777,28 +4829,44 @@ angle::Result Program::deserialize(const Context *context,
     mState.mEarlyFramentTestsOptimization = stream.readBool();
     mState.mSpecConstUsageBits            = rx::SpecConstUsageBits(stream.readInt<uint32_t>());
 
-    const size_t uniformIndexCount = stream.readInt<size_t>();
+    const size_t uniformIndexCount = stream.readElementCount();
     ASSERT(mState.mUniformLocations.empty());
-    for (size_t uniformIndexIndex = 0; uniformIndexIndex < uniformIndexCount; ++uniformIndexIndex)
+    mState.mUniformLocations.resize(uniformIndexCount);
+    for (VariableLocation &variable : mState.mUniformLocations)
     {
-        VariableLocation variable;
         stream.readInt(&variable.arrayIndex);
         stream.readInt(&variable.index);
         stream.readBool(&variable.ignored);
-
-        mState.mUniformLocations.push_back(variable);
     }
 
-    size_t bufferVariableCount = stream.readInt<size_t>();
-    ASSERT(mState.mBufferVariables.empty());
-    for (size_t bufferVarIndex = 0; bufferVarIndex < bufferVariableCount; ++bufferVarIndex)
+    // Only keep the serialized buffer variables around; they are parsed on first query.
+    const size_t bufferVariableCount = stream.readInt<size_t>();
+    ASSERT(mState.mBufferVariables.empty() && mState.mPendingBufferVariablesData.empty());
+    if (bufferVariableCount > 0)
     {
-        BufferVariable bufferVariable;
-        LoadBufferVariable(&stream, &bufferVariable);
-        mState.mBufferVariables.push_back(bufferVariable);
+        const size_t bufferVariableDataSize   = stream.readInt<size_t>();
+        const uint64_t bufferVariableChecksum = stream.readInt<uint64_t>();
+        if (stream.error() || bufferVariableDataSize > stream.remainingSize())
+        {
+            infoLog << "Invalid program binary.";
+            return angle::Result::Stop;
+        }
+        // Parsing is deferred, so make sure the section is intact now.  The program cannot fail to
+        // load once the buffer variables are queried.
+        const uint8_t *bufferVariableData = stream.data() + stream.offset();
+        if (ComputeBufferVariablesChecksum(bufferVariableData, bufferVariableDataSize) !=
+            bufferVariableChecksum)
+        {
+            infoLog << "Invalid program binary.";
+            return angle::Result::Stop;
+        }
+        mState.mPendingBufferVariablesData.assign(bufferVariableData,
+                                                  bufferVariableData + bufferVariableDataSize);
+        stream.skip(bufferVariableDataSize);
     }
 
     size_t outputTypeCount = stream.readInt<size_t>();
+    mState.mOutputVariableTypes.reserve(outputTypeCount);
     for (size_t outputIndex = 0; outputIndex < outputTypeCount; ++outputIndex)
     {
         mState.mOutputVariableTypes.push_back(stream.readInt<GLenum>());
@@ -275,7 +275,14 @@ class ProgramState final : angle::NonCopyable
     {
         return mExecutable->getShaderStorageBlocks();
     }
-    const std::vector<BufferVariable> &getBufferVariables() const { return mBufferVariables; }
+    const std::vector<BufferVariable> &getBufferVariables() const
+    {
+        if (ANGLE_UNLIKELY(!mPendingBufferVariablesData.empty()))
+        {
+            resolvePendingBufferVariables();
+        }
+        return mBufferVariables;
+    }
     const std::vector<SamplerBinding> &getSamplerBindings() const
     {
         return mExecutable->getSamplerBindings();
@@ -381,6 +388,9 @@ class ProgramState final : angle::NonCopyable
     // Scans the sampler bindings for type conflicts with sampler 'textureUnitIndex'.
     void setSamplerUniformTextureTypeAndFormat(size_t textureUnitIndex);
 
+    // Parses buffer variables that were deferred when loading from a binary.
+    void resolvePendingBufferVariables() const;
+
     std::string mLabel;
 
     sh::WorkGroupSize mComputeShaderLocalSize;
@@ -391,7 +401,11 @@ class ProgramState final : angle::NonCopyable
     std::vector<std::string> mTransformFeedbackVaryingNames;
 
     std::vector<VariableLocation> mUniformLocations;
-    std::vector<BufferVariable> mBufferVariables;
+    // Buffer variables are only used by program interface queries.  When a program is loaded from
+    // a binary, their serialized form is kept in mPendingBufferVariablesData and only parsed on
+    // first use.
+    mutable std::vector<BufferVariable> mBufferVariables;
+    mutable std::vector<uint8_t> mPendingBufferVariablesData;
     RangeUI mAtomicCounterUniformRange;
 
     DrawBufferMask mActiveOutputVariables;
@@ -251,21 +251,22 @@ void ProgramExecutable::load(bool isSeparable, gl::BinaryInputStream *stream)
     mTessGenVertexOrder        = stream->readInt<GLenum>();
     mTessGenPointMode          = stream->readInt<GLenum>();
 
-    size_t attribCount = stream->readInt<size_t>();
+    // The variables below are deserialized in place to avoid copying their names and array sizes
+    // into the vectors, which is noticeable for programs with many resources.
+    size_t attribCount = stream->readElementCount();
     ASSERT(getProgramInputs().empty());
-    for (size_t attribIndex = 0; attribIndex < attribCount; ++attribIndex)
+    mProgramInputs.resize(attribCount);
+    for (sh::ShaderVariable &attrib : mProgramInputs)
     {
-        sh::ShaderVariable attrib;
         LoadShaderVar(stream, &attrib);
         attrib.location = stream->readInt<int>();
-        mProgramInputs.push_back(attrib);
     }
 
-    size_t uniformCount = stream->readInt<size_t>();
+    size_t uniformCount = stream->readElementCount();
     ASSERT(getUniforms().empty());
-    for (size_t uniformIndex = 0; uniformIndex < uniformCount; ++uniformIndex)
+    mUniforms.resize(uniformCount);
+    for (LinkedUniform &uniform : mUniforms)
     {
-        LinkedUniform uniform;
         LoadShaderVar(stream, &uniform);
 
         uniform.bufferIndex = stream->readInt<int>();
@@ -280,17 +281,15 @@ void ProgramExecutable::load(bool isSeparable, gl::BinaryInputStream *stream)
         {
             uniform.setActive(shaderType, stream->readBool());
         }
-
-        mUniforms.push_back(uniform);
     }
 
-    size_t uniformBlockCount = stream->readInt<size_t>();
+    size_t uniformBlockCount = stream->readElementCount();
     ASSERT(getUniformBlocks().empty());
+    mUniformBlocks.resize(uniformBlockCount);
     for (size_t uniformBlockIndex = 0; uniformBlockIndex < uniformBlockCount; ++uniformBlockIndex)
     {
-        InterfaceBlock uniformBlock;
+        InterfaceBlock &uniformBlock = mUniformBlocks[uniformBlockIndex];
         LoadInterfaceBlock(stream, &uniformBlock);
-        mUniformBlocks.push_back(uniformBlock);
 
         mActiveUniformBlockBindings.set(uniformBlockIndex, uniformBlock.binding != 0);
     }
@@ -340,15 +339,14 @@ void ProgramExecutable::load(bool isSeparable, gl::BinaryInputStream *stream)
 
     mTransformFeedbackBufferMode = stream->readInt<GLint>();
 
-    size_t outputCount = stream->readInt<size_t>();
+    size_t outputCount = stream->readElementCount();
     ASSERT(getOutputVariables().empty());
-    for (size_t outputIndex = 0; outputIndex < outputCount; ++outputIndex)
+    mOutputVariables.resize(outputCount);
+    for (sh::ShaderVariable &output : mOutputVariables)
     {
-        sh::ShaderVariable output;
         LoadShaderVar(stream, &output);
         output.location = stream->readInt<int>();
         output.index    = stream->readInt<int>();
-        mOutputVariables.push_back(output);
     }
 
     size_t outputVarCount = stream->readInt<size_t>();
@@ -29,6 +29,12 @@ namespace gl
 
 namespace
 {
+void ComputeShaderHash(const std::string &input, ShaderHash *hashOut)
+{
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(input.c_str()),
+                               input.length(), hashOut->data());
+}
+
 template <typename VarT>
 std::vector<VarT> GetActiveShaderVariables(const std::vector<VarT> *variableList)
 {
@@ -124,6 +130,7 @@ ShaderState::ShaderState(ShaderType shaderType)
     : mLabel(),
       mShaderType(shaderType),
       mShaderVersion(100),
+      mSourceHash{},
       mNumViews(-1),
       mGeometryShaderInvocations(1),
       mCompileStatus(CompileStatus::NOT_COMPILED)
@@ -145,6 +152,7 @@ Shader::Shader(ShaderProgramManager *manager,
       mType(type),
       mRefCount(0),
       mDeleteStatus(false),
+      mCompilerResourcesHash{},
       mResourceManager(manager),
       mCurrentMaxComputeWorkGroupInvocations(0u)
 {
@@ -197,6 +205,9 @@ void Shader::setSource(GLsizei count, const char *const *string, const GLint *le
     }
 
     mState.mSource = stream.str();
+
+    // Hash the source once here rather than on every link that consults the program cache.
+    ComputeShaderHash(mState.mSource, &mState.mSourceHash);
 }
 
 int Shader::getInfoLogLength()
@@ -385,6 +396,7 @@ void Shader::compile(const Context *context)
     ShHandle compilerHandle             = compilerInstance.getHandle();
     ASSERT(compilerHandle);
     mCompilerResourcesString = compilerInstance.getBuiltinResourcesString();
+    ComputeShaderHash(mCompilerResourcesString, &mCompilerResourcesHash);
 
     mCompilingState.reset(new CompilingState());
     mCompilingState->shCompilerInstance = std::move(compilerInstance);
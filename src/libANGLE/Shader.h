@@ -12,12 +12,14 @@
 #ifndef LIBANGLE_SHADER_H_
 #define LIBANGLE_SHADER_H_
 
+#include <array>
 #include <list>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include <GLSLANG/ShaderLang.h>
+#include <anglebase/sha1.h>
 #include "angle_gl.h"
 
 #include "common/Optional.h"
@@ -48,6 +50,10 @@ class Context;
 class ShaderProgramManager;
 class State;
 
+// SHA-1 digest of shader inputs.  Computed once when the inputs change so that program cache keys
+// can be derived without rehashing the full shader source on every link.
+using ShaderHash = std::array<uint8_t, angle::base::kSHA1Length>;
+
 // We defer the compile until link time, or until properties are queried.
 enum class CompileStatus
 {
@@ -65,6 +71,7 @@ class ShaderState final : angle::NonCopyable
     const std::string &getLabel() const { return mLabel; }
 
     const std::string &getSource() const { return mSource; }
+    const ShaderHash &getSourceHash() const { return mSourceHash; }
     bool isCompiledToBinary() const { return !mCompiledBinary.empty(); }
     const std::string &getTranslatedSource() const { return mTranslatedSource; }
     const sh::BinaryBlob &getCompiledBinary() const { return mCompiledBinary; }
@@ -122,6 +129,7 @@ class ShaderState final : angle::NonCopyable
     std::string mTranslatedSource;
     sh::BinaryBlob mCompiledBinary;
     std::string mSource;
+    ShaderHash mSourceHash;
 
     sh::WorkGroupSize mLocalSize;
 
@@ -236,6 +244,7 @@ class Shader final : angle::NonCopyable, public LabeledObject
     GLenum getTessGenPointMode();
 
     const std::string &getCompilerResourcesString() const;
+    const ShaderHash &getCompilerResourcesHash() const { return mCompilerResourcesHash; }
 
     const ShaderState &getState() const { return mState; }
 
@@ -271,6 +280,7 @@ class Shader final : angle::NonCopyable, public LabeledObject
     BindingPointer<Compiler> mBoundCompiler;
     std::unique_ptr<CompilingState> mCompilingState;
     std::string mCompilerResourcesString;
+    ShaderHash mCompilerResourcesHash;
 
     ShaderProgramManager *mResourceManager;
 
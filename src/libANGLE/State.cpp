@@ -1293,6 +1293,10 @@ void State::setEnableFeature(GLenum feature, bool enabled)
 
     // GLES1 emulation. Need to separate from main switch due to conflict enum between
     // GL_CLIP_DISTANCE0_EXT & GL_CLIP_PLANE0
+    const bool isTextureEnable = feature == GL_TEXTURE_2D || feature == GL_TEXTURE_CUBE_MAP;
+    mGLES1State.setDirty(isTextureEnable ? GLES1State::DIRTY_GLES1_TEXTURE_UNIT_ENABLE
+                                         : GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
+
     switch (feature)
     {
         case GL_ALPHA_TEST:
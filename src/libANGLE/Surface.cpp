@@ -18,6 +18,7 @@
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/Texture.h"
 #include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/EGLImplFactory.h"
 #include "libANGLE/trace.h"
 
@@ -343,6 +344,7 @@ Error Surface::postSubBuffer(const gl::Context *context,
         return egl::NoError();
     }
 
+    context->getImplementation()->onPreSwap(context);
     context->getState().getOverlay()->onSwap();
 
     ANGLE_TRY(mImplementation->postSubBuffer(context, x, y, width, height));
@@ -918,3 +918,18 @@ GLsizeiptr GetBoundBufferAvailableSize(const OffsetBindingPointer<Buffer> &bindi
 }
 
 }  // namespace gl
+
+namespace angle
+{
+PerfMonitorCounter::PerfMonitorCounter() : value(0) {}
+
+PerfMonitorCounter::PerfMonitorCounter(const PerfMonitorCounter &other) = default;
+
+PerfMonitorCounter::~PerfMonitorCounter() = default;
+
+PerfMonitorCounterGroup::PerfMonitorCounterGroup() = default;
+
+PerfMonitorCounterGroup::PerfMonitorCounterGroup(const PerfMonitorCounterGroup &other) = default;
+
+PerfMonitorCounterGroup::~PerfMonitorCounterGroup() = default;
+}  // namespace angle
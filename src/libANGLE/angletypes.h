@@ -23,7 +23,9 @@
 
 #include <bitset>
 #include <map>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace gl
 {
@@ -1111,6 +1113,40 @@ class UniqueObjectPointerBase : angle::NonCopyable
 template <typename ObjT, typename ContextT>
 using UniqueObjectPointer = UniqueObjectPointerBase<ObjT, DestroyThenDelete<ObjT, ContextT>>;
 
+// GL_AMD_performance_monitor counters are supplied by the back end.  They are all unsigned 64-bit
+// integers that only ever increase, so a monitor's result is the difference between the values at
+// EndPerfMonitorAMD and BeginPerfMonitorAMD.
+struct PerfMonitorCounter
+{
+    PerfMonitorCounter();
+    PerfMonitorCounter(const PerfMonitorCounter &other);
+    ~PerfMonitorCounter();
+
+    std::string name;
+    uint64_t value;
+};
+using PerfMonitorCounters = std::vector<PerfMonitorCounter>;
+
+struct PerfMonitorCounterGroup
+{
+    PerfMonitorCounterGroup();
+    PerfMonitorCounterGroup(const PerfMonitorCounterGroup &other);
+    ~PerfMonitorCounterGroup();
+
+    std::string name;
+    PerfMonitorCounters counters;
+};
+using PerfMonitorCounterGroups = std::vector<PerfMonitorCounterGroup>;
+
+// The layout of each counter in the GL_PERFMON_RESULT_AMD data.
+struct PerfMonitorTriplet
+{
+    uint32_t group;
+    uint32_t counter;
+    uint64_t value;
+};
+static_assert(sizeof(PerfMonitorTriplet) == 4 * sizeof(uint32_t), "Unexpected triplet size");
+
 }  // namespace angle
 
 namespace gl
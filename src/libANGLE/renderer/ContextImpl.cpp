@@ -9,6 +9,7 @@
 
 #include "libANGLE/renderer/ContextImpl.h"
 
+#include "anglebase/no_destructor.h"
 #include "libANGLE/Context.h"
 
 namespace rx
@@ -65,4 +66,10 @@ egl::Error ContextImpl::reacquireHighPowerGPU(gl::Context *)
     return egl::NoError();
 }
 
+const angle::PerfMonitorCounterGroups &ContextImpl::getPerfMonitorCounters()
+{
+    static angle::base::NoDestructor<angle::PerfMonitorCounterGroups> sCounters;
+    return *sCounters;
+}
+
 }  // namespace rx
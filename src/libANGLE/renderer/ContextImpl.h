@@ -196,6 +196,9 @@ class ContextImpl : public GLImplFactory
     virtual angle::Result onMakeCurrent(const gl::Context *context) = 0;
     virtual angle::Result onUnMakeCurrent(const gl::Context *context);
 
+    // Called before the draw surface is presented.
+    virtual void onPreSwap(const gl::Context *context) {}
+
     // Native capabilities, unmodified by gl::Context.
     virtual gl::Caps getNativeCaps() const                         = 0;
     virtual const gl::TextureCapsMap &getNativeTextureCaps() const = 0;
@@ -238,6 +241,10 @@ class ContextImpl : public GLImplFactory
     virtual egl::Error releaseHighPowerGPU(gl::Context *context);
     virtual egl::Error reacquireHighPowerGPU(gl::Context *context);
 
+    // GL_AMD_performance_monitor implementation.  Returns the current values of the back end's
+    // counters, which are grouped the same way each time this is called.
+    virtual const angle::PerfMonitorCounterGroups &getPerfMonitorCounters();
+
   protected:
     const gl::State &mState;
     gl::MemoryProgramCache *mMemoryProgramCache;
@@ -77,13 +77,13 @@ cl_int CLCommandQueueCL::enqueueReadBuffer(const cl::Buffer &buffer,
                                            const cl::EventPtrs &waitEvents,
                                            CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeBuffer                = buffer.getImpl<CLMemoryCL>().getNative();
-    const cl_bool block                      = blocking ? CL_TRUE : CL_FALSE;
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeBuffer             = buffer.getImpl<CLMemoryCL>().getNative();
+    const cl_bool block                   = blocking ? CL_TRUE : CL_FALSE;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode =
         mNative->getDispatch().clEnqueueReadBuffer(mNative, nativeBuffer, block, offset, size, ptr,
@@ -101,13 +101,13 @@ cl_int CLCommandQueueCL::enqueueWriteBuffer(const cl::Buffer &buffer,
                                             const cl::EventPtrs &waitEvents,
                                             CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeBuffer                = buffer.getImpl<CLMemoryCL>().getNative();
-    const cl_bool block                      = blocking ? CL_TRUE : CL_FALSE;
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeBuffer             = buffer.getImpl<CLMemoryCL>().getNative();
+    const cl_bool block                   = blocking ? CL_TRUE : CL_FALSE;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode =
         mNative->getDispatch().clEnqueueWriteBuffer(mNative, nativeBuffer, block, offset, size, ptr,
@@ -130,13 +130,13 @@ cl_int CLCommandQueueCL::enqueueReadBufferRect(const cl::Buffer &buffer,
                                                const cl::EventPtrs &waitEvents,
                                                CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeBuffer                = buffer.getImpl<CLMemoryCL>().getNative();
-    const cl_bool block                      = blocking ? CL_TRUE : CL_FALSE;
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeBuffer             = buffer.getImpl<CLMemoryCL>().getNative();
+    const cl_bool block                   = blocking ? CL_TRUE : CL_FALSE;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueReadBufferRect(
         mNative, nativeBuffer, block, bufferOrigin, hostOrigin, region, bufferRowPitch,
@@ -160,13 +160,13 @@ cl_int CLCommandQueueCL::enqueueWriteBufferRect(const cl::Buffer &buffer,
                                                 const cl::EventPtrs &waitEvents,
                                                 CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeBuffer                = buffer.getImpl<CLMemoryCL>().getNative();
-    const cl_bool block                      = blocking ? CL_TRUE : CL_FALSE;
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeBuffer             = buffer.getImpl<CLMemoryCL>().getNative();
+    const cl_bool block                   = blocking ? CL_TRUE : CL_FALSE;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueWriteBufferRect(
         mNative, nativeBuffer, block, bufferOrigin, hostOrigin, region, bufferRowPitch,
@@ -185,13 +185,13 @@ cl_int CLCommandQueueCL::enqueueCopyBuffer(const cl::Buffer &srcBuffer,
                                            const cl::EventPtrs &waitEvents,
                                            CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeSrc                   = srcBuffer.getImpl<CLMemoryCL>().getNative();
-    const cl_mem nativeDst                   = dstBuffer.getImpl<CLMemoryCL>().getNative();
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeSrc                = srcBuffer.getImpl<CLMemoryCL>().getNative();
+    const cl_mem nativeDst                = dstBuffer.getImpl<CLMemoryCL>().getNative();
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueCopyBuffer(
         mNative, nativeSrc, nativeDst, srcOffset, dstOffset, size, numEvents, nativeEventsPtr,
@@ -213,13 +213,13 @@ cl_int CLCommandQueueCL::enqueueCopyBufferRect(const cl::Buffer &srcBuffer,
                                                const cl::EventPtrs &waitEvents,
                                                CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeSrc                   = srcBuffer.getImpl<CLMemoryCL>().getNative();
-    const cl_mem nativeDst                   = dstBuffer.getImpl<CLMemoryCL>().getNative();
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeSrc                = srcBuffer.getImpl<CLMemoryCL>().getNative();
+    const cl_mem nativeDst                = dstBuffer.getImpl<CLMemoryCL>().getNative();
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueCopyBufferRect(
         mNative, nativeSrc, nativeDst, srcOrigin, dstOrigin, region, srcRowPitch, srcSlicePitch,
@@ -237,12 +237,12 @@ cl_int CLCommandQueueCL::enqueueFillBuffer(const cl::Buffer &buffer,
                                            const cl::EventPtrs &waitEvents,
                                            CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeBuffer                = buffer.getImpl<CLMemoryCL>().getNative();
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeBuffer             = buffer.getImpl<CLMemoryCL>().getNative();
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueFillBuffer(
         mNative, nativeBuffer, pattern, patternSize, offset, size, numEvents, nativeEventsPtr,
@@ -261,13 +261,13 @@ void *CLCommandQueueCL::enqueueMapBuffer(const cl::Buffer &buffer,
                                          CLEventImpl::CreateFunc *eventCreateFunc,
                                          cl_int &errorCode)
 {
-    const cl_mem nativeBuffer                = buffer.getImpl<CLMemoryCL>().getNative();
-    const cl_bool block                      = blocking ? CL_TRUE : CL_FALSE;
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeBuffer             = buffer.getImpl<CLMemoryCL>().getNative();
+    const cl_bool block                   = blocking ? CL_TRUE : CL_FALSE;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     void *const map = mNative->getDispatch().clEnqueueMapBuffer(
         mNative, nativeBuffer, block, mapFlags.get(), offset, size, numEvents, nativeEventsPtr,
@@ -287,13 +287,13 @@ cl_int CLCommandQueueCL::enqueueReadImage(const cl::Image &image,
                                           const cl::EventPtrs &waitEvents,
                                           CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeImage                 = image.getImpl<CLMemoryCL>().getNative();
-    const cl_bool block                      = blocking ? CL_TRUE : CL_FALSE;
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeImage              = image.getImpl<CLMemoryCL>().getNative();
+    const cl_bool block                   = blocking ? CL_TRUE : CL_FALSE;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueReadImage(
         mNative, nativeImage, block, origin, region, rowPitch, slicePitch, ptr, numEvents,
@@ -313,13 +313,13 @@ cl_int CLCommandQueueCL::enqueueWriteImage(const cl::Image &image,
                                            const cl::EventPtrs &waitEvents,
                                            CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeImage                 = image.getImpl<CLMemoryCL>().getNative();
-    const cl_bool block                      = blocking ? CL_TRUE : CL_FALSE;
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeImage              = image.getImpl<CLMemoryCL>().getNative();
+    const cl_bool block                   = blocking ? CL_TRUE : CL_FALSE;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueWriteImage(
         mNative, nativeImage, block, origin, region, inputRowPitch, inputSlicePitch, ptr, numEvents,
@@ -337,13 +337,13 @@ cl_int CLCommandQueueCL::enqueueCopyImage(const cl::Image &srcImage,
                                           const cl::EventPtrs &waitEvents,
                                           CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeSrc                   = srcImage.getImpl<CLMemoryCL>().getNative();
-    const cl_mem nativeDst                   = dstImage.getImpl<CLMemoryCL>().getNative();
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeSrc                = srcImage.getImpl<CLMemoryCL>().getNative();
+    const cl_mem nativeDst                = dstImage.getImpl<CLMemoryCL>().getNative();
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueCopyImage(
         mNative, nativeSrc, nativeDst, srcOrigin, dstOrigin, region, numEvents, nativeEventsPtr,
@@ -360,12 +360,12 @@ cl_int CLCommandQueueCL::enqueueFillImage(const cl::Image &image,
                                           const cl::EventPtrs &waitEvents,
                                           CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeImage                 = image.getImpl<CLMemoryCL>().getNative();
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeImage              = image.getImpl<CLMemoryCL>().getNative();
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode =
         mNative->getDispatch().clEnqueueFillImage(mNative, nativeImage, fillColor, origin, region,
@@ -383,13 +383,13 @@ cl_int CLCommandQueueCL::enqueueCopyImageToBuffer(const cl::Image &srcImage,
                                                   const cl::EventPtrs &waitEvents,
                                                   CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeSrc                   = srcImage.getImpl<CLMemoryCL>().getNative();
-    const cl_mem nativeDst                   = dstBuffer.getImpl<CLMemoryCL>().getNative();
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeSrc                = srcImage.getImpl<CLMemoryCL>().getNative();
+    const cl_mem nativeDst                = dstBuffer.getImpl<CLMemoryCL>().getNative();
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueCopyImageToBuffer(
         mNative, nativeSrc, nativeDst, srcOrigin, region, dstOffset, numEvents, nativeEventsPtr,
@@ -407,13 +407,13 @@ cl_int CLCommandQueueCL::enqueueCopyBufferToImage(const cl::Buffer &srcBuffer,
                                                   const cl::EventPtrs &waitEvents,
                                                   CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeSrc                   = srcBuffer.getImpl<CLMemoryCL>().getNative();
-    const cl_mem nativeDst                   = dstImage.getImpl<CLMemoryCL>().getNative();
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeSrc                = srcBuffer.getImpl<CLMemoryCL>().getNative();
+    const cl_mem nativeDst                = dstImage.getImpl<CLMemoryCL>().getNative();
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueCopyBufferToImage(
         mNative, nativeSrc, nativeDst, srcOffset, dstOrigin, region, numEvents, nativeEventsPtr,
@@ -434,13 +434,13 @@ void *CLCommandQueueCL::enqueueMapImage(const cl::Image &image,
                                         CLEventImpl::CreateFunc *eventCreateFunc,
                                         cl_int &errorCode)
 {
-    const cl_mem nativeImage                 = image.getImpl<CLMemoryCL>().getNative();
-    const cl_bool block                      = blocking ? CL_TRUE : CL_FALSE;
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeImage              = image.getImpl<CLMemoryCL>().getNative();
+    const cl_bool block                   = blocking ? CL_TRUE : CL_FALSE;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     void *const map = mNative->getDispatch().clEnqueueMapImage(
         mNative, nativeImage, block, mapFlags.get(), origin, region, imageRowPitch, imageSlicePitch,
@@ -463,12 +463,12 @@ cl_int CLCommandQueueCL::enqueueUnmapMemObject(const cl::Memory &memory,
                                                const cl::EventPtrs &waitEvents,
                                                CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_mem nativeMemory                = memory.getImpl<CLMemoryCL>().getNative();
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_mem nativeMemory             = memory.getImpl<CLMemoryCL>().getNative();
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueUnmapMemObject(
         mNative, nativeMemory, mappedPtr, numEvents, nativeEventsPtr, nativeEventPtr);
@@ -488,12 +488,12 @@ cl_int CLCommandQueueCL::enqueueMigrateMemObjects(const cl::MemoryPtrs &memObjec
     {
         nativeMemories.emplace_back(memory->getImpl<CLMemoryCL>().getNative());
     }
-    const cl_uint numMemories                = static_cast<cl_uint>(nativeMemories.size());
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_uint numMemories             = static_cast<cl_uint>(nativeMemories.size());
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueMigrateMemObjects(
         mNative, numMemories, nativeMemories.data(), flags.get(), numEvents, nativeEventsPtr,
@@ -511,12 +511,12 @@ cl_int CLCommandQueueCL::enqueueNDRangeKernel(const cl::Kernel &kernel,
                                               const cl::EventPtrs &waitEvents,
                                               CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_kernel nativeKernel             = kernel.getImpl<CLKernelCL>().getNative();
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_kernel nativeKernel          = kernel.getImpl<CLKernelCL>().getNative();
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueNDRangeKernel(
         mNative, nativeKernel, workDim, globalWorkOffset, globalWorkSize, localWorkSize, numEvents,
@@ -530,12 +530,12 @@ cl_int CLCommandQueueCL::enqueueTask(const cl::Kernel &kernel,
                                      const cl::EventPtrs &waitEvents,
                                      CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const cl_kernel nativeKernel             = kernel.getImpl<CLKernelCL>().getNative();
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const cl_kernel nativeKernel          = kernel.getImpl<CLKernelCL>().getNative();
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueTask(mNative, nativeKernel, numEvents,
                                                                   nativeEventsPtr, nativeEventPtr);
@@ -586,11 +586,11 @@ cl_int CLCommandQueueCL::enqueueNativeKernel(cl::UserFunc userFunc,
     const cl_mem *const nativeBuffersPtr = nativeBuffers.empty() ? nullptr : nativeBuffers.data();
     const void **const locsPtr           = locs.empty() ? nullptr : locs.data();
 
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueNativeKernel(
         mNative, userFunc, args, cbArgs, numBuffers, nativeBuffersPtr, locsPtr, numEvents,
@@ -603,11 +603,11 @@ cl_int CLCommandQueueCL::enqueueNativeKernel(cl::UserFunc userFunc,
 cl_int CLCommandQueueCL::enqueueMarkerWithWaitList(const cl::EventPtrs &waitEvents,
                                                    CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueMarkerWithWaitList(
         mNative, numEvents, nativeEventsPtr, nativeEventPtr);
@@ -633,8 +633,8 @@ cl_int CLCommandQueueCL::enqueueMarker(CLEventImpl::CreateFunc &eventCreateFunc)
 
 cl_int CLCommandQueueCL::enqueueWaitForEvents(const cl::EventPtrs &events)
 {
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(events);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
+    const CLNativeEvents nativeEvents = CLEventCL::Cast(events);
+    const cl_uint numEvents           = static_cast<cl_uint>(nativeEvents.size());
 
     return mNative->getDispatch().clEnqueueWaitForEvents(mNative, numEvents, nativeEvents.data());
 }
@@ -642,11 +642,11 @@ cl_int CLCommandQueueCL::enqueueWaitForEvents(const cl::EventPtrs &events)
 cl_int CLCommandQueueCL::enqueueBarrierWithWaitList(const cl::EventPtrs &waitEvents,
                                                     CLEventImpl::CreateFunc *eventCreateFunc)
 {
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(waitEvents);
-    const cl_uint numEvents                  = static_cast<cl_uint>(nativeEvents.size());
-    const cl_event *const nativeEventsPtr    = nativeEvents.empty() ? nullptr : nativeEvents.data();
-    cl_event nativeEvent                     = nullptr;
-    cl_event *const nativeEventPtr           = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
+    const CLNativeEvents nativeEvents     = CLEventCL::Cast(waitEvents);
+    const cl_uint numEvents               = static_cast<cl_uint>(nativeEvents.size());
+    const cl_event *const nativeEventsPtr = nativeEvents.empty() ? nullptr : nativeEvents.data();
+    cl_event nativeEvent                  = nullptr;
+    cl_event *const nativeEventPtr        = eventCreateFunc != nullptr ? &nativeEvent : nullptr;
 
     const cl_int errorCode = mNative->getDispatch().clEnqueueBarrierWithWaitList(
         mNative, numEvents, nativeEventsPtr, nativeEventPtr);
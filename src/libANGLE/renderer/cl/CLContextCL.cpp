@@ -346,7 +346,7 @@ CLEventImpl::Ptr CLContextCL::createUserEvent(const cl::Event &event, cl_int &er
 
 cl_int CLContextCL::waitForEvents(const cl::EventPtrs &events)
 {
-    const std::vector<cl_event> nativeEvents = CLEventCL::Cast(events);
+    const CLNativeEvents nativeEvents = CLEventCL::Cast(events);
     return mNative->getDispatch().clWaitForEvents(static_cast<cl_uint>(nativeEvents.size()),
                                                   nativeEvents.data());
 }
@@ -50,10 +50,9 @@ cl_int CLEventCL::getProfilingInfo(cl::ProfilingInfo name,
                                                           value, valueSizeRet);
 }
 
-std::vector<cl_event> CLEventCL::Cast(const cl::EventPtrs &events)
+CLNativeEvents CLEventCL::Cast(const cl::EventPtrs &events)
 {
-    std::vector<cl_event> nativeEvents;
-    nativeEvents.reserve(events.size());
+    CLNativeEvents nativeEvents;
     for (const cl::EventPtr &event : events)
     {
         nativeEvents.emplace_back(event->getImpl<CLEventCL>().getNative());
@@ -34,7 +34,7 @@ class CLEventCL : public CLEventImpl
                             void *value,
                             size_t *valueSizeRet) override;
 
-    static std::vector<cl_event> Cast(const cl::EventPtrs &events);
+    static CLNativeEvents Cast(const cl::EventPtrs &events);
 
   private:
     static void CL_CALLBACK Callback(cl_event event, cl_int commandStatus, void *userData);
@@ -131,9 +131,19 @@ cl_int CLKernelCL::setArg(cl_uint argIndex, size_t argSize, const void *argValue
     void *value = nullptr;
     if (argValue != nullptr)
     {
+        // Only arguments which may be CL objects are looked up in the context, since each lookup
+        // takes a lock. Without argument info, any argument of the size of a handle may be one.
+        using ArgType         = cl::Kernel::ArgType;
+        const ArgType argType = mKernel.getArgType(argIndex);
+        const bool isUnknown  = argType == ArgType::Unknown;
+        const bool mayBeMemory =
+            isUnknown || argType == ArgType::Memory || argType == ArgType::Image;
+        const bool mayBeSampler     = isUnknown || argType == ArgType::Sampler;
+        const bool mayBeDeviceQueue = isUnknown || argType == ArgType::DeviceQueue;
+
         // If argument is a CL object, fetch the mapped value
         const CLContextCL &ctx = mKernel.getProgram().getContext().getImpl<CLContextCL>();
-        if (argSize == sizeof(cl_mem))
+        if (mayBeMemory && argSize == sizeof(cl_mem))
         {
             cl_mem memory = *static_cast<const cl_mem *>(argValue);
             if (ctx.hasMemory(memory))
@@ -141,7 +151,7 @@ cl_int CLKernelCL::setArg(cl_uint argIndex, size_t argSize, const void *argValue
                 value = memory->cast<cl::Memory>().getImpl<CLMemoryCL>().getNative();
             }
         }
-        if (value == nullptr && argSize == sizeof(cl_sampler))
+        if (value == nullptr && mayBeSampler && argSize == sizeof(cl_sampler))
         {
             cl_sampler sampler = *static_cast<const cl_sampler *>(argValue);
             if (ctx.hasSampler(sampler))
@@ -149,7 +159,7 @@ cl_int CLKernelCL::setArg(cl_uint argIndex, size_t argSize, const void *argValue
                 value = sampler->cast<cl::Sampler>().getImpl<CLSamplerCL>().getNative();
             }
         }
-        if (value == nullptr && argSize == sizeof(cl_command_queue))
+        if (value == nullptr && mayBeDeviceQueue && argSize == sizeof(cl_command_queue))
         {
             cl_command_queue queue = *static_cast<const cl_command_queue *>(argValue);
             if (ctx.hasDeviceQueue(queue))
@@ -23,6 +23,8 @@ class CLPlatformCL;
 class CLProgramCL;
 class CLSamplerCL;
 
+using CLNativeEvents = angle::FastVector<cl_event, cl::kInlineEventCount>;
+
 }  // namespace rx
 
 #endif  // LIBANGLE_RENDERER_CL_CL_TYPES_H_
@@ -303,6 +303,7 @@ angle::Result BlitGL::copySubImageToLUMAWorkaroundTexture(const gl::Context *con
                                                           const gl::Rectangle &sourceArea,
                                                           gl::Framebuffer *source)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     ANGLE_TRY(initializeResources(context));
 
     BlitProgram *blitProgram = nullptr;
@@ -404,6 +405,7 @@ angle::Result BlitGL::blitColorBufferWithShader(const gl::Context *context,
                                                 GLenum filter,
                                                 bool writeAlpha)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     ANGLE_TRY(initializeResources(context));
     mStateManager->bindFramebuffer(GL_FRAMEBUFFER, mScratchFBO);
     ANGLE_GL_TRY(context, mFunctions->framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
@@ -443,6 +445,7 @@ angle::Result BlitGL::blitColorBufferWithShader(const gl::Context *context,
                                                 GLenum filter,
                                                 bool writeAlpha)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     ANGLE_TRY(initializeResources(context));
 
     BlitProgram *blitProgram = nullptr;
@@ -577,6 +580,7 @@ angle::Result BlitGL::copySubTexture(const gl::Context *context,
     ASSERT(source->getType() == gl::TextureType::_2D ||
            source->getType() == gl::TextureType::External ||
            source->getType() == gl::TextureType::Rectangle);
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     ANGLE_TRY(initializeResources(context));
 
     // Make sure the destination texture can be rendered to before setting anything else up.  Some
@@ -690,6 +694,7 @@ angle::Result BlitGL::copySubTextureCPUReadback(const gl::Context *context,
                                                 bool unpackPremultiplyAlpha,
                                                 bool unpackUnmultiplyAlpha)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     ANGLE_TRY(initializeResources(context));
 
     ContextGL *contextGL = GetImplAs<ContextGL>(context);
@@ -829,6 +834,7 @@ angle::Result BlitGL::copyTexSubImage(const gl::Context *context,
                                       const gl::Offset &destOffset,
                                       bool *copySucceededOut)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     ANGLE_TRY(initializeResources(context));
 
     // Make sure the source texture can create a complete framebuffer before continuing.
@@ -861,6 +867,7 @@ angle::Result BlitGL::clearRenderableTexture(const gl::Context *context,
                                              const gl::ImageIndex &imageIndex,
                                              bool *clearSucceededOut)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     ANGLE_TRY(initializeResources(context));
 
     ClearBindTargetVector bindTargets;
@@ -965,6 +972,7 @@ angle::Result BlitGL::clearRenderbuffer(const gl::Context *context,
                                         RenderbufferGL *source,
                                         GLenum sizedInternalFormat)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     ANGLE_TRY(initializeResources(context));
 
     ClearBindTargetVector bindTargets;
@@ -997,6 +1005,7 @@ angle::Result BlitGL::clearRenderbuffer(const gl::Context *context,
 angle::Result BlitGL::clearFramebuffer(const gl::Context *context, FramebufferGL *source)
 {
     // initializeResources skipped because no local state is used
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
 
     // Clear all attachments
     GLbitfield clearMask = 0;
@@ -1016,6 +1025,7 @@ angle::Result BlitGL::clearRenderableTextureAlphaToOne(const gl::Context *contex
     // Clearing the alpha of 3D textures is not supported/needed yet.
     ASSERT(nativegl::UseTexImage2D(TextureTargetToType(target)));
 
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     ANGLE_TRY(initializeResources(context));
 
     mStateManager->setClearColor(gl::ColorF(0.0f, 0.0f, 0.0f, 1.0f));
@@ -1041,6 +1051,7 @@ angle::Result BlitGL::generateSRGBMipmap(const gl::Context *context,
                                          GLuint levelCount,
                                          const gl::Extents &sourceBaseLevelSize)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     ANGLE_TRY(initializeResources(context));
 
     const gl::TextureType sourceType     = gl::TextureType::_2D;
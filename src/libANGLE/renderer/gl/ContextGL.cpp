@@ -208,11 +208,13 @@ OverlayImpl *ContextGL::createOverlay(const gl::OverlayState &state)
 
 angle::Result ContextGL::flush(const gl::Context *context)
 {
+    ANGLE_TRY(flushPendingDraws(context));
     return mRenderer->flush();
 }
 
 angle::Result ContextGL::finish(const gl::Context *context)
 {
+    ANGLE_TRY(flushPendingDraws(context));
     return mRenderer->finish();
 }
 
@@ -319,8 +321,21 @@ angle::Result ContextGL::drawArrays(const gl::Context *context,
     validateState();
 #endif
 
+    // Client data is streamed for every draw, so those draws are not batched.
+    StateManagerGL *stateManager = mRenderer->getStateManager();
+    const bool batchDraw         = !usesMultiview && stateManager->canBatchDrawArrays() &&
+                           !context->getStateCache().hasAnyActiveClientAttrib();
+    if (!batchDraw)
+    {
+        ANGLE_TRY(flushPendingDraws(context));
+    }
+
     ANGLE_TRY(setDrawArraysState(context, first, count, instanceCount));
-    if (!usesMultiview)
+    if (batchDraw)
+    {
+        ANGLE_TRY(stateManager->addPendingDrawArrays(context, mode, first, count));
+    }
+    else if (!usesMultiview)
     {
         ANGLE_GL_TRY(context, getFunctions()->drawArrays(ToGLenum(mode), first, count));
     }
@@ -340,6 +355,8 @@ angle::Result ContextGL::drawArraysInstanced(const gl::Context *context,
                                              GLsizei count,
                                              GLsizei instanceCount)
 {
+    ANGLE_TRY(flushPendingDraws(context));
+
     GLsizei adjustedInstanceCount = instanceCount;
     const gl::Program *program    = context->getState().getProgram();
     if (program->usesMultiview())
@@ -439,6 +456,8 @@ angle::Result ContextGL::drawArraysInstancedBaseInstance(const gl::Context *cont
                                                          GLsizei instanceCount,
                                                          GLuint baseInstance)
 {
+    ANGLE_TRY(flushPendingDraws(context));
+
     GLsizei adjustedInstanceCount = instanceCount;
     const gl::Program *program    = context->getState().getProgram();
     if (program->usesMultiview())
@@ -478,6 +497,13 @@ angle::Result ContextGL::drawArraysInstancedBaseInstance(const gl::Context *cont
     return angle::Result::Continue;
 }
 
+ANGLE_INLINE bool ContextGL::canBatchDrawElements(const gl::Context *context) const
+{
+    // Indices in client memory are streamed for every draw too.
+    return !context->getStateCache().hasAnyActiveClientAttrib() &&
+           context->getState().getVertexArray()->getElementArrayBuffer() != nullptr;
+}
+
 angle::Result ContextGL::drawElements(const gl::Context *context,
                                       gl::PrimitiveMode mode,
                                       GLsizei count,
@@ -494,8 +520,21 @@ angle::Result ContextGL::drawElements(const gl::Context *context,
     validateState();
 #endif  // ANGLE_STATE_VALIDATION_ENABLED
 
+    StateManagerGL *stateManager = mRenderer->getStateManager();
+    const bool batchDraw =
+        !usesMultiview && stateManager->canBatchDrawElements(0) && canBatchDrawElements(context);
+    if (!batchDraw)
+    {
+        ANGLE_TRY(flushPendingDraws(context));
+    }
+
     ANGLE_TRY(setDrawElementsState(context, count, type, indices, instanceCount, &drawIndexPtr));
-    if (!usesMultiview)
+    if (batchDraw)
+    {
+        ANGLE_TRY(
+            stateManager->addPendingDrawElements(context, mode, count, type, drawIndexPtr, 0));
+    }
+    else if (!usesMultiview)
     {
         ANGLE_GL_TRY(context, getFunctions()->drawElements(ToGLenum(mode), count, ToGLenum(type),
                                                            drawIndexPtr));
@@ -528,8 +567,22 @@ angle::Result ContextGL::drawElementsBaseVertex(const gl::Context *context,
     validateState();
 #endif  // ANGLE_STATE_VALIDATION_ENABLED
 
+    StateManagerGL *stateManager = mRenderer->getStateManager();
+    const bool batchDraw         = !usesMultiview &&
+                           stateManager->canBatchDrawElements(baseVertex) &&
+                           canBatchDrawElements(context);
+    if (!batchDraw)
+    {
+        ANGLE_TRY(flushPendingDraws(context));
+    }
+
     ANGLE_TRY(setDrawElementsState(context, count, type, indices, instanceCount, &drawIndexPtr));
-    if (!usesMultiview)
+    if (batchDraw)
+    {
+        ANGLE_TRY(stateManager->addPendingDrawElements(context, mode, count, type, drawIndexPtr,
+                                                       baseVertex));
+    }
+    else if (!usesMultiview)
     {
         ANGLE_GL_TRY(context, getFunctions()->drawElementsBaseVertex(
                                   ToGLenum(mode), count, ToGLenum(type), drawIndexPtr, baseVertex));
@@ -552,6 +605,8 @@ angle::Result ContextGL::drawElementsInstanced(const gl::Context *context,
                                                const void *indices,
                                                GLsizei instances)
 {
+    ANGLE_TRY(flushPendingDraws(context));
+
     GLsizei adjustedInstanceCount = instances;
     const gl::Program *program    = context->getState().getProgram();
     if (program->usesMultiview())
@@ -576,6 +631,8 @@ angle::Result ContextGL::drawElementsInstancedBaseVertex(const gl::Context *cont
                                                          GLsizei instances,
                                                          GLint baseVertex)
 {
+    ANGLE_TRY(flushPendingDraws(context));
+
     GLsizei adjustedInstanceCount = instances;
     const gl::Program *program    = context->getState().getProgram();
     if (program->usesMultiview())
@@ -603,6 +660,8 @@ angle::Result ContextGL::drawElementsInstancedBaseVertexBaseInstance(const gl::C
                                                                      GLint baseVertex,
                                                                      GLuint baseInstance)
 {
+    ANGLE_TRY(flushPendingDraws(context));
+
     GLsizei adjustedInstanceCount = instances;
     const gl::Program *program    = context->getState().getProgram();
     if (program->usesMultiview())
@@ -650,6 +709,8 @@ angle::Result ContextGL::drawRangeElements(const gl::Context *context,
                                            gl::DrawElementsType type,
                                            const void *indices)
 {
+    ANGLE_TRY(flushPendingDraws(context));
+
     const gl::Program *program   = context->getState().getProgram();
     const bool usesMultiview     = program->usesMultiview();
     const GLsizei instanceCount  = usesMultiview ? program->getNumViews() : 0;
@@ -682,6 +743,8 @@ angle::Result ContextGL::drawRangeElementsBaseVertex(const gl::Context *context,
                                                      const void *indices,
                                                      GLint baseVertex)
 {
+    ANGLE_TRY(flushPendingDraws(context));
+
     const gl::Program *program   = context->getState().getProgram();
     const bool usesMultiview     = program->usesMultiview();
     const GLsizei instanceCount  = usesMultiview ? program->getNumViews() : 0;
@@ -710,6 +773,8 @@ angle::Result ContextGL::drawArraysIndirect(const gl::Context *context,
                                             gl::PrimitiveMode mode,
                                             const void *indirect)
 {
+    ANGLE_TRY(flushPendingDraws(context));
+
     ANGLE_GL_TRY(context, getFunctions()->drawArraysIndirect(ToGLenum(mode), indirect));
     mRenderer->markWorkSubmitted();
 
@@ -721,6 +786,8 @@ angle::Result ContextGL::drawElementsIndirect(const gl::Context *context,
                                               gl::DrawElementsType type,
                                               const void *indirect)
 {
+    ANGLE_TRY(flushPendingDraws(context));
+
     ANGLE_GL_TRY(context,
                  getFunctions()->drawElementsIndirect(ToGLenum(mode), ToGLenum(type), indirect));
     return angle::Result::Continue;
@@ -823,18 +890,21 @@ gl::GraphicsResetStatus ContextGL::getResetStatus()
 
 angle::Result ContextGL::insertEventMarker(GLsizei length, const char *marker)
 {
+    mRenderer->getStateManager()->flushPendingDrawsWithoutContext();
     mRenderer->insertEventMarker(length, marker);
     return angle::Result::Continue;
 }
 
 angle::Result ContextGL::pushGroupMarker(GLsizei length, const char *marker)
 {
+    mRenderer->getStateManager()->flushPendingDrawsWithoutContext();
     mRenderer->pushGroupMarker(length, marker);
     return angle::Result::Continue;
 }
 
 angle::Result ContextGL::popGroupMarker()
 {
+    mRenderer->getStateManager()->flushPendingDrawsWithoutContext();
     mRenderer->popGroupMarker();
     return angle::Result::Continue;
 }
@@ -844,12 +914,14 @@ angle::Result ContextGL::pushDebugGroup(const gl::Context *context,
                                         GLuint id,
                                         const std::string &message)
 {
+    ANGLE_TRY(flushPendingDraws(context));
     mRenderer->pushDebugGroup(source, id, message);
     return angle::Result::Continue;
 }
 
 angle::Result ContextGL::popDebugGroup(const gl::Context *context)
 {
+    ANGLE_TRY(flushPendingDraws(context));
     mRenderer->popDebugGroup();
     return angle::Result::Continue;
 }
@@ -887,6 +959,12 @@ angle::Result ContextGL::onUnMakeCurrent(const gl::Context *context)
     return ContextImpl::onUnMakeCurrent(context);
 }
 
+void ContextGL::onPreSwap(const gl::Context *context)
+{
+    // An error has already been recorded on the context, and the swap goes ahead regardless.
+    (void)flushPendingDraws(context);
+}
+
 gl::Caps ContextGL::getNativeCaps() const
 {
     return mRenderer->getNativeCaps();
@@ -932,20 +1010,24 @@ angle::Result ContextGL::dispatchCompute(const gl::Context *context,
                                          GLuint numGroupsY,
                                          GLuint numGroupsZ)
 {
+    ANGLE_TRY(flushPendingDraws(context));
     return mRenderer->dispatchCompute(context, numGroupsX, numGroupsY, numGroupsZ);
 }
 
 angle::Result ContextGL::dispatchComputeIndirect(const gl::Context *context, GLintptr indirect)
 {
+    ANGLE_TRY(flushPendingDraws(context));
     return mRenderer->dispatchComputeIndirect(context, indirect);
 }
 
 angle::Result ContextGL::memoryBarrier(const gl::Context *context, GLbitfield barriers)
 {
+    ANGLE_TRY(flushPendingDraws(context));
     return mRenderer->memoryBarrier(barriers);
 }
 angle::Result ContextGL::memoryBarrierByRegion(const gl::Context *context, GLbitfield barriers)
 {
+    ANGLE_TRY(flushPendingDraws(context));
     return mRenderer->memoryBarrierByRegion(barriers);
 }
 
@@ -980,4 +1062,32 @@ void ContextGL::markWorkSubmitted()
     mRenderer->markWorkSubmitted();
 }
 
+angle::Result ContextGL::flushPendingDraws(const gl::Context *context)
+{
+    return mRenderer->getStateManager()->flushPendingDraws(context);
+}
+
+const angle::PerfMonitorCounterGroups &ContextGL::getPerfMonitorCounters()
+{
+    if (mPerfMonitorCounters.empty())
+    {
+        mPerfMonitorCounters.resize(1);
+
+        angle::PerfMonitorCounterGroup &drawBatchingGroup = mPerfMonitorCounters[0];
+        drawBatchingGroup.name                            = "gl_draw_batching";
+        drawBatchingGroup.counters.resize(2);
+        drawBatchingGroup.counters[0].name = "multiDrawCalls";
+        drawBatchingGroup.counters[1].name = "nativeDrawCallsSaved";
+    }
+
+    const DrawBatchingPerfCounters &drawBatchingCounters =
+        mRenderer->getStateManager()->getDrawBatchingPerfCounters();
+
+    angle::PerfMonitorCounters &counters = mPerfMonitorCounters[0].counters;
+    counters[0].value                    = drawBatchingCounters.multiDrawCalls;
+    counters[1].value                    = drawBatchingCounters.nativeDrawCallsSaved;
+
+    return mPerfMonitorCounters;
+}
+
 }  // namespace rx
@@ -236,6 +236,7 @@ class ContextGL : public ContextImpl
     // Context switching
     angle::Result onMakeCurrent(const gl::Context *context) override;
     angle::Result onUnMakeCurrent(const gl::Context *context) override;
+    void onPreSwap(const gl::Context *context) override;
 
     // Caps queries
     gl::Caps getNativeCaps() const override;
@@ -271,6 +272,12 @@ class ContextGL : public ContextImpl
 
     void markWorkSubmitted();
 
+    // Submits the draws recorded for batching by StateManagerGL.
+    angle::Result flushPendingDraws(const gl::Context *context);
+
+    // GL_AMD_performance_monitor
+    const angle::PerfMonitorCounterGroups &getPerfMonitorCounters() override;
+
     const gl::Debug &getDebug() const { return mState.getDebug(); }
 
   private:
@@ -286,6 +293,8 @@ class ContextGL : public ContextImpl
                                        GLsizei instanceCount,
                                        const void **outIndices);
 
+    bool canBatchDrawElements(const gl::Context *context) const;
+
     gl::AttributesMask updateAttributesForBaseInstance(const gl::Program *program,
                                                        GLuint baseInstance);
     void resetUpdatedAttributes(gl::AttributesMask attribMask);
@@ -294,6 +303,9 @@ class ContextGL : public ContextImpl
     std::shared_ptr<RendererGL> mRenderer;
 
     RobustnessVideoMemoryPurgeStatus mRobustnessVideoMemoryPurgeStatus;
+
+    // The counters exposed through GL_AMD_performance_monitor, created on first use.
+    angle::PerfMonitorCounterGroups mPerfMonitorCounters;
 };
 
 }  // namespace rx
@@ -31,6 +31,7 @@ angle::Result FenceNVGL::set(const gl::Context *context, GLenum condition)
 {
     ASSERT(condition == GL_ALL_COMPLETED_NV);
     ContextGL *contextGL = GetImplAs<ContextGL>(context);
+    ANGLE_TRY(contextGL->flushPendingDraws(context));
     mFunctions->setFenceNV(mFence, condition);
     contextGL->markWorkSubmitted();
     return angle::Result::Continue;
@@ -72,7 +73,8 @@ angle::Result FenceNVSyncGL::set(const gl::Context *context, GLenum condition)
 {
     ASSERT(condition == GL_ALL_COMPLETED_NV);
     ContextGL *contextGL = GetImplAs<ContextGL>(context);
-    mSyncObject          = mFunctions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    ANGLE_TRY(contextGL->flushPendingDraws(context));
+    mSyncObject = mFunctions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
     ANGLE_CHECK(contextGL, mSyncObject != 0, "glFenceSync failed to create a GLsync object.",
                 GL_OUT_OF_MEMORY);
     contextGL->markWorkSubmitted();
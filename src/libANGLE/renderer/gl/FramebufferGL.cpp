@@ -506,6 +506,7 @@ angle::Result FramebufferGL::clear(const gl::Context *context, GLbitfield mask)
     const FunctionsGL *functions = GetFunctionsGL(context);
     StateManagerGL *stateManager = GetStateManagerGL(context);
 
+    ANGLE_TRY(stateManager->flushPendingDraws(context));
     syncClearState(context, mask);
     stateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
@@ -534,6 +535,7 @@ angle::Result FramebufferGL::clearBufferfv(const gl::Context *context,
     const FunctionsGL *functions = GetFunctionsGL(context);
     StateManagerGL *stateManager = GetStateManagerGL(context);
 
+    ANGLE_TRY(stateManager->flushPendingDraws(context));
     syncClearBufferState(context, buffer, drawbuffer);
     stateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
@@ -563,6 +565,7 @@ angle::Result FramebufferGL::clearBufferuiv(const gl::Context *context,
     const FunctionsGL *functions = GetFunctionsGL(context);
     StateManagerGL *stateManager = GetStateManagerGL(context);
 
+    ANGLE_TRY(stateManager->flushPendingDraws(context));
     syncClearBufferState(context, buffer, drawbuffer);
     stateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
@@ -592,6 +595,7 @@ angle::Result FramebufferGL::clearBufferiv(const gl::Context *context,
     const FunctionsGL *functions = GetFunctionsGL(context);
     StateManagerGL *stateManager = GetStateManagerGL(context);
 
+    ANGLE_TRY(stateManager->flushPendingDraws(context));
     syncClearBufferState(context, buffer, drawbuffer);
     stateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
@@ -622,6 +626,7 @@ angle::Result FramebufferGL::clearBufferfi(const gl::Context *context,
     const FunctionsGL *functions = GetFunctionsGL(context);
     StateManagerGL *stateManager = GetStateManagerGL(context);
 
+    ANGLE_TRY(stateManager->flushPendingDraws(context));
     syncClearBufferState(context, buffer, drawbuffer);
     stateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
@@ -656,6 +661,8 @@ angle::Result FramebufferGL::readPixels(const gl::Context *context,
     const angle::FeaturesGL &features = GetFeaturesGL(context);
     gl::PixelPackState packState      = pack;
 
+    ANGLE_TRY(stateManager->flushPendingDraws(context));
+
     // Clip read area to framebuffer.
     const auto *readAttachment = mState.getReadPixelsAttachment(format);
     const gl::Extents fbSize   = readAttachment->getSize();
@@ -748,6 +755,8 @@ angle::Result FramebufferGL::blit(const gl::Context *context,
     StateManagerGL *stateManager      = GetStateManagerGL(context);
     const angle::FeaturesGL &features = GetFeaturesGL(context);
 
+    ANGLE_TRY(stateManager->flushPendingDraws(context));
+
     const Framebuffer *sourceFramebuffer = context->getState().getReadFramebuffer();
     const Framebuffer *destFramebuffer   = context->getState().getDrawFramebuffer();
 
@@ -8,12 +8,15 @@
 
 #include "libANGLE/renderer/gl/ProgramGL.h"
 
+#include <anglebase/sha1.h>
+
 #include "common/angleutils.h"
 #include "common/bitset_utils.h"
 #include "common/debug.h"
 #include "common/string_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/ProgramLinkedResources.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/WorkerThread.h"
@@ -25,10 +28,38 @@
 #include "libANGLE/renderer/gl/StateManagerGL.h"
 #include "libANGLE/trace.h"
 #include "platform/FeaturesGL.h"
+#include "platform/FrontendFeatures.h"
 #include "platform/PlatformMethods.h"
 
 namespace rx
 {
+namespace
+{
+// Bump when the layout of native binary cache entries changes.
+constexpr char kNativeBinaryKeyTag[] = "ANGLE GL native program binary 1";
+
+template <typename T>
+void HashValue(angle::base::SecureHashAlgorithm *hasher, T value)
+{
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only scalar values can be hashed directly");
+    hasher->Update(&value, sizeof(value));
+}
+
+void HashString(angle::base::SecureHashAlgorithm *hasher, const std::string &str)
+{
+    HashValue(hasher, str.length());
+    hasher->Update(str.c_str(), str.length());
+}
+
+void HashNativeString(angle::base::SecureHashAlgorithm *hasher,
+                      const FunctionsGL *functions,
+                      GLenum name)
+{
+    const GLubyte *str = functions->getString(name);
+    HashString(hasher, str ? reinterpret_cast<const char *>(str) : "");
+}
+}  // anonymous namespace
 
 ProgramGL::ProgramGL(const gl::ProgramState &data,
                      const FunctionsGL *functions,
@@ -115,6 +146,165 @@ void ProgramGL::reapplyUBOBindingsIfNeeded(const gl::Context *context)
     }
 }
 
+std::vector<std::string> ProgramGL::getTransformFeedbackVaryingMappedNames() const
+{
+    std::vector<std::string> transformFeedbackVaryingMappedNames;
+    for (const auto &tfVarying : mState.getTransformFeedbackVaryingNames())
+    {
+        gl::ShaderType tfShaderType =
+            mState.getExecutable().hasLinkedShaderStage(gl::ShaderType::Geometry)
+                ? gl::ShaderType::Geometry
+                : gl::ShaderType::Vertex;
+        std::string tfVaryingMappedName =
+            mState.getAttachedShader(tfShaderType)->getTransformFeedbackVaryingMappedName(tfVarying);
+        transformFeedbackVaryingMappedNames.push_back(tfVaryingMappedName);
+    }
+    return transformFeedbackVaryingMappedNames;
+}
+
+egl::BlobCache *ProgramGL::getNativeBinaryCache(const gl::Context *context) const
+{
+    if (!mFeatures.cacheNativeProgramBinaries.enabled)
+    {
+        return nullptr;
+    }
+
+    // Follow the frontend program cache workarounds.
+    const angle::FrontendFeatures &frontendFeatures = context->getFrontendFeatures();
+    if (frontendFeatures.disableProgramBinary.enabled ||
+        (frontendFeatures.disableProgramCachingForTransformFeedback.enabled &&
+         !mState.getTransformFeedbackVaryingNames().empty()))
+    {
+        return nullptr;
+    }
+
+    // The frontend program cache also holds the native binaries of the programs it caches, but its
+    // keys include the ANGLE version.  The native binaries are keyed by the translated sources and
+    // the driver only, so they are cached for every program: they are only used when the frontend
+    // cache misses, such as after an ANGLE update, or for the programs the frontend skips.
+    egl::BlobCache &blobCache = context->getDisplay()->getBlobCache();
+    return blobCache.isCachingEnabled() ? &blobCache : nullptr;
+}
+
+void ProgramGL::computeNativeBinaryKey(const gl::Context *context,
+                                       egl::BlobCache::Key *keyOut) const
+{
+    angle::base::SecureHashAlgorithm hasher;
+    HashString(&hasher, kNativeBinaryKeyTag);
+
+    // A binary can only be loaded by the driver that produced it.
+    HashNativeString(&hasher, mFunctions, GL_VENDOR);
+    HashNativeString(&hasher, mFunctions, GL_RENDERER);
+    HashNativeString(&hasher, mFunctions, GL_VERSION);
+
+    // The translated sources and every input of the native link that is not part of them.
+    for (const gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        const gl::Shader *shader = mState.getAttachedShader(shaderType);
+        HashValue(&hasher, shader != nullptr);
+        if (shader)
+        {
+            HashString(&hasher, shader->getState().getTranslatedSource());
+        }
+    }
+
+    for (const sh::ShaderVariable &attribute : mState.getProgramInputs())
+    {
+        if (attribute.active && !attribute.isBuiltIn())
+        {
+            HashString(&hasher, attribute.mappedName);
+            HashValue(&hasher, attribute.location);
+        }
+    }
+
+    for (const std::string &tfVaryingMappedName : getTransformFeedbackVaryingMappedNames())
+    {
+        HashString(&hasher, tfVaryingMappedName);
+    }
+    HashValue(&hasher, mState.getTransformFeedbackBufferMode());
+
+    HashValue(&hasher, context->getExtensions().blendFuncExtended);
+    for (const std::vector<gl::VariableLocation> *locations :
+         {&mState.getOutputLocations(), &mState.getSecondaryOutputLocations()})
+    {
+        HashValue(&hasher, locations->size());
+        for (const gl::VariableLocation &location : *locations)
+        {
+            HashValue(&hasher, location.index);
+            HashValue(&hasher, location.arrayIndex);
+            HashValue(&hasher, location.ignored);
+        }
+    }
+
+    HashValue(&hasher, mState.isSeparable());
+
+    hasher.Final();
+    memcpy(keyOut->data(), hasher.Digest(), keyOut->size());
+}
+
+bool ProgramGL::loadNativeBinary(const gl::Context *context,
+                                 egl::BlobCache *cache,
+                                 const egl::BlobCache::Key &key)
+{
+    egl::BlobCache::Value cachedBinary;
+    size_t cachedBinarySize = 0;
+    if (!cache->get(context->getScratchBuffer(), key, &cachedBinary, &cachedBinarySize))
+    {
+        return false;
+    }
+
+    // The blob is the binary format followed by the binary.
+    GLenum binaryFormat = GL_NONE;
+    if (cachedBinarySize <= sizeof(binaryFormat))
+    {
+        cache->remove(key);
+        return false;
+    }
+    memcpy(&binaryFormat, cachedBinary.data(), sizeof(binaryFormat));
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "ProgramGL::loadNativeBinary");
+    mFunctions->programBinary(mProgramID, binaryFormat, cachedBinary.data() + sizeof(binaryFormat),
+                              static_cast<GLsizei>(cachedBinarySize - sizeof(binaryFormat)));
+
+    GLint linkStatus = GL_FALSE;
+    mFunctions->getProgramiv(mProgramID, GL_LINK_STATUS, &linkStatus);
+    if (linkStatus == GL_FALSE)
+    {
+        // Drivers may reject binaries of an older build that reports the same version. The entry
+        // is replaced once the program is linked from source.
+        cache->remove(key);
+        return false;
+    }
+
+    return true;
+}
+
+void ProgramGL::storeNativeBinary(egl::BlobCache *cache, const egl::BlobCache::Key &key)
+{
+    GLint binaryLength = 0;
+    mFunctions->getProgramiv(mProgramID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0)
+    {
+        return;
+    }
+
+    GLenum binaryFormat = GL_NONE;
+    angle::MemoryBuffer blob;
+    if (!blob.resize(sizeof(binaryFormat) + binaryLength))
+    {
+        return;
+    }
+    mFunctions->getProgramBinary(mProgramID, binaryLength, &binaryLength, &binaryFormat,
+                                 blob.data() + sizeof(binaryFormat));
+    if (binaryLength <= 0 || !blob.resize(sizeof(binaryFormat) + binaryLength))
+    {
+        return;
+    }
+    memcpy(blob.data(), &binaryFormat, sizeof(binaryFormat));
+
+    cache->put(key, std::move(blob));
+}
+
 void ProgramGL::setBinaryRetrievableHint(bool retrievable)
 {
     // glProgramParameteri isn't always available on ES backends.
@@ -228,6 +418,34 @@ std::unique_ptr<LinkEvent> ProgramGL::link(const gl::Context *context,
 
     preLink();
 
+    // Look for a native binary of an identical program linked earlier, possibly by another
+    // process or another version of ANGLE.
+    egl::BlobCache *nativeBinaryCache = getNativeBinaryCache(context);
+    egl::BlobCache::Key nativeBinaryKey;
+    if (nativeBinaryCache)
+    {
+        computeNativeBinaryKey(context, &nativeBinaryKey);
+        if (loadNativeBinary(context, nativeBinaryCache, nativeBinaryKey))
+        {
+            if (mFeatures.alwaysCallUseProgramAfterLink.enabled)
+            {
+                mStateManager->forceUseProgram(mProgramID);
+            }
+
+            linkResources(resources);
+            postLink();
+            reapplyUBOBindingsIfNeeded(context);
+
+            return std::make_unique<LinkEventDone>(angle::Result::Continue);
+        }
+
+        // Make sure the binary of the native link below can be retrieved.
+        if (mFunctions->programParameteri)
+        {
+            mFunctions->programParameteri(mProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+    }
+
     if (mState.getAttachedShader(gl::ShaderType::Compute))
     {
         const ShaderGL *computeShaderGL =
@@ -238,18 +456,8 @@ std::unique_ptr<LinkEvent> ProgramGL::link(const gl::Context *context,
     else
     {
         // Set the transform feedback state
-        std::vector<std::string> transformFeedbackVaryingMappedNames;
-        for (const auto &tfVarying : mState.getTransformFeedbackVaryingNames())
-        {
-            gl::ShaderType tfShaderType =
-                mState.getExecutable().hasLinkedShaderStage(gl::ShaderType::Geometry)
-                    ? gl::ShaderType::Geometry
-                    : gl::ShaderType::Vertex;
-            std::string tfVaryingMappedName =
-                mState.getAttachedShader(tfShaderType)
-                    ->getTransformFeedbackVaryingMappedName(tfVarying);
-            transformFeedbackVaryingMappedNames.push_back(tfVaryingMappedName);
-        }
+        const std::vector<std::string> transformFeedbackVaryingMappedNames =
+            getTransformFeedbackVaryingMappedNames();
 
         if (transformFeedbackVaryingMappedNames.empty())
         {
@@ -429,8 +637,9 @@ std::unique_ptr<LinkEvent> ProgramGL::link(const gl::Context *context,
         return false;
     });
 
-    auto postLinkImplTask = [this, &infoLog, &resources](bool fallbackToMainContext,
-                                                         const std::string &workerInfoLog) {
+    auto postLinkImplTask = [this, context, &infoLog, &resources, nativeBinaryCache,
+                             nativeBinaryKey](bool fallbackToMainContext,
+                                              const std::string &workerInfoLog) {
         infoLog << workerInfoLog;
         if (fallbackToMainContext)
         {
@@ -470,6 +679,12 @@ std::unique_ptr<LinkEvent> ProgramGL::link(const gl::Context *context,
         linkResources(resources);
         postLink();
 
+        if (nativeBinaryCache)
+        {
+            storeNativeBinary(nativeBinaryCache, nativeBinaryKey);
+            reapplyUBOBindingsIfNeeded(context);
+        }
+
         return angle::Result::Continue;
     };
 
@@ -499,6 +714,7 @@ GLboolean ProgramGL::validate(const gl::Caps & /*caps*/, gl::InfoLog * /*infoLog
 
 void ProgramGL::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform1fv != nullptr)
     {
         mFunctions->programUniform1fv(mProgramID, uniLoc(location), count, v);
@@ -512,6 +728,7 @@ void ProgramGL::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
 
 void ProgramGL::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform2fv != nullptr)
     {
         mFunctions->programUniform2fv(mProgramID, uniLoc(location), count, v);
@@ -525,6 +742,7 @@ void ProgramGL::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
 
 void ProgramGL::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform3fv != nullptr)
     {
         mFunctions->programUniform3fv(mProgramID, uniLoc(location), count, v);
@@ -538,6 +756,7 @@ void ProgramGL::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
 
 void ProgramGL::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform4fv != nullptr)
     {
         mFunctions->programUniform4fv(mProgramID, uniLoc(location), count, v);
@@ -551,6 +770,7 @@ void ProgramGL::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
 
 void ProgramGL::setUniform1iv(GLint location, GLsizei count, const GLint *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform1iv != nullptr)
     {
         mFunctions->programUniform1iv(mProgramID, uniLoc(location), count, v);
@@ -564,6 +784,7 @@ void ProgramGL::setUniform1iv(GLint location, GLsizei count, const GLint *v)
 
 void ProgramGL::setUniform2iv(GLint location, GLsizei count, const GLint *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform2iv != nullptr)
     {
         mFunctions->programUniform2iv(mProgramID, uniLoc(location), count, v);
@@ -577,6 +798,7 @@ void ProgramGL::setUniform2iv(GLint location, GLsizei count, const GLint *v)
 
 void ProgramGL::setUniform3iv(GLint location, GLsizei count, const GLint *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform3iv != nullptr)
     {
         mFunctions->programUniform3iv(mProgramID, uniLoc(location), count, v);
@@ -590,6 +812,7 @@ void ProgramGL::setUniform3iv(GLint location, GLsizei count, const GLint *v)
 
 void ProgramGL::setUniform4iv(GLint location, GLsizei count, const GLint *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform4iv != nullptr)
     {
         mFunctions->programUniform4iv(mProgramID, uniLoc(location), count, v);
@@ -603,6 +826,7 @@ void ProgramGL::setUniform4iv(GLint location, GLsizei count, const GLint *v)
 
 void ProgramGL::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform1uiv != nullptr)
     {
         mFunctions->programUniform1uiv(mProgramID, uniLoc(location), count, v);
@@ -616,6 +840,7 @@ void ProgramGL::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
 
 void ProgramGL::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform2uiv != nullptr)
     {
         mFunctions->programUniform2uiv(mProgramID, uniLoc(location), count, v);
@@ -629,6 +854,7 @@ void ProgramGL::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
 
 void ProgramGL::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform3uiv != nullptr)
     {
         mFunctions->programUniform3uiv(mProgramID, uniLoc(location), count, v);
@@ -642,6 +868,7 @@ void ProgramGL::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
 
 void ProgramGL::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniform4uiv != nullptr)
     {
         mFunctions->programUniform4uiv(mProgramID, uniLoc(location), count, v);
@@ -658,6 +885,7 @@ void ProgramGL::setUniformMatrix2fv(GLint location,
                                     GLboolean transpose,
                                     const GLfloat *value)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniformMatrix2fv != nullptr)
     {
         mFunctions->programUniformMatrix2fv(mProgramID, uniLoc(location), count, transpose, value);
@@ -674,6 +902,7 @@ void ProgramGL::setUniformMatrix3fv(GLint location,
                                     GLboolean transpose,
                                     const GLfloat *value)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniformMatrix3fv != nullptr)
     {
         mFunctions->programUniformMatrix3fv(mProgramID, uniLoc(location), count, transpose, value);
@@ -690,6 +919,7 @@ void ProgramGL::setUniformMatrix4fv(GLint location,
                                     GLboolean transpose,
                                     const GLfloat *value)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniformMatrix4fv != nullptr)
     {
         mFunctions->programUniformMatrix4fv(mProgramID, uniLoc(location), count, transpose, value);
@@ -706,6 +936,7 @@ void ProgramGL::setUniformMatrix2x3fv(GLint location,
                                       GLboolean transpose,
                                       const GLfloat *value)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniformMatrix2x3fv != nullptr)
     {
         mFunctions->programUniformMatrix2x3fv(mProgramID, uniLoc(location), count, transpose,
@@ -723,6 +954,7 @@ void ProgramGL::setUniformMatrix3x2fv(GLint location,
                                       GLboolean transpose,
                                       const GLfloat *value)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniformMatrix3x2fv != nullptr)
     {
         mFunctions->programUniformMatrix3x2fv(mProgramID, uniLoc(location), count, transpose,
@@ -740,6 +972,7 @@ void ProgramGL::setUniformMatrix2x4fv(GLint location,
                                       GLboolean transpose,
                                       const GLfloat *value)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniformMatrix2x4fv != nullptr)
     {
         mFunctions->programUniformMatrix2x4fv(mProgramID, uniLoc(location), count, transpose,
@@ -757,6 +990,7 @@ void ProgramGL::setUniformMatrix4x2fv(GLint location,
                                       GLboolean transpose,
                                       const GLfloat *value)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniformMatrix4x2fv != nullptr)
     {
         mFunctions->programUniformMatrix4x2fv(mProgramID, uniLoc(location), count, transpose,
@@ -774,6 +1008,7 @@ void ProgramGL::setUniformMatrix3x4fv(GLint location,
                                       GLboolean transpose,
                                       const GLfloat *value)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniformMatrix3x4fv != nullptr)
     {
         mFunctions->programUniformMatrix3x4fv(mProgramID, uniLoc(location), count, transpose,
@@ -791,6 +1026,7 @@ void ProgramGL::setUniformMatrix4x3fv(GLint location,
                                       GLboolean transpose,
                                       const GLfloat *value)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     if (mFunctions->programUniformMatrix4x3fv != nullptr)
     {
         mFunctions->programUniformMatrix4x3fv(mProgramID, uniLoc(location), count, transpose,
@@ -805,6 +1041,7 @@ void ProgramGL::setUniformMatrix4x3fv(GLint location,
 
 void ProgramGL::setUniformBlockBinding(GLuint uniformBlockIndex, GLuint uniformBlockBinding)
 {
+    mStateManager->flushPendingDrawsWithoutContext();
     // Lazy init
     if (mUniformBlockRealLocationMap.empty())
     {
@@ -956,6 +1193,8 @@ void ProgramGL::getAtomicCounterBufferSizeMap(std::map<int, unsigned int> *sizeM
 
 void ProgramGL::preLink()
 {
+    mStateManager->flushPendingDrawsWithoutContext();
+
     // Reset the program state
     mUniformRealLocationMap.clear();
     mUniformBlockRealLocationMap.clear();
@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 
 namespace angle
@@ -125,6 +126,18 @@ class ProgramGL : public ProgramImpl
 
     void reapplyUBOBindingsIfNeeded(const gl::Context *context);
 
+    std::vector<std::string> getTransformFeedbackVaryingMappedNames() const;
+
+    // Native binaries of linked programs are cached in the display's BlobCache, keyed by the
+    // native driver and by everything that is passed to the native link.  Returns nullptr if they
+    // should not be cached for this program.
+    egl::BlobCache *getNativeBinaryCache(const gl::Context *context) const;
+    void computeNativeBinaryKey(const gl::Context *context, egl::BlobCache::Key *keyOut) const;
+    bool loadNativeBinary(const gl::Context *context,
+                          egl::BlobCache *cache,
+                          const egl::BlobCache::Key &key);
+    void storeNativeBinary(egl::BlobCache *cache, const egl::BlobCache::Key &key);
+
     bool getUniformBlockSize(const std::string &blockName,
                              const std::string &blockMappedName,
                              size_t *sizeOut) const;
@@ -86,12 +86,14 @@ StandardQueryGL::~StandardQueryGL()
 
 angle::Result StandardQueryGL::begin(const gl::Context *context)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     mResultSum = 0;
     return resume(context);
 }
 
 angle::Result StandardQueryGL::end(const gl::Context *context)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     return pause(context);
 }
 
@@ -101,6 +103,8 @@ angle::Result StandardQueryGL::queryCounter(const gl::Context *context)
 
     // Directly create a query for the timestamp and add it to the pending query queue, as timestamp
     // queries do not have the traditional begin/end block and never need to be paused/resumed
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
+
     GLuint query;
     mFunctions->genQueries(1, &query);
     mFunctions->queryCounter(query, GL_TIMESTAMP);
@@ -340,6 +344,8 @@ angle::Result SyncQueryGL::begin(const gl::Context *context)
 
 angle::Result SyncQueryGL::end(const gl::Context *context)
 {
+    ANGLE_TRY(GetImplAs<ContextGL>(context)->flushPendingDraws(context));
+
     if (nativegl::SupportsFenceSync(mFunctions))
     {
         mSyncProvider.reset(new SyncProviderGLSync(mFunctions));
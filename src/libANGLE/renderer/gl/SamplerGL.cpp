@@ -89,6 +89,9 @@ angle::Result SamplerGL::syncState(const gl::Context *context, const bool dirty)
     {
         return angle::Result::Continue;
     }
+
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
+
     // clang-format off
     SyncSamplerStateMember(mFunctions, mSamplerID, mState, mAppliedSamplerState, GL_TEXTURE_MIN_FILTER, &gl::SamplerState::getMinFilter, &gl::SamplerState::setMinFilter);
     SyncSamplerStateMember(mFunctions, mSamplerID, mState, mAppliedSamplerState, GL_TEXTURE_MAG_FILTER, &gl::SamplerState::getMagFilter, &gl::SamplerState::setMagFilter);
@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/gl/BufferGL.h"
 #include "libANGLE/renderer/gl/ContextGL.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
 #include "libANGLE/renderer/gl/TextureGL.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 
@@ -80,6 +81,7 @@ angle::Result SemaphoreGL::wait(gl::Context *context,
                                 const gl::TextureBarrierVector &textureBarriers)
 {
     const FunctionsGL *functions = GetFunctionsGL(context);
+    ANGLE_TRY(GetStateManagerGL(context)->flushPendingDraws(context));
 
     gl::BarrierVector<GLuint> bufferIDs(bufferBarriers.size());
     GatherNativeBufferIDs(bufferBarriers, &bufferIDs);
@@ -101,6 +103,7 @@ angle::Result SemaphoreGL::signal(gl::Context *context,
                                   const gl::TextureBarrierVector &textureBarriers)
 {
     const FunctionsGL *functions = GetFunctionsGL(context);
+    ANGLE_TRY(GetStateManagerGL(context)->flushPendingDraws(context));
 
     gl::BarrierVector<GLuint> bufferIDs(bufferBarriers.size());
     GatherNativeBufferIDs(bufferBarriers, &bufferIDs);
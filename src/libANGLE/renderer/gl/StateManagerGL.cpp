@@ -22,6 +22,7 @@
 #include "libANGLE/TransformFeedback.h"
 #include "libANGLE/VertexArray.h"
 #include "libANGLE/renderer/gl/BufferGL.h"
+#include "libANGLE/renderer/gl/ContextGL.h"
 #include "libANGLE/renderer/gl/FramebufferGL.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/ProgramGL.h"
@@ -36,6 +37,8 @@ namespace rx
 
 namespace
 {
+// Bounds how long recorded draws can be held back from the driver.
+constexpr size_t kMaxPendingDraws = 256;
 
 static void ValidateStateHelper(const FunctionsGL *functions,
                                 const GLuint localValue,
@@ -158,7 +161,12 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions,
       mIsMultiviewEnabled(extensions.multiview || extensions.multiview2),
       mProvokingVertex(GL_LAST_VERTEX_CONVENTION),
       mMaxClipDistances(rendererCaps.maxClipDistances),
-      mLocalDirtyBits()
+      mLocalDirtyBits(),
+      mDrawBatchingEnabled(features.batchDrawCallsWithMultiDraw.enabled &&
+                           mFunctions->multiDrawArrays != nullptr &&
+                           mFunctions->multiDrawElements != nullptr),
+      mUncheckedDrawError(GL_NO_ERROR),
+      mDrawBatchingPerfCounters()
 {
     ASSERT(mFunctions);
     ASSERT(extensions.maxViews >= 1u);
@@ -218,6 +226,8 @@ StateManagerGL::~StateManagerGL()
 
 void StateManagerGL::deleteProgram(GLuint program)
 {
+    flushPendingDrawsWithoutContext();
+
     if (program != 0)
     {
         if (mProgram == program)
@@ -231,6 +241,8 @@ void StateManagerGL::deleteProgram(GLuint program)
 
 void StateManagerGL::deleteVertexArray(GLuint vao)
 {
+    flushPendingDrawsWithoutContext();
+
     if (vao != 0)
     {
         if (mVAO == vao)
@@ -243,6 +255,8 @@ void StateManagerGL::deleteVertexArray(GLuint vao)
 
 void StateManagerGL::deleteTexture(GLuint texture)
 {
+    flushPendingDrawsWithoutContext();
+
     if (texture != 0)
     {
         for (gl::TextureType type : angle::AllEnums<gl::TextureType>())
@@ -273,6 +287,8 @@ void StateManagerGL::deleteTexture(GLuint texture)
 
 void StateManagerGL::deleteSampler(GLuint sampler)
 {
+    flushPendingDrawsWithoutContext();
+
     if (sampler != 0)
     {
         for (size_t unit = 0; unit < mSamplers.size(); unit++)
@@ -289,6 +305,8 @@ void StateManagerGL::deleteSampler(GLuint sampler)
 
 void StateManagerGL::deleteBuffer(GLuint buffer)
 {
+    flushPendingDrawsWithoutContext();
+
     if (buffer == 0)
     {
         return;
@@ -332,6 +350,8 @@ void StateManagerGL::deleteBuffer(GLuint buffer)
 
 void StateManagerGL::deleteFramebuffer(GLuint fbo)
 {
+    flushPendingDrawsWithoutContext();
+
     if (fbo != 0)
     {
         if (mHasSeparateFramebufferBindings)
@@ -361,6 +381,8 @@ void StateManagerGL::deleteFramebuffer(GLuint fbo)
 
 void StateManagerGL::deleteRenderbuffer(GLuint rbo)
 {
+    flushPendingDrawsWithoutContext();
+
     if (rbo != 0)
     {
         if (mRenderbuffer == rbo)
@@ -374,6 +396,8 @@ void StateManagerGL::deleteRenderbuffer(GLuint rbo)
 
 void StateManagerGL::deleteTransformFeedback(GLuint transformFeedback)
 {
+    flushPendingDrawsWithoutContext();
+
     if (transformFeedback != 0)
     {
         if (mTransformFeedback == transformFeedback)
@@ -393,6 +417,8 @@ void StateManagerGL::deleteTransformFeedback(GLuint transformFeedback)
 
 void StateManagerGL::useProgram(GLuint program)
 {
+    flushPendingDrawsWithoutContext();
+
     if (mProgram != program)
     {
         forceUseProgram(program);
@@ -401,6 +427,8 @@ void StateManagerGL::useProgram(GLuint program)
 
 void StateManagerGL::forceUseProgram(GLuint program)
 {
+    flushPendingDrawsWithoutContext();
+
     mProgram = program;
     mFunctions->useProgram(mProgram);
     mLocalDirtyBits.set(gl::State::DIRTY_BIT_PROGRAM_BINDING);
@@ -412,6 +440,7 @@ void StateManagerGL::bindVertexArray(GLuint vao, VertexArrayStateGL *vaoState)
     if (mVAO != vao)
     {
         ASSERT(!mFeatures.syncVertexArraysToDefault.enabled);
+        flushPendingDrawsWithoutContext();
 
         mVAO                                      = vao;
         mVAOState                                 = vaoState;
@@ -429,6 +458,11 @@ void StateManagerGL::bindBuffer(gl::BufferBinding target, GLuint buffer)
     // glBindTransformFeedback is called. To avoid these behavior differences we shouldn't try to
     // use it.
     ASSERT(target != gl::BufferBinding::TransformFeedback);
+
+    // Buffers are bound to be modified, even if they are already bound, so draws recorded for
+    // batching are submitted first.  The same goes for textures, framebuffers and renderbuffers.
+    flushPendingDrawsWithoutContext();
+
     if (mBuffers[target] != buffer)
     {
         mBuffers[target] = buffer;
@@ -446,6 +480,7 @@ void StateManagerGL::bindBufferBase(gl::BufferBinding target, size_t index, GLui
     if (binding.buffer != buffer || binding.offset != static_cast<size_t>(-1) ||
         binding.size != static_cast<size_t>(-1))
     {
+        flushPendingDrawsWithoutContext();
         binding.buffer   = buffer;
         binding.offset   = static_cast<size_t>(-1);
         binding.size     = static_cast<size_t>(-1);
@@ -466,6 +501,7 @@ void StateManagerGL::bindBufferRange(gl::BufferBinding target,
     auto &binding = mIndexedBuffers[target][index];
     if (binding.buffer != buffer || binding.offset != offset || binding.size != size)
     {
+        flushPendingDrawsWithoutContext();
         binding.buffer   = buffer;
         binding.offset   = offset;
         binding.size     = size;
@@ -486,6 +522,8 @@ void StateManagerGL::activeTexture(size_t unit)
 
 void StateManagerGL::bindTexture(gl::TextureType type, GLuint texture)
 {
+    flushPendingDrawsWithoutContext();
+
     gl::TextureType nativeType = nativegl::GetNativeTextureType(type);
     if (mTextures[nativeType][mTextureUnitIndex] != texture)
     {
@@ -657,6 +695,8 @@ angle::Result StateManagerGL::setPixelPackBuffer(const gl::Context *context,
 
 void StateManagerGL::bindFramebuffer(GLenum type, GLuint framebuffer)
 {
+    flushPendingDrawsWithoutContext();
+
     bool framebufferChanged = false;
     switch (type)
     {
@@ -715,6 +755,8 @@ void StateManagerGL::bindFramebuffer(GLenum type, GLuint framebuffer)
 void StateManagerGL::bindRenderbuffer(GLenum type, GLuint renderbuffer)
 {
     ASSERT(type == GL_RENDERBUFFER);
+    flushPendingDrawsWithoutContext();
+
     if (mRenderbuffer != renderbuffer)
     {
         mRenderbuffer = renderbuffer;
@@ -727,6 +769,8 @@ void StateManagerGL::bindTransformFeedback(GLenum type, GLuint transformFeedback
     ASSERT(type == GL_TRANSFORM_FEEDBACK);
     if (mTransformFeedback != transformFeedback)
     {
+        flushPendingDrawsWithoutContext();
+
         // Pause the current transform feedback if one is active.
         // To handle virtualized contexts, StateManagerGL needs to be able to bind a new transform
         // feedback at any time, even if there is one active.
@@ -754,6 +798,8 @@ void StateManagerGL::beginQuery(gl::QueryType type, QueryGL *queryObject, GLuint
     ASSERT(mQueries[type] == nullptr);
     ASSERT(queryId != 0);
 
+    flushPendingDrawsWithoutContext();
+
     mQueries[type] = queryObject;
     mFunctions->beginQuery(ToGLenum(type), queryId);
 }
@@ -762,10 +808,159 @@ void StateManagerGL::endQuery(gl::QueryType type, QueryGL *queryObject, GLuint q
 {
     ASSERT(queryObject != nullptr);
     ASSERT(mQueries[type] == queryObject);
+
+    flushPendingDrawsWithoutContext();
+
     mQueries[type] = nullptr;
     mFunctions->endQuery(ToGLenum(type));
 }
 
+bool StateManagerGL::canBatchDrawElements(GLint baseVertex) const
+{
+    return mDrawBatchingEnabled &&
+           (baseVertex == 0 || mFunctions->multiDrawElementsBaseVertex != nullptr);
+}
+
+angle::Result StateManagerGL::addPendingDrawArrays(const gl::Context *context,
+                                                   gl::PrimitiveMode mode,
+                                                   GLint first,
+                                                   GLsizei count)
+{
+    ASSERT(mDrawBatchingEnabled);
+
+    if (mPendingDraws.mode != mode || mPendingDraws.type != gl::DrawElementsType::InvalidEnum ||
+        mPendingDraws.counts.size() >= kMaxPendingDraws)
+    {
+        ANGLE_TRY(flushPendingDraws(context));
+        mPendingDraws.mode = mode;
+        mPendingDraws.type = gl::DrawElementsType::InvalidEnum;
+    }
+
+    mPendingDraws.firsts.push_back(first);
+    mPendingDraws.counts.push_back(count);
+
+    return angle::Result::Continue;
+}
+
+angle::Result StateManagerGL::addPendingDrawElements(const gl::Context *context,
+                                                     gl::PrimitiveMode mode,
+                                                     GLsizei count,
+                                                     gl::DrawElementsType type,
+                                                     const void *indices,
+                                                     GLint baseVertex)
+{
+    ASSERT(canBatchDrawElements(baseVertex));
+
+    if (mPendingDraws.mode != mode || mPendingDraws.type != type ||
+        mPendingDraws.counts.size() >= kMaxPendingDraws)
+    {
+        ANGLE_TRY(flushPendingDraws(context));
+        mPendingDraws.mode          = mode;
+        mPendingDraws.type          = type;
+        mPendingDraws.hasBaseVertex = false;
+    }
+
+    mPendingDraws.counts.push_back(count);
+    mPendingDraws.indices.push_back(indices);
+    mPendingDraws.baseVertices.push_back(baseVertex);
+    mPendingDraws.hasBaseVertex = mPendingDraws.hasBaseVertex || baseVertex != 0;
+
+    return angle::Result::Continue;
+}
+
+angle::Result StateManagerGL::issuePendingDraws(const gl::Context *context)
+{
+    if (!mPendingDraws.counts.empty())
+    {
+        ANGLE_GL_TRY(context, submitPendingDraws());
+    }
+
+    // Report an error generated by draws that were submitted when no context was available.
+    if (ANGLE_UNLIKELY(mUncheckedDrawError != GL_NO_ERROR))
+    {
+        const GLenum error  = mUncheckedDrawError;
+        mUncheckedDrawError = GL_NO_ERROR;
+        ContextGL *contextGL = GetImplAs<ContextGL>(context);
+        contextGL->handleError(error, "Unexpected driver error in batched draws.", __FILE__,
+                               ANGLE_FUNCTION, __LINE__);
+        return angle::Result::Stop;
+    }
+
+    return angle::Result::Continue;
+}
+
+void StateManagerGL::issuePendingDrawsWithoutContext()
+{
+    submitPendingDraws();
+
+    // Keep the first error until a context is available to report it to.
+    const GLenum error = mFunctions->getError();
+    if (error != GL_NO_ERROR && mUncheckedDrawError == GL_NO_ERROR)
+    {
+        mUncheckedDrawError = error;
+    }
+}
+
+void StateManagerGL::submitPendingDraws()
+{
+    ASSERT(!mPendingDraws.counts.empty());
+
+    const GLenum mode       = ToGLenum(mPendingDraws.mode);
+    const GLsizei drawCount = static_cast<GLsizei>(mPendingDraws.counts.size());
+
+    if (mPendingDraws.type == gl::DrawElementsType::InvalidEnum)
+    {
+        if (drawCount == 1)
+        {
+            mFunctions->drawArrays(mode, mPendingDraws.firsts[0], mPendingDraws.counts[0]);
+        }
+        else
+        {
+            mFunctions->multiDrawArrays(mode, mPendingDraws.firsts.data(),
+                                        mPendingDraws.counts.data(), drawCount);
+        }
+    }
+    else
+    {
+        const GLenum type = ToGLenum(mPendingDraws.type);
+        if (drawCount == 1 && !mPendingDraws.hasBaseVertex)
+        {
+            mFunctions->drawElements(mode, mPendingDraws.counts[0], type,
+                                     mPendingDraws.indices[0]);
+        }
+        else if (drawCount == 1)
+        {
+            mFunctions->drawElementsBaseVertex(mode, mPendingDraws.counts[0], type,
+                                               mPendingDraws.indices[0],
+                                               mPendingDraws.baseVertices[0]);
+        }
+        else if (!mPendingDraws.hasBaseVertex)
+        {
+            mFunctions->multiDrawElements(mode, mPendingDraws.counts.data(), type,
+                                          mPendingDraws.indices.data(), drawCount);
+        }
+        else
+        {
+            mFunctions->multiDrawElementsBaseVertex(mode, mPendingDraws.counts.data(), type,
+                                                    mPendingDraws.indices.data(), drawCount,
+                                                    mPendingDraws.baseVertices.data());
+        }
+    }
+
+    if (drawCount > 1)
+    {
+        mDrawBatchingPerfCounters.multiDrawCalls++;
+        mDrawBatchingPerfCounters.nativeDrawCallsSaved += drawCount - 1;
+    }
+
+    mPendingDraws.mode = gl::PrimitiveMode::InvalidEnum;
+    mPendingDraws.type = gl::DrawElementsType::InvalidEnum;
+    mPendingDraws.firsts.clear();
+    mPendingDraws.counts.clear();
+    mPendingDraws.indices.clear();
+    mPendingDraws.baseVertices.clear();
+}
+
 void StateManagerGL::updateDrawIndirectBufferBinding(const gl::Context *context)
 {
     gl::Buffer *drawIndirectBuffer =
@@ -790,6 +985,8 @@ void StateManagerGL::updateDispatchIndirectBufferBinding(const gl::Context *cont
 
 void StateManagerGL::pauseTransformFeedback()
 {
+    flushPendingDrawsWithoutContext();
+
     if (mCurrentTransformFeedback != nullptr)
     {
         mCurrentTransformFeedback->syncPausedState(true);
@@ -860,6 +1057,8 @@ angle::Result StateManagerGL::resumeQuery(const gl::Context *context, gl::QueryT
 
 angle::Result StateManagerGL::onMakeCurrent(const gl::Context *context)
 {
+    ANGLE_TRY(flushPendingDraws(context));
+
     const gl::State &glState = context->getState();
 
 #if defined(ANGLE_ENABLE_ASSERTS)
@@ -1720,6 +1919,7 @@ angle::Result StateManagerGL::setPrimitiveRestartIndex(const gl::Context *contex
 {
     if (mPrimitiveRestartIndex != index)
     {
+        ANGLE_TRY(flushPendingDraws(context));
         ANGLE_GL_TRY(context, mFunctions->primitiveRestartIndex(index));
         mPrimitiveRestartIndex = index;
 
@@ -1803,6 +2003,9 @@ angle::Result StateManagerGL::syncState(const gl::Context *context,
         return angle::Result::Continue;
     }
 
+    // Draws recorded for batching use the state from before this change.
+    ANGLE_TRY(flushPendingDraws(context));
+
     // TODO(jmadill): Investigate only syncing vertex state for active attributes
     for (auto iter = glAndLocalDirtyBits.begin(), endIter = glAndLocalDirtyBits.end();
          iter != endIter; ++iter)
@@ -2620,6 +2823,7 @@ void StateManagerGL::get(GLenum name, gl::ColorF *color)
 void StateManagerGL::syncFromNativeContext(const gl::Extensions &extensions,
                                            ExternalContextState *state)
 {
+    flushPendingDrawsWithoutContext();
     ASSERT(mFunctions->getError() == GL_NO_ERROR);
 
     get(GL_VIEWPORT, &state->viewport);
@@ -2802,6 +3006,7 @@ void StateManagerGL::syncFromNativeContext(const gl::Extensions &extensions,
 void StateManagerGL::restoreNativeContext(const gl::Extensions &extensions,
                                           const ExternalContextState *state)
 {
+    flushPendingDrawsWithoutContext();
     ASSERT(mFunctions->getError() == GL_NO_ERROR);
 
     setViewport(state->viewport);
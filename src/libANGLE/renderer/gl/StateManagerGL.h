@@ -145,6 +145,13 @@ struct VertexArrayStateGL
     angle::FixedVector<VertexBindingGL, gl::MAX_VERTEX_ATTRIBS> bindings;
 };
 
+// Counters for draw calls coalesced into native multi-draw calls.
+struct DrawBatchingPerfCounters
+{
+    uint32_t multiDrawCalls;
+    uint32_t nativeDrawCallsSaved;
+};
+
 class StateManagerGL final : angle::NonCopyable
 {
   public:
@@ -301,7 +308,52 @@ class StateManagerGL final : angle::NonCopyable
     void syncFromNativeContext(const gl::Extensions &extensions, ExternalContextState *state);
     void restoreNativeContext(const gl::Extensions &extensions, const ExternalContextState *state);
 
+    // Draw batching. Consecutive draws that only differ in their vertex or index ranges are
+    // recorded instead of issued, and are submitted as one native multi-draw call.  They are
+    // flushed when state is synced, when an object is bound to be modified or deleted, and at the
+    // ContextGL entry points that reach the native context directly (other draws, compute, flush,
+    // finish, fences, markers and swap).
+    bool canBatchDrawArrays() const { return mDrawBatchingEnabled; }
+    bool canBatchDrawElements(GLint baseVertex) const;
+    angle::Result addPendingDrawArrays(const gl::Context *context,
+                                       gl::PrimitiveMode mode,
+                                       GLint first,
+                                       GLsizei count);
+    angle::Result addPendingDrawElements(const gl::Context *context,
+                                         gl::PrimitiveMode mode,
+                                         GLsizei count,
+                                         gl::DrawElementsType type,
+                                         const void *indices,
+                                         GLint baseVertex);
+    ANGLE_INLINE angle::Result flushPendingDraws(const gl::Context *context)
+    {
+        if (ANGLE_UNLIKELY(!mPendingDraws.counts.empty() || mUncheckedDrawError != GL_NO_ERROR))
+        {
+            return issuePendingDraws(context);
+        }
+        return angle::Result::Continue;
+    }
+    // Used by the entry points that have no context to report errors to, such as object deletion,
+    // uniform updates and binding an object before modifying it.  An error generated by the draws
+    // is reported by the next flushPendingDraws(context).
+    ANGLE_INLINE void flushPendingDrawsWithoutContext()
+    {
+        if (ANGLE_UNLIKELY(!mPendingDraws.counts.empty()))
+        {
+            issuePendingDrawsWithoutContext();
+        }
+    }
+
+    const DrawBatchingPerfCounters &getDrawBatchingPerfCounters() const
+    {
+        return mDrawBatchingPerfCounters;
+    }
+
   private:
+    void submitPendingDraws();
+    angle::Result issuePendingDraws(const gl::Context *context);
+    void issuePendingDrawsWithoutContext();
+
     void setTextureCubemapSeamlessEnabled(bool enabled);
 
     angle::Result propagateProgramToVAO(const gl::Context *context,
@@ -515,6 +567,23 @@ class StateManagerGL final : angle::NonCopyable
 
     gl::State::DirtyBits mLocalDirtyBits;
     gl::AttributesMask mLocalDirtyCurrentValues;
+
+    // Draws recorded for batching. |type| is InvalidEnum for non-indexed draws.
+    struct PendingDraws
+    {
+        gl::PrimitiveMode mode    = gl::PrimitiveMode::InvalidEnum;
+        gl::DrawElementsType type = gl::DrawElementsType::InvalidEnum;
+        bool hasBaseVertex        = false;
+        std::vector<GLint> firsts;
+        std::vector<GLsizei> counts;
+        std::vector<const void *> indices;
+        std::vector<GLint> baseVertices;
+    };
+
+    const bool mDrawBatchingEnabled;
+    PendingDraws mPendingDraws;
+    GLenum mUncheckedDrawError;
+    DrawBatchingPerfCounters mDrawBatchingPerfCounters;
 };
 
 }  // namespace rx
@@ -0,0 +1,189 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// StreamingBufferGL:
+//   A ring buffer of persistently mapped memory used to stream client-side vertex and index data
+//   without re-specifying or re-mapping a buffer on every draw call.
+//
+
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
+
+#include "common/mathutil.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/renderergl_utils.h"
+
+namespace rx
+{
+namespace
+{
+constexpr size_t kMinStreamingBufferSize = 256 * 1024;
+
+// Allocations are aligned so that they can be used for any attribute or index type.
+constexpr size_t kStreamingAllocationAlignment = 16;
+
+constexpr GLbitfield kStreamingBufferFlags =
+    GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+constexpr GLuint64 kFenceWaitTimeoutNs = 1000 * 1000 * 1000;
+}  // anonymous namespace
+
+StreamingBufferGL::StreamingBufferGL()
+{
+    mSegmentFences.fill(0);
+}
+
+StreamingBufferGL::~StreamingBufferGL()
+{
+    ASSERT(mBufferID == 0);
+}
+
+// static
+bool StreamingBufferGL::IsSupported(const FunctionsGL *functions)
+{
+    return functions->bufferStorage != nullptr && functions->mapBufferRange != nullptr &&
+           functions->fenceSync != nullptr && functions->clientWaitSync != nullptr;
+}
+
+void StreamingBufferGL::destroy(const gl::Context *context)
+{
+    releaseStorage(context);
+}
+
+angle::Result StreamingBufferGL::allocate(const gl::Context *context,
+                                          gl::BufferBinding binding,
+                                          size_t size,
+                                          uint8_t **mappedPointerOut,
+                                          size_t *offsetOut)
+{
+    ASSERT(size > 0);
+
+    // Allocations never exceed one segment, so they fit in the segment after the current one when
+    // they don't fit in the current one.
+    if (mBufferID == 0 || size > mSize / kSegmentCount)
+    {
+        const size_t newSize = std::max(
+            kMinStreamingBufferSize, gl::ceilPow2(static_cast<unsigned int>(size)) * kSegmentCount);
+        ANGLE_TRY(initStorage(context, binding, newSize));
+    }
+    else
+    {
+        GetStateManagerGL(context)->bindBuffer(binding, mBufferID);
+    }
+
+    // Allocations never cross a segment boundary.  A segment is then only left when an allocation
+    // for a later draw is made, by which point every draw that reads from it has been issued, and
+    // its fence covers them.
+    const size_t segmentSize = mSize / kSegmentCount;
+    size_t offset            = roundUp(mHead, kStreamingAllocationAlignment);
+    if (offset + size > (mCurrentSegment + 1) * segmentSize)
+    {
+        offset = (mCurrentSegment + 1) * segmentSize;
+        if (offset == mSize)
+        {
+            offset = 0;
+        }
+    }
+    ASSERT(offset / segmentSize == (offset + size - 1) / segmentSize);
+
+    ANGLE_TRY(enterSegment(context, offset / segmentSize));
+
+    mHead             = offset + size;
+    *mappedPointerOut = mMappedPointer;
+    *offsetOut        = offset;
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingBufferGL::initStorage(const gl::Context *context,
+                                             gl::BufferBinding binding,
+                                             size_t size)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    StateManagerGL *stateManager = GetStateManagerGL(context);
+
+    // The old buffer is kept alive by the driver until the draws that reference it complete.
+    releaseStorage(context);
+
+    ANGLE_GL_TRY(context, functions->genBuffers(1, &mBufferID));
+    stateManager->bindBuffer(binding, mBufferID);
+
+    const GLenum target = gl::ToGLenum(binding);
+    ANGLE_GL_TRY(context, functions->bufferStorage(target, static_cast<GLsizeiptr>(size), nullptr,
+                                                   kStreamingBufferFlags));
+    void *mappedPointer =
+        ANGLE_GL_TRY(context, functions->mapBufferRange(target, 0, size, kStreamingBufferFlags));
+    mMappedPointer = static_cast<uint8_t *>(mappedPointer);
+    ANGLE_CHECK(GetImplAs<ContextGL>(context), mMappedPointer != nullptr,
+                "Failed to map the client data streaming buffer.", GL_OUT_OF_MEMORY);
+
+    mSize           = size;
+    mHead           = 0;
+    mCurrentSegment = 0;
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingBufferGL::enterSegment(const gl::Context *context, size_t segment)
+{
+    if (segment == mCurrentSegment)
+    {
+        return angle::Result::Continue;
+    }
+
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    ContextGL *contextGL         = GetImplAs<ContextGL>(context);
+
+    // Every draw that read from the segment being left has already been issued.
+    ASSERT(mSegmentFences[mCurrentSegment] == 0);
+    mSegmentFences[mCurrentSegment] =
+        ANGLE_GL_TRY(context, functions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    ANGLE_CHECK(contextGL, mSegmentFences[mCurrentSegment] != 0,
+                "glFenceSync failed to create a GLsync object.", GL_OUT_OF_MEMORY);
+    contextGL->markWorkSubmitted();
+
+    mCurrentSegment = segment;
+
+    GLsync &fence = mSegmentFences[segment];
+    if (fence != 0)
+    {
+        GLenum result = GL_TIMEOUT_EXPIRED;
+        while (result == GL_TIMEOUT_EXPIRED)
+        {
+            result = ANGLE_GL_TRY(
+                context, functions->clientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                                   kFenceWaitTimeoutNs));
+        }
+        ANGLE_GL_TRY(context, functions->deleteSync(fence));
+        fence = 0;
+        ANGLE_CHECK(contextGL, result != GL_WAIT_FAILED,
+                    "Failed to wait for the client data streaming buffer.", GL_OUT_OF_MEMORY);
+    }
+
+    return angle::Result::Continue;
+}
+
+void StreamingBufferGL::releaseStorage(const gl::Context *context)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+
+    for (GLsync &fence : mSegmentFences)
+    {
+        if (fence != 0)
+        {
+            functions->deleteSync(fence);
+            fence = 0;
+        }
+    }
+
+    // Deleting the buffer also unmaps it.
+    GetStateManagerGL(context)->deleteBuffer(mBufferID);
+    mBufferID      = 0;
+    mSize          = 0;
+    mMappedPointer = nullptr;
+    mHead          = 0;
+}
+
+}  // namespace rx
@@ -0,0 +1,71 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// StreamingBufferGL:
+//   A ring buffer of persistently mapped memory used to stream client-side vertex and index data
+//   without re-specifying or re-mapping a buffer on every draw call.
+//
+
+#ifndef LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+#define LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+
+#include <array>
+
+#include "angle_gl.h"
+#include "libANGLE/Error.h"
+#include "libANGLE/angletypes.h"
+
+namespace gl
+{
+class Context;
+}  // namespace gl
+
+namespace rx
+{
+class FunctionsGL;
+
+// Requires buffer storage (GL 4.4, GL_ARB_buffer_storage or GL_EXT_buffer_storage) and sync
+// objects. The buffer is split into segments that allocations never cross; a fence is inserted
+// when the writer leaves a segment and waited on before the segment is written again, so memory
+// handed out by allocate() is never overwritten while a previously issued draw may still read it.
+class StreamingBufferGL : angle::NonCopyable
+{
+  public:
+    StreamingBufferGL();
+    ~StreamingBufferGL();
+
+    static bool IsSupported(const FunctionsGL *functions);
+
+    void destroy(const gl::Context *context);
+
+    // Reserves |size| bytes and binds the buffer to |binding|. |mappedPointerOut| points to the
+    // start of the mapping, and the reserved range starts at |offsetOut| in both the mapping and the
+    // buffer. Reserved memory must be written before the draw call that consumes it is issued.
+    angle::Result allocate(const gl::Context *context,
+                           gl::BufferBinding binding,
+                           size_t size,
+                           uint8_t **mappedPointerOut,
+                           size_t *offsetOut);
+
+    GLuint getBufferID() const { return mBufferID; }
+
+  private:
+    static constexpr size_t kSegmentCount = 4;
+
+    angle::Result initStorage(const gl::Context *context, gl::BufferBinding binding, size_t size);
+    angle::Result enterSegment(const gl::Context *context, size_t segment);
+    void releaseStorage(const gl::Context *context);
+
+    GLuint mBufferID        = 0;
+    size_t mSize            = 0;
+    uint8_t *mMappedPointer = nullptr;
+    size_t mHead            = 0;
+    size_t mCurrentSegment  = 0;
+    std::array<GLsync, kSegmentCount> mSegmentFences;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
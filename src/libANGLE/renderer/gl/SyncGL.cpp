@@ -37,7 +37,8 @@ angle::Result SyncGL::set(const gl::Context *context, GLenum condition, GLbitfie
 {
     ASSERT(condition == GL_SYNC_GPU_COMMANDS_COMPLETE && flags == 0);
     ContextGL *contextGL = GetImplAs<ContextGL>(context);
-    mSyncObject          = mFunctions->fenceSync(condition, flags);
+    ANGLE_TRY(contextGL->flushPendingDraws(context));
+    mSyncObject = mFunctions->fenceSync(condition, flags);
     ANGLE_CHECK(contextGL, mSyncObject != 0, "glFenceSync failed to create a GLsync object.",
                 GL_OUT_OF_MEMORY);
     contextGL->markWorkSubmitted();
@@ -49,6 +49,7 @@ angle::Result TransformFeedbackGL::begin(const gl::Context *context,
 
 angle::Result TransformFeedbackGL::end(const gl::Context *context)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     mStateManager->onTransformFeedbackStateChange();
 
     // Immediately end the transform feedback so that the results are visible.
@@ -58,6 +59,7 @@ angle::Result TransformFeedbackGL::end(const gl::Context *context)
 
 angle::Result TransformFeedbackGL::pause(const gl::Context *context)
 {
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     mStateManager->onTransformFeedbackStateChange();
 
     syncPausedState(true);
@@ -79,6 +81,7 @@ angle::Result TransformFeedbackGL::bindIndexedBuffer(
 
     // Directly bind buffer (not through the StateManager methods) because the buffer bindings are
     // tracked per transform feedback object
+    ANGLE_TRY(mStateManager->flushPendingDraws(context));
     mStateManager->bindTransformFeedback(GL_TRANSFORM_FEEDBACK, mTransformFeedbackID);
     if (binding.get() != nullptr)
     {
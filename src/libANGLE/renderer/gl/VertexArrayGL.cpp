@@ -149,6 +149,9 @@ void VertexArrayGL::destroy(const gl::Context *context)
     mStreamingArrayBufferSize = 0;
     mStreamingArrayBuffer     = 0;
 
+    mStreamingElementArrayRingBuffer.destroy(context);
+    mStreamingArrayRingBuffer.destroy(context);
+
     if (mOwnsNativeState)
     {
         delete mNativeState;
@@ -301,6 +304,28 @@ angle::Result VertexArrayGL::syncIndexData(const gl::Context *context,
             *outIndexRange = ComputeIndexRange(type, indices, count, primitiveRestartEnabled);
         }
 
+        const GLuint indexTypeBytes        = gl::GetDrawElementsTypeSize(type);
+        size_t requiredStreamingBufferSize = indexTypeBytes * count;
+
+        if (GetFeaturesGL(context).usePersistentMappedStreamingBuffers.enabled)
+        {
+            stateManager->bindVertexArray(mVertexArrayID, mNativeState);
+
+            // Write the indices into the ring buffer and offset the draw call to them
+            uint8_t *bufferPointer = nullptr;
+            size_t bufferOffset    = 0;
+            ANGLE_TRY(mStreamingElementArrayRingBuffer.allocate(
+                context, gl::BufferBinding::ElementArray, requiredStreamingBufferSize,
+                &bufferPointer, &bufferOffset));
+            memcpy(bufferPointer + bufferOffset, indices, requiredStreamingBufferSize);
+
+            mElementArrayBuffer.set(context, nullptr);
+            mNativeState->elementArrayBuffer = mStreamingElementArrayRingBuffer.getBufferID();
+
+            *outIndices = reinterpret_cast<const void *>(bufferOffset);
+            return angle::Result::Continue;
+        }
+
         // Allocate the streaming element array buffer
         if (mStreamingElementArrayBuffer == 0)
         {
@@ -315,8 +340,6 @@ angle::Result VertexArrayGL::syncIndexData(const gl::Context *context,
         mNativeState->elementArrayBuffer = mStreamingElementArrayBuffer;
 
         // Make sure the element array buffer is large enough
-        const GLuint indexTypeBytes        = gl::GetDrawElementsTypeSize(type);
-        size_t requiredStreamingBufferSize = indexTypeBytes * count;
         if (requiredStreamingBufferSize > mStreamingElementArrayBufferSize)
         {
             // Copy the indices in while resizing the buffer
@@ -393,24 +416,37 @@ angle::Result VertexArrayGL::streamAttributes(
         return angle::Result::Continue;
     }
 
-    if (mStreamingArrayBuffer == 0)
-    {
-        ANGLE_GL_TRY(context, functions->genBuffers(1, &mStreamingArrayBuffer));
-        mStreamingArrayBufferSize = 0;
-    }
-
     // If first is greater than zero, a slack space needs to be left at the beginning of the buffer
     // for each attribute so that the same 'first' argument can be passed into the draw call.
     const size_t bufferEmptySpace =
         attribsToStream.count() * maxAttributeDataSize * indexRange.start;
     const size_t requiredBufferSize = streamingDataSize + bufferEmptySpace;
 
-    stateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
-    if (requiredBufferSize > mStreamingArrayBufferSize)
+    // With persistently mapped buffers, the data is written to a fresh range of a ring buffer that
+    // stays mapped, so neither the driver nor the previous draw calls need to be synchronized with.
+    const bool usePersistentMapping =
+        GetFeaturesGL(context).usePersistentMappedStreamingBuffers.enabled;
+    if (!usePersistentMapping)
     {
-        ANGLE_GL_TRY(context, functions->bufferData(GL_ARRAY_BUFFER, requiredBufferSize, nullptr,
-                                                    GL_DYNAMIC_DRAW));
-        mStreamingArrayBufferSize = requiredBufferSize;
+        if (mStreamingArrayBuffer == 0)
+        {
+            ANGLE_GL_TRY(context, functions->genBuffers(1, &mStreamingArrayBuffer));
+            mStreamingArrayBufferSize = 0;
+        }
+
+        stateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
+        if (requiredBufferSize > mStreamingArrayBufferSize)
+        {
+            ANGLE_GL_TRY(context, functions->bufferData(GL_ARRAY_BUFFER, requiredBufferSize,
+                                                        nullptr, GL_DYNAMIC_DRAW));
+            mStreamingArrayBufferSize = requiredBufferSize;
+        }
+        else if (functions->mapBufferRange == nullptr)
+        {
+            // Orphan the whole buffer so that mapping it doesn't wait for the previous draw calls.
+            ANGLE_GL_TRY(context, functions->bufferData(GL_ARRAY_BUFFER, mStreamingArrayBufferSize,
+                                                        nullptr, GL_DYNAMIC_DRAW));
+        }
     }
 
     stateManager->bindVertexArray(mVertexArrayID, mNativeState);
@@ -422,9 +458,27 @@ angle::Result VertexArrayGL::streamAttributes(
     size_t unmapRetryAttempts = 5;
     while (unmapResult != GL_TRUE && --unmapRetryAttempts > 0)
     {
-        uint8_t *bufferPointer = MapBufferRangeWithFallback(functions, GL_ARRAY_BUFFER, 0,
-                                                            requiredBufferSize, GL_MAP_WRITE_BIT);
-        size_t curBufferOffset = maxAttributeDataSize * indexRange.start;
+        uint8_t *bufferPointer  = nullptr;
+        size_t bufferBaseOffset = 0;
+        GLuint streamingBuffer  = mStreamingArrayBuffer;
+        if (usePersistentMapping)
+        {
+            ANGLE_TRY(mStreamingArrayRingBuffer.allocate(context, gl::BufferBinding::Array,
+                                                         requiredBufferSize, &bufferPointer,
+                                                         &bufferBaseOffset));
+            streamingBuffer = mStreamingArrayRingBuffer.getBufferID();
+        }
+        else
+        {
+            // Invalidate the previous contents, the driver can hand out new storage instead of
+            // waiting for the draw calls that still use it.
+            const GLbitfield access = functions->mapBufferRange != nullptr
+                                          ? GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT
+                                          : GL_MAP_WRITE_BIT;
+            bufferPointer = MapBufferRangeWithFallback(functions, GL_ARRAY_BUFFER, 0,
+                                                       requiredBufferSize, access);
+        }
+        size_t curBufferOffset = bufferBaseOffset + maxAttributeDataSize * indexRange.start;
 
         const auto &attribs  = mState.getVertexAttributes();
         const auto &bindings = mState.getVertexBindings();
@@ -521,7 +575,7 @@ angle::Result VertexArrayGL::streamAttributes(
             if (needsUnmapAndRebindStreamingAttributeBuffer)
             {
                 ANGLE_GL_TRY(context, functions->unmapBuffer(GL_ARRAY_BUFFER));
-                stateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
+                stateManager->bindBuffer(gl::BufferBinding::Array, streamingBuffer);
             }
 
             // Compute where the 0-index vertex would be.
@@ -540,7 +594,7 @@ angle::Result VertexArrayGL::streamAttributes(
             mNativeState->bindings[idx].stride = static_cast<GLsizei>(destStride);
             mNativeState->bindings[idx].offset = static_cast<GLintptr>(vertexStartOffset);
             mArrayBuffers[idx].set(context, nullptr);
-            mNativeState->bindings[idx].buffer = mStreamingArrayBuffer;
+            mNativeState->bindings[idx].buffer = streamingBuffer;
 
             // There's maxAttributeDataSize * indexRange.start of empty space allocated for each
             // streaming attributes
@@ -548,7 +602,14 @@ angle::Result VertexArrayGL::streamAttributes(
                 destStride * streamedVertexCount + maxAttributeDataSize * indexRange.start;
         }
 
-        unmapResult = ANGLE_GL_TRY(context, functions->unmapBuffer(GL_ARRAY_BUFFER));
+        if (usePersistentMapping)
+        {
+            unmapResult = GL_TRUE;
+        }
+        else
+        {
+            unmapResult = ANGLE_GL_TRY(context, functions->unmapBuffer(GL_ARRAY_BUFFER));
+        }
     }
 
     ANGLE_CHECK(GetImplAs<ContextGL>(context), unmapResult == GL_TRUE,
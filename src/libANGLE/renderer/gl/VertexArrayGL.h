@@ -14,6 +14,7 @@
 #include "common/mathutil.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 
 namespace rx
 {
@@ -145,6 +146,10 @@ class VertexArrayGL : public VertexArrayImpl
     mutable size_t mStreamingArrayBufferSize = 0;
     mutable GLuint mStreamingArrayBuffer     = 0;
 
+    // Used instead of the streaming buffers above when persistently mapped buffers are supported
+    mutable StreamingBufferGL mStreamingElementArrayRingBuffer;
+    mutable StreamingBufferGL mStreamingArrayRingBuffer;
+
     // Used for Mac Intel instanced draw workaround
     mutable gl::AttributesMask mForcedStreamingAttributesForDrawArraysInstancedMask;
     mutable gl::AttributesMask mInstancedAttributesMask;
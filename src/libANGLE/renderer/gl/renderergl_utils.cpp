@@ -25,6 +25,7 @@
 #include "libANGLE/renderer/gl/FenceNVGL.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/QueryGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 #include "libANGLE/renderer/gl/formatutilsgl.h"
 #include "platform/FeaturesGL.h"
 #include "platform/FrontendFeatures.h"
@@ -1803,6 +1804,9 @@ void GenerateCaps(const FunctionsGL *functions,
 
     extensions->yuvTargetEXT = functions->hasGLESExtension("GL_EXT_YUV_target");
 
+    // GL_AMD_performance_monitor is implemented by ANGLE and exposes the draw batching counters.
+    extensions->performanceMonitorAMD = true;
+
     // PVRTC1 textures must be squares on Apple platforms.
     if (IsApple())
     {
@@ -2202,6 +2206,19 @@ void InitializeFeatures(const FunctionsGL *functions, angle::FeaturesGL *feature
 
     // https://crbug.com/1060012
     ANGLE_FEATURE_CONDITION(features, emulateImmutableCompressedTexture3D, isQualcomm);
+
+    ANGLE_FEATURE_CONDITION(features, usePersistentMappedStreamingBuffers,
+                            StreamingBufferGL::IsSupported(functions));
+
+    // Optional, can be enabled through feature overrides.
+    ANGLE_FEATURE_CONDITION(features, batchDrawCallsWithMultiDraw, false);
+
+    // https://crbug.com/480992
+    ANGLE_FEATURE_CONDITION(features, cacheNativeProgramBinaries,
+                            functions->programBinary != nullptr &&
+                                functions->getProgramBinary != nullptr &&
+                                QuerySingleGLInt(functions, GL_NUM_PROGRAM_BINARY_FORMATS) > 0 &&
+                                !IsPowerVrRogue(functions));
 }
 
 void InitializeFrontendFeatures(const FunctionsGL *functions, angle::FrontendFeatures *features)
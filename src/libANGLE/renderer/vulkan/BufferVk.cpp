@@ -11,10 +11,12 @@
 
 #include "common/FixedVector.h"
 #include "common/debug.h"
+#include "common/hash_utils.h"
 #include "common/mathutil.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 #include "libANGLE/trace.h"
 
@@ -33,6 +35,20 @@ static_assert(gl::isPow2(kBufferSizeGranularity), "use as alignment, must be pow
 // Start with a fairly small buffer size. We can increase this dynamically as we convert more data.
 constexpr size_t kConvertedArrayBufferInitialSize = 1024 * 8;
 
+// Line loop conversions are written by the CPU or copied by the GPU, and are cached until the
+// buffer they're made in is full.  Most line loops are small, so a buffer holds many of them.
+constexpr VkBufferUsageFlags kLineLoopConversionBufferUsage =
+    VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+constexpr size_t kLineLoopConversionBufferInitialSize = 1024 * 64;
+
+// Readbacks into the buffer that are packed on the CPU are copied into host-cached staging memory,
+// suballocated from a buffer that's reused once the readbacks in it are packed.  The alignment
+// fits the largest known uncompressed format, as well as 3-component formats.
+constexpr VkMemoryPropertyFlags kPackPixelsStagingMemoryFlags =
+    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+constexpr size_t kPackPixelsStagingAlignment   = 32 * 3;
+constexpr size_t kPackPixelsStagingInitialSize = 1024 * 128;
+
 // Buffers that have a static usage pattern will be allocated in
 // device local memory to speed up access to and from the GPU.
 // Dynamic usage patterns or that are frequently mapped
@@ -173,6 +189,28 @@ ConversionBuffer::~ConversionBuffer() = default;
 
 ConversionBuffer::ConversionBuffer(ConversionBuffer &&other) = default;
 
+// LineLoopConversionKey implementation.
+LineLoopConversionKey::LineLoopConversionKey(gl::DrawElementsType indexTypeIn,
+                                             uint32_t indexCountIn,
+                                             VkDeviceSize offsetIn,
+                                             bool primitiveRestartIn)
+    : offset(offsetIn),
+      indexCount(indexCountIn),
+      indexType(static_cast<uint8_t>(indexTypeIn)),
+      primitiveRestart(primitiveRestartIn),
+      padding{}
+{}
+
+size_t LineLoopConversionKey::hash() const
+{
+    return angle::ComputeGenericHash(*this);
+}
+
+bool LineLoopConversionKey::operator==(const LineLoopConversionKey &other) const
+{
+    return memcmp(this, &other, sizeof(LineLoopConversionKey)) == 0;
+}
+
 // BufferVk::VertexConversionBuffer implementation.
 BufferVk::VertexConversionBuffer::VertexConversionBuffer(RendererVk *renderer,
                                                          angle::FormatID formatIDIn,
@@ -216,6 +254,8 @@ void BufferVk::release(ContextVk *contextVk)
     {
         mBuffer->release(renderer);
     }
+    releasePendingPackPixels(contextVk);
+    mPackPixelsStagingBuffer.release(renderer);
     mShadowBuffer.release();
     mBufferPool.release(renderer);
     mHostVisibleBufferPool.release(renderer);
@@ -226,6 +266,8 @@ void BufferVk::release(ContextVk *contextVk)
     {
         buffer.data.release(renderer);
     }
+    mLineLoopConversionBuffer.release(renderer);
+    mLineLoopConversions.clear();
 }
 
 angle::Result BufferVk::initializeShadowBuffer(ContextVk *contextVk,
@@ -401,6 +443,9 @@ angle::Result BufferVk::setDataWithMemoryType(const gl::Context *context,
         return angle::Result::Continue;
     }
 
+    // The contents of the buffer are re-specified, so the pending readbacks are dropped.
+    releasePendingPackPixels(contextVk);
+
     // BufferData call is re-specifying the entire buffer
     // Release and init a new mBuffer with this new size
     if (size != static_cast<size_t>(mState.getSize()))
@@ -472,8 +517,13 @@ angle::Result BufferVk::copySubData(const gl::Context *context,
 {
     ASSERT(mBuffer && mBuffer->valid());
 
-    ContextVk *contextVk            = vk::GetImpl(context);
-    BufferVk *sourceVk              = GetAs<BufferVk>(source);
+    ContextVk *contextVk = vk::GetImpl(context);
+    BufferVk *sourceVk   = GetAs<BufferVk>(source);
+
+    // Pack the pending readbacks of both buffers before they are copied over.
+    ANGLE_TRY(sourceVk->flushPendingPackPixels(contextVk));
+    ANGLE_TRY(flushPendingPackPixels(contextVk));
+
     VkDeviceSize sourceBufferOffset = 0;
     vk::BufferHelper &sourceBuffer  = sourceVk->getBufferAndOffset(&sourceBufferOffset);
     ASSERT(sourceBuffer.valid());
@@ -517,7 +567,7 @@ angle::Result BufferVk::copySubData(const gl::Context *context,
     commandBuffer->copyBuffer(sourceBuffer.getBuffer(), mBuffer->getBuffer(), 1, &copyRegion);
 
     // The new destination buffer data may require a conversion for the next draw, so mark it dirty.
-    onDataChanged();
+    markConversionBuffersDirty(static_cast<size_t>(destOffset), static_cast<size_t>(size));
 
     return angle::Result::Continue;
 }
@@ -592,6 +642,8 @@ angle::Result BufferVk::mapRangeImpl(ContextVk *contextVk,
                                      GLbitfield access,
                                      void **mapPtr)
 {
+    ANGLE_TRY(flushPendingPackPixels(contextVk));
+
     if (!mShadowBuffer.valid())
     {
         ASSERT(mBuffer && mBuffer->valid());
@@ -649,19 +701,25 @@ angle::Result BufferVk::unmap(const gl::Context *context, GLboolean *result)
 
 angle::Result BufferVk::unmapImpl(ContextVk *contextVk)
 {
-    ASSERT(mBuffer && mBuffer->valid());
-
     bool writeOperation = ((mState.getAccessFlags() & GL_MAP_WRITE_BIT) != 0);
 
+    return unmapRangeImpl(contextVk, writeOperation, static_cast<size_t>(mState.getMapOffset()),
+                          static_cast<size_t>(mState.getMapLength()));
+}
+
+angle::Result BufferVk::unmapRangeImpl(ContextVk *contextVk,
+                                       bool writeOperation,
+                                       size_t offset,
+                                       size_t size)
+{
+    ASSERT(mBuffer && mBuffer->valid());
+
     if (!mShadowBuffer.valid() && mBuffer->isHostVisible())
     {
         mBuffer->unmap(contextVk->getRenderer());
     }
     else
     {
-        size_t offset = static_cast<size_t>(mState.getMapOffset());
-        size_t size   = static_cast<size_t>(mState.getMapLength());
-
         // If it was a write operation we need to update the buffer with new data.
         if (writeOperation)
         {
@@ -684,7 +742,7 @@ angle::Result BufferVk::unmapImpl(ContextVk *contextVk)
 
     if (writeOperation)
     {
-        markConversionBuffersDirty();
+        markConversionBuffersDirty(offset, size);
     }
 
     return angle::Result::Continue;
@@ -696,10 +754,12 @@ angle::Result BufferVk::getSubData(const gl::Context *context,
                                    void *outData)
 {
     ASSERT(offset + size <= getSize());
+    ContextVk *contextVk = vk::GetImpl(context);
+    ANGLE_TRY(flushPendingPackPixels(contextVk));
+
     if (!mShadowBuffer.valid())
     {
         ASSERT(mBuffer && mBuffer->valid());
-        ContextVk *contextVk = vk::GetImpl(context);
         void *mapPtr;
         ANGLE_TRY(mapRangeImpl(contextVk, offset, size, 0, &mapPtr));
         memcpy(outData, mapPtr, size);
@@ -856,6 +916,9 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
                                     size_t size,
                                     size_t offset)
 {
+    // The pending readbacks land before the new data.
+    ANGLE_TRY(flushPendingPackPixels(contextVk));
+
     // Update shadow buffer
     updateShadowBuffer(data, size, offset);
 
@@ -882,7 +945,7 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
     }
 
     // Update conversions
-    markConversionBuffersDirty();
+    markConversionBuffersDirty(offset, size);
 
     return angle::Result::Continue;
 }
@@ -905,12 +968,242 @@ ConversionBuffer *BufferVk::getVertexConversionBuffer(RendererVk *renderer,
     return &mVertexConversionBuffers.back();
 }
 
+const LineLoopConversion *BufferVk::getLineLoopConversion(const LineLoopConversionKey &key) const
+{
+    auto iter = mLineLoopConversions.find(key);
+    return iter != mLineLoopConversions.end() ? &iter->second : nullptr;
+}
+
+angle::Result BufferVk::allocateLineLoopConversion(ContextVk *contextVk,
+                                                   const LineLoopConversionKey &key,
+                                                   size_t sizeInBytes,
+                                                   uint32_t indexCount,
+                                                   uint8_t **ptrOut,
+                                                   LineLoopConversion *conversionOut)
+{
+    if (!mLineLoopConversionBuffer.valid())
+    {
+        // The alignment fits both index types, see LineLoopHelper.
+        mLineLoopConversionBuffer.init(contextVk->getRenderer(), kLineLoopConversionBufferUsage,
+                                       sizeof(uint32_t), kLineLoopConversionBufferInitialSize, true,
+                                       vk::DynamicBufferPolicy::OneShotUse);
+    }
+
+    VkDeviceSize offset     = 0;
+    bool newBufferAllocated = false;
+    mLineLoopConversionBuffer.releaseInFlightBuffers(contextVk);
+    ANGLE_TRY(mLineLoopConversionBuffer.allocate(contextVk, sizeInBytes, ptrOut, nullptr, &offset,
+                                                 &newBufferAllocated));
+
+    // The previous buffer is released once the GPU is done with it, so drop the conversions made
+    // in it.
+    if (newBufferAllocated)
+    {
+        mLineLoopConversions.clear();
+    }
+
+    LineLoopConversion &conversion = mLineLoopConversions[key];
+    conversion.buffer              = mLineLoopConversionBuffer.getCurrentBuffer();
+    conversion.offset              = offset;
+    conversion.indexCount          = indexCount;
+    *conversionOut                 = conversion;
+
+    return angle::Result::Continue;
+}
+
+angle::Result BufferVk::flushLineLoopConversions(ContextVk *contextVk)
+{
+    return mLineLoopConversionBuffer.flush(contextVk);
+}
+
+bool BufferVk::isReadableWithoutWait(ContextVk *contextVk)
+{
+    if (mShadowBuffer.valid())
+    {
+        return true;
+    }
+
+    return mBuffer != nullptr && mBuffer->isHostVisible() && !hasPendingPackPixels() &&
+           !mBuffer->isCurrentlyInUse(contextVk->getLastCompletedQueueSerial());
+}
+
+angle::Result BufferVk::deferPackPixels(ContextVk *contextVk,
+                                        size_t stagingSize,
+                                        const PackPixelsParams &params,
+                                        const angle::Format &readFormat,
+                                        GLuint inputPitch,
+                                        ptrdiff_t outputOffset,
+                                        vk::BufferHelper **stagingBufferOut,
+                                        VkDeviceSize *stagingOffsetOut)
+{
+    if (!mPackPixelsStagingBuffer.valid())
+    {
+        mPackPixelsStagingBuffer.initWithFlags(
+            contextVk->getRenderer(), VK_BUFFER_USAGE_TRANSFER_DST_BIT, kPackPixelsStagingAlignment,
+            kPackPixelsStagingInitialSize, kPackPixelsStagingMemoryFlags,
+            vk::DynamicBufferPolicy::OneShotUse);
+    }
+
+    // The staging buffers that fill up stay mapped until the readbacks in them are packed.
+    uint8_t *stagingData = nullptr;
+    ANGLE_TRY(mPackPixelsStagingBuffer.allocate(contextVk, stagingSize, &stagingData, nullptr,
+                                                stagingOffsetOut, nullptr));
+    *stagingBufferOut = mPackPixelsStagingBuffer.getCurrentBuffer();
+
+    if (mPendingPackPixels.empty())
+    {
+        contextVk->getShareGroupVk()->getBuffersWithPendingPackPixels()->push_back(this);
+    }
+
+    mPendingPackPixels.push_back(
+        {*stagingBufferOut, stagingData, params, &readFormat, inputPitch, outputOffset});
+
+    return angle::Result::Continue;
+}
+
+angle::Result BufferVk::flushPendingPackPixels(ContextVk *contextVk)
+{
+    if (mPendingPackPixels.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "BufferVk::flushPendingPackPixels");
+
+    // Take the readbacks first, as mapping the buffer to pack them flushes them too.
+    std::vector<PendingPackPixels> pendingPackPixels = std::move(mPendingPackPixels);
+    mPendingPackPixels.clear();
+
+    angle::Result result = packPixels(contextVk, pendingPackPixels);
+    releasePendingPackPixels(contextVk);
+
+    return result;
+}
+
+angle::Result BufferVk::packPixels(ContextVk *contextVk,
+                                   const std::vector<PendingPackPixels> &pendingPackPixels)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+
+    // Waiting for the last readback first lets the waits for the earlier ones return immediately.
+    for (auto iter = pendingPackPixels.rbegin(); iter != pendingPackPixels.rend(); ++iter)
+    {
+        ANGLE_TRY(iter->stagingBuffer->waitForIdle(contextVk, "GPU stall due to ReadPixels"));
+    }
+
+    const size_t size = static_cast<size_t>(mState.getSize());
+    void *mapPtr      = nullptr;
+    ANGLE_TRY(mapRangeImpl(contextVk, 0, size, 0, &mapPtr));
+
+    vk::BufferHelper *invalidatedBuffer = nullptr;
+    for (const PendingPackPixels &packPixels : pendingPackPixels)
+    {
+        // The staging memory may not be host coherent, so it's invalidated before it's read.
+        // Consecutive readbacks are mostly suballocated from the same buffer.
+        vk::BufferHelper *stagingBuffer = packPixels.stagingBuffer;
+        if (stagingBuffer != invalidatedBuffer)
+        {
+            ANGLE_TRY(stagingBuffer->invalidate(renderer, 0, stagingBuffer->getSize()));
+            invalidatedBuffer = stagingBuffer;
+        }
+
+        PackPixels(packPixels.params, *packPixels.readFormat, packPixels.inputPitch,
+                   packPixels.stagingData,
+                   static_cast<uint8_t *>(mapPtr) + packPixels.outputOffset);
+    }
+
+    // Unmapping as a write updates the buffer from the shadow buffer or host visible copy, if any.
+    return unmapRangeImpl(contextVk, true, 0, size);
+}
+
+void BufferVk::releasePendingPackPixels(ContextVk *contextVk)
+{
+    mPendingPackPixels.clear();
+
+    // The staging buffers that are no longer current can be reused once the GPU is done with them.
+    if (mPackPixelsStagingBuffer.valid())
+    {
+        mPackPixelsStagingBuffer.releaseInFlightBuffers(contextVk);
+    }
+
+    std::vector<BufferVk *> *buffers =
+        contextVk->getShareGroupVk()->getBuffersWithPendingPackPixels();
+    buffers->erase(std::remove(buffers->begin(), buffers->end(), this), buffers->end());
+}
+
+bool BufferVk::isUsedByCommands(const gl::State &state) const
+{
+    // The pixel pack binding is only used by ReadPixels.  Any other binding, including those of
+    // vertex arrays and transform feedback, may be used by draws and dispatches.
+    const gl::Buffer *packBuffer = state.getTargetBuffer(gl::BufferBinding::PixelPack);
+    const int packBindingCount   = packBuffer && vk::GetImpl(packBuffer) == this ? 1 : 0;
+    if (mState.getBindingCount() > packBindingCount)
+    {
+        return true;
+    }
+
+    // Buffer textures are not bindings of the buffer.
+    const gl::ProgramExecutable *executable = state.getProgramExecutable();
+    if (executable == nullptr)
+    {
+        return false;
+    }
+
+    const gl::ActiveTexturesCache &textures = state.getActiveTexturesCache();
+    for (size_t textureUnit : executable->getActiveSamplersMask())
+    {
+        const gl::Texture *texture = textures[textureUnit];
+        if (texture && texture->getBuffer().get() &&
+            vk::GetImpl(texture->getBuffer().get()) == this)
+        {
+            return true;
+        }
+    }
+
+    for (size_t imageUnit : executable->getActiveImagesMask())
+    {
+        const gl::Texture *texture = state.getImageUnit(imageUnit).texture.get();
+        if (texture && texture->getBuffer().get() &&
+            vk::GetImpl(texture->getBuffer().get()) == this)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void BufferVk::markConversionBuffersDirty()
 {
     for (VertexConversionBuffer &buffer : mVertexConversionBuffers)
     {
         buffer.dirty = true;
     }
+    mLineLoopConversions.clear();
+}
+
+void BufferVk::markConversionBuffersDirty(size_t offset, size_t size)
+{
+    for (VertexConversionBuffer &buffer : mVertexConversionBuffers)
+    {
+        buffer.dirty = true;
+    }
+
+    // Only the line loops converted from the changed range need to be converted again.
+    for (auto iter = mLineLoopConversions.begin(); iter != mLineLoopConversions.end();)
+    {
+        const LineLoopConversionKey &key = iter->first;
+        const VkDeviceSize keyEnd =
+            key.offset + key.indexCount * gl::GetDrawElementsTypeSize(key.getIndexType());
+        if (key.offset < offset + size && offset < keyEnd)
+        {
+            mLineLoopConversions.erase(iter++);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
 }
 
 void BufferVk::onDataChanged()
@@ -41,6 +41,41 @@ struct ConversionBuffer
     vk::DynamicBuffer data;
 };
 
+// Line loop conversions are identified by the range of indices they were made from.
+struct LineLoopConversionKey
+{
+    LineLoopConversionKey(gl::DrawElementsType indexTypeIn,
+                          uint32_t indexCountIn,
+                          VkDeviceSize offsetIn,
+                          bool primitiveRestartIn);
+
+    gl::DrawElementsType getIndexType() const
+    {
+        return static_cast<gl::DrawElementsType>(indexType);
+    }
+    size_t hash() const;
+    bool operator==(const LineLoopConversionKey &other) const;
+
+    VkDeviceSize offset;
+    uint32_t indexCount;
+    uint8_t indexType;
+    uint8_t primitiveRestart;
+    uint8_t padding[2];
+};
+
+struct LineLoopConversionKeyHash
+{
+    size_t operator()(const LineLoopConversionKey &key) const { return key.hash(); }
+};
+
+// A converted range of indices, which closes the loops.
+struct LineLoopConversion
+{
+    vk::BufferHelper *buffer;
+    VkDeviceSize offset;
+    uint32_t indexCount;
+};
+
 class BufferVk : public BufferImpl
 {
   public:
@@ -122,12 +157,42 @@ class BufferVk : public BufferImpl
                                void **mapPtr);
     angle::Result unmapImpl(ContextVk *contextVk);
 
+    // Takes a readback into the buffer.  Returns the staging memory the caller copies the pixels
+    // into.  Their conversion on the CPU is deferred until the buffer is next accessed, so
+    // ReadPixels doesn't wait for the GPU.
+    angle::Result deferPackPixels(ContextVk *contextVk,
+                                  size_t stagingSize,
+                                  const PackPixelsParams &params,
+                                  const angle::Format &readFormat,
+                                  GLuint inputPitch,
+                                  ptrdiff_t outputOffset,
+                                  vk::BufferHelper **stagingBufferOut,
+                                  VkDeviceSize *stagingOffsetOut);
+    // Waits for the deferred readbacks and packs their pixels into the buffer.
+    angle::Result flushPendingPackPixels(ContextVk *contextVk);
+    bool hasPendingPackPixels() const { return !mPendingPackPixels.empty(); }
+    // Whether draws and dispatches may access the buffer with the current state.
+    bool isUsedByCommands(const gl::State &state) const;
+
     ConversionBuffer *getVertexConversionBuffer(RendererVk *renderer,
                                                 angle::FormatID formatID,
                                                 GLuint stride,
                                                 size_t offset,
                                                 bool hostVisible);
 
+    // Line loop conversions of the buffer's indices are cached until the indices change.
+    const LineLoopConversion *getLineLoopConversion(const LineLoopConversionKey &key) const;
+    angle::Result allocateLineLoopConversion(ContextVk *contextVk,
+                                             const LineLoopConversionKey &key,
+                                             size_t sizeInBytes,
+                                             uint32_t indexCount,
+                                             uint8_t **ptrOut,
+                                             LineLoopConversion *conversionOut);
+    angle::Result flushLineLoopConversions(ContextVk *contextVk);
+
+    // Whether the data can be read on the CPU without waiting for the GPU.
+    bool isReadableWithoutWait(ContextVk *contextVk);
+
   private:
     angle::Result initializeShadowBuffer(ContextVk *contextVk,
                                          gl::BufferBinding target,
@@ -175,12 +240,30 @@ class BufferVk : public BufferImpl
     angle::Result handleDeviceLocalBufferUnmap(ContextVk *contextVk,
                                                VkDeviceSize offset,
                                                VkDeviceSize size);
+    angle::Result unmapRangeImpl(ContextVk *contextVk,
+                                 bool writeOperation,
+                                 size_t offset,
+                                 size_t size);
     angle::Result setDataImpl(ContextVk *contextVk,
                               const uint8_t *data,
                               size_t size,
                               size_t offset);
     void release(ContextVk *context);
     void markConversionBuffersDirty();
+    void markConversionBuffersDirty(size_t offset, size_t size);
+
+    struct PendingPackPixels
+    {
+        vk::BufferHelper *stagingBuffer;
+        const uint8_t *stagingData;
+        PackPixelsParams params;
+        const angle::Format *readFormat;
+        GLuint inputPitch;
+        ptrdiff_t outputOffset;
+    };
+    angle::Result packPixels(ContextVk *contextVk,
+                             const std::vector<PendingPackPixels> &pendingPackPixels);
+    void releasePendingPackPixels(ContextVk *contextVk);
 
     angle::Result acquireBufferHelper(ContextVk *contextVk, size_t sizeInBytes);
 
@@ -220,6 +303,17 @@ class BufferVk : public BufferImpl
 
     // A cache of converted vertex data.
     std::vector<VertexConversionBuffer> mVertexConversionBuffers;
+
+    // A cache of index data converted for line loops.  The conversions are made in a single
+    // host-visible buffer, and are dropped when it's full.
+    vk::DynamicBuffer mLineLoopConversionBuffer;
+    angle::HashMap<LineLoopConversionKey, LineLoopConversion, LineLoopConversionKeyHash>
+        mLineLoopConversions;
+
+    // Readbacks whose pixels are yet to be packed into the buffer, in the order they were made.
+    // Their staging memory is suballocated from a host-cached buffer.
+    std::vector<PendingPackPixels> mPendingPackPixels;
+    vk::DynamicBuffer mPackPixelsStagingBuffer;
 };
 
 }  // namespace rx
@@ -7,13 +7,1233 @@
 
 #include "libANGLE/renderer/vulkan/CLCommandQueueVk.h"
 
+#include "libANGLE/renderer/vulkan/CLContextVk.h"
+#include "libANGLE/renderer/vulkan/CLEventVk.h"
+#include "libANGLE/renderer/vulkan/CLMemoryVk.h"
+#include "libANGLE/renderer/vulkan/CLPlatformVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
+
+#include "libANGLE/CLBuffer.h"
+#include "libANGLE/CLCommandQueue.h"
+#include "libANGLE/CLContext.h"
+#include "libANGLE/CLEvent.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 namespace rx
 {
 
-CLCommandQueueVk::CLCommandQueueVk(const cl::CommandQueue &commandQueue)
-    : CLCommandQueueImpl(commandQueue)
+namespace
+{
+
+// Bounds the latency of commands which are never flushed.
+constexpr size_t kMaxBatchedCommands = 128;
+
+// Returns one copy for each row of a rectangular region. Pitches of zero are derived from the
+// region, as specified for the rectangular buffer commands.
+std::vector<VkBufferCopy> GetRectCopies(const size_t srcOrigin[3],
+                                        const size_t dstOrigin[3],
+                                        const size_t region[3],
+                                        size_t srcRowPitch,
+                                        size_t srcSlicePitch,
+                                        size_t dstRowPitch,
+                                        size_t dstSlicePitch)
+{
+    srcRowPitch   = srcRowPitch != 0u ? srcRowPitch : region[0];
+    srcSlicePitch = srcSlicePitch != 0u ? srcSlicePitch : region[1] * srcRowPitch;
+    dstRowPitch   = dstRowPitch != 0u ? dstRowPitch : region[0];
+    dstSlicePitch = dstSlicePitch != 0u ? dstSlicePitch : region[1] * dstRowPitch;
+
+    std::vector<VkBufferCopy> copies;
+    copies.reserve(region[1] * region[2]);
+    for (size_t z = 0; z < region[2]; ++z)
+    {
+        for (size_t y = 0; y < region[1]; ++y)
+        {
+            VkBufferCopy copy = {};
+            copy.srcOffset    = (srcOrigin[2] + z) * srcSlicePitch +
+                             (srcOrigin[1] + y) * srcRowPitch + srcOrigin[0];
+            copy.dstOffset = (dstOrigin[2] + z) * dstSlicePitch +
+                             (dstOrigin[1] + y) * dstRowPitch + dstOrigin[0];
+            copy.size = region[0];
+            copies.push_back(copy);
+        }
+    }
+    return copies;
+}
+
+size_t GetTotalCopySize(const std::vector<VkBufferCopy> &copies)
+{
+    size_t size = 0;
+    for (const VkBufferCopy &copy : copies)
+    {
+        size += static_cast<size_t>(copy.size);
+    }
+    return size;
+}
+
+// Returns in |statusOut| CL_COMPLETE if the commands which wait for |event| of another queue or of
+// the user can be submitted, CL_QUEUED if they have to be held, or the error of a failed event.
+// All batches go to the same Vulkan queue, and each batch starts with a full barrier, so a command
+// of another queue is ordered before the batches submitted after its own.
+cl_int GetWaitEventStatus(const cl::Event &event, cl_int *statusOut)
+{
+    CLEventVk &eventVk      = event.getImpl<CLEventVk>();
+    cl::CommandQueue *queue = event.getCommandQueue().get();
+    if (queue == nullptr)
+    {
+        ANGLE_CL_TRY(eventVk.getCommandExecutionStatus(*statusOut));
+        *statusOut = *statusOut > CL_COMPLETE ? CL_QUEUED : *statusOut;
+        return CL_SUCCESS;
+    }
+
+    CLCommandQueueVk &queueVk = queue->getImpl<CLCommandQueueVk>();
+    ANGLE_CL_TRY(queueVk.ensureSubmitted(eventVk.getCommandId()));
+    const cl_int status = queueVk.getCommandStatus(eventVk.getCommandId());
+    *statusOut          = status == CL_SUBMITTED ? CL_COMPLETE : status;
+    return CL_SUCCESS;
+}
+
+}  // namespace
+
+CLCommandQueueVk::CLCommandQueueVk(const cl::CommandQueue &commandQueue, CLContextVk *context)
+    : CLCommandQueueImpl(commandQueue),
+      mContext(context),
+      mOutOfOrder(commandQueue.getProperties().isSet(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE)),
+      mBatchHasUnorderedCommands(false),
+      mBatchHasHostAccess(false),
+      mBarrierPending(false),
+      mNextCommandId(1),
+      mLastSubmittedCommandId(0),
+      mLastCompletedCommandId(0)
 {}
 
-CLCommandQueueVk::~CLCommandQueueVk() = default;
+CLCommandQueueVk::~CLCommandQueueVk()
+{
+    // Events keep their queue alive, so no callbacks can be pending.
+    ASSERT(mCallbackEvents.empty());
+
+    // Waiting for the events of a held batch could block forever, so its commands are dropped.
+    cl::EventPtrs waitEvents;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        waitEvents.swap(mBatchWaitEvents);
+        if (!waitEvents.empty())
+        {
+            WARN() << "Released a command queue with commands waiting for events";
+            terminateBatch();
+        }
+    }
+    removeFromWaitEvents(waitEvents);
+
+    // Releasing a queue flushes it, and the host memory of outstanding reads is still valid.
+    if (finish() != CL_SUCCESS)
+    {
+        WARN() << "Failed to finish the commands of a released command queue";
+    }
+
+    RendererVk *renderer = mContext->getRenderer();
+    for (SubmittedBatch &batch : mSubmittedBatches)
+    {
+        for (Readback &readback : batch.readbacks)
+        {
+            readback.stagingBuffer->release(renderer);
+        }
+    }
+    for (Readback &readback : mBatchReadbacks)
+    {
+        readback.stagingBuffer->release(renderer);
+    }
+    mBatchResourceUseList.releaseResourceUses();
+}
+
+cl_int CLCommandQueueVk::ensureSubmitted(CommandId commandId)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (commandId > mLastSubmittedCommandId)
+    {
+        return mContext->toCLResult(submitBatch());
+    }
+    return CL_SUCCESS;
+}
+
+cl_int CLCommandQueueVk::finishCommand(CommandId commandId)
+{
+    Serial serial;
+    while (true)
+    {
+        cl::EventPtrs waitEvents;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (isTerminated(commandId))
+            {
+                return CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST;
+            }
+            if (commandId <= mLastCompletedCommandId)
+            {
+                return CL_SUCCESS;
+            }
+            if (commandId > mLastSubmittedCommandId)
+            {
+                ANGLE_CL_TRY(mContext->toCLResult(submitBatch()));
+            }
+
+            if (commandId <= mLastSubmittedCommandId)
+            {
+                // Batches are submitted in the order of their commands.
+                auto batch = std::find_if(mSubmittedBatches.begin(), mSubmittedBatches.end(),
+                                          [commandId](const SubmittedBatch &submittedBatch) {
+                                              return submittedBatch.lastCommandId >= commandId;
+                                          });
+                ASSERT(batch != mSubmittedBatches.end());
+                serial = batch->serial;
+                break;
+            }
+
+            // The command is held until the events of its batch have completed.
+            waitEvents = mBatchWaitEvents;
+        }
+
+        // A failed event terminates the command when the batch is resolved, so the error of the
+        // wait isn't returned.
+        for (const cl::EventPtr &event : waitEvents)
+        {
+            event->getImpl<CLEventVk>().wait();
+        }
+        ANGLE_CL_TRY(resolveBatchWaitEvents());
+    }
+
+    ANGLE_CL_TRY(mContext->toCLResult(mContext->getRenderer()->finishToSerial(mContext, serial)));
+    return checkCompletedCommands();
+}
+
+cl_int CLCommandQueueVk::checkCompletedCommands()
+{
+    RendererVk *renderer = mContext->getRenderer();
+    ANGLE_CL_TRY(mContext->toCLResult(renderer->checkCompletedCommands(mContext)));
+
+    std::vector<std::pair<CLEventVk *, cl_int>> completedEvents;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        const Serial lastCompletedSerial = renderer->getLastCompletedQueueSerial();
+
+        while (!mSubmittedBatches.empty() &&
+               mSubmittedBatches.front().serial <= lastCompletedSerial)
+        {
+            SubmittedBatch &batch = mSubmittedBatches.front();
+            for (Readback &readback : batch.readbacks)
+            {
+                ANGLE_CL_TRY(mContext->toCLResult(finishReadback(&readback)));
+            }
+            mLastCompletedCommandId = batch.lastCommandId;
+            mSubmittedBatches.pop_front();
+        }
+
+        auto completedBegin = std::partition(
+            mCallbackEvents.begin(), mCallbackEvents.end(), [this](const CLEventVk *event) {
+                return event->getCommandId() > mLastCompletedCommandId &&
+                       !isTerminated(event->getCommandId());
+            });
+        for (auto event = completedBegin; event != mCallbackEvents.end(); ++event)
+        {
+            completedEvents.emplace_back(*event, isTerminated((*event)->getCommandId())
+                                                     ? CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST
+                                                     : CL_COMPLETE);
+        }
+        mCallbackEvents.erase(completedBegin, mCallbackEvents.end());
+    }
+
+    renderer->cleanupCompletedCommandsGarbage();
+
+    // Callbacks may enqueue new commands, so they are called without holding the lock.
+    for (const std::pair<CLEventVk *, cl_int> &event : completedEvents)
+    {
+        event.first->onCommandCompleted(event.second);
+    }
+    return CL_SUCCESS;
+}
+
+cl_int CLCommandQueueVk::getCommandStatus(CommandId commandId) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (isTerminated(commandId))
+    {
+        return CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST;
+    }
+    if (commandId <= mLastCompletedCommandId)
+    {
+        return CL_COMPLETE;
+    }
+    return commandId <= mLastSubmittedCommandId ? CL_SUBMITTED : CL_QUEUED;
+}
+
+cl_int CLCommandQueueVk::waitForBatch(Serial serial, uint64_t timeout, bool *finishedOut)
+{
+    VkResult result = VK_SUCCESS;
+    ANGLE_CL_TRY(mContext->toCLResult(
+        mContext->getRenderer()->waitForSerialWithUserTimeout(mContext, serial, timeout, &result)));
+    *finishedOut = result != VK_TIMEOUT;
+    return *finishedOut ? checkCompletedCommands() : CL_SUCCESS;
+}
+
+void CLCommandQueueVk::addCallbackEvent(CLEventVk *event)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mCallbackEvents.push_back(event);
+
+    // Commands which are still queued get a completion wait when their batch is submitted.
+    const CommandId commandId = event->getCommandId();
+    if (commandId <= mLastSubmittedCommandId && !isTerminated(commandId))
+    {
+        // The batches of completed commands are gone, and a null serial has already finished.
+        auto batch = std::find_if(mSubmittedBatches.begin(), mSubmittedBatches.end(),
+                                  [commandId](const SubmittedBatch &submittedBatch) {
+                                      return submittedBatch.lastCommandId >= commandId;
+                                  });
+        addCompletionWait(batch != mSubmittedBatches.end() ? batch->serial : Serial());
+    }
+}
+
+cl_int CLCommandQueueVk::resolveBatchWaitEvents()
+{
+    while (true)
+    {
+        cl::EventPtrs waitEvents;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            waitEvents = mBatchWaitEvents;
+        }
+        if (waitEvents.empty())
+        {
+            return CL_SUCCESS;
+        }
+
+        // The events are checked without holding the lock, since that may submit the batches of
+        // other queues.
+        bool held   = false;
+        bool failed = false;
+        for (const cl::EventPtr &event : waitEvents)
+        {
+            cl_int status = CL_QUEUED;
+            ANGLE_CL_TRY(GetWaitEventStatus(*event, &status));
+            held   = held || status > CL_COMPLETE;
+            failed = failed || status < CL_COMPLETE;
+        }
+        if (held && !failed)
+        {
+            return CL_SUCCESS;
+        }
+
+        std::vector<CLCommandQueueVk *> waitingQueues;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            // Another thread may have added events to the batch, or resolved it, meanwhile.
+            if (mBatchWaitEvents.size() != waitEvents.size() ||
+                !std::equal(waitEvents.begin(), waitEvents.end(), mBatchWaitEvents.begin()))
+            {
+                continue;
+            }
+
+            // Clearing a FastVector keeps its elements alive, so the events are released by
+            // swapping them out.
+            cl::EventPtrs().swap(mBatchWaitEvents);
+            if (failed)
+            {
+                terminateBatch();
+            }
+            else
+            {
+                ANGLE_CL_TRY(mContext->toCLResult(submitBatch()));
+            }
+            std::swap(waitingQueues, mWaitingQueues);
+        }
+
+        removeFromWaitEvents(waitEvents);
+        for (CLCommandQueueVk *queue : waitingQueues)
+        {
+            ANGLE_CL_TRY(queue->resolveBatchWaitEvents());
+        }
+
+        // The callbacks of the terminated commands are called right away.
+        return failed ? checkCompletedCommands() : CL_SUCCESS;
+    }
+}
+
+void CLCommandQueueVk::addWaitingQueue(CLCommandQueueVk *queue)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (std::find(mWaitingQueues.begin(), mWaitingQueues.end(), queue) == mWaitingQueues.end())
+    {
+        mWaitingQueues.push_back(queue);
+    }
+}
+
+void CLCommandQueueVk::removeWaitingQueue(CLCommandQueueVk *queue)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mWaitingQueues.erase(std::remove(mWaitingQueues.begin(), mWaitingQueues.end(), queue),
+                         mWaitingQueues.end());
+}
+
+cl_int CLCommandQueueVk::setProperty(cl::CommandQueueProperties properties, cl_bool enable)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (properties.isSet(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE))
+    {
+        // Commands enqueued in order execute after all earlier commands.
+        mOutOfOrder     = enable != CL_FALSE;
+        mBarrierPending = mBarrierPending || !mOutOfOrder;
+    }
+    return CL_SUCCESS;
+}
+
+cl_int CLCommandQueueVk::enqueueReadBuffer(const cl::Buffer &buffer,
+                                           bool blocking,
+                                           size_t offset,
+                                           size_t size,
+                                           void *ptr,
+                                           const cl::EventPtrs &waitEvents,
+                                           CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    CommandId dependency = 0;
+    ANGLE_CL_TRY(processWaitEvents(waitEvents, &dependency));
+
+    VkBufferCopy copy = {};
+    copy.srcOffset    = offset;
+    copy.dstOffset    = 0;
+    copy.size         = size;
+
+    CommandId commandId        = 0;
+    const angle::Result result = readBuffer(buffer, ptr, {copy}, dependency, &commandId);
+    return onCommandEnqueued(result, commandId, blocking, eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueWriteBuffer(const cl::Buffer &buffer,
+                                            bool blocking,
+                                            size_t offset,
+                                            size_t size,
+                                            const void *ptr,
+                                            const cl::EventPtrs &waitEvents,
+                                            CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    CommandId dependency = 0;
+    ANGLE_CL_TRY(processWaitEvents(waitEvents, &dependency));
+
+    VkBufferCopy copy = {};
+    copy.srcOffset    = 0;
+    copy.dstOffset    = offset;
+    copy.size         = size;
+
+    // The host memory is copied to a staging buffer right away, so a blocking write doesn't have
+    // to wait for the command.
+    CommandId commandId        = 0;
+    const angle::Result result = writeBuffer(buffer, ptr, {copy}, dependency, &commandId);
+    return onCommandEnqueued(result, commandId, false, eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueReadBufferRect(const cl::Buffer &buffer,
+                                               bool blocking,
+                                               const size_t bufferOrigin[3],
+                                               const size_t hostOrigin[3],
+                                               const size_t region[3],
+                                               size_t bufferRowPitch,
+                                               size_t bufferSlicePitch,
+                                               size_t hostRowPitch,
+                                               size_t hostSlicePitch,
+                                               void *ptr,
+                                               const cl::EventPtrs &waitEvents,
+                                               CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    CommandId dependency = 0;
+    ANGLE_CL_TRY(processWaitEvents(waitEvents, &dependency));
+
+    const std::vector<VkBufferCopy> copies =
+        GetRectCopies(bufferOrigin, hostOrigin, region, bufferRowPitch, bufferSlicePitch,
+                      hostRowPitch, hostSlicePitch);
+
+    CommandId commandId        = 0;
+    const angle::Result result = readBuffer(buffer, ptr, copies, dependency, &commandId);
+    return onCommandEnqueued(result, commandId, blocking, eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueWriteBufferRect(const cl::Buffer &buffer,
+                                                bool blocking,
+                                                const size_t bufferOrigin[3],
+                                                const size_t hostOrigin[3],
+                                                const size_t region[3],
+                                                size_t bufferRowPitch,
+                                                size_t bufferSlicePitch,
+                                                size_t hostRowPitch,
+                                                size_t hostSlicePitch,
+                                                const void *ptr,
+                                                const cl::EventPtrs &waitEvents,
+                                                CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    CommandId dependency = 0;
+    ANGLE_CL_TRY(processWaitEvents(waitEvents, &dependency));
+
+    const std::vector<VkBufferCopy> copies =
+        GetRectCopies(hostOrigin, bufferOrigin, region, hostRowPitch, hostSlicePitch,
+                      bufferRowPitch, bufferSlicePitch);
+
+    CommandId commandId        = 0;
+    const angle::Result result = writeBuffer(buffer, ptr, copies, dependency, &commandId);
+    return onCommandEnqueued(result, commandId, false, eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueCopyBuffer(const cl::Buffer &srcBuffer,
+                                           const cl::Buffer &dstBuffer,
+                                           size_t srcOffset,
+                                           size_t dstOffset,
+                                           size_t size,
+                                           const cl::EventPtrs &waitEvents,
+                                           CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    CommandId dependency = 0;
+    ANGLE_CL_TRY(processWaitEvents(waitEvents, &dependency));
+
+    VkBufferCopy copy = {};
+    copy.srcOffset    = srcOffset;
+    copy.dstOffset    = dstOffset;
+    copy.size         = size;
+
+    CommandId commandId        = 0;
+    const angle::Result result = copyBuffer(srcBuffer, dstBuffer, {copy}, dependency, &commandId);
+    return onCommandEnqueued(result, commandId, false, eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueCopyBufferRect(const cl::Buffer &srcBuffer,
+                                               const cl::Buffer &dstBuffer,
+                                               const size_t srcOrigin[3],
+                                               const size_t dstOrigin[3],
+                                               const size_t region[3],
+                                               size_t srcRowPitch,
+                                               size_t srcSlicePitch,
+                                               size_t dstRowPitch,
+                                               size_t dstSlicePitch,
+                                               const cl::EventPtrs &waitEvents,
+                                               CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    CommandId dependency = 0;
+    ANGLE_CL_TRY(processWaitEvents(waitEvents, &dependency));
+
+    const std::vector<VkBufferCopy> copies = GetRectCopies(
+        srcOrigin, dstOrigin, region, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch);
+
+    CommandId commandId        = 0;
+    const angle::Result result = copyBuffer(srcBuffer, dstBuffer, copies, dependency, &commandId);
+    return onCommandEnqueued(result, commandId, false, eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueFillBuffer(const cl::Buffer &buffer,
+                                           const void *pattern,
+                                           size_t patternSize,
+                                           size_t offset,
+                                           size_t size,
+                                           const cl::EventPtrs &waitEvents,
+                                           CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    CommandId dependency = 0;
+    ANGLE_CL_TRY(processWaitEvents(waitEvents, &dependency));
+
+    CommandId commandId = 0;
+    const angle::Result result =
+        fillBuffer(buffer, pattern, patternSize, offset, size, dependency, &commandId);
+    return onCommandEnqueued(result, commandId, false, eventCreateFunc);
+}
+
+void *CLCommandQueueVk::enqueueMapBuffer(const cl::Buffer &buffer,
+                                         bool blocking,
+                                         cl::MapFlags mapFlags,
+                                         size_t offset,
+                                         size_t size,
+                                         const cl::EventPtrs &waitEvents,
+                                         CLEventImpl::CreateFunc *eventCreateFunc,
+                                         cl_int &errorCode)
+{
+    CommandId dependency = 0;
+    errorCode            = processWaitEvents(waitEvents, &dependency);
+    if (errorCode != CL_SUCCESS)
+    {
+        return nullptr;
+    }
+
+    CLMemoryVk &memory        = buffer.getImpl<CLMemoryVk>();
+    uint8_t *const hostMemory = memory.getHostMemory();
+    uint8_t *ptr              = nullptr;
+    CommandId commandId       = 0;
+    angle::Result result      = angle::Result::Continue;
+    if (hostMemory != nullptr)
+    {
+        // The buffer is always mapped, so the map only makes earlier device writes visible to the
+        // host.
+        ptr = hostMemory + offset;
+        std::lock_guard<std::mutex> lock(mMutex);
+        mBatchHasHostAccess = true;
+        result              = addCommand(dependency, nullptr, &commandId);
+    }
+    else if (mapFlags.isSet(CL_MAP_WRITE_INVALIDATE_REGION))
+    {
+        // The mapped region is overwritten, so its contents don't have to be read.
+        ptr = memory.addStagedMapping(offset, size, mapFlags);
+        std::lock_guard<std::mutex> lock(mMutex);
+        result = addCommand(dependency, nullptr, &commandId);
+    }
+    else
+    {
+        VkBufferCopy copy = {};
+        copy.srcOffset    = offset;
+        copy.dstOffset    = 0;
+        copy.size         = size;
+
+        ptr    = memory.addStagedMapping(offset, size, mapFlags);
+        result = readBuffer(buffer, ptr, {copy}, dependency, &commandId);
+    }
+
+    errorCode = onCommandEnqueued(result, commandId, blocking, eventCreateFunc);
+    return errorCode == CL_SUCCESS ? ptr : nullptr;
+}
+
+cl_int CLCommandQueueVk::enqueueReadImage(const cl::Image &image,
+                                          bool blocking,
+                                          const size_t origin[3],
+                                          const size_t region[3],
+                                          size_t rowPitch,
+                                          size_t slicePitch,
+                                          void *ptr,
+                                          const cl::EventPtrs &waitEvents,
+                                          CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    return CL_INVALID_OPERATION;
+}
+
+cl_int CLCommandQueueVk::enqueueWriteImage(const cl::Image &image,
+                                           bool blocking,
+                                           const size_t origin[3],
+                                           const size_t region[3],
+                                           size_t inputRowPitch,
+                                           size_t inputSlicePitch,
+                                           const void *ptr,
+                                           const cl::EventPtrs &waitEvents,
+                                           CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    return CL_INVALID_OPERATION;
+}
+
+cl_int CLCommandQueueVk::enqueueCopyImage(const cl::Image &srcImage,
+                                          const cl::Image &dstImage,
+                                          const size_t srcOrigin[3],
+                                          const size_t dstOrigin[3],
+                                          const size_t region[3],
+                                          const cl::EventPtrs &waitEvents,
+                                          CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    return CL_INVALID_OPERATION;
+}
+
+cl_int CLCommandQueueVk::enqueueFillImage(const cl::Image &image,
+                                          const void *fillColor,
+                                          const size_t origin[3],
+                                          const size_t region[3],
+                                          const cl::EventPtrs &waitEvents,
+                                          CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    return CL_INVALID_OPERATION;
+}
+
+cl_int CLCommandQueueVk::enqueueCopyImageToBuffer(const cl::Image &srcImage,
+                                                  const cl::Buffer &dstBuffer,
+                                                  const size_t srcOrigin[3],
+                                                  const size_t region[3],
+                                                  size_t dstOffset,
+                                                  const cl::EventPtrs &waitEvents,
+                                                  CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    return CL_INVALID_OPERATION;
+}
+
+cl_int CLCommandQueueVk::enqueueCopyBufferToImage(const cl::Buffer &srcBuffer,
+                                                  const cl::Image &dstImage,
+                                                  size_t srcOffset,
+                                                  const size_t dstOrigin[3],
+                                                  const size_t region[3],
+                                                  const cl::EventPtrs &waitEvents,
+                                                  CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    return CL_INVALID_OPERATION;
+}
+
+void *CLCommandQueueVk::enqueueMapImage(const cl::Image &image,
+                                        bool blocking,
+                                        cl::MapFlags mapFlags,
+                                        const size_t origin[3],
+                                        const size_t region[3],
+                                        size_t *imageRowPitch,
+                                        size_t *imageSlicePitch,
+                                        const cl::EventPtrs &waitEvents,
+                                        CLEventImpl::CreateFunc *eventCreateFunc,
+                                        cl_int &errorCode)
+{
+    errorCode = CL_INVALID_OPERATION;
+    return nullptr;
+}
+
+cl_int CLCommandQueueVk::enqueueUnmapMemObject(const cl::Memory &memory,
+                                               void *mappedPtr,
+                                               const cl::EventPtrs &waitEvents,
+                                               CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    // Images can't be mapped yet.
+    ASSERT(memory.getType() == cl::MemObjectType::Buffer);
+
+    CommandId dependency = 0;
+    ANGLE_CL_TRY(processWaitEvents(waitEvents, &dependency));
+
+    CLMemoryVk &memoryVk = memory.getImpl<CLMemoryVk>();
+    CLMemoryVk::StagedMapping mapping = {};
+    if (memoryVk.getHostMemory() == nullptr && !memoryVk.removeStagedMapping(mappedPtr, &mapping))
+    {
+        return CL_INVALID_VALUE;
+    }
+
+    CommandId commandId = 0;
+    angle::Result result;
+    if (mapping.ptr != nullptr &&
+        mapping.flags.isSet(CL_MAP_WRITE | CL_MAP_WRITE_INVALIDATE_REGION))
+    {
+        VkBufferCopy copy = {};
+        copy.srcOffset    = 0;
+        copy.dstOffset    = mapping.offset;
+        copy.size         = mapping.size;
+
+        // The written contents are copied to a staging buffer right away, so the staged memory
+        // can be freed once the unmap is enqueued.
+        result = writeBuffer(static_cast<const cl::Buffer &>(memory), mapping.ptr, {copy},
+                             dependency, &commandId);
+    }
+    else
+    {
+        // Host writes to host memory are visible to the commands submitted after them.
+        std::lock_guard<std::mutex> lock(mMutex);
+        result = addCommand(dependency, nullptr, &commandId);
+    }
+    return onCommandEnqueued(result, commandId, false, eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueMigrateMemObjects(const cl::MemoryPtrs &memObjects,
+                                                  cl::MemMigrationFlags flags,
+                                                  const cl::EventPtrs &waitEvents,
+                                                  CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    // There is a single device, so memory objects never have to be migrated.
+    return enqueueMarkerWithWaitList(waitEvents, eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueNDRangeKernel(const cl::Kernel &kernel,
+                                              cl_uint workDim,
+                                              const size_t *globalWorkOffset,
+                                              const size_t *globalWorkSize,
+                                              const size_t *localWorkSize,
+                                              const cl::EventPtrs &waitEvents,
+                                              CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    return CL_INVALID_OPERATION;
+}
+
+cl_int CLCommandQueueVk::enqueueTask(const cl::Kernel &kernel,
+                                     const cl::EventPtrs &waitEvents,
+                                     CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    return CL_INVALID_OPERATION;
+}
+
+cl_int CLCommandQueueVk::enqueueNativeKernel(cl::UserFunc userFunc,
+                                             void *args,
+                                             size_t cbArgs,
+                                             const cl::BufferPtrs &buffers,
+                                             const std::vector<size_t> bufferPtrOffsets,
+                                             const cl::EventPtrs &waitEvents,
+                                             CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    return CL_INVALID_OPERATION;
+}
+
+cl_int CLCommandQueueVk::enqueueMarkerWithWaitList(const cl::EventPtrs &waitEvents,
+                                                   CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    CommandId dependency = 0;
+    ANGLE_CL_TRY(processWaitEvents(waitEvents, &dependency));
+
+    // Batches complete in order, so a marker completes with its batch, after all earlier commands.
+    CommandId commandId = 0;
+    angle::Result result;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        result = addCommand(dependency, nullptr, &commandId);
+    }
+    return onCommandEnqueued(result, commandId, false, eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueMarker(CLEventImpl::CreateFunc &eventCreateFunc)
+{
+    return enqueueMarkerWithWaitList(cl::EventPtrs(), &eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueWaitForEvents(const cl::EventPtrs &events)
+{
+    // Commands of this queue wait for the events like for a barrier, without an event of their own.
+    return enqueueBarrierWithWaitList(events, nullptr);
+}
+
+cl_int CLCommandQueueVk::enqueueBarrierWithWaitList(const cl::EventPtrs &waitEvents,
+                                                    CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    CommandId dependency = 0;
+    ANGLE_CL_TRY(processWaitEvents(waitEvents, &dependency));
+
+    CommandId commandId = 0;
+    angle::Result result;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        result          = addCommand(dependency, nullptr, &commandId);
+        mBarrierPending = true;
+    }
+    return onCommandEnqueued(result, commandId, false, eventCreateFunc);
+}
+
+cl_int CLCommandQueueVk::enqueueBarrier()
+{
+    return enqueueBarrierWithWaitList(cl::EventPtrs(), nullptr);
+}
+
+cl_int CLCommandQueueVk::flush()
+{
+    // Only the pending batch is submitted, so repeated flushes are cheap.
+    ANGLE_CL_TRY(ensureSubmitted(std::numeric_limits<CommandId>::max()));
+    return checkCompletedCommands();
+}
+
+cl_int CLCommandQueueVk::finish()
+{
+    CommandId lastCommandId = 0;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        lastCommandId = mNextCommandId - 1;
+    }
+    const cl_int errorCode = finishCommand(lastCommandId);
+    if (errorCode != CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST)
+    {
+        return errorCode;
+    }
+
+    // The last commands were terminated, so only the commands submitted before them are waited for.
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        lastCommandId = mSubmittedBatches.empty() ? 0 : mSubmittedBatches.back().lastCommandId;
+    }
+    return finishCommand(lastCommandId);
+}
+
+void CLCommandQueueVk::RecordTransferCommand(vk::PrimaryCommandBuffer *commandBuffer,
+                                             const TransferCommand &command)
+{
+    if (command.barrier)
+    {
+        VkMemoryBarrier memoryBarrier = {};
+        memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask   = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        commandBuffer->memoryBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                     &memoryBarrier);
+    }
+
+    if (command.srcBuffer != VK_NULL_HANDLE)
+    {
+        vkCmdCopyBuffer(commandBuffer->getHandle(), command.srcBuffer, command.dstBuffer,
+                        static_cast<uint32_t>(command.regions.size()), command.regions.data());
+    }
+    else
+    {
+        ASSERT(command.regions.size() == 1);
+        vkCmdFillBuffer(commandBuffer->getHandle(), command.dstBuffer,
+                        command.regions[0].dstOffset, command.regions[0].size, command.fillData);
+    }
+}
+
+cl_int CLCommandQueueVk::processWaitEvents(const cl::EventPtrs &waitEvents,
+                                           CommandId *dependencyOut)
+{
+    *dependencyOut = 0;
+    cl::EventPtrs blockingEvents;
+    for (const cl::EventPtr &event : waitEvents)
+    {
+        CLEventVk &eventVk      = event->getImpl<CLEventVk>();
+        cl::CommandQueue *queue = event->getCommandQueue().get();
+        if (queue == &mCommandQueue)
+        {
+            *dependencyOut = std::max(*dependencyOut, eventVk.getCommandId());
+            continue;
+        }
+
+        cl_int status = CL_QUEUED;
+        ANGLE_CL_TRY(GetWaitEventStatus(*event, &status));
+        if (status < CL_COMPLETE)
+        {
+            return CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST;
+        }
+        if (status > CL_COMPLETE)
+        {
+            if (queue != nullptr)
+            {
+                queue->getImpl<CLCommandQueueVk>().addWaitingQueue(this);
+            }
+            else
+            {
+                eventVk.addWaitingQueue(this);
+            }
+            blockingEvents.push_back(event);
+        }
+    }
+
+    if (blockingEvents.empty())
+    {
+        return CL_SUCCESS;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // The earlier commands don't wait for the events, so they are submitted before the batch
+        // is held.
+        if (mBatchWaitEvents.empty())
+        {
+            ANGLE_CL_TRY(mContext->toCLResult(submitBatch()));
+        }
+        for (const cl::EventPtr &event : blockingEvents)
+        {
+            mBatchWaitEvents.push_back(event);
+        }
+    }
+
+    // The events may have completed before this queue was registered with them.
+    return resolveBatchWaitEvents();
+}
+
+void CLCommandQueueVk::removeFromWaitEvents(const cl::EventPtrs &waitEvents)
+{
+    for (const cl::EventPtr &event : waitEvents)
+    {
+        cl::CommandQueue *queue = event->getCommandQueue().get();
+        if (queue != nullptr)
+        {
+            queue->getImpl<CLCommandQueueVk>().removeWaitingQueue(this);
+        }
+        else
+        {
+            event->getImpl<CLEventVk>().removeWaitingQueue(this);
+        }
+    }
+}
+
+void CLCommandQueueVk::addCompletionWait(Serial serial)
+{
+    // The wait holds a reference to this queue until the callbacks have been called.
+    cl::CommandQueuePtr queue(const_cast<cl::CommandQueue *>(&mCommandQueue));
+    mCommandQueue.getContext().getPlatform().getImpl<CLPlatformVk>().addCompletionWait(
+        std::move(queue), serial);
+}
+
+bool CLCommandQueueVk::isTerminated(CommandId commandId) const
+{
+    return std::any_of(mTerminatedCommands.begin(), mTerminatedCommands.end(),
+                       [commandId](const std::pair<CommandId, CommandId> &commands) {
+                           return commandId >= commands.first && commandId <= commands.second;
+                       });
+}
+
+void CLCommandQueueVk::terminateBatch()
+{
+    const CommandId lastCommandId = mNextCommandId - 1;
+    if (lastCommandId > mLastSubmittedCommandId)
+    {
+        mTerminatedCommands.emplace_back(mLastSubmittedCommandId + 1, lastCommandId);
+    }
+
+    RendererVk *renderer = mContext->getRenderer();
+    for (Readback &readback : mBatchReadbacks)
+    {
+        readback.stagingBuffer->release(renderer);
+    }
+    mBatch.clear();
+    mBatchReadbacks.clear();
+    mBatchResourceUseList.releaseResourceUses();
+    mBatchHasUnorderedCommands = false;
+    mBatchHasHostAccess        = false;
+    mBarrierPending            = false;
+    mLastSubmittedCommandId    = lastCommandId;
+}
+
+cl_int CLCommandQueueVk::onCommandEnqueued(angle::Result result,
+                                           CommandId commandId,
+                                           bool blocking,
+                                           CLEventImpl::CreateFunc *eventCreateFunc)
+{
+    ANGLE_CL_TRY(mContext->toCLResult(result));
+
+    if (eventCreateFunc != nullptr)
+    {
+        *eventCreateFunc = [this, commandId](const cl::Event &event) {
+            return CLEventImpl::Ptr(new CLEventVk(event, this, commandId));
+        };
+    }
+
+    return blocking ? finishCommand(commandId) : CL_SUCCESS;
+}
+
+angle::Result CLCommandQueueVk::addCommand(CommandId dependency,
+                                           TransferCommand *command,
+                                           CommandId *commandIdOut)
+{
+    if (command != nullptr)
+    {
+        // Commands of an in-order queue depend on all earlier commands. Otherwise only a
+        // dependency within the batch needs a barrier, since the batch starts with one.
+        const bool ordered =
+            !mOutOfOrder || mBarrierPending || dependency > mLastSubmittedCommandId;
+        command->barrier = ordered && mBatchHasUnorderedCommands;
+        mBatch.push_back(std::move(*command));
+        mBatchHasUnorderedCommands = true;
+        mBarrierPending            = false;
+    }
+
+    *commandIdOut = mNextCommandId++;
+
+    if (mNextCommandId - 1 - mLastSubmittedCommandId >= kMaxBatchedCommands)
+    {
+        ANGLE_TRY(submitBatch());
+    }
+    return angle::Result::Continue;
+}
+
+angle::Result CLCommandQueueVk::submitBatch()
+{
+    // A held batch is submitted once the events it waits for have completed.
+    const CommandId lastCommandId = mNextCommandId - 1;
+    if (lastCommandId == mLastSubmittedCommandId || !mBatchWaitEvents.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    const bool hasHostAccess = mBatchHasHostAccess || !mBatchReadbacks.empty();
+    Serial serial;
+    ANGLE_TRY(mContext->submitCommands(
+        [this, hasHostAccess](vk::PrimaryCommandBuffer *commandBuffer) {
+            for (const TransferCommand &command : mBatch)
+            {
+                RecordTransferCommand(commandBuffer, command);
+            }
+
+            // Make the reads into staging buffers and the writes to mapped buffers visible to the
+            // host.
+            if (hasHostAccess)
+            {
+                VkMemoryBarrier memoryBarrier = {};
+                memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                memoryBarrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+                memoryBarrier.dstAccessMask   = VK_ACCESS_HOST_READ_BIT;
+                commandBuffer->memoryBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                             VK_PIPELINE_STAGE_HOST_BIT, &memoryBarrier);
+            }
+        },
+        &mBatchResourceUseList, &serial));
+
+    mSubmittedBatches.push_back({lastCommandId, serial, std::move(mBatchReadbacks)});
+    if (!mCallbackEvents.empty())
+    {
+        addCompletionWait(serial);
+    }
+    mBatch.clear();
+    mBatchReadbacks.clear();
+    mBatchHasUnorderedCommands = false;
+    mBatchHasHostAccess        = false;
+    mBarrierPending            = false;
+    mLastSubmittedCommandId    = lastCommandId;
+
+    return angle::Result::Continue;
+}
+
+angle::Result CLCommandQueueVk::readBuffer(const cl::Buffer &buffer,
+                                           void *ptr,
+                                           const std::vector<VkBufferCopy> &copies,
+                                           CommandId dependency,
+                                           CommandId *commandIdOut)
+{
+    const CLMemoryVk &memory = buffer.getImpl<CLMemoryVk>();
+
+    Readback readback;
+    readback.stagingBuffer.reset(new vk::BufferHelper());
+    readback.hostPtr = static_cast<uint8_t *>(ptr);
+
+    uint8_t *stagingMemory = nullptr;
+    ANGLE_TRY(mContext->initStagingBuffer(GetTotalCopySize(copies), readback.stagingBuffer.get(),
+                                          &stagingMemory));
+
+    // The staging buffer is packed in the order of the copies.
+    TransferCommand command = {};
+    command.srcBuffer       = memory.getBuffer().getBuffer().getHandle();
+    command.dstBuffer       = readback.stagingBuffer->getBuffer().getHandle();
+    command.regions.reserve(copies.size());
+    readback.hostCopies.reserve(copies.size());
+    VkDeviceSize stagingOffset = 0;
+    for (const VkBufferCopy &copy : copies)
+    {
+        command.regions.push_back({memory.getOffset() + copy.srcOffset, stagingOffset, copy.size});
+        readback.hostCopies.push_back({stagingOffset, copy.dstOffset, copy.size});
+        stagingOffset += copy.size;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    memory.getBuffer().retain(&mBatchResourceUseList);
+    readback.stagingBuffer->retain(&mBatchResourceUseList);
+    mBatchReadbacks.push_back(std::move(readback));
+    return addCommand(dependency, &command, commandIdOut);
+}
+
+angle::Result CLCommandQueueVk::writeBuffer(const cl::Buffer &buffer,
+                                            const void *ptr,
+                                            const std::vector<VkBufferCopy> &copies,
+                                            CommandId dependency,
+                                            CommandId *commandIdOut)
+{
+    const CLMemoryVk &memory = buffer.getImpl<CLMemoryVk>();
+    RendererVk *renderer     = mContext->getRenderer();
+
+    const size_t stagingSize = GetTotalCopySize(copies);
+    vk::BufferHelper stagingBuffer;
+    uint8_t *stagingMemory = nullptr;
+    ANGLE_TRY(mContext->initStagingBuffer(stagingSize, &stagingBuffer, &stagingMemory));
+
+    // The staging buffer is packed in the order of the copies.
+    TransferCommand command = {};
+    command.srcBuffer       = stagingBuffer.getBuffer().getHandle();
+    command.dstBuffer       = memory.getBuffer().getBuffer().getHandle();
+    command.regions.reserve(copies.size());
+    const uint8_t *hostMemory  = static_cast<const uint8_t *>(ptr);
+    VkDeviceSize stagingOffset = 0;
+    for (const VkBufferCopy &copy : copies)
+    {
+        std::memcpy(stagingMemory + stagingOffset, hostMemory + copy.srcOffset,
+                    static_cast<size_t>(copy.size));
+        command.regions.push_back({stagingOffset, memory.getOffset() + copy.dstOffset, copy.size});
+        stagingOffset += copy.size;
+    }
+    ANGLE_TRY(stagingBuffer.flush(renderer, 0, stagingSize));
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    memory.getBuffer().retain(&mBatchResourceUseList);
+    stagingBuffer.retain(&mBatchResourceUseList);
+
+    // The staging buffer is kept alive by the batch.
+    stagingBuffer.release(renderer);
+    return addCommand(dependency, &command, commandIdOut);
+}
+
+angle::Result CLCommandQueueVk::copyBuffer(const cl::Buffer &srcBuffer,
+                                           const cl::Buffer &dstBuffer,
+                                           const std::vector<VkBufferCopy> &copies,
+                                           CommandId dependency,
+                                           CommandId *commandIdOut)
+{
+    const CLMemoryVk &srcMemory = srcBuffer.getImpl<CLMemoryVk>();
+    const CLMemoryVk &dstMemory = dstBuffer.getImpl<CLMemoryVk>();
+
+    TransferCommand command = {};
+    command.srcBuffer       = srcMemory.getBuffer().getBuffer().getHandle();
+    command.dstBuffer       = dstMemory.getBuffer().getBuffer().getHandle();
+    command.regions.reserve(copies.size());
+    for (const VkBufferCopy &copy : copies)
+    {
+        command.regions.push_back({srcMemory.getOffset() + copy.srcOffset,
+                                   dstMemory.getOffset() + copy.dstOffset, copy.size});
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    srcMemory.getBuffer().retain(&mBatchResourceUseList);
+    dstMemory.getBuffer().retain(&mBatchResourceUseList);
+    return addCommand(dependency, &command, commandIdOut);
+}
+
+angle::Result CLCommandQueueVk::fillBuffer(const cl::Buffer &buffer,
+                                           const void *pattern,
+                                           size_t patternSize,
+                                           size_t offset,
+                                           size_t size,
+                                           CommandId dependency,
+                                           CommandId *commandIdOut)
+{
+    const CLMemoryVk &memory     = buffer.getImpl<CLMemoryVk>();
+    const VkDeviceSize dstOffset = memory.getOffset() + offset;
+    RendererVk *renderer         = mContext->getRenderer();
+
+    TransferCommand command = {};
+    command.dstBuffer       = memory.getBuffer().getBuffer().getHandle();
+
+    // vkCmdFillBuffer repeats a 4-byte value, and requires a 4-byte aligned offset and size.
+    if (patternSize <= sizeof(uint32_t) && dstOffset % sizeof(uint32_t) == 0 &&
+        size % sizeof(uint32_t) == 0)
+    {
+        for (size_t byte = 0; byte < sizeof(command.fillData); byte += patternSize)
+        {
+            std::memcpy(reinterpret_cast<uint8_t *>(&command.fillData) + byte, pattern,
+                        patternSize);
+        }
+        command.regions.push_back({0, dstOffset, size});
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        memory.getBuffer().retain(&mBatchResourceUseList);
+        return addCommand(dependency, &command, commandIdOut);
+    }
+
+    // Otherwise the pattern is repeated in a staging buffer. The size is a multiple of the pattern
+    // size.
+    vk::BufferHelper stagingBuffer;
+    uint8_t *stagingMemory = nullptr;
+    ANGLE_TRY(mContext->initStagingBuffer(size, &stagingBuffer, &stagingMemory));
+    for (size_t byte = 0; byte < size; byte += patternSize)
+    {
+        std::memcpy(stagingMemory + byte, pattern, patternSize);
+    }
+    ANGLE_TRY(stagingBuffer.flush(renderer, 0, size));
+
+    command.srcBuffer = stagingBuffer.getBuffer().getHandle();
+    command.regions.push_back({0, dstOffset, size});
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    memory.getBuffer().retain(&mBatchResourceUseList);
+    stagingBuffer.retain(&mBatchResourceUseList);
+
+    // The staging buffer is kept alive by the batch.
+    stagingBuffer.release(renderer);
+    return addCommand(dependency, &command, commandIdOut);
+}
+
+angle::Result CLCommandQueueVk::finishReadback(Readback *readback)
+{
+    RendererVk *renderer            = mContext->getRenderer();
+    vk::BufferHelper *stagingBuffer = readback->stagingBuffer.get();
+
+    ANGLE_TRY(stagingBuffer->invalidate(renderer, 0, stagingBuffer->getSize()));
+    const uint8_t *stagingMemory = stagingBuffer->getMappedMemory();
+    for (const VkBufferCopy &copy : readback->hostCopies)
+    {
+        std::memcpy(readback->hostPtr + copy.dstOffset, stagingMemory + copy.srcOffset,
+                    static_cast<size_t>(copy.size));
+    }
+
+    stagingBuffer->release(renderer);
+    return angle::Result::Continue;
+}
 
 }  // namespace rx
@@ -10,17 +10,371 @@
 #define LIBANGLE_RENDERER_VULKAN_CLCOMMANDQUEUEVK_H_
 
 #include "libANGLE/renderer/vulkan/cl_types.h"
+#include "libANGLE/renderer/vulkan/vk_helpers.h"
 
 #include "libANGLE/renderer/CLCommandQueueImpl.h"
 
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 namespace rx
 {
 
+// Commands are batched and submitted together in one command buffer on clFlush and clFinish, when
+// a blocking read needs them, when an event of theirs is waited for, or once a batch is full. The
+// event dependencies of the commands decide where barriers are needed within a batch: commands of
+// an out-of-order queue which don't depend on each other are recorded without barriers in between.
+// Reads into host memory go through staging buffers, which are copied to the host memory once
+// their batch has completed. Buffers with host memory are mapped without copies, other maps are
+// read into and written back from host memory like reads and writes.
+// A command which waits for a user event that hasn't completed, or for a held command of another
+// queue, is held in the batch with the commands after it. The batch is submitted once the events
+// have completed, or its commands are terminated if one of them has failed.
 class CLCommandQueueVk : public CLCommandQueueImpl
 {
   public:
-    CLCommandQueueVk(const cl::CommandQueue &commandQueue);
+    // Commands, including markers and barriers, are identified by increasing ids starting at 1.
+    using CommandId = uint64_t;
+
+    CLCommandQueueVk(const cl::CommandQueue &commandQueue, CLContextVk *context);
     ~CLCommandQueueVk() override;
+
+    // Submits the batch if it contains the command |commandId|, unless the batch is held.
+    cl_int ensureSubmitted(CommandId commandId);
+
+    // Blocks until the command |commandId| and the host copies of its reads have completed.
+    cl_int finishCommand(CommandId commandId);
+
+    // Completes the host copies and event callbacks of finished batches without blocking.
+    cl_int checkCompletedCommands();
+
+    // Waits up to |timeout| nanoseconds for the batch of |serial| to finish, and then checks for
+    // completed commands. |finishedOut| is false if the wait timed out.
+    cl_int waitForBatch(Serial serial, uint64_t timeout, bool *finishedOut);
+
+    // Returns CL_QUEUED, CL_SUBMITTED or CL_COMPLETE, as of the last check for completed commands,
+    // or CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST if the command was terminated.
+    cl_int getCommandStatus(CommandId commandId) const;
+
+    // Registers an event with pending callbacks, which are called once its command has completed.
+    void addCallbackEvent(CLEventVk *event);
+
+    // Submits the held batch once the events it waits for have completed, or terminates its
+    // commands if one of them has failed. Called when the status of one of the events may have
+    // changed.
+    cl_int resolveBatchWaitEvents();
+
+    // Registers a queue whose batch waits for a command held in the batch of this queue. The queue
+    // resolves its batch once the batch of this queue has been submitted or terminated.
+    void addWaitingQueue(CLCommandQueueVk *queue);
+    void removeWaitingQueue(CLCommandQueueVk *queue);
+
+    cl_int setProperty(cl::CommandQueueProperties properties, cl_bool enable) override;
+
+    cl_int enqueueReadBuffer(const cl::Buffer &buffer,
+                             bool blocking,
+                             size_t offset,
+                             size_t size,
+                             void *ptr,
+                             const cl::EventPtrs &waitEvents,
+                             CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueWriteBuffer(const cl::Buffer &buffer,
+                              bool blocking,
+                              size_t offset,
+                              size_t size,
+                              const void *ptr,
+                              const cl::EventPtrs &waitEvents,
+                              CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueReadBufferRect(const cl::Buffer &buffer,
+                                 bool blocking,
+                                 const size_t bufferOrigin[3],
+                                 const size_t hostOrigin[3],
+                                 const size_t region[3],
+                                 size_t bufferRowPitch,
+                                 size_t bufferSlicePitch,
+                                 size_t hostRowPitch,
+                                 size_t hostSlicePitch,
+                                 void *ptr,
+                                 const cl::EventPtrs &waitEvents,
+                                 CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueWriteBufferRect(const cl::Buffer &buffer,
+                                  bool blocking,
+                                  const size_t bufferOrigin[3],
+                                  const size_t hostOrigin[3],
+                                  const size_t region[3],
+                                  size_t bufferRowPitch,
+                                  size_t bufferSlicePitch,
+                                  size_t hostRowPitch,
+                                  size_t hostSlicePitch,
+                                  const void *ptr,
+                                  const cl::EventPtrs &waitEvents,
+                                  CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueCopyBuffer(const cl::Buffer &srcBuffer,
+                             const cl::Buffer &dstBuffer,
+                             size_t srcOffset,
+                             size_t dstOffset,
+                             size_t size,
+                             const cl::EventPtrs &waitEvents,
+                             CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueCopyBufferRect(const cl::Buffer &srcBuffer,
+                                 const cl::Buffer &dstBuffer,
+                                 const size_t srcOrigin[3],
+                                 const size_t dstOrigin[3],
+                                 const size_t region[3],
+                                 size_t srcRowPitch,
+                                 size_t srcSlicePitch,
+                                 size_t dstRowPitch,
+                                 size_t dstSlicePitch,
+                                 const cl::EventPtrs &waitEvents,
+                                 CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueFillBuffer(const cl::Buffer &buffer,
+                             const void *pattern,
+                             size_t patternSize,
+                             size_t offset,
+                             size_t size,
+                             const cl::EventPtrs &waitEvents,
+                             CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    void *enqueueMapBuffer(const cl::Buffer &buffer,
+                           bool blocking,
+                           cl::MapFlags mapFlags,
+                           size_t offset,
+                           size_t size,
+                           const cl::EventPtrs &waitEvents,
+                           CLEventImpl::CreateFunc *eventCreateFunc,
+                           cl_int &errorCode) override;
+
+    cl_int enqueueReadImage(const cl::Image &image,
+                            bool blocking,
+                            const size_t origin[3],
+                            const size_t region[3],
+                            size_t rowPitch,
+                            size_t slicePitch,
+                            void *ptr,
+                            const cl::EventPtrs &waitEvents,
+                            CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueWriteImage(const cl::Image &image,
+                             bool blocking,
+                             const size_t origin[3],
+                             const size_t region[3],
+                             size_t inputRowPitch,
+                             size_t inputSlicePitch,
+                             const void *ptr,
+                             const cl::EventPtrs &waitEvents,
+                             CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueCopyImage(const cl::Image &srcImage,
+                            const cl::Image &dstImage,
+                            const size_t srcOrigin[3],
+                            const size_t dstOrigin[3],
+                            const size_t region[3],
+                            const cl::EventPtrs &waitEvents,
+                            CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueFillImage(const cl::Image &image,
+                            const void *fillColor,
+                            const size_t origin[3],
+                            const size_t region[3],
+                            const cl::EventPtrs &waitEvents,
+                            CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueCopyImageToBuffer(const cl::Image &srcImage,
+                                    const cl::Buffer &dstBuffer,
+                                    const size_t srcOrigin[3],
+                                    const size_t region[3],
+                                    size_t dstOffset,
+                                    const cl::EventPtrs &waitEvents,
+                                    CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueCopyBufferToImage(const cl::Buffer &srcBuffer,
+                                    const cl::Image &dstImage,
+                                    size_t srcOffset,
+                                    const size_t dstOrigin[3],
+                                    const size_t region[3],
+                                    const cl::EventPtrs &waitEvents,
+                                    CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    void *enqueueMapImage(const cl::Image &image,
+                          bool blocking,
+                          cl::MapFlags mapFlags,
+                          const size_t origin[3],
+                          const size_t region[3],
+                          size_t *imageRowPitch,
+                          size_t *imageSlicePitch,
+                          const cl::EventPtrs &waitEvents,
+                          CLEventImpl::CreateFunc *eventCreateFunc,
+                          cl_int &errorCode) override;
+
+    cl_int enqueueUnmapMemObject(const cl::Memory &memory,
+                                 void *mappedPtr,
+                                 const cl::EventPtrs &waitEvents,
+                                 CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueMigrateMemObjects(const cl::MemoryPtrs &memObjects,
+                                    cl::MemMigrationFlags flags,
+                                    const cl::EventPtrs &waitEvents,
+                                    CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueNDRangeKernel(const cl::Kernel &kernel,
+                                cl_uint workDim,
+                                const size_t *globalWorkOffset,
+                                const size_t *globalWorkSize,
+                                const size_t *localWorkSize,
+                                const cl::EventPtrs &waitEvents,
+                                CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueTask(const cl::Kernel &kernel,
+                       const cl::EventPtrs &waitEvents,
+                       CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueNativeKernel(cl::UserFunc userFunc,
+                               void *args,
+                               size_t cbArgs,
+                               const cl::BufferPtrs &buffers,
+                               const std::vector<size_t> bufferPtrOffsets,
+                               const cl::EventPtrs &waitEvents,
+                               CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueMarkerWithWaitList(const cl::EventPtrs &waitEvents,
+                                     CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueMarker(CLEventImpl::CreateFunc &eventCreateFunc) override;
+
+    cl_int enqueueWaitForEvents(const cl::EventPtrs &events) override;
+
+    cl_int enqueueBarrierWithWaitList(const cl::EventPtrs &waitEvents,
+                                      CLEventImpl::CreateFunc *eventCreateFunc) override;
+
+    cl_int enqueueBarrier() override;
+
+    cl_int flush() override;
+    cl_int finish() override;
+
+  private:
+    // A transfer command of a batch, which is recorded into the command buffer on submission. The
+    // buffers may be released before that, so their handles are stored.
+    struct TransferCommand
+    {
+        // Orders the command after the earlier commands of the batch.
+        bool barrier;
+        // A fill if there is no source buffer.
+        VkBuffer srcBuffer;
+        VkBuffer dstBuffer;
+        std::vector<VkBufferCopy> regions;
+        uint32_t fillData;
+    };
+
+    struct Readback
+    {
+        std::unique_ptr<vk::BufferHelper> stagingBuffer;
+        uint8_t *hostPtr;
+        // Copies from the staging buffer (source) to the host memory (destination).
+        std::vector<VkBufferCopy> hostCopies;
+    };
+
+    struct SubmittedBatch
+    {
+        CommandId lastCommandId;
+        Serial serial;
+        std::vector<Readback> readbacks;
+    };
+
+    static void RecordTransferCommand(vk::PrimaryCommandBuffer *commandBuffer,
+                                      const TransferCommand &command);
+
+    // Resolves the dependencies of a command on events. Commands of other queues are submitted
+    // before the batch of this queue, and the batch is held for user events which haven't
+    // completed and for held commands of other queues. Returns the last command of this queue the
+    // new command depends on, or 0.
+    cl_int processWaitEvents(const cl::EventPtrs &waitEvents, CommandId *dependencyOut);
+
+    // Removes this queue from the events and queues it was registered with for |waitEvents|.
+    void removeFromWaitEvents(const cl::EventPtrs &waitEvents);
+
+    // Must be called with mMutex held.
+    bool isTerminated(CommandId commandId) const;
+    // Drops the commands of the held batch, because an event they wait for has failed. Must be
+    // called with mMutex held.
+    void terminateBatch();
+    // Has the completion thread of the platform check for completed commands once the batch of
+    // |serial| has finished. Must be called with mMutex held.
+    void addCompletionWait(Serial serial);
+
+    cl_int onCommandEnqueued(angle::Result result,
+                             CommandId commandId,
+                             bool blocking,
+                             CLEventImpl::CreateFunc *eventCreateFunc);
+
+    // Adds a command to the batch, with a transfer command unless |command| is null. Must be called
+    // with mMutex held.
+    angle::Result addCommand(CommandId dependency,
+                             TransferCommand *command,
+                             CommandId *commandIdOut);
+    angle::Result submitBatch();
+
+    // The copies are relative to the start of the memory object and the host memory.
+    angle::Result readBuffer(const cl::Buffer &buffer,
+                             void *ptr,
+                             const std::vector<VkBufferCopy> &copies,
+                             CommandId dependency,
+                             CommandId *commandIdOut);
+    angle::Result writeBuffer(const cl::Buffer &buffer,
+                              const void *ptr,
+                              const std::vector<VkBufferCopy> &copies,
+                              CommandId dependency,
+                              CommandId *commandIdOut);
+    angle::Result copyBuffer(const cl::Buffer &srcBuffer,
+                             const cl::Buffer &dstBuffer,
+                             const std::vector<VkBufferCopy> &copies,
+                             CommandId dependency,
+                             CommandId *commandIdOut);
+    angle::Result fillBuffer(const cl::Buffer &buffer,
+                             const void *pattern,
+                             size_t patternSize,
+                             size_t offset,
+                             size_t size,
+                             CommandId dependency,
+                             CommandId *commandIdOut);
+
+    angle::Result finishReadback(Readback *readback);
+
+    CLContextVk *const mContext;
+
+    mutable std::mutex mMutex;
+    bool mOutOfOrder;
+
+    // The batch of commands which have not been submitted yet.
+    std::vector<TransferCommand> mBatch;
+    std::vector<Readback> mBatchReadbacks;
+    vk::ResourceUseList mBatchResourceUseList;
+    // Whether transfer commands were added since the last barrier of the batch.
+    bool mBatchHasUnorderedCommands;
+    // Whether the batch maps a buffer with host memory.
+    bool mBatchHasHostAccess;
+    // Whether the next transfer command has to be ordered after all earlier commands.
+    bool mBarrierPending;
+
+    CommandId mNextCommandId;
+    CommandId mLastSubmittedCommandId;
+    CommandId mLastCompletedCommandId;
+    std::deque<SubmittedBatch> mSubmittedBatches;
+    std::vector<CLEventVk *> mCallbackEvents;
+
+    // The events the batch is held for, or empty if the batch isn't held.
+    cl::EventPtrs mBatchWaitEvents;
+    // The first and last ids of the commands terminated with their held batches.
+    std::vector<std::pair<CommandId, CommandId>> mTerminatedCommands;
+    // The queues whose batches wait for a command held in the batch of this queue.
+    std::vector<CLCommandQueueVk *> mWaitingQueues;
 };
 
 }  // namespace rx
@@ -7,11 +7,227 @@
 
 #include "libANGLE/renderer/vulkan/CLContextVk.h"
 
+#include "libANGLE/renderer/vulkan/CLCommandQueueVk.h"
+#include "libANGLE/renderer/vulkan/CLEventVk.h"
+#include "libANGLE/renderer/vulkan/CLMemoryVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
+
+#include "libANGLE/CLBuffer.h"
+#include "libANGLE/CLContext.h"
+#include "libANGLE/CLEvent.h"
+#include "libANGLE/CLPlatform.h"
+
 namespace rx
 {
 
-CLContextVk::CLContextVk(const cl::Context &context) : CLContextImpl(context) {}
+CLContextVk::CLContextVk(const cl::Context &context, RendererVk *renderer)
+    : CLContextImpl(context), vk::Context(renderer), mLastError(VK_SUCCESS)
+{}
 
 CLContextVk::~CLContextVk() = default;
 
+void CLContextVk::handleError(VkResult result,
+                              const char *file,
+                              const char *function,
+                              unsigned int line)
+{
+    ASSERT(result != VK_SUCCESS);
+
+    mLastError = result;
+
+    WARN() << "Internal Vulkan error (" << result << "): " << VulkanResultString(result) << ", in "
+           << file << ", " << function << ":" << line << ".";
+
+    if (result == VK_ERROR_DEVICE_LOST)
+    {
+        mRenderer->notifyDeviceLost();
+    }
+}
+
+cl_int CLContextVk::toCLResult(angle::Result result) const
+{
+    if (result == angle::Result::Continue)
+    {
+        return CL_SUCCESS;
+    }
+
+    switch (mLastError.load())
+    {
+        case VK_ERROR_OUT_OF_HOST_MEMORY:
+            return CL_OUT_OF_HOST_MEMORY;
+        case VK_ERROR_OUT_OF_DEVICE_MEMORY:
+            return CL_MEM_OBJECT_ALLOCATION_FAILURE;
+        default:
+            return CL_OUT_OF_RESOURCES;
+    }
+}
+
+angle::Result CLContextVk::initStagingBuffer(size_t size,
+                                             vk::BufferHelper *stagingBufferOut,
+                                             uint8_t **mappedMemoryOut)
+{
+    constexpr VkBufferUsageFlags kStagingUsageFlags =
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = size;
+    createInfo.usage                 = kStagingUsageFlags;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    // Host visible memory is required, coherent and cached memory is preferred.
+    const VkMemoryPropertyFlags memoryPropertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
+                                                      VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+
+    ANGLE_TRY(stagingBufferOut->init(this, createInfo, memoryPropertyFlags));
+    return stagingBufferOut->map(this, mappedMemoryOut);
+}
+
+angle::Result CLContextVk::submitCommands(const RecordCommandsFunc &recordCommands,
+                                          vk::ResourceUseList *resourceUseList,
+                                          Serial *serialOut)
+{
+    std::lock_guard<std::mutex> lock(mSubmitMutex);
+
+    vk::PrimaryCommandBuffer commandBuffer;
+    ANGLE_TRY(mRenderer->getCommandBufferOneOff(this, false, &commandBuffer));
+
+    // All submissions go to the same queue, so a full memory barrier at the start of each command
+    // buffer orders it after the commands of earlier submissions.
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask   = VK_ACCESS_MEMORY_WRITE_BIT;
+    memoryBarrier.dstAccessMask   = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    commandBuffer.memoryBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, &memoryBarrier);
+
+    recordCommands(&commandBuffer);
+
+    ANGLE_VK_TRY(this, commandBuffer.end());
+
+    ANGLE_TRY(mRenderer->queueSubmitOneOff(this, std::move(commandBuffer), false,
+                                           egl::ContextPriority::Medium, nullptr,
+                                           vk::SubmitPolicy::EnsureSubmitted, serialOut));
+    resourceUseList->releaseResourceUsesAndUpdateSerials(*serialOut);
+
+    return angle::Result::Continue;
+}
+
+cl::DevicePtrs CLContextVk::getDevices(cl_int &errorCode) const
+{
+    // The Vulkan back end exposes a single device, which matches all requested device types.
+    return mContext.getPlatform().getDevices();
+}
+
+CLCommandQueueImpl::Ptr CLContextVk::createCommandQueue(const cl::CommandQueue &commandQueue,
+                                                        cl_int &errorCode)
+{
+    return CLCommandQueueImpl::Ptr(new CLCommandQueueVk(commandQueue, this));
+}
+
+CLMemoryImpl::Ptr CLContextVk::createBuffer(const cl::Buffer &buffer,
+                                            size_t size,
+                                            void *hostPtr,
+                                            cl_int &errorCode)
+{
+    std::unique_ptr<CLMemoryVk> memory(new CLMemoryVk(buffer, this));
+    errorCode = toCLResult(memory->init(size, hostPtr));
+    return CLMemoryImpl::Ptr(errorCode == CL_SUCCESS ? memory.release() : nullptr);
+}
+
+CLMemoryImpl::Ptr CLContextVk::createImage(const cl::Image &image,
+                                           cl::MemFlags flags,
+                                           const cl_image_format &format,
+                                           const cl::ImageDescriptor &desc,
+                                           void *hostPtr,
+                                           cl_int &errorCode)
+{
+    // Images are not supported by the Vulkan back end yet.
+    errorCode = CL_INVALID_OPERATION;
+    return CLMemoryImpl::Ptr();
+}
+
+cl_int CLContextVk::getSupportedImageFormats(cl::MemFlags flags,
+                                             cl::MemObjectType imageType,
+                                             cl_uint numEntries,
+                                             cl_image_format *imageFormats,
+                                             cl_uint *numImageFormats)
+{
+    if (numImageFormats != nullptr)
+    {
+        *numImageFormats = 0u;
+    }
+    return CL_SUCCESS;
+}
+
+CLSamplerImpl::Ptr CLContextVk::createSampler(const cl::Sampler &sampler, cl_int &errorCode)
+{
+    errorCode = CL_INVALID_OPERATION;
+    return CLSamplerImpl::Ptr();
+}
+
+CLProgramImpl::Ptr CLContextVk::createProgramWithSource(const cl::Program &program,
+                                                        const std::string &source,
+                                                        cl_int &errorCode)
+{
+    errorCode = CL_INVALID_OPERATION;
+    return CLProgramImpl::Ptr();
+}
+
+CLProgramImpl::Ptr CLContextVk::createProgramWithIL(const cl::Program &program,
+                                                    const void *il,
+                                                    size_t length,
+                                                    cl_int &errorCode)
+{
+    errorCode = CL_INVALID_OPERATION;
+    return CLProgramImpl::Ptr();
+}
+
+CLProgramImpl::Ptr CLContextVk::createProgramWithBinary(const cl::Program &program,
+                                                        const size_t *lengths,
+                                                        const unsigned char **binaries,
+                                                        cl_int *binaryStatus,
+                                                        cl_int &errorCode)
+{
+    errorCode = CL_INVALID_OPERATION;
+    return CLProgramImpl::Ptr();
+}
+
+CLProgramImpl::Ptr CLContextVk::createProgramWithBuiltInKernels(const cl::Program &program,
+                                                                const char *kernel_names,
+                                                                cl_int &errorCode)
+{
+    errorCode = CL_INVALID_OPERATION;
+    return CLProgramImpl::Ptr();
+}
+
+CLProgramImpl::Ptr CLContextVk::linkProgram(const cl::Program &program,
+                                            const cl::DevicePtrs &devices,
+                                            const char *options,
+                                            const cl::ProgramPtrs &inputPrograms,
+                                            cl::Program *notify,
+                                            cl_int &errorCode)
+{
+    errorCode = CL_INVALID_OPERATION;
+    return CLProgramImpl::Ptr();
+}
+
+CLEventImpl::Ptr CLContextVk::createUserEvent(const cl::Event &event, cl_int &errorCode)
+{
+    return CLEventImpl::Ptr(new CLEventVk(event));
+}
+
+cl_int CLContextVk::waitForEvents(const cl::EventPtrs &events)
+{
+    for (const cl::EventPtr &event : events)
+    {
+        ANGLE_CL_TRY(event->getImpl<CLEventVk>().wait());
+    }
+    return CL_SUCCESS;
+}
+
 }  // namespace rx
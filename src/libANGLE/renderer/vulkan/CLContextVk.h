@@ -9,17 +9,107 @@
 #define LIBANGLE_RENDERER_VULKAN_CLCONTEXTVK_H_
 
 #include "libANGLE/renderer/vulkan/cl_types.h"
+#include "libANGLE/renderer/vulkan/vk_helpers.h"
 
 #include "libANGLE/renderer/CLContextImpl.h"
 
+#include <atomic>
+#include <mutex>
+
 namespace rx
 {
 
-class CLContextVk : public CLContextImpl
+class CLContextVk : public CLContextImpl, public vk::Context
 {
   public:
-    CLContextVk(const cl::Context &context);
+    using RecordCommandsFunc = std::function<void(vk::PrimaryCommandBuffer *commandBuffer)>;
+
+    CLContextVk(const cl::Context &context, RendererVk *renderer);
     ~CLContextVk() override;
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override;
+
+    // Returns CL_SUCCESS for a successful result, otherwise the OpenCL error code matching the last
+    // Vulkan error reported to handleError().
+    cl_int toCLResult(angle::Result result) const;
+
+    // Creates a mapped, host visible buffer used to transfer data between host memory and memory
+    // objects.
+    angle::Result initStagingBuffer(size_t size,
+                                    vk::BufferHelper *stagingBufferOut,
+                                    uint8_t **mappedMemoryOut);
+
+    // Records commands into a one-off command buffer and submits it. Submissions are ordered: the
+    // recorded commands see all memory writes of earlier submissions. The resources in
+    // |resourceUseList| are kept alive until the returned serial has completed.
+    angle::Result submitCommands(const RecordCommandsFunc &recordCommands,
+                                 vk::ResourceUseList *resourceUseList,
+                                 Serial *serialOut);
+
+    cl::DevicePtrs getDevices(cl_int &errorCode) const override;
+
+    CLCommandQueueImpl::Ptr createCommandQueue(const cl::CommandQueue &commandQueue,
+                                               cl_int &errorCode) override;
+
+    CLMemoryImpl::Ptr createBuffer(const cl::Buffer &buffer,
+                                   size_t size,
+                                   void *hostPtr,
+                                   cl_int &errorCode) override;
+
+    CLMemoryImpl::Ptr createImage(const cl::Image &image,
+                                  cl::MemFlags flags,
+                                  const cl_image_format &format,
+                                  const cl::ImageDescriptor &desc,
+                                  void *hostPtr,
+                                  cl_int &errorCode) override;
+
+    cl_int getSupportedImageFormats(cl::MemFlags flags,
+                                    cl::MemObjectType imageType,
+                                    cl_uint numEntries,
+                                    cl_image_format *imageFormats,
+                                    cl_uint *numImageFormats) override;
+
+    CLSamplerImpl::Ptr createSampler(const cl::Sampler &sampler, cl_int &errorCode) override;
+
+    CLProgramImpl::Ptr createProgramWithSource(const cl::Program &program,
+                                               const std::string &source,
+                                               cl_int &errorCode) override;
+
+    CLProgramImpl::Ptr createProgramWithIL(const cl::Program &program,
+                                           const void *il,
+                                           size_t length,
+                                           cl_int &errorCode) override;
+
+    CLProgramImpl::Ptr createProgramWithBinary(const cl::Program &program,
+                                               const size_t *lengths,
+                                               const unsigned char **binaries,
+                                               cl_int *binaryStatus,
+                                               cl_int &errorCode) override;
+
+    CLProgramImpl::Ptr createProgramWithBuiltInKernels(const cl::Program &program,
+                                                       const char *kernel_names,
+                                                       cl_int &errorCode) override;
+
+    CLProgramImpl::Ptr linkProgram(const cl::Program &program,
+                                   const cl::DevicePtrs &devices,
+                                   const char *options,
+                                   const cl::ProgramPtrs &inputPrograms,
+                                   cl::Program *notify,
+                                   cl_int &errorCode) override;
+
+    CLEventImpl::Ptr createUserEvent(const cl::Event &event, cl_int &errorCode) override;
+
+    cl_int waitForEvents(const cl::EventPtrs &events) override;
+
+  private:
+    std::atomic<VkResult> mLastError;
+
+    // Serializes the recording of one-off command buffers, so that the queues and memory objects of
+    // this context can be used from several threads.
+    std::mutex mSubmitMutex;
 };
 
 }  // namespace rx
@@ -8,43 +8,243 @@
 #include "libANGLE/renderer/vulkan/CLDeviceVk.h"
 
 #include "libANGLE/renderer/vulkan/CLPlatformVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
+
+#include "libANGLE/renderer/driver_utils.h"
+
+#include <cstring>
 
 namespace rx
 {
 
-CLDeviceVk::CLDeviceVk(const cl::Device &device) : CLDeviceImpl(device) {}
+namespace
+{
+// The size of the largest OpenCL built-in data type, long16, which is the minimum base address
+// alignment of a full profile device.
+constexpr cl_uint kMinMemBaseAddrAlign = 128u;
+
+// Images, kernels and profiling are not implemented yet, so neither are the device features they
+// need. The limits are those of the Vulkan device, and the minimum values of the OpenCL 1.2
+// specification where Vulkan has no equivalent.
+constexpr cl_uint kMaxComputeUnits = 1u;
+constexpr cl_uint kMaxConstantArgs = 8u;
+constexpr size_t kMaxParameterSize = 1024u;
+constexpr char kDeviceExtensions[] = "cl_khr_extended_versioning";
+constexpr char kOpenCL_C_Version[] = "OpenCL C 1.2 ";
+}  // namespace
+
+CLDeviceVk::CLDeviceVk(const cl::Device &device, RendererVk *renderer)
+    : CLDeviceImpl(device), mRenderer(renderer), mGlobalMemSize(0u)
+{
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    vkGetPhysicalDeviceMemoryProperties(mRenderer->getPhysicalDevice(), &memoryProperties);
+    for (uint32_t heapIndex = 0; heapIndex < memoryProperties.memoryHeapCount; ++heapIndex)
+    {
+        const VkMemoryHeap &heap = memoryProperties.memoryHeaps[heapIndex];
+        if ((heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0)
+        {
+            mGlobalMemSize += heap.size;
+        }
+    }
+}
 
 CLDeviceVk::~CLDeviceVk() = default;
 
 CLDeviceImpl::Info CLDeviceVk::createInfo(cl::DeviceType type) const
 {
+    const VkPhysicalDeviceLimits &limits = mRenderer->getPhysicalDeviceProperties().limits;
+    const cl_uint memBaseAddrAlign       = std::max(
+        static_cast<cl_uint>(limits.minStorageBufferOffsetAlignment), kMinMemBaseAddrAlign);
+
     Info info(type);
+    info.maxWorkItemSizes.assign(std::begin(limits.maxComputeWorkGroupSize),
+                                 std::end(limits.maxComputeWorkGroupSize));
+    info.maxMemAllocSize = std::min<cl_ulong>(limits.maxStorageBufferRange, mGlobalMemSize);
+    info.imageSupport    = CL_FALSE;
+    // The alignment is in bits.
+    info.memBaseAddrAlign = memBaseAddrAlign * 8u;
+    info.execCapabilities = CL_EXEC_KERNEL;
+    // A device that cannot be partitioned returns a single 0 property.
+    info.partitionProperties.push_back(0);
+
+    info.versionStr = CLPlatformVk::GetVersionString();
+    info.version    = CLPlatformVk::GetVersion();
+    info.initializeExtensions(kDeviceExtensions);
+    info.extensionsWithVersion.push_back(
+        cl_name_version{CL_MAKE_VERSION(1, 0, 0), "cl_khr_extended_versioning"});
     return info;
 }
 
 cl_int CLDeviceVk::getInfoUInt(cl::DeviceInfo name, cl_uint *value) const
 {
-    return CL_INVALID_VALUE;
+    const VkPhysicalDeviceProperties &properties = mRenderer->getPhysicalDeviceProperties();
+    switch (name)
+    {
+        case cl::DeviceInfo::VendorID:
+            *value = properties.vendorID;
+            break;
+        case cl::DeviceInfo::MaxComputeUnits:
+            *value = kMaxComputeUnits;
+            break;
+        case cl::DeviceInfo::PreferredVectorWidthChar:
+        case cl::DeviceInfo::PreferredVectorWidthShort:
+        case cl::DeviceInfo::PreferredVectorWidthInt:
+        case cl::DeviceInfo::PreferredVectorWidthLong:
+        case cl::DeviceInfo::PreferredVectorWidthFloat:
+        case cl::DeviceInfo::NativeVectorWidthChar:
+        case cl::DeviceInfo::NativeVectorWidthShort:
+        case cl::DeviceInfo::NativeVectorWidthInt:
+        case cl::DeviceInfo::NativeVectorWidthLong:
+        case cl::DeviceInfo::NativeVectorWidthFloat:
+            *value = 1u;
+            break;
+        // Doubles and halves are not supported.
+        case cl::DeviceInfo::PreferredVectorWidthDouble:
+        case cl::DeviceInfo::PreferredVectorWidthHalf:
+        case cl::DeviceInfo::NativeVectorWidthDouble:
+        case cl::DeviceInfo::NativeVectorWidthHalf:
+            *value = 0u;
+            break;
+        // Vulkan does not expose the clock frequency.
+        case cl::DeviceInfo::MaxClockFrequency:
+            *value = 0u;
+            break;
+        case cl::DeviceInfo::AddressBits:
+            *value = 32u;
+            break;
+        case cl::DeviceInfo::MaxReadImageArgs:
+        case cl::DeviceInfo::MaxWriteImageArgs:
+        case cl::DeviceInfo::MaxSamplers:
+            *value = 0u;
+            break;
+        case cl::DeviceInfo::MinDataTypeAlignSize:
+            *value = kMinMemBaseAddrAlign;
+            break;
+        case cl::DeviceInfo::GlobalMemCacheType:
+            *value = CL_NONE;
+            break;
+        case cl::DeviceInfo::GlobalMemCachelineSize:
+            *value = 0u;
+            break;
+        case cl::DeviceInfo::MaxConstantArgs:
+            *value = kMaxConstantArgs;
+            break;
+        case cl::DeviceInfo::LocalMemType:
+            *value = CL_LOCAL;
+            break;
+        case cl::DeviceInfo::ErrorCorrectionSupport:
+            *value = CL_FALSE;
+            break;
+        case cl::DeviceInfo::HostUnifiedMemory:
+            *value = properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU ||
+                             properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU
+                         ? CL_TRUE
+                         : CL_FALSE;
+            break;
+        case cl::DeviceInfo::EndianLittle:
+        case cl::DeviceInfo::Available:
+        case cl::DeviceInfo::PreferredInteropUserSync:
+            *value = CL_TRUE;
+            break;
+        // Programs are not implemented yet.
+        case cl::DeviceInfo::CompilerAvailable:
+        case cl::DeviceInfo::LinkerAvailable:
+            *value = CL_FALSE;
+            break;
+        case cl::DeviceInfo::PartitionMaxSubDevices:
+            *value = 0u;
+            break;
+        default:
+            return CL_INVALID_VALUE;
+    }
+    return CL_SUCCESS;
 }
 
 cl_int CLDeviceVk::getInfoULong(cl::DeviceInfo name, cl_ulong *value) const
 {
-    return CL_INVALID_VALUE;
+    const VkPhysicalDeviceLimits &limits = mRenderer->getPhysicalDeviceProperties().limits;
+    switch (name)
+    {
+        // The minimum single precision capabilities of a full profile device.
+        case cl::DeviceInfo::SingleFpConfig:
+            *value = CL_FP_ROUND_TO_NEAREST | CL_FP_INF_NAN;
+            break;
+        case cl::DeviceInfo::DoubleFpConfig:
+        case cl::DeviceInfo::HalfFpConfig:
+            *value = 0u;
+            break;
+        case cl::DeviceInfo::GlobalMemCacheSize:
+            *value = 0u;
+            break;
+        case cl::DeviceInfo::GlobalMemSize:
+            *value = mGlobalMemSize;
+            break;
+        case cl::DeviceInfo::MaxConstantBufferSize:
+            *value = limits.maxUniformBufferRange;
+            break;
+        case cl::DeviceInfo::LocalMemSize:
+            *value = limits.maxComputeSharedMemorySize;
+            break;
+        case cl::DeviceInfo::QueueOnHostProperties:
+            *value = CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE;
+            break;
+        case cl::DeviceInfo::PartitionAffinityDomain:
+            *value = 0u;
+            break;
+        default:
+            return CL_INVALID_VALUE;
+    }
+    return CL_SUCCESS;
 }
 
 cl_int CLDeviceVk::getInfoSizeT(cl::DeviceInfo name, size_t *value) const
 {
-    return CL_INVALID_VALUE;
+    const VkPhysicalDeviceLimits &limits = mRenderer->getPhysicalDeviceProperties().limits;
+    switch (name)
+    {
+        case cl::DeviceInfo::MaxWorkGroupSize:
+            *value = limits.maxComputeWorkGroupInvocations;
+            break;
+        case cl::DeviceInfo::MaxParameterSize:
+            *value = kMaxParameterSize;
+            break;
+        // The resolution is in nanoseconds.
+        case cl::DeviceInfo::ProfilingTimerResolution:
+            *value = std::max<size_t>(static_cast<size_t>(limits.timestampPeriod), 1u);
+            break;
+        case cl::DeviceInfo::PrintfBufferSize:
+            *value = 0u;
+            break;
+        default:
+            return CL_INVALID_VALUE;
+    }
+    return CL_SUCCESS;
 }
 
 cl_int CLDeviceVk::getInfoStringLength(cl::DeviceInfo name, size_t *value) const
 {
-    return CL_INVALID_VALUE;
+    std::string str;
+    const cl_int errorCode = getInfoStringValue(name, &str);
+    if (errorCode == CL_SUCCESS)
+    {
+        *value = str.length() + 1u;
+    }
+    return errorCode;
 }
 
 cl_int CLDeviceVk::getInfoString(cl::DeviceInfo name, size_t size, char *value) const
 {
-    return CL_INVALID_VALUE;
+    std::string str;
+    const cl_int errorCode = getInfoStringValue(name, &str);
+    if (errorCode == CL_SUCCESS)
+    {
+        if (size < str.length() + 1u)
+        {
+            return CL_INVALID_VALUE;
+        }
+        std::memcpy(value, str.c_str(), str.length() + 1u);
+    }
+    return errorCode;
 }
 
 cl_int CLDeviceVk::createSubDevices(const cl_device_partition_property *properties,
@@ -55,4 +255,43 @@ cl_int CLDeviceVk::createSubDevices(const cl_device_partition_property *properti
     return CL_INVALID_VALUE;
 }
 
+cl::DeviceType CLDeviceVk::GetDeviceType(RendererVk *renderer)
+{
+    switch (renderer->getPhysicalDeviceProperties().deviceType)
+    {
+        case VK_PHYSICAL_DEVICE_TYPE_CPU:
+            return cl::DeviceType(CL_DEVICE_TYPE_CPU);
+        case VK_PHYSICAL_DEVICE_TYPE_OTHER:
+            return cl::DeviceType(CL_DEVICE_TYPE_ACCELERATOR);
+        default:
+            return cl::DeviceType(CL_DEVICE_TYPE_GPU);
+    }
+}
+
+cl_int CLDeviceVk::getInfoStringValue(cl::DeviceInfo name, std::string *value) const
+{
+    const VkPhysicalDeviceProperties &properties = mRenderer->getPhysicalDeviceProperties();
+    switch (name)
+    {
+        case cl::DeviceInfo::Name:
+            *value = properties.deviceName;
+            break;
+        case cl::DeviceInfo::Vendor:
+            *value = GetVendorString(properties.vendorID);
+            break;
+        case cl::DeviceInfo::DriverVersion:
+            *value = mRenderer->getVersionString();
+            break;
+        case cl::DeviceInfo::Profile:
+            *value = "FULL_PROFILE";
+            break;
+        case cl::DeviceInfo::OpenCL_C_Version:
+            *value = kOpenCL_C_Version;
+            break;
+        default:
+            return CL_INVALID_VALUE;
+    }
+    return CL_SUCCESS;
+}
+
 }  // namespace rx
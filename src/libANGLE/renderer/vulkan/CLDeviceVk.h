@@ -14,11 +14,12 @@
 
 namespace rx
 {
+class RendererVk;
 
 class CLDeviceVk : public CLDeviceImpl
 {
   public:
-    explicit CLDeviceVk(const cl::Device &device);
+    CLDeviceVk(const cl::Device &device, RendererVk *renderer);
     ~CLDeviceVk() override;
 
     Info createInfo(cl::DeviceType type) const override;
@@ -33,6 +34,15 @@ class CLDeviceVk : public CLDeviceImpl
                             cl_uint numDevices,
                             CreateFuncs &subDevices,
                             cl_uint *numDevicesRet) override;
+
+    // Returns the device type of the physical device of |renderer|.
+    static cl::DeviceType GetDeviceType(RendererVk *renderer);
+
+  private:
+    cl_int getInfoStringValue(cl::DeviceInfo name, std::string *value) const;
+
+    RendererVk *const mRenderer;
+    cl_ulong mGlobalMemSize;
 };
 
 }  // namespace rx
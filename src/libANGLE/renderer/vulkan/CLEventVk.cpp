@@ -7,11 +7,163 @@
 
 #include "libANGLE/renderer/vulkan/CLEventVk.h"
 
+#include "libANGLE/renderer/vulkan/CLCommandQueueVk.h"
+
+#include "libANGLE/CLEvent.h"
+
+#include <algorithm>
+
 namespace rx
 {
 
-CLEventVk::CLEventVk(const cl::Event &event) : CLEventImpl(event) {}
+CLEventVk::CLEventVk(const cl::Event &event)
+    : CLEventImpl(event),
+      mQueue(nullptr),
+      mCommandId(0),
+      mStatus(CL_SUBMITTED),
+      mPendingCallbacks{},
+      mAddedToQueue(false)
+{}
+
+CLEventVk::CLEventVk(const cl::Event &event, CLCommandQueueVk *queue, uint64_t commandId)
+    : CLEventImpl(event),
+      mQueue(queue),
+      mCommandId(commandId),
+      mStatus(CL_SUBMITTED),
+      mPendingCallbacks{},
+      mAddedToQueue(false)
+{}
 
 CLEventVk::~CLEventVk() = default;
 
+cl_int CLEventVk::wait()
+{
+    if (mQueue != nullptr)
+    {
+        return mQueue->finishCommand(mCommandId);
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mStatusChanged.wait(lock, [this] { return mStatus <= CL_COMPLETE; });
+    return mStatus == CL_COMPLETE ? CL_SUCCESS : CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST;
+}
+
+void CLEventVk::onCommandCompleted(cl_int executionStatus)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mAddedToQueue = false;
+    }
+    callPendingCallbacks(executionStatus);
+}
+
+void CLEventVk::addWaitingQueue(CLCommandQueueVk *queue)
+{
+    ASSERT(mQueue == nullptr);
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (std::find(mWaitingQueues.begin(), mWaitingQueues.end(), queue) == mWaitingQueues.end())
+    {
+        mWaitingQueues.push_back(queue);
+    }
+}
+
+void CLEventVk::removeWaitingQueue(CLCommandQueueVk *queue)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mWaitingQueues.erase(std::remove(mWaitingQueues.begin(), mWaitingQueues.end(), queue),
+                         mWaitingQueues.end());
+}
+
+cl_int CLEventVk::getCommandExecutionStatus(cl_int &executionStatus)
+{
+    if (mQueue != nullptr)
+    {
+        ANGLE_CL_TRY(mQueue->checkCompletedCommands());
+        executionStatus = mQueue->getCommandStatus(mCommandId);
+        return CL_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    executionStatus = mStatus;
+    return CL_SUCCESS;
+}
+
+cl_int CLEventVk::setUserEventStatus(cl_int executionStatus)
+{
+    ASSERT(mQueue == nullptr);
+    std::vector<CLCommandQueueVk *> waitingQueues;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStatus = executionStatus;
+        std::swap(waitingQueues, mWaitingQueues);
+    }
+    mStatusChanged.notify_all();
+
+    // The commands held for this event are submitted, or terminated if it failed.
+    cl_int errorCode = CL_SUCCESS;
+    for (CLCommandQueueVk *queue : waitingQueues)
+    {
+        const cl_int queueErrorCode = queue->resolveBatchWaitEvents();
+        errorCode                   = errorCode == CL_SUCCESS ? queueErrorCode : errorCode;
+    }
+
+    callPendingCallbacks(executionStatus);
+    return errorCode;
+}
+
+cl_int CLEventVk::setCallback(cl::Event &event, cl_int commandExecCallbackType)
+{
+    // The front end holds a lock on its callbacks while this is called, so callbacks are never
+    // called from here.
+    bool addToQueue = false;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        ASSERT(mPendingCallbacks[commandExecCallbackType] == nullptr);
+        mPendingCallbacks[commandExecCallbackType] = &event;
+        if (mQueue != nullptr && !mAddedToQueue)
+        {
+            mAddedToQueue = true;
+            addToQueue    = true;
+        }
+    }
+
+    if (addToQueue)
+    {
+        mQueue->addCallbackEvent(this);
+    }
+    return CL_SUCCESS;
+}
+
+cl_int CLEventVk::getProfilingInfo(cl::ProfilingInfo name,
+                                   size_t valueSize,
+                                   void *value,
+                                   size_t *valueSizeRet)
+{
+    return CL_PROFILING_INFO_NOT_AVAILABLE;
+}
+
+void CLEventVk::callPendingCallbacks(cl_int executionStatus)
+{
+    // A status reaches all callback types with a larger or equal value.
+    std::array<cl::Event *, 3u> callbacks = {};
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (cl_int callbackType = executionStatus < 0 ? 0 : executionStatus; callbackType < 3;
+             ++callbackType)
+        {
+            std::swap(callbacks[callbackType], mPendingCallbacks[callbackType]);
+        }
+    }
+
+    // Call the callbacks in the order of the execution status. The front end event releases itself
+    // after its last callback, so this object must not be accessed after the loop.
+    for (cl_int callbackType = 2; callbackType >= 0; --callbackType)
+    {
+        if (callbacks[callbackType] != nullptr)
+        {
+            callbacks[callbackType]->callback(callbackType);
+        }
+    }
+}
+
 }  // namespace rx
@@ -12,16 +12,71 @@
 
 #include "libANGLE/renderer/CLEventImpl.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 namespace rx
 {
 
 class CLEventVk : public CLEventImpl
 {
   public:
-    CLEventVk(const cl::Event &event);
+    // Creates a user event.
+    explicit CLEventVk(const cl::Event &event);
+    // Creates the event of the command |commandId| of |queue|.
+    CLEventVk(const cl::Event &event, CLCommandQueueVk *queue, uint64_t commandId);
     ~CLEventVk() override;
+
+    uint64_t getCommandId() const;
+
+    // Blocks until the command has completed or the status of the user event has been set.
+    cl_int wait();
+
+    // Called by the command queue once the command of this event has completed with
+    // |executionStatus|, which is CL_COMPLETE or the error of a failed event it waited for.
+    // Callbacks of command events are called from the completion thread of the platform once the
+    // batch of the command has finished, or earlier if the queue checks for completed commands.
+    void onCommandCompleted(cl_int executionStatus);
+
+    // Registers a queue whose batch is held until the status of this user event is set. The queue
+    // resolves its batch once the status has been set.
+    void addWaitingQueue(CLCommandQueueVk *queue);
+    void removeWaitingQueue(CLCommandQueueVk *queue);
+
+    cl_int getCommandExecutionStatus(cl_int &executionStatus) override;
+
+    cl_int setUserEventStatus(cl_int executionStatus) override;
+
+    cl_int setCallback(cl::Event &event, cl_int commandExecCallbackType) override;
+
+    cl_int getProfilingInfo(cl::ProfilingInfo name,
+                            size_t valueSize,
+                            void *value,
+                            size_t *valueSizeRet) override;
+
+  private:
+    void callPendingCallbacks(cl_int executionStatus);
+
+    CLCommandQueueVk *const mQueue;
+    const uint64_t mCommandId;
+
+    std::mutex mMutex;
+    std::condition_variable mStatusChanged;
+    // Execution status of a user event.
+    cl_int mStatus;
+    // The front end event registered for the callbacks of each execution status.
+    std::array<cl::Event *, 3u> mPendingCallbacks;
+    bool mAddedToQueue;
+    // The queues whose batches are held until the status of this user event is set.
+    std::vector<CLCommandQueueVk *> mWaitingQueues;
 };
 
+inline uint64_t CLEventVk::getCommandId() const
+{
+    return mCommandId;
+}
+
 }  // namespace rx
 
 #endif  // LIBANGLE_RENDERER_VULKAN_CLEVENTVK_H_
@@ -7,11 +7,212 @@
 
 #include "libANGLE/renderer/vulkan/CLMemoryVk.h"
 
+#include "libANGLE/renderer/vulkan/CLContextVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
+
+#include "libANGLE/CLBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
 namespace rx
 {
 
-CLMemoryVk::CLMemoryVk(const cl::Memory &memory) : CLMemoryImpl(memory) {}
+CLMemoryVk::CLMemoryVk(const cl::Memory &memory, CLContextVk *context)
+    : CLMemoryImpl(memory), mContext(context), mParent(nullptr), mSize(0u), mHostMemory(nullptr)
+{}
+
+CLMemoryVk::CLMemoryVk(const cl::Memory &memory, CLMemoryVk *parent, size_t size)
+    : CLMemoryImpl(memory),
+      mContext(parent->mContext),
+      mParent(parent),
+      mSize(size),
+      mHostMemory(nullptr)
+{}
+
+CLMemoryVk::~CLMemoryVk()
+{
+    if (!mBuffer.valid())
+    {
+        return;
+    }
+
+    // The application may free imported memory once the buffer is released, so the submitted
+    // commands are waited for. Commands which are still batched in a queue have to be flushed by
+    // the application, as for any use of its memory.
+    RendererVk *renderer = mContext->getRenderer();
+    if (mBuffer.isExternalBuffer() &&
+        mBuffer.isCurrentlyInUse(renderer->getLastCompletedQueueSerial()) &&
+        renderer->finishToSerial(mContext, renderer->getLastSubmittedQueueSerial()) !=
+            angle::Result::Continue)
+    {
+        WARN() << "Failed to finish the commands using the host memory of a released buffer";
+    }
+
+    // Otherwise the storage is released once the commands that use it have completed.
+    mBuffer.release(renderer);
+}
+
+angle::Result CLMemoryVk::init(size_t size, void *hostPtr)
+{
+    constexpr VkBufferUsageFlags kBufferUsageFlags =
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = size;
+    createInfo.usage                 = kBufferUsageFlags;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    mSize = size;
+
+    const cl::MemFlags flags = mMemory.getFlags();
+    if (flags.isSet(CL_MEM_USE_HOST_PTR))
+    {
+        ANGLE_TRY(initFromHostMemory(createInfo, hostPtr));
+        if (mBuffer.valid())
+        {
+            return angle::Result::Continue;
+        }
+    }
+    else if (flags.isSet(CL_MEM_ALLOC_HOST_PTR))
+    {
+        ANGLE_TRY(mBuffer.init(mContext, createInfo,
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                   VK_MEMORY_PROPERTY_HOST_COHERENT_BIT));
+        ANGLE_TRY(mBuffer.map(mContext, &mHostMemory));
+        if (hostPtr != nullptr)
+        {
+            std::memcpy(mHostMemory, hostPtr, size);
+        }
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(mBuffer.init(mContext, createInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+
+    // The initial contents of CL_MEM_COPY_HOST_PTR buffers, and of CL_MEM_USE_HOST_PTR buffers
+    // which couldn't import the host memory, are uploaded through a staging buffer.
+    if (hostPtr == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    RendererVk *renderer = mContext->getRenderer();
+
+    vk::BufferHelper stagingBuffer;
+    uint8_t *stagingMemory = nullptr;
+    ANGLE_TRY(mContext->initStagingBuffer(size, &stagingBuffer, &stagingMemory));
+    std::memcpy(stagingMemory, hostPtr, size);
+    ANGLE_TRY(stagingBuffer.flush(renderer, 0, size));
+
+    vk::ResourceUseList resourceUseList;
+    stagingBuffer.retain(&resourceUseList);
+    mBuffer.retain(&resourceUseList);
+
+    VkBufferCopy copyRegion = {};
+    copyRegion.srcOffset    = 0;
+    copyRegion.dstOffset    = 0;
+    copyRegion.size         = size;
+
+    Serial serial;
+    ANGLE_TRY(mContext->submitCommands(
+        [&](vk::PrimaryCommandBuffer *commandBuffer) {
+            commandBuffer->copyBuffer(stagingBuffer.getBuffer(), mBuffer.getBuffer(), 1,
+                                      &copyRegion);
+        },
+        &resourceUseList, &serial));
+
+    stagingBuffer.release(renderer);
+    return angle::Result::Continue;
+}
+
+VkDeviceSize CLMemoryVk::getOffset() const
+{
+    return mMemory.getOffset();
+}
+
+uint8_t *CLMemoryVk::addStagedMapping(size_t offset, size_t size, cl::MapFlags flags)
+{
+    ASSERT(getHostMemory() == nullptr);
+
+    StagedMapping mapping = {offset, size, flags, nullptr, nullptr};
+    if (mMemory.getHostPtr() != nullptr)
+    {
+        // Maps of CL_MEM_USE_HOST_PTR buffers have to return the host memory.
+        mapping.ptr = static_cast<uint8_t *>(mMemory.getHostPtr()) + offset;
+    }
+    else
+    {
+        mapping.storage.reset(new uint8_t[size]);
+        mapping.ptr = mapping.storage.get();
+    }
+
+    uint8_t *ptr = mapping.ptr;
+    std::lock_guard<std::mutex> lock(mMappingMutex);
+    mStagedMappings.push_back(std::move(mapping));
+    return ptr;
+}
+
+bool CLMemoryVk::removeStagedMapping(void *ptr, StagedMapping *mappingOut)
+{
+    std::lock_guard<std::mutex> lock(mMappingMutex);
+    auto mapping = std::find_if(
+        mStagedMappings.begin(), mStagedMappings.end(),
+        [ptr](const StagedMapping &stagedMapping) { return stagedMapping.ptr == ptr; });
+    if (mapping == mStagedMappings.end())
+    {
+        return false;
+    }
+    *mappingOut = std::move(*mapping);
+    mStagedMappings.erase(mapping);
+    return true;
+}
 
-CLMemoryVk::~CLMemoryVk() = default;
+size_t CLMemoryVk::getSize(cl_int &errorCode) const
+{
+    return mSize;
+}
+
+angle::Result CLMemoryVk::initFromHostMemory(const VkBufferCreateInfo &createInfo, void *hostPtr)
+{
+    RendererVk *renderer = mContext->getRenderer();
+    if (!renderer->getFeatures().supportsExternalMemoryHost.enabled)
+    {
+        return angle::Result::Continue;
+    }
+
+    // The whole import has to lie within the host memory.
+    const VkDeviceSize alignment = renderer->getMinImportedHostPointerAlignment();
+    if (reinterpret_cast<uintptr_t>(hostPtr) % alignment != 0 || createInfo.size % alignment != 0)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(mBuffer.initExternalHost(
+        mContext, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        createInfo, hostPtr));
+
+    // Without coherent memory, the host memory would need explicit flushes around device access.
+    if (!mBuffer.isHostVisible() || !mBuffer.isCoherent())
+    {
+        mBuffer.destroy(renderer);
+        return angle::Result::Continue;
+    }
+
+    mHostMemory = static_cast<uint8_t *>(hostPtr);
+    return angle::Result::Continue;
+}
+
+CLMemoryImpl::Ptr CLMemoryVk::createSubBuffer(const cl::Buffer &buffer,
+                                              cl::MemFlags flags,
+                                              size_t size,
+                                              cl_int &errorCode)
+{
+    return CLMemoryImpl::Ptr(new CLMemoryVk(buffer, this, size));
+}
 
 }  // namespace rx
@@ -9,19 +9,87 @@
 #define LIBANGLE_RENDERER_VULKAN_CLMEMORYVK_H_
 
 #include "libANGLE/renderer/vulkan/cl_types.h"
+#include "libANGLE/renderer/vulkan/vk_helpers.h"
 
 #include "libANGLE/renderer/CLMemoryImpl.h"
 
+#include <mutex>
+
 namespace rx
 {
 
+// CL_MEM_USE_HOST_PTR buffers import the application memory with VK_EXT_external_memory_host when
+// it is suitably aligned, and CL_MEM_ALLOC_HOST_PTR buffers are allocated in host-visible memory.
+// Both are coherent and mapped at all times, so maps don't copy. Other buffers live in device-local
+// memory, and maps go through staging copies.
 class CLMemoryVk : public CLMemoryImpl
 {
   public:
-    CLMemoryVk(const cl::Memory &memory);
+    // A map of a buffer without host memory, which is copied back on unmap if it was written.
+    struct StagedMapping
+    {
+        size_t offset;
+        size_t size;
+        cl::MapFlags flags;
+        uint8_t *ptr;
+        // Holds the mapped contents unless they are copied to the CL_MEM_USE_HOST_PTR memory.
+        std::unique_ptr<uint8_t[]> storage;
+    };
+
+    // Creates a buffer with its own storage. init() has to be called before it can be used.
+    CLMemoryVk(const cl::Memory &memory, CLContextVk *context);
     ~CLMemoryVk() override;
+
+    angle::Result init(size_t size, void *hostPtr);
+
+    // Sub-buffers share the storage of their parent buffer.
+    const vk::BufferHelper &getBuffer() const;
+    VkDeviceSize getOffset() const;
+
+    // Returns the host memory of the buffer at its offset, or null if the buffer has none.
+    uint8_t *getHostMemory() const;
+
+    // Returns the host pointer of a new staged map of the given range of the buffer.
+    uint8_t *addStagedMapping(size_t offset, size_t size, cl::MapFlags flags);
+    // Removes a staged map by its host pointer. Returns false if there is no such map.
+    bool removeStagedMapping(void *ptr, StagedMapping *mappingOut);
+
+    size_t getSize(cl_int &errorCode) const override;
+
+    CLMemoryImpl::Ptr createSubBuffer(const cl::Buffer &buffer,
+                                      cl::MemFlags flags,
+                                      size_t size,
+                                      cl_int &errorCode) override;
+
+  private:
+    CLMemoryVk(const cl::Memory &memory, CLMemoryVk *parent, size_t size);
+
+    // Imports CL_MEM_USE_HOST_PTR memory if the device supports it for the pointer. Otherwise the
+    // buffer is left uninitialized.
+    angle::Result initFromHostMemory(const VkBufferCreateInfo &createInfo, void *hostPtr);
+
+    CLContextVk *const mContext;
+    // The front end keeps the parent memory object alive as long as its sub-buffers.
+    CLMemoryVk *const mParent;
+    vk::BufferHelper mBuffer;
+    size_t mSize;
+    uint8_t *mHostMemory;
+
+    std::mutex mMappingMutex;
+    std::vector<StagedMapping> mStagedMappings;
 };
 
+inline const vk::BufferHelper &CLMemoryVk::getBuffer() const
+{
+    return mParent != nullptr ? mParent->mBuffer : mBuffer;
+}
+
+inline uint8_t *CLMemoryVk::getHostMemory() const
+{
+    uint8_t *hostMemory = mParent != nullptr ? mParent->mHostMemory : mHostMemory;
+    return hostMemory != nullptr ? hostMemory + getOffset() : nullptr;
+}
+
 }  // namespace rx
 
 #endif  // LIBANGLE_RENDERER_VULKAN_CLMEMORYVK_H_
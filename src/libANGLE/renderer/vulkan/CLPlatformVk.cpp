@@ -7,9 +7,14 @@
 
 #include "libANGLE/renderer/vulkan/CLPlatformVk.h"
 
+#include "libANGLE/renderer/vulkan/CLCommandQueueVk.h"
+#include "libANGLE/renderer/vulkan/CLContextVk.h"
 #include "libANGLE/renderer/vulkan/CLDeviceVk.h"
+#include "libANGLE/renderer/vulkan/DisplayVk.h"
 
+#include "libANGLE/CLCommandQueue.h"
 #include "libANGLE/CLPlatform.h"
+#include "libANGLE/Display.h"
 
 #include "anglebase/no_destructor.h"
 #include "common/angle_version.h"
@@ -20,6 +25,10 @@ namespace rx
 namespace
 {
 
+// The completion thread waits in slices, so it doesn't hold the command queue lock of the renderer
+// for long, and notices when the platform is destroyed.
+constexpr uint64_t kCompletionWaitTimeoutNs = 10'000'000;
+
 std::string CreateExtensionString(const NameVersionVector &extList)
 {
     std::string extensions;
@@ -37,7 +46,18 @@ std::string CreateExtensionString(const NameVersionVector &extList)
 
 }  // namespace
 
-CLPlatformVk::~CLPlatformVk() = default;
+CLPlatformVk::~CLPlatformVk()
+{
+    {
+        std::lock_guard<std::mutex> lock(mCompletionMutex);
+        mCompletionThreadExit = true;
+    }
+    mCompletionCondition.notify_one();
+    if (mCompletionThread.joinable())
+    {
+        mCompletionThread.join();
+    }
+}
 
 CLPlatformImpl::Info CLPlatformVk::createInfo() const
 {
@@ -58,10 +78,22 @@ CLPlatformImpl::Info CLPlatformVk::createInfo() const
 
 CLDeviceImpl::CreateDatas CLPlatformVk::createDevices() const
 {
-    cl::DeviceType type;  // TODO(jplate) Fetch device type from Vulkan
     CLDeviceImpl::CreateDatas createDatas;
-    createDatas.emplace_back(
-        type, [](const cl::Device &device) { return CLDeviceVk::Ptr(new CLDeviceVk(device)); });
+
+    // The device info is queried from the renderer, so a platform without one has no devices.
+    cl_int errorCode     = CL_SUCCESS;
+    RendererVk *renderer = getRenderer(errorCode);
+    if (renderer == nullptr)
+    {
+        return createDatas;
+    }
+
+    // The renderer's device is the only device, so it is the default device.
+    cl::DeviceType type = CLDeviceVk::GetDeviceType(renderer);
+    type.set(CL_DEVICE_TYPE_DEFAULT);
+    createDatas.emplace_back(type, [renderer](const cl::Device &device) {
+        return CLDeviceVk::Ptr(new CLDeviceVk(device, renderer));
+    });
     return createDatas;
 }
 
@@ -70,8 +102,12 @@ CLContextImpl::Ptr CLPlatformVk::createContext(cl::Context &context,
                                                bool userSync,
                                                cl_int &errorCode)
 {
-    CLContextImpl::Ptr contextImpl;
-    return contextImpl;
+    RendererVk *renderer = getRenderer(errorCode);
+    if (renderer == nullptr)
+    {
+        return CLContextImpl::Ptr();
+    }
+    return CLContextImpl::Ptr(new CLContextVk(context, renderer));
 }
 
 CLContextImpl::Ptr CLPlatformVk::createContextFromType(cl::Context &context,
@@ -79,8 +115,12 @@ CLContextImpl::Ptr CLPlatformVk::createContextFromType(cl::Context &context,
                                                        bool userSync,
                                                        cl_int &errorCode)
 {
-    CLContextImpl::Ptr contextImpl;
-    return contextImpl;
+    RendererVk *renderer = getRenderer(errorCode);
+    if (renderer == nullptr)
+    {
+        return CLContextImpl::Ptr();
+    }
+    return CLContextImpl::Ptr(new CLContextVk(context, renderer));
 }
 
 cl_int CLPlatformVk::unloadCompiler()
@@ -88,6 +128,19 @@ cl_int CLPlatformVk::unloadCompiler()
     return CL_SUCCESS;
 }
 
+void CLPlatformVk::addCompletionWait(cl::CommandQueuePtr &&queue, Serial serial)
+{
+    {
+        std::lock_guard<std::mutex> lock(mCompletionMutex);
+        mCompletionWaits.push_back({std::move(queue), serial});
+        if (!mCompletionThread.joinable())
+        {
+            mCompletionThread = std::thread(&CLPlatformVk::processCompletionWaits, this);
+        }
+    }
+    mCompletionCondition.notify_one();
+}
+
 void CLPlatformVk::Initialize(CreateFuncs &createFuncs)
 {
     createFuncs.emplace_back(
@@ -104,4 +157,72 @@ const std::string &CLPlatformVk::GetVersionString()
 
 CLPlatformVk::CLPlatformVk(const cl::Platform &platform) : CLPlatformImpl(platform) {}
 
+void CLPlatformVk::processCompletionWaits()
+{
+    std::unique_lock<std::mutex> lock(mCompletionMutex);
+    while (true)
+    {
+        mCompletionCondition.wait(
+            lock, [this] { return mCompletionThreadExit || !mCompletionWaits.empty(); });
+        if (mCompletionThreadExit)
+        {
+            return;
+        }
+
+        // Serials are submitted in order, so the oldest wait finishes first.
+        CompletionWait wait = std::move(mCompletionWaits.front());
+        mCompletionWaits.pop_front();
+        lock.unlock();
+
+        CLCommandQueueVk &queueVk = wait.queue->getImpl<CLCommandQueueVk>();
+        bool finished             = false;
+        while (!finished)
+        {
+            if (queueVk.waitForBatch(wait.serial, kCompletionWaitTimeoutNs, &finished) !=
+                CL_SUCCESS)
+            {
+                WARN() << "Failed to wait for the completion of OpenCL commands";
+                break;
+            }
+
+            std::lock_guard<std::mutex> exitLock(mCompletionMutex);
+            if (mCompletionThreadExit)
+            {
+                break;
+            }
+        }
+
+        // The callbacks may have released the last other reference to the queue, so it is
+        // released without holding the lock.
+        wait.queue = nullptr;
+        lock.lock();
+    }
+}
+
+RendererVk *CLPlatformVk::getRenderer(cl_int &errorCode) const
+{
+    std::lock_guard<std::mutex> lock(mDisplayMutex);
+    if (mDisplay == nullptr)
+    {
+        // The default Vulkan display is shared with EGL. It is not terminated, since the platform
+        // lives as long as the process. ANGLE_DEFAULT_PLATFORM=swiftshader selects SwiftShader.
+        const EGLAttrib attribs[] = {EGL_PLATFORM_ANGLE_TYPE_ANGLE,
+                                     EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE, EGL_NONE};
+        egl::Display *display = egl::Display::GetDisplayFromNativeDisplay(
+            EGL_DEFAULT_DISPLAY, egl::AttributeMap::CreateFromAttribArray(attribs));
+        // The display may already have been initialized by EGL with another back end.
+        if (display == nullptr ||
+            display->getAttributeMap().get(EGL_PLATFORM_ANGLE_TYPE_ANGLE) !=
+                EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE ||
+            display->initialize().isError())
+        {
+            ERR() << "Failed to initialize the Vulkan display for OpenCL";
+            errorCode = CL_OUT_OF_RESOURCES;
+            return nullptr;
+        }
+        mDisplay = display;
+    }
+    return vk::GetImpl(mDisplay)->getRenderer();
+}
+
 }  // namespace rx
@@ -9,9 +9,21 @@
 #define LIBANGLE_RENDERER_VULKAN_CLPLATFORMVK_H_
 
 #include "libANGLE/renderer/CLPlatformImpl.h"
+#include "libANGLE/renderer/serial_utils.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace egl
+{
+class Display;
+}  // namespace egl
 
 namespace rx
 {
+class RendererVk;
 
 class CLPlatformVk : public CLPlatformImpl
 {
@@ -33,6 +45,10 @@ class CLPlatformVk : public CLPlatformImpl
 
     cl_int unloadCompiler() override;
 
+    // Checks the completed commands of |queue| on the completion thread once the batch of |serial|
+    // has finished, so that event callbacks are called without the application waiting.
+    void addCompletionWait(cl::CommandQueuePtr &&queue, Serial serial);
+
     static void Initialize(CreateFuncs &createFuncs);
 
     static constexpr cl_version GetVersion();
@@ -40,6 +56,27 @@ class CLPlatformVk : public CLPlatformImpl
 
   private:
     explicit CLPlatformVk(const cl::Platform &platform);
+
+    // Returns the renderer of the Vulkan display, which is initialized on first use.
+    RendererVk *getRenderer(cl_int &errorCode) const;
+
+    void processCompletionWaits();
+
+    mutable std::mutex mDisplayMutex;
+    mutable egl::Display *mDisplay = nullptr;
+
+    // The completion thread is started with the first wait. It lives in the platform, since the
+    // callbacks it calls may release the last references to queues and contexts.
+    struct CompletionWait
+    {
+        cl::CommandQueuePtr queue;
+        Serial serial;
+    };
+    std::mutex mCompletionMutex;
+    std::condition_variable mCompletionCondition;
+    std::deque<CompletionWait> mCompletionWaits;
+    std::thread mCompletionThread;
+    bool mCompletionThreadExit = false;
 };
 
 constexpr cl_version CLPlatformVk::GetVersion()
@@ -281,6 +281,7 @@ CommandBatch &CommandBatch::operator=(CommandBatch &&other)
     std::swap(commandPool, other.commandPool);
     std::swap(fence, other.fence);
     std::swap(serial, other.serial);
+    std::swap(priority, other.priority);
     std::swap(hasProtectedContent, other.hasProtectedContent);
     return *this;
 }
@@ -744,7 +745,9 @@ angle::Result CommandProcessor::flushRenderPassCommands(Context *context,
 }
 
 // CommandQueue implementation.
-CommandQueue::CommandQueue() : mCurrentQueueSerial(mQueueSerialFactory.generate()) {}
+CommandQueue::CommandQueue()
+    : mCurrentQueueSerial(mQueueSerialFactory.generate()), mUseTimelineSemaphores(false)
+{}
 
 CommandQueue::~CommandQueue() = default;
 
@@ -775,6 +778,11 @@ void CommandQueue::destroy(Context *context)
 
     mFenceRecycler.destroy(context);
 
+    for (Semaphore &semaphore : mQueueSerialSemaphores)
+    {
+        semaphore.destroy(renderer->getDevice());
+    }
+
     ASSERT(mInFlightCommands.empty() && mGarbageQueue.empty());
 }
 
@@ -789,6 +797,30 @@ angle::Result CommandQueue::init(Context *context, const vk::DeviceQueueMap &que
         ANGLE_TRY(mProtectedCommandPool.init(context, true, queueMap.getIndex()));
     }
 
+    const angle::FeaturesVk &features = context->getRenderer()->getFeatures();
+    mUseTimelineSemaphores            = features.supportsTimelineSemaphore.enabled;
+    if (mUseTimelineSemaphores)
+    {
+        VkSemaphoreTypeCreateInfoKHR typeInfo = {};
+        typeInfo.sType                        = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        typeInfo.semaphoreType                = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        typeInfo.initialValue                 = 0;
+
+        VkSemaphoreCreateInfo semaphoreInfo = {};
+        semaphoreInfo.sType                 = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext                 = &typeInfo;
+
+        // Priorities that share a queue share its semaphore.
+        for (egl::ContextPriority priority : angle::AllEnums<egl::ContextPriority>())
+        {
+            if (queueMap.getDevicePriority(priority) == priority)
+            {
+                ANGLE_VK_TRY(context, mQueueSerialSemaphores[priority].init(context->getDevice(),
+                                                                            semaphoreInfo));
+            }
+        }
+    }
+
     return angle::Result::Continue;
 }
 
@@ -800,15 +832,40 @@ angle::Result CommandQueue::checkCompletedCommands(Context *context)
 
     int finishedCount = 0;
 
-    for (CommandBatch &batch : mInFlightCommands)
+    if (mUseTimelineSemaphores)
     {
-        VkResult result = batch.fence.get().getStatus(device);
-        if (result == VK_NOT_READY)
+        // The value of a queue's semaphore is the serial of the last batch it finished, so it's
+        // queried once for all of the batches submitted to the queue.
+        angle::PackedEnumMap<egl::ContextPriority, uint64_t> completedSerials;
+        angle::PackedEnumBitSet<egl::ContextPriority> queriedSemaphores;
+
+        for (const CommandBatch &batch : mInFlightCommands)
         {
-            break;
+            if (!queriedSemaphores.test(batch.priority))
+            {
+                ANGLE_VK_TRY(context, mQueueSerialSemaphores[batch.priority].getCounterValue(
+                                          device, &completedSerials[batch.priority]));
+                queriedSemaphores.set(batch.priority);
+            }
+            if (batch.serial.getValue() > completedSerials[batch.priority])
+            {
+                break;
+            }
+            ++finishedCount;
+        }
+    }
+    else
+    {
+        for (CommandBatch &batch : mInFlightCommands)
+        {
+            VkResult result = batch.fence.get().getStatus(device);
+            if (result == VK_NOT_READY)
+            {
+                break;
+            }
+            ANGLE_VK_TRY(context, result);
+            ++finishedCount;
         }
-        ANGLE_VK_TRY(context, result);
-        ++finishedCount;
     }
 
     if (finishedCount == 0)
@@ -850,10 +907,7 @@ angle::Result CommandQueue::retireFinishedCommands(Context *context, size_t fini
         GarbageAndSerial &garbageList = mGarbageQueue[freeIndex];
         if (garbageList.getSerial() < mLastCompletedQueueSerial)
         {
-            for (GarbageObject &garbage : garbageList.get())
-            {
-                garbage.destroy(renderer);
-            }
+            renderer->collectCompletedGarbage(std::move(garbageList.get()));
         }
         else
         {
@@ -923,7 +977,7 @@ void CommandQueue::handleDeviceLost(RendererVk *renderer)
     for (CommandBatch &batch : mInFlightCommands)
     {
         // On device loss we need to wait for fence to be signaled before destroying it
-        VkResult status = batch.fence.get().wait(device, renderer->getMaxFenceWaitTimeNs());
+        VkResult status = waitForCommandBatch(device, batch, renderer->getMaxFenceWaitTimeNs());
         // If the wait times out, it is probably not possible to recover from lost device
         ASSERT(status == VK_SUCCESS || status == VK_ERROR_DEVICE_LOST);
 
@@ -970,7 +1024,7 @@ angle::Result CommandQueue::finishToSerial(Context *context, Serial finishSerial
 
     // Wait for it finish
     VkDevice device = context->getDevice();
-    VkResult status = batch.fence.get().wait(device, timeout);
+    VkResult status = waitForCommandBatch(device, batch, timeout);
 
     ANGLE_VK_TRY(context, status);
 
@@ -1025,11 +1079,16 @@ angle::Result CommandQueue::submitFrame(
     DeviceScoped<CommandBatch> scopedBatch(device);
     CommandBatch &batch = scopedBatch.get();
 
-    ANGLE_TRY(mFenceRecycler.newSharedFence(context, &batch.fence));
+    if (!mUseTimelineSemaphores)
+    {
+        ANGLE_TRY(mFenceRecycler.newSharedFence(context, &batch.fence));
+    }
     batch.serial              = submitQueueSerial;
+    batch.priority            = mQueueMap.getDevicePriority(priority);
     batch.hasProtectedContent = hasProtectedContent;
 
-    ANGLE_TRY(queueSubmit(context, priority, submitInfo, &batch.fence.get(), batch.serial));
+    const Fence *fence = batch.fence.isReferenced() ? &batch.fence.get() : nullptr;
+    ANGLE_TRY(queueSubmit(context, priority, submitInfo, fence, batch.serial));
 
     if (!currentGarbage.empty())
     {
@@ -1099,9 +1158,7 @@ angle::Result CommandQueue::waitForSerialWithUserTimeout(vk::Context *context,
 
     ASSERT(serial == mInFlightCommands[batchIndex].serial);
 
-    vk::Fence &fence = mInFlightCommands[batchIndex].fence.get();
-    ASSERT(fence.valid());
-    *result = fence.wait(context->getDevice(), timeout);
+    *result = waitForCommandBatch(context->getDevice(), mInFlightCommands[batchIndex], timeout);
 
     // Don't trigger an error on timeout.
     if (*result != VK_TIMEOUT)
@@ -1133,6 +1190,20 @@ angle::Result CommandQueue::ensurePrimaryCommandBufferValid(Context *context,
     return angle::Result::Continue;
 }
 
+VkResult CommandQueue::waitForCommandBatch(VkDevice device,
+                                           const CommandBatch &batch,
+                                           uint64_t timeout)
+{
+    if (mUseTimelineSemaphores)
+    {
+        return mQueueSerialSemaphores[batch.priority].wait(device, batch.serial.getValue(),
+                                                           timeout);
+    }
+
+    ASSERT(batch.fence.get().valid());
+    return batch.fence.get().wait(device, timeout);
+}
+
 angle::Result CommandQueue::flushOutsideRPCommands(Context *context,
                                                    bool hasProtectedContent,
                                                    CommandBufferHelper **outsideRPCommands)
@@ -1198,9 +1269,37 @@ angle::Result CommandQueue::queueSubmit(Context *context,
         renderer->outputVmaStatString();
     }
 
+    // Add the signal of the queue's timeline semaphore to the semaphore the caller may signal.
+    VkSubmitInfo queueSubmitInfo                        = submitInfo;
+    VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo = {};
+    std::array<VkSemaphore, 2> signalSemaphores         = {};
+    std::array<uint64_t, 2> signalValues                = {};
+    if (mUseTimelineSemaphores)
+    {
+        ASSERT(submitInfo.signalSemaphoreCount <= 1);
+        const uint32_t signalCount = submitInfo.signalSemaphoreCount;
+        if (signalCount > 0)
+        {
+            signalSemaphores[0] = submitInfo.pSignalSemaphores[0];
+        }
+
+        const egl::ContextPriority devicePriority = mQueueMap.getDevicePriority(contextPriority);
+        signalSemaphores[signalCount] = mQueueSerialSemaphores[devicePriority].getHandle();
+        signalValues[signalCount]     = submitQueueSerial.getValue();
+
+        timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timelineSubmitInfo.pNext                     = submitInfo.pNext;
+        timelineSubmitInfo.signalSemaphoreValueCount = signalCount + 1;
+        timelineSubmitInfo.pSignalSemaphoreValues    = signalValues.data();
+
+        queueSubmitInfo.pNext                = &timelineSubmitInfo;
+        queueSubmitInfo.signalSemaphoreCount = signalCount + 1;
+        queueSubmitInfo.pSignalSemaphores    = signalSemaphores.data();
+    }
+
     VkFence fenceHandle = fence ? fence->getHandle() : VK_NULL_HANDLE;
     VkQueue queue       = getQueue(contextPriority);
-    ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &submitInfo, fenceHandle));
+    ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &queueSubmitInfo, fenceHandle));
     mLastSubmittedQueueSerial = submitQueueSerial;
 
     // Now that we've submitted work, clean up RendererVk garbage
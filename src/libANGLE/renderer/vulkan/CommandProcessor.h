@@ -179,8 +179,11 @@ struct CommandBatch final : angle::NonCopyable
     PrimaryCommandBuffer primaryCommands;
     // commandPool is for secondary CommandBuffer allocation
     CommandPool commandPool;
+    // Not used with timeline semaphores, which are signaled with |serial| instead.
     Shared<Fence> fence;
     Serial serial;
+    // The device priority of the queue the batch is submitted to.
+    egl::ContextPriority priority;
     bool hasProtectedContent;
 };
 
@@ -381,6 +384,7 @@ class CommandQueue final : public CommandQueueInterface
                                         CommandBatch *batch);
     angle::Result retireFinishedCommands(Context *context, size_t finishedCount);
     angle::Result ensurePrimaryCommandBufferValid(Context *context, bool hasProtectedContent);
+    VkResult waitForCommandBatch(VkDevice device, const CommandBatch &batch, uint64_t timeout);
 
     bool allInFlightCommandsAreAfterSerial(Serial serial);
 
@@ -430,6 +434,13 @@ class CommandQueue final : public CommandQueueInterface
     DeviceQueueMap mQueueMap;
 
     FenceRecycler mFenceRecycler;
+
+    // With the supportsTimelineSemaphore feature, every submission signals the timeline semaphore
+    // of its queue with its serial, and the batches are tracked with the semaphores instead of
+    // fences.  There is a semaphore per device priority, as the queues can finish their
+    // submissions out of serial order, while the value of a timeline semaphore only increases.
+    bool mUseTimelineSemaphores;
+    angle::PackedEnumMap<egl::ContextPriority, Semaphore> mQueueSerialSemaphores;
 };
 
 // CommandProcessor is used to dispatch work to the GPU when the asyncCommandQueue feature is
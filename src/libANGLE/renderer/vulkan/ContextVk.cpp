@@ -450,6 +450,7 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
       mPerfCounters{},
       mContextPerfCounters{},
       mCumulativeContextPerfCounters{},
+      mPerfCounterTotals{},
       mContextPriority(renderer->getDriverPriority(GetContextPriority(state))),
       mShareGroupVk(vk::GetImpl(state.getShareGroup()))
 {
@@ -872,6 +873,23 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
         mGraphicsDirtyBits.set(DIRTY_BIT_VERTEX_BUFFERS);
     }
 
+    // Must be called before the command buffer is started. Can call finish.  The buffers whose
+    // indices or vertices are converted on the GPU are already packed, before the conversions are
+    // recorded.
+    if (ANGLE_UNLIKELY(!mShareGroupVk->getBuffersWithPendingPackPixels()->empty()))
+    {
+        ANGLE_TRY(flushPendingPackPixelsUsedByCommands());
+    }
+
+    // The index and vertex buffer conversions of this draw are recorded together when its render
+    // pass starts.  If the draw continues the started render pass, they are recorded here, before
+    // the draw, without breaking the render pass unless it uses the converted buffers.
+    if (ANGLE_UNLIKELY(mUtils.hasPendingConversions()) && hasStartedRenderPass() &&
+        !mGraphicsDirtyBits.test(DIRTY_BIT_RENDER_PASS))
+    {
+        ANGLE_TRY(mUtils.flushPendingConversions(this));
+    }
+
     // Create a local object to ensure we flush the descriptor updates to device when we leave this
     // function
     ScopedDescriptorSetUpdates descriptorSetUpdates(this);
@@ -1110,6 +1128,21 @@ angle::Result ContextVk::setupLineLoopDraw(const gl::Context *context,
                      mIndexedDirtyBitsMask);
 }
 
+angle::Result ContextVk::flushPendingPackPixelsUsedByCommands()
+{
+    // The buffers are removed from the list as they are flushed, so iterate over a copy.
+    const std::vector<BufferVk *> buffers = *mShareGroupVk->getBuffersWithPendingPackPixels();
+    for (BufferVk *bufferVk : buffers)
+    {
+        if (bufferVk->isUsedByCommands(mState))
+        {
+            ANGLE_TRY(bufferVk->flushPendingPackPixels(this));
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::setupDispatch(const gl::Context *context)
 {
     // Note: numerous tests miss a glMemoryBarrier call between the initial texture data upload and
@@ -1117,6 +1150,11 @@ angle::Result ContextVk::setupDispatch(const gl::Context *context)
     // TODO: Remove this and fix tests.  http://anglebug.com/5070
     ANGLE_TRY(flushOutsideRenderPassCommands());
 
+    if (ANGLE_UNLIKELY(!mShareGroupVk->getBuffersWithPendingPackPixels()->empty()))
+    {
+        ANGLE_TRY(flushPendingPackPixelsUsedByCommands());
+    }
+
     // Create a local object to ensure we flush the descriptor updates to device when we leave this
     // function
     ScopedDescriptorSetUpdates descriptorSetUpdates(this);
@@ -1465,6 +1503,13 @@ angle::Result ContextVk::handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirt
                                                dirtyBitMask & ~DirtyBits{DIRTY_BIT_RENDER_PASS}));
     }
 
+    // Record the conversions of the draw's index and vertex buffers before the render pass that
+    // uses them.
+    if (mUtils.hasPendingConversions())
+    {
+        ANGLE_TRY(mUtils.flushPendingConversions(this));
+    }
+
     gl::Rectangle scissoredRenderArea = mDrawFramebuffer->getRotatedScissoredRenderArea(this);
     bool renderPassDescChanged        = false;
 
@@ -2043,6 +2088,12 @@ angle::Result ContextVk::handleDirtyDescriptorSetsImpl(vk::CommandBuffer *comman
 
 void ContextVk::syncObjectPerfCounters()
 {
+    mPerfCounterTotals.descriptorSetAllocations += mPerfCounters.descriptorSetAllocations;
+    mPerfCounterTotals.shaderBuffersDescriptorSetCacheHits +=
+        mPerfCounters.shaderBuffersDescriptorSetCacheHits;
+    mPerfCounterTotals.shaderBuffersDescriptorSetCacheMisses +=
+        mPerfCounters.shaderBuffersDescriptorSetCacheMisses;
+
     mPerfCounters.descriptorSetAllocations              = 0;
     mPerfCounters.shaderBuffersDescriptorSetCacheHits   = 0;
     mPerfCounters.shaderBuffersDescriptorSetCacheMisses = 0;
@@ -2084,6 +2135,99 @@ void ContextVk::syncObjectPerfCounters()
     }
 }
 
+const angle::PerfMonitorCounterGroups &ContextVk::getPerfMonitorCounters()
+{
+    constexpr angle::PackedEnumMap<VulkanCacheType, const char *> kCacheNames = {
+        {VulkanCacheType::CompatibleRenderPass, "compatibleRenderPass"},
+        {VulkanCacheType::RenderPassWithOps, "renderPassWithOps"},
+        {VulkanCacheType::GraphicsPipeline, "graphicsPipeline"},
+        {VulkanCacheType::PipelineLayout, "pipelineLayout"},
+        {VulkanCacheType::Sampler, "sampler"},
+        {VulkanCacheType::SamplerYcbcrConversion, "samplerYcbcrConversion"},
+        {VulkanCacheType::DescriptorSetLayout, "descriptorSetLayout"},
+        {VulkanCacheType::DriverUniformsDescriptors, "driverUniformsDescriptors"},
+        {VulkanCacheType::TextureDescriptors, "textureDescriptors"},
+        {VulkanCacheType::UniformsAndXfbDescriptors, "uniformsAndXfbDescriptors"},
+        {VulkanCacheType::ShaderBuffersDescriptors, "shaderBuffersDescriptors"},
+        {VulkanCacheType::Framebuffer, "framebuffer"},
+    };
+
+    // Group 0 has the perf counters, group 1 has the hits and misses of each cache, and group 2
+    // has the renderer's garbage stats.
+    if (mPerfMonitorCounters.empty())
+    {
+        mPerfMonitorCounters.resize(3);
+
+        angle::PerfMonitorCounterGroup &perfCounterGroup = mPerfMonitorCounters[0];
+        perfCounterGroup.name                            = "vulkan";
+#define ANGLE_ADD_PERF_MONITOR_COUNTER(COUNTER) \
+    perfCounterGroup.counters.emplace_back();   \
+    perfCounterGroup.counters.back().name = #COUNTER;
+        ANGLE_VK_PERF_COUNTERS_X(ANGLE_ADD_PERF_MONITOR_COUNTER)
+#undef ANGLE_ADD_PERF_MONITOR_COUNTER
+
+        angle::PerfMonitorCounterGroup &cacheGroup = mPerfMonitorCounters[1];
+        cacheGroup.name                            = "vulkan_caches";
+        cacheGroup.counters.resize(2 * angle::EnumSize<VulkanCacheType>());
+        for (VulkanCacheType cacheType : angle::AllEnums<VulkanCacheType>())
+        {
+            const std::string cacheName = kCacheNames[cacheType];
+            const size_t index          = 2 * ToUnderlying(cacheType);
+
+            cacheGroup.counters[index].name     = cacheName + "CacheHits";
+            cacheGroup.counters[index + 1].name = cacheName + "CacheMisses";
+        }
+
+        angle::PerfMonitorCounterGroup &garbageGroup = mPerfMonitorCounters[2];
+        garbageGroup.name                            = "vulkan_garbage";
+        garbageGroup.counters.resize(4);
+        garbageGroup.counters[0].name = "queuedGarbageObjects";
+        garbageGroup.counters[1].name = "queuedGarbageBytes";
+        garbageGroup.counters[2].name = "destroyedGarbageObjects";
+        garbageGroup.counters[3].name = "destroyedGarbageBytes";
+    }
+
+    // Update the counters which are only counted by their objects when asked to.
+    syncObjectPerfCounters();
+
+    angle::PerfMonitorCounters &perfCounters = mPerfMonitorCounters[0].counters;
+    size_t perfCounterIndex                  = 0;
+#define ANGLE_UPDATE_PERF_MONITOR_COUNTER(COUNTER) \
+    perfCounters[perfCounterIndex++].value = mPerfCounterTotals.COUNTER + mPerfCounters.COUNTER;
+    ANGLE_VK_PERF_COUNTERS_X(ANGLE_UPDATE_PERF_MONITOR_COUNTER)
+#undef ANGLE_UPDATE_PERF_MONITOR_COUNTER
+
+    // Most caches add their stats to the renderer's when they are destroyed.  The render pass
+    // cache of this context is still alive, so its stats are added here.
+    angle::PerfMonitorCounters &cacheCounters = mPerfMonitorCounters[1].counters;
+    for (VulkanCacheType cacheType : angle::AllEnums<VulkanCacheType>())
+    {
+        CacheStats stats;
+        stats.accumulate(mRenderer->getCacheStats(cacheType));
+        if (cacheType == VulkanCacheType::CompatibleRenderPass)
+        {
+            stats.accumulate(mRenderPassCache.getCompatibleRenderPassCacheStats());
+        }
+        else if (cacheType == VulkanCacheType::RenderPassWithOps)
+        {
+            stats.accumulate(mRenderPassCache.getRenderPassWithOpsCacheStats());
+        }
+
+        const size_t index             = 2 * ToUnderlying(cacheType);
+        cacheCounters[index].value     = stats.getHitCount();
+        cacheCounters[index + 1].value = stats.getMissCount();
+    }
+
+    const vk::GarbageStats garbageStats         = mRenderer->getGarbageStats();
+    angle::PerfMonitorCounters &garbageCounters = mPerfMonitorCounters[2].counters;
+    garbageCounters[0].value                    = garbageStats.queuedObjects;
+    garbageCounters[1].value                    = garbageStats.queuedBytes;
+    garbageCounters[2].value                    = garbageStats.destroyedObjects;
+    garbageCounters[3].value                    = garbageStats.destroyedBytes;
+
+    return mPerfMonitorCounters;
+}
+
 void ContextVk::updateOverlayOnPresent()
 {
     const gl::OverlayType *overlay = mState.getOverlay();
@@ -2105,9 +2249,20 @@ void ContextVk::updateOverlayOnPresent()
         writeDescriptorSetCount->add(mPerfCounters.writeDescriptorSets);
         writeDescriptorSetCount->next();
 
+        mPerfCounterTotals.writeDescriptorSets += mPerfCounters.writeDescriptorSets;
         mPerfCounters.writeDescriptorSets = 0;
     }
 
+    {
+        gl::RunningGraphWidget *framebufferCreations =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanFramebufferCreations);
+        framebufferCreations->add(mPerfCounters.framebufferCreations);
+        framebufferCreations->next();
+
+        mPerfCounterTotals.framebufferCreations += mPerfCounters.framebufferCreations;
+        mPerfCounters.framebufferCreations = 0;
+    }
+
     {
         gl::RunningGraphWidget *descriptorSetAllocationCount =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanDescriptorSetAllocations);
@@ -4982,6 +5137,9 @@ void ContextVk::handleError(VkResult errorCode,
 {
     ASSERT(errorCode != VK_SUCCESS);
 
+    // The draw that queued the conversions failed, and the buffers they use may be released.
+    mUtils.clearPendingConversions();
+
     GLenum glErrorCode = DefaultGLErrorCode(errorCode);
 
     std::stringstream errorStream;
@@ -5267,6 +5425,12 @@ angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore)
     mHasDeferredFlush = false;
     getShareGroupVk()->clearSyncObjectPendingFlush();
 
+    // Conversions are normally recorded when the render pass of the draw that queued them starts.
+    if (mUtils.hasPendingConversions())
+    {
+        ANGLE_TRY(mUtils.flushPendingConversions(this));
+    }
+
     ANGLE_TRY(flushCommandsAndEndRenderPass());
 
     if (mIsAnyHostVisibleBufferWritten)
@@ -5305,6 +5469,12 @@ angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore)
 
     ANGLE_TRY(submitFrame(signalSemaphore));
 
+    mPerfCounterTotals.renderPasses += mPerfCounters.renderPasses;
+    mPerfCounterTotals.writeDescriptorSets += mPerfCounters.writeDescriptorSets;
+    mPerfCounterTotals.flushedOutsideRenderPassCommandBuffers +=
+        mPerfCounters.flushedOutsideRenderPassCommandBuffers;
+    mPerfCounterTotals.resolveImageCommands += mPerfCounters.resolveImageCommands;
+
     mPerfCounters.renderPasses                           = 0;
     mPerfCounters.writeDescriptorSets                    = 0;
     mPerfCounters.flushedOutsideRenderPassCommandBuffers = 0;
@@ -5551,6 +5721,7 @@ angle::Result ContextVk::onImageReleaseToExternal(const vk::ImageHelper &image)
 
 angle::Result ContextVk::beginNewRenderPass(
     const vk::Framebuffer &framebuffer,
+    const vk::FramebufferAttachmentsVector<VkImageView> &imagelessAttachments,
     const gl::Rectangle &renderArea,
     const vk::RenderPassDesc &renderPassDesc,
     const vk::AttachmentOpsArray &renderPassAttachmentOps,
@@ -5562,9 +5733,10 @@ angle::Result ContextVk::beginNewRenderPass(
     // Next end any currently outstanding renderPass
     ANGLE_TRY(flushCommandsAndEndRenderPass());
 
-    mRenderPassCommands->beginRenderPass(
-        framebuffer, renderArea, renderPassDesc, renderPassAttachmentOps, colorAttachmentCount,
-        depthStencilAttachmentIndex, clearValues, commandBufferOut);
+    mRenderPassCommands->beginRenderPass(framebuffer, imagelessAttachments, renderArea,
+                                         renderPassDesc, renderPassAttachmentOps,
+                                         colorAttachmentCount, depthStencilAttachmentIndex,
+                                         clearValues, commandBufferOut);
     mPerfCounters.renderPasses++;
 
     return angle::Result::Continue;
@@ -6180,6 +6352,58 @@ angle::Result ContextVk::onResourceAccess(const vk::CommandBufferAccess &access)
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::getOutsideRenderPassCommandBufferForComputeBuffers(
+    const std::vector<vk::BufferHelper *> &readBuffers,
+    const std::vector<vk::BufferHelper *> &writeBuffers,
+    vk::CommandBuffer **commandBufferOut)
+{
+    ASSERT(!mOutsideRenderPassCommands->hasRenderPass());
+
+    // Same as flushCommandBuffersIfNecessary(), for all the buffers at once.
+    bool shouldEndRenderPass                  = false;
+    bool shouldCloseOutsideRenderPassCommands = false;
+    for (const vk::BufferHelper *buffer : readBuffers)
+    {
+        shouldEndRenderPass =
+            shouldEndRenderPass || mRenderPassCommands->usesBufferForWrite(*buffer);
+        shouldCloseOutsideRenderPassCommands =
+            shouldCloseOutsideRenderPassCommands ||
+            mOutsideRenderPassCommands->usesBufferForWrite(*buffer);
+    }
+    for (const vk::BufferHelper *buffer : writeBuffers)
+    {
+        shouldEndRenderPass = shouldEndRenderPass || mRenderPassCommands->usesBuffer(*buffer);
+        shouldCloseOutsideRenderPassCommands =
+            shouldCloseOutsideRenderPassCommands || mOutsideRenderPassCommands->usesBuffer(*buffer);
+    }
+
+    if (shouldEndRenderPass)
+    {
+        ANGLE_TRY(flushCommandsAndEndRenderPass());
+    }
+    else if (shouldCloseOutsideRenderPassCommands)
+    {
+        ANGLE_TRY(flushOutsideRenderPassCommands());
+    }
+
+    // The accesses all use the compute shader stage, so their barriers are merged into the single
+    // barrier recorded when the commands are flushed.
+    for (vk::BufferHelper *buffer : readBuffers)
+    {
+        mOutsideRenderPassCommands->bufferRead(this, VK_ACCESS_SHADER_READ_BIT,
+                                               vk::PipelineStage::ComputeShader, buffer);
+    }
+    for (vk::BufferHelper *buffer : writeBuffers)
+    {
+        mOutsideRenderPassCommands->bufferWrite(this, VK_ACCESS_SHADER_WRITE_BIT,
+                                                vk::PipelineStage::ComputeShader,
+                                                vk::AliasingMode::Disallowed, buffer);
+    }
+
+    *commandBufferOut = &mOutsideRenderPassCommands->getCommandBuffer();
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::flushCommandBuffersIfNecessary(const vk::CommandBufferAccess &access)
 {
     // Go over resources and decide whether the render pass needs to close, whether the outside
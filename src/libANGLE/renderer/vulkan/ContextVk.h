@@ -216,6 +216,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                  const std::string &message) override;
     angle::Result popDebugGroup(const gl::Context *context) override;
 
+    // GL_AMD_performance_monitor
+    const angle::PerfMonitorCounterGroups &getPerfMonitorCounters() override;
+
     // Record GL API calls for debuggers
     void logEvent(const char *eventString);
     void endEventLog(angle::EntryPoint entryPoint, PipelineType pipelineType);
@@ -524,14 +527,24 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         return angle::Result::Continue;
     }
 
-    angle::Result beginNewRenderPass(const vk::Framebuffer &framebuffer,
-                                     const gl::Rectangle &renderArea,
-                                     const vk::RenderPassDesc &renderPassDesc,
-                                     const vk::AttachmentOpsArray &renderPassAttachmentOps,
-                                     const vk::PackedAttachmentCount colorAttachmentCount,
-                                     const vk::PackedAttachmentIndex depthStencilAttachmentIndex,
-                                     const vk::PackedClearValuesArray &clearValues,
-                                     vk::CommandBuffer **commandBufferOut);
+    // Like getOutsideRenderPassCommandBuffer(), for compute shader reads and writes of any number
+    // of buffers.  The command buffers are flushed at most once for all the buffers, and their
+    // barriers are merged into one.
+    angle::Result getOutsideRenderPassCommandBufferForComputeBuffers(
+        const std::vector<vk::BufferHelper *> &readBuffers,
+        const std::vector<vk::BufferHelper *> &writeBuffers,
+        vk::CommandBuffer **commandBufferOut);
+
+    angle::Result beginNewRenderPass(
+        const vk::Framebuffer &framebuffer,
+        const vk::FramebufferAttachmentsVector<VkImageView> &imagelessAttachments,
+        const gl::Rectangle &renderArea,
+        const vk::RenderPassDesc &renderPassDesc,
+        const vk::AttachmentOpsArray &renderPassAttachmentOps,
+        const vk::PackedAttachmentCount colorAttachmentCount,
+        const vk::PackedAttachmentIndex depthStencilAttachmentIndex,
+        const vk::PackedClearValuesArray &clearValues,
+        vk::CommandBuffer **commandBufferOut);
 
     // Only returns true if we have a started RP and we've run setupDraw.
     bool hasStartedRenderPass() const
@@ -546,6 +559,14 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                mRenderPassCommands->getFramebufferHandle() == framebuffer->getHandle();
     }
 
+    // Unlike hasStartedRenderPassWithFramebuffer(), also true if the render pass was finished but
+    // not yet flushed, so that restoreFinishedRenderPass() could resume it.
+    bool hasRenderPassCommandsWithFramebuffer(vk::Framebuffer *framebuffer) const
+    {
+        return mRenderPassCommands->started() &&
+               mRenderPassCommands->getFramebufferHandle() == framebuffer->getHandle();
+    }
+
     bool hasStartedRenderPassWithCommands() const
     {
         return hasStartedRenderPass() && !mRenderPassCommands->getCommandBuffer().empty();
@@ -782,6 +803,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                     const void *indices,
                                     uint32_t *numIndicesOut);
     angle::Result setupDispatch(const gl::Context *context);
+    // Packs the pending readbacks into the buffers that draws and dispatches may use.
+    angle::Result flushPendingPackPixelsUsedByCommands();
 
     gl::Rectangle getCorrectedViewport(const gl::Rectangle &viewport) const;
     void updateViewport(FramebufferVk *framebufferVk,
@@ -1142,6 +1165,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     vk::PerfCounters mPerfCounters;
     ContextVkPerfCounters mContextPerfCounters;
     ContextVkPerfCounters mCumulativeContextPerfCounters;
+    vk::PerfCounterTotals mPerfCounterTotals;
+    // The counters exposed through GL_AMD_performance_monitor, created on first use.
+    angle::PerfMonitorCounterGroups mPerfMonitorCounters;
 
     gl::State::DirtyBits mPipelineDirtyBitsMask;
 
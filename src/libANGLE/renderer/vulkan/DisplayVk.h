@@ -48,6 +48,12 @@ class ShareGroupVk : public ShareGroupImpl
     void setSyncObjectPendingFlush() { mSyncObjectPendingFlush = true; }
     void clearSyncObjectPendingFlush() { mSyncObjectPendingFlush = false; }
 
+    // Buffers with readbacks that are yet to be packed, see BufferVk::deferPackPixels.
+    std::vector<BufferVk *> *getBuffersWithPendingPackPixels()
+    {
+        return &mBuffersWithPendingPackPixels;
+    }
+
   private:
     // ANGLE uses a PipelineLayout cache to store compatible pipeline layouts.
     PipelineLayoutCache mPipelineLayoutCache;
@@ -63,6 +69,9 @@ class ShareGroupVk : public ShareGroupImpl
     std::vector<vk::ResourceUseList> mResourceUseLists;
 
     bool mSyncObjectPendingFlush;
+
+    // Draws and dispatches may need to wait for these readbacks, if they use the buffers.
+    std::vector<BufferVk *> mBuffersWithPendingPackPixels;
 };
 
 class DisplayVk : public DisplayImpl, public vk::Context
@@ -34,6 +34,11 @@ namespace
 {
 constexpr size_t kMinReadPixelsBufferSize = 128000;
 
+// Maximum number of framebuffers created from image views kept by a FramebufferVk.  Applications
+// attaching many transient textures to the same FBO would otherwise accumulate a framebuffer for
+// each of them.
+constexpr size_t kMaxFramebufferCacheSize = 32;
+
 // Alignment value to accommodate the largest known, for now, uncompressed Vulkan format
 // VK_FORMAT_R64G64B64A64_SFLOAT, while supporting 3-component types such as
 // VK_FORMAT_R16G16B16_SFLOAT.
@@ -319,6 +324,20 @@ bool IsAnyAttachment3DWithoutAllLayers(const RenderTargetCache<RenderTargetVk> &
 
     return false;
 }
+
+void AddImagelessFramebufferAttachment(const RenderTargetVk &renderTarget,
+                                       const vk::ImageHelper &image,
+                                       vk::ImagelessFramebufferDesc *descOut)
+{
+    // The image views of both the image and the resolve image of a render target are created for
+    // the level of the former.
+    const vk::LevelIndex levelVk =
+        renderTarget.getImageForRenderPass().toVkLevel(renderTarget.getLevelIndex());
+
+    descOut->addAttachment(image.getCreateFlags(), image.getUsage(),
+                           image.getLevelExtents2D(levelVk), renderTarget.getLayerCount(),
+                           image.getViewFormats());
+}
 }  // anonymous namespace
 
 // static
@@ -1414,6 +1433,7 @@ angle::Result FramebufferVk::resolveColorWithSubpass(ContextVk *contextVk,
     // 2. Update the CommandBufferHelper with the new framebuffer and render pass
     vk::CommandBufferHelper &commandBufferHelper = contextVk->getStartedRenderPassCommands();
     commandBufferHelper.updateRenderPassForResolve(contextVk, newSrcFramebuffer,
+                                                   srcFramebufferVk->getImagelessAttachments(),
                                                    srcFramebufferVk->getRenderPassDesc());
 
     // End the render pass now since we don't (yet) support subpass dependencies.
@@ -1845,6 +1865,7 @@ angle::Result FramebufferVk::syncState(const gl::Context *context,
                 // Invalidate the cache. If we have performance critical code hitting this path we
                 // can add related data (such as width/height) to the cache
                 mFramebufferCache.clear(contextVk);
+                mFramebuffer = nullptr;
                 break;
             case gl::Framebuffer::DIRTY_BIT_FRAMEBUFFER_SRGB_WRITE_CONTROL_MODE:
                 shouldUpdateSrgbWriteControlMode = true;
@@ -1936,6 +1957,13 @@ angle::Result FramebufferVk::syncState(const gl::Context *context,
         // blit src. FramebufferVk::blit() will handle those details for us.
         ANGLE_TRY(contextVk->flushCommandsAndEndRenderPass());
     }
+    else if (mFramebuffer != nullptr && !mImagelessAttachments.empty() &&
+             contextVk->hasRenderPassCommandsWithFramebuffer(&mFramebuffer->getFramebuffer()))
+    {
+        // An imageless framebuffer may stay the same with the new attachments, in which case
+        // blit() could no longer tell that the render pass was started with the old ones.
+        ANGLE_TRY(contextVk->flushCommandsAndEndRenderPass());
+    }
 
     updateRenderPassDesc(contextVk);
 
@@ -2045,9 +2073,19 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
         *framebufferOut = &mFramebuffer->getFramebuffer();
         return angle::Result::Continue;
     }
+
+    // Imageless framebuffers are looked up by the properties of the attachments, which are only
+    // known after gathering them.  They are not used when resolving into another framebuffer's
+    // attachment, as |resolveImageViewIn| is not described by the render targets of this one.
+    const bool useImagelessFramebuffer =
+        contextVk->getFeatures().supportsImagelessFramebuffer.enabled && mBackbuffer == nullptr &&
+        resolveImageViewIn == nullptr;
+    mImagelessAttachments.clear();
+
     // No current FB, so now check for previously cached Framebuffer
     vk::FramebufferHelper *framebufferHelper = nullptr;
-    if (mFramebufferCache.get(contextVk, mCurrentFramebufferDesc, &framebufferHelper))
+    if (!useImagelessFramebuffer &&
+        mFramebufferCache.get(contextVk, mCurrentFramebufferDesc, &framebufferHelper))
     {
         *framebufferOut = &framebufferHelper->getFramebuffer();
         return angle::Result::Continue;
@@ -2063,10 +2101,20 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
     }
 
     // Gather VkImageViews over all FBO attachments, also size of attached region.
-    std::vector<VkImageView> attachments;
+    vk::FramebufferAttachmentsVector<VkImageView> attachments;
     gl::Extents attachmentsSize = mState.getExtents();
     ASSERT(attachmentsSize.width != 0 && attachmentsSize.height != 0);
 
+    uint32_t layers = 1;
+    if (!mCurrentFramebufferDesc.isMultiview())
+    {
+        layers = std::max(mCurrentFramebufferDesc.getLayerCount(), 1u);
+    }
+
+    vk::ImagelessFramebufferDesc imagelessDesc;
+    imagelessDesc.reset(*compatibleRenderPass, static_cast<uint32_t>(attachmentsSize.width),
+                        static_cast<uint32_t>(attachmentsSize.height), layers);
+
     // Color attachments.
     const auto &colorRenderTargets = mRenderTargetCache.getColors();
     for (size_t colorIndexGL : mState.getColorAttachmentsMask())
@@ -2079,6 +2127,9 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
             contextVk, mCurrentFramebufferDesc.getWriteControlMode(), &imageView));
 
         attachments.push_back(imageView->getHandle());
+        AddImagelessFramebufferAttachment(*colorRenderTarget,
+                                          colorRenderTarget->getImageForRenderPass(),
+                                          &imagelessDesc);
     }
 
     // Depth/stencil attachment.
@@ -2089,6 +2140,9 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
         ANGLE_TRY(depthStencilRenderTarget->getImageView(contextVk, &imageView));
 
         attachments.push_back(imageView->getHandle());
+        AddImagelessFramebufferAttachment(*depthStencilRenderTarget,
+                                          depthStencilRenderTarget->getImageForRenderPass(),
+                                          &imagelessDesc);
     }
 
     // Color resolve attachments.
@@ -2114,6 +2168,9 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
                 ANGLE_TRY(colorRenderTarget->getResolveImageView(contextVk, &resolveImageView));
 
                 attachments.push_back(resolveImageView->getHandle());
+                AddImagelessFramebufferAttachment(
+                    *colorRenderTarget, colorRenderTarget->getResolveImageForRenderPass(),
+                    &imagelessDesc);
             }
         }
     }
@@ -2125,6 +2182,40 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
         ANGLE_TRY(depthStencilRenderTarget->getResolveImageView(contextVk, &imageView));
 
         attachments.push_back(imageView->getHandle());
+        AddImagelessFramebufferAttachment(*depthStencilRenderTarget,
+                                          depthStencilRenderTarget->getResolveImageForRenderPass(),
+                                          &imagelessDesc);
+    }
+
+    // Check that our description matches our attachments. Can catch implementation bugs.
+    ASSERT(static_cast<uint32_t>(attachments.size()) == mCurrentFramebufferDesc.attachmentCount());
+
+    if (useImagelessFramebuffer)
+    {
+        ASSERT(imagelessDesc.attachmentCount() == static_cast<uint32_t>(attachments.size()));
+
+        // The image views are given to the render pass when it begins.
+        mImagelessAttachments = attachments;
+
+        if (!mFramebufferCache.get(contextVk, imagelessDesc, &mFramebuffer))
+        {
+            vk::FramebufferAttachmentsVector<VkFramebufferAttachmentImageInfoKHR>
+                attachmentImageInfos;
+            VkFramebufferAttachmentsCreateInfoKHR attachmentsCreateInfo = {};
+            VkFramebufferCreateInfo framebufferInfo                     = {};
+            imagelessDesc.getFramebufferCreateInfo(&attachmentImageInfos, &attachmentsCreateInfo,
+                                                   &framebufferInfo);
+
+            vk::FramebufferHelper newFramebuffer;
+            ANGLE_TRY(newFramebuffer.init(contextVk, framebufferInfo));
+
+            mFramebufferCache.insert(imagelessDesc, std::move(newFramebuffer));
+            bool result = mFramebufferCache.get(contextVk, imagelessDesc, &mFramebuffer);
+            ASSERT(result);
+        }
+
+        *framebufferOut = &mFramebuffer->getFramebuffer();
+        return angle::Result::Continue;
     }
 
     VkFramebufferCreateInfo framebufferInfo = {};
@@ -2136,19 +2227,12 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
     framebufferInfo.pAttachments    = attachments.data();
     framebufferInfo.width           = static_cast<uint32_t>(attachmentsSize.width);
     framebufferInfo.height          = static_cast<uint32_t>(attachmentsSize.height);
-    framebufferInfo.layers          = 1;
-    if (!mCurrentFramebufferDesc.isMultiview())
-    {
-        framebufferInfo.layers = std::max(mCurrentFramebufferDesc.getLayerCount(), 1u);
-    }
+    framebufferInfo.layers          = layers;
 
     vk::FramebufferHelper newFramebuffer;
     ANGLE_TRY(newFramebuffer.init(contextVk, framebufferInfo));
 
-    // Check that our description matches our attachments. Can catch implementation bugs.
-    ASSERT(static_cast<uint32_t>(attachments.size()) == mCurrentFramebufferDesc.attachmentCount());
-
-    mFramebufferCache.insert(mCurrentFramebufferDesc, std::move(newFramebuffer));
+    mFramebufferCache.insert(contextVk, mCurrentFramebufferDesc, std::move(newFramebuffer));
     bool result = mFramebufferCache.get(contextVk, mCurrentFramebufferDesc, &mFramebuffer);
     ASSERT(result);
 
@@ -2660,9 +2744,10 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
         renderArea = getRotatedCompleteRenderArea(contextVk);
     }
 
-    ANGLE_TRY(contextVk->beginNewRenderPass(
-        *framebuffer, renderArea, mRenderPassDesc, renderPassAttachmentOps, colorIndexVk,
-        depthStencilAttachmentIndex, packedClearValues, commandBufferOut));
+    ANGLE_TRY(contextVk->beginNewRenderPass(*framebuffer, mImagelessAttachments, renderArea,
+                                            mRenderPassDesc, renderPassAttachmentOps, colorIndexVk,
+                                            depthStencilAttachmentIndex, packedClearValues,
+                                            commandBufferOut));
 
     // Add the images to the renderpass tracking list  (through onColorDraw).
     vk::PackedAttachmentIndex colorAttachmentIndex(0);
@@ -2852,17 +2937,27 @@ void FramebufferVk::onSwitchProgramFramebufferFetch(ContextVk *contextVk,
 }
 
 // FramebufferCache implementation.
+FramebufferCache::FramebufferCache() : mPayload(decltype(mPayload)::NO_AUTO_EVICT) {}
+
+FramebufferCache::~FramebufferCache()
+{
+    ASSERT(mPayload.empty());
+    ASSERT(mImagelessPayload.empty());
+}
+
 void FramebufferCache::destroy(RendererVk *rendererVk)
 {
     rendererVk->accumulateCacheStats(VulkanCacheType::Framebuffer, mCacheStats);
-    mPayload.clear();
+    mPayload.Clear();
+    mImagelessPayload.clear();
 }
 
 bool FramebufferCache::get(ContextVk *contextVk,
                            const vk::FramebufferDesc &desc,
                            vk::FramebufferHelper **framebufferHelperOut)
 {
-    auto iter = mPayload.find(desc);
+    // Get() also makes the framebuffer the most recently used.
+    auto iter = mPayload.Get(desc);
     if (iter != mPayload.end())
     {
         *framebufferHelperOut = &iter->second;
@@ -2874,10 +2969,42 @@ bool FramebufferCache::get(ContextVk *contextVk,
     return false;
 }
 
-void FramebufferCache::insert(const vk::FramebufferDesc &desc,
+void FramebufferCache::insert(ContextVk *contextVk,
+                              const vk::FramebufferDesc &desc,
                               vk::FramebufferHelper &&framebufferHelper)
 {
-    mPayload.emplace(desc, std::move(framebufferHelper));
+    // Evict the least recently used framebuffers.  They may still be used by a recorded render
+    // pass, so they are released to the garbage rather than destroyed.
+    while (mPayload.size() >= kMaxFramebufferCacheSize)
+    {
+        auto oldest = mPayload.rbegin();
+        oldest->second.release(contextVk);
+        mPayload.Erase(oldest);
+    }
+
+    mPayload.Put(desc, std::move(framebufferHelper));
+}
+
+bool FramebufferCache::get(ContextVk *contextVk,
+                           const vk::ImagelessFramebufferDesc &desc,
+                           vk::FramebufferHelper **framebufferHelperOut)
+{
+    auto iter = mImagelessPayload.find(desc);
+    if (iter != mImagelessPayload.end())
+    {
+        *framebufferHelperOut = &iter->second;
+        mCacheStats.hit();
+        return true;
+    }
+
+    mCacheStats.miss();
+    return false;
+}
+
+void FramebufferCache::insert(const vk::ImagelessFramebufferDesc &desc,
+                              vk::FramebufferHelper &&framebufferHelper)
+{
+    mImagelessPayload.emplace(desc, std::move(framebufferHelper));
 }
 
 void FramebufferCache::clear(ContextVk *contextVk)
@@ -2887,6 +3014,13 @@ void FramebufferCache::clear(ContextVk *contextVk)
         vk::FramebufferHelper &tmpFB = entry.second;
         tmpFB.release(contextVk);
     }
-    mPayload.clear();
+    mPayload.Clear();
+
+    for (auto &entry : mImagelessPayload)
+    {
+        vk::FramebufferHelper &tmpFB = entry.second;
+        tmpFB.release(contextVk);
+    }
+    mImagelessPayload.clear();
 }
 }  // namespace rx
@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_FRAMEBUFFERVK_H_
 #define LIBANGLE_RENDERER_VULKAN_FRAMEBUFFERVK_H_
 
+#include <anglebase/containers/mru_cache.h>
+
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/FramebufferImpl.h"
 #include "libANGLE/renderer/RenderTargetCache.h"
@@ -26,22 +28,37 @@ class RenderTargetVk;
 class WindowSurfaceVk;
 
 // FramebufferVk Cache
+//
+// Framebuffers are keyed by the image views of their attachments, so a new one is created for
+// every set of attached images.  Once the cache is full, the least recently used framebuffer is
+// released.  Imageless framebuffers are keyed by the properties of the attachments instead, of
+// which there are few combinations, so they are not evicted.
 class FramebufferCache final : angle::NonCopyable
 {
   public:
-    FramebufferCache() = default;
-    ~FramebufferCache() { ASSERT(mPayload.empty()); }
+    FramebufferCache();
+    ~FramebufferCache();
 
     void destroy(RendererVk *rendererVk);
 
     bool get(ContextVk *contextVk,
              const vk::FramebufferDesc &desc,
              vk::FramebufferHelper **framebufferOut);
-    void insert(const vk::FramebufferDesc &desc, vk::FramebufferHelper &&framebufferHelper);
+    void insert(ContextVk *contextVk,
+                const vk::FramebufferDesc &desc,
+                vk::FramebufferHelper &&framebufferHelper);
+
+    bool get(ContextVk *contextVk,
+             const vk::ImagelessFramebufferDesc &desc,
+             vk::FramebufferHelper **framebufferOut);
+    void insert(const vk::ImagelessFramebufferDesc &desc,
+                vk::FramebufferHelper &&framebufferHelper);
+
     void clear(ContextVk *contextVk);
 
   private:
-    angle::HashMap<vk::FramebufferDesc, vk::FramebufferHelper> mPayload;
+    angle::base::HashingMRUCache<vk::FramebufferDesc, vk::FramebufferHelper> mPayload;
+    angle::HashMap<vk::ImagelessFramebufferDesc, vk::FramebufferHelper> mImagelessPayload;
     CacheStats mCacheStats;
 };
 
@@ -148,6 +165,12 @@ class FramebufferVk : public FramebufferImpl
     angle::Result getFramebuffer(ContextVk *contextVk,
                                  vk::Framebuffer **framebufferOut,
                                  const vk::ImageView *resolveImageViewIn);
+    // The image views to begin the render pass with if the framebuffer returned by
+    // getFramebuffer() is imageless, or empty otherwise.
+    const vk::FramebufferAttachmentsVector<VkImageView> &getImagelessAttachments() const
+    {
+        return mImagelessAttachments;
+    }
 
     bool hasDeferredClears() const { return !mDeferredClears.empty(); }
     angle::Result flushDeferredClears(ContextVk *contextVk);
@@ -260,6 +283,7 @@ class FramebufferVk : public FramebufferImpl
 
     vk::FramebufferDesc mCurrentFramebufferDesc;
     FramebufferCache mFramebufferCache;
+    vk::FramebufferAttachmentsVector<VkImageView> mImagelessAttachments;
 
     vk::ClearValuesArray mDeferredClears;
 
@@ -14,6 +14,9 @@
 
 #include <EGL/eglext.h>
 
+#include <map>
+#include <tuple>
+
 #include "common/debug.h"
 #include "common/platform.h"
 #include "common/system_utils.h"
@@ -23,6 +26,7 @@
 #include "gpu_info_util/SystemInfo.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/driver_utils.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
@@ -37,6 +41,8 @@
 #include "libANGLE/trace.h"
 #include "platform/PlatformMethods.h"
 
+#include "anglebase/no_destructor.h"
+
 // Consts
 namespace
 {
@@ -65,6 +71,24 @@ constexpr uint32_t kPreferredDefaultUniformBufferSize = 64 * 1024u;
 
 // Update the pipeline cache every this many swaps.
 constexpr uint32_t kPipelineCacheVkUpdatePeriod = 60;
+
+// The garbage cleanup thread destroys about this many objects before it lets go of the GPU driver
+// and the garbage lock, so large releases are spread out over time.
+constexpr size_t kMaxGarbageObjectsPerTick = 256;
+
+// Identifies a physical device and driver across VkInstances.
+using PhysicalDeviceKey =
+    std::tuple<uint32_t, uint32_t, uint32_t, std::array<uint8_t, VK_UUID_SIZE>>;
+
+PhysicalDeviceKey GetPhysicalDeviceKey(const VkPhysicalDeviceProperties &properties)
+{
+    std::array<uint8_t, VK_UUID_SIZE> pipelineCacheUUID;
+    std::copy(std::begin(properties.pipelineCacheUUID), std::end(properties.pipelineCacheUUID),
+              pipelineCacheUUID.begin());
+    return PhysicalDeviceKey(properties.vendorID, properties.deviceID, properties.driverVersion,
+                             pipelineCacheUUID);
+}
+
 // Per the Vulkan specification, as long as Vulkan 1.1+ is returned by vkEnumerateInstanceVersion,
 // ANGLE must indicate the highest version of Vulkan functionality that it uses.  The Vulkan
 // validation layers will issue messages for any core functionality that requires a higher version.
@@ -695,9 +719,70 @@ constexpr char kEnableDebugMarkersPropertyName[] = "debug.angle.markers";
 }  // namespace
 
 // RendererVk implementation.
+// VkFormatProperties only depend on the physical device and driver, so they are shared by all
+// renderers in the process.  Processes that create many short-lived displays then query each format
+// from the driver once instead of once per display.
+//
+// The format table and texture caps are derived from those properties, the device limits and the
+// few features that select fallback formats.  They are built once for each combination of these
+// features and shared immutably as well.
+struct RendererVk::SharedFormatProperties final : angle::NonCopyable
+{
+    SharedFormatProperties()
+    {
+        VkFormatProperties invalid = {0, 0, kInvalidFormatFeatureFlags};
+        properties.fill(invalid);
+    }
+
+    std::mutex mutex;
+    angle::FormatMap<VkFormatProperties> properties;
+
+    struct FormatTable final : angle::NonCopyable
+    {
+        vk::FormatTable formatTable;
+        gl::TextureCapsMap textureCaps;
+        std::vector<GLenum> compressedTextureFormats;
+    };
+
+    // Indexed by the bitmask returned by GetFormatTableFeatureKey.
+    std::mutex formatTablesMutex;
+    std::map<uint32_t, std::unique_ptr<FormatTable>> formatTables;
+};
+
+// static
+RendererVk::SharedFormatProperties *RendererVk::GetSharedFormatProperties(
+    const VkPhysicalDeviceProperties &physicalDeviceProperties)
+{
+    using SharedFormatPropertiesMap =
+        std::map<PhysicalDeviceKey, std::unique_ptr<SharedFormatProperties>>;
+    static angle::base::NoDestructor<std::mutex> mapMutex;
+    static angle::base::NoDestructor<SharedFormatPropertiesMap> sharedFormatProperties;
+
+    std::lock_guard<std::mutex> lock(*mapMutex);
+    std::unique_ptr<SharedFormatProperties> &properties =
+        (*sharedFormatProperties)[GetPhysicalDeviceKey(physicalDeviceProperties)];
+    if (!properties)
+    {
+        properties = std::make_unique<SharedFormatProperties>();
+    }
+    return properties.get();
+}
+
+namespace
+{
+// Every feature that affects the format table must be part of its key.
+uint32_t GetFormatTableFeatureKey(const angle::FeaturesVk &features)
+{
+    return (features.forceFallbackFormat.enabled ? 1u : 0u) |
+           (features.compressVertexData.enabled ? 2u : 0u) |
+           (features.forceD16TexFilter.enabled ? 4u : 0u);
+}
+}  // anonymous namespace
+
 RendererVk::RendererVk()
     : mDisplay(nullptr),
       mCapsInitialized(false),
+      mNativeTextureCaps(nullptr),
       mInstance(VK_NULL_HANDLE),
       mEnableValidationLayers(false),
       mEnableDebugUtils(false),
@@ -706,6 +791,7 @@ RendererVk::RendererVk()
       mDebugUtilsMessenger(VK_NULL_HANDLE),
       mDebugReportCallback(VK_NULL_HANDLE),
       mPhysicalDevice(VK_NULL_HANDLE),
+      mWaitForPresentKHR(nullptr),
       mMaxVertexAttribDivisor(1),
       mCurrentQueueFamilyIndex(std::numeric_limits<uint32_t>::max()),
       mMaxVertexAttribStride(0),
@@ -713,9 +799,14 @@ RendererVk::RendererVk()
       mDefaultUniformBufferSize(kPreferredDefaultUniformBufferSize),
       mDevice(VK_NULL_HANDLE),
       mDeviceLost(false),
+      mGarbageStats{},
+      mGarbageCleanupRequested(false),
+      mGarbageCleanupThreadExit(false),
+      mFormatTable(nullptr),
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
       mPipelineCacheDirty(false),
       mPipelineCacheInitialized(false),
+      mSharedFormatProperties(nullptr),
       mValidationMessageCount(0),
       mCommandProcessor(this),
       mSupportedVulkanPipelineStageMask(0)
@@ -752,6 +843,8 @@ void RendererVk::releaseSharedResources(vk::ResourceUseList *resourceList)
 
 void RendererVk::onDestroy(vk::Context *context)
 {
+    stopGarbageCleanupThread();
+
     {
         std::lock_guard<std::mutex> lock(mCommandQueueMutex);
         if (mFeatures.asyncCommandQueue.enabled)
@@ -1133,6 +1226,7 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
                                                        physicalDevices.data()));
     ChoosePhysicalDevice(physicalDevices, mEnabledICD, &mPhysicalDevice,
                          &mPhysicalDeviceProperties);
+    mSharedFormatProperties = GetSharedFormatProperties(mPhysicalDeviceProperties);
 
     mGarbageCollectionFlushThreshold =
         static_cast<uint32_t>(mPhysicalDeviceProperties.limits.maxMemoryAllocationCount *
@@ -1195,7 +1289,10 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
     }
 
     // Initialize the format table.
-    mFormatTable.initialize(this, &mNativeTextureCaps, &mNativeCaps.compressedTextureFormats);
+    {
+        SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.RendererVkInitializeFormatTableMS");
+        initFormatTable();
+    }
 
     setGlobalDebugAnnotator();
 
@@ -1281,6 +1378,20 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
     mProtectedMemoryProperties.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES;
 
+    mPresentIdFeatures       = {};
+    mPresentIdFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+
+    mPresentWaitFeatures       = {};
+    mPresentWaitFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+
+    mTimelineSemaphoreFeatures = {};
+    mTimelineSemaphoreFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+
+    mImagelessFramebufferFeatures = {};
+    mImagelessFramebufferFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES_KHR;
+
     if (!vkGetPhysicalDeviceProperties2KHR || !vkGetPhysicalDeviceFeatures2KHR)
     {
         return;
@@ -1380,6 +1491,26 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
         vk::AddToPNextChain(&deviceFeatures, &mCustomBorderColorFeatures);
     }
 
+    // Query present wait features, which depend on present IDs.
+    if (ExtensionFound(VK_KHR_PRESENT_ID_EXTENSION_NAME, deviceExtensionNames) &&
+        ExtensionFound(VK_KHR_PRESENT_WAIT_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mPresentIdFeatures);
+        vk::AddToPNextChain(&deviceFeatures, &mPresentWaitFeatures);
+    }
+
+    // Query timeline semaphore features
+    if (ExtensionFound(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mTimelineSemaphoreFeatures);
+    }
+
+    // Query imageless framebuffer features
+    if (ExtensionFound(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mImagelessFramebufferFeatures);
+    }
+
     // Query subgroup properties
     vk::AddToPNextChain(&deviceProperties, &mSubgroupProperties);
 
@@ -1431,6 +1562,10 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
     mMultisampledRenderToSingleSampledFeatures.pNext = nullptr;
     mMultiviewFeatures.pNext                         = nullptr;
     mMultiviewProperties.pNext                       = nullptr;
+    mPresentIdFeatures.pNext                         = nullptr;
+    mPresentWaitFeatures.pNext                       = nullptr;
+    mTimelineSemaphoreFeatures.pNext                 = nullptr;
+    mImagelessFramebufferFeatures.pNext              = nullptr;
     mDriverProperties.pNext                          = nullptr;
     mSamplerYcbcrConversionFeatures.pNext            = nullptr;
     mProtectedMemoryFeatures.pNext                   = nullptr;
@@ -1542,6 +1677,15 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         enabledDeviceExtensions.push_back(VK_KHR_MAINTENANCE1_EXTENSION_NAME);
     }
 
+    // Enable KHR_MAINTENANCE2 to allow images to be created with usages only their views support.
+    // It is also a dependency of KHR_imageless_framebuffer.
+    if ((getFeatures().supportsImageExtendedUsage.enabled ||
+         getFeatures().supportsImagelessFramebuffer.enabled) &&
+        mPhysicalDeviceProperties.apiVersion < VK_MAKE_VERSION(1, 1, 0))
+    {
+        enabledDeviceExtensions.push_back(VK_KHR_MAINTENANCE2_EXTENSION_NAME);
+    }
+
     if (getFeatures().supportsRenderpass2.enabled)
     {
         enabledDeviceExtensions.push_back(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME);
@@ -1784,6 +1928,26 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         vk::AddToPNextChain(&createInfo, &mMultiviewFeatures);
     }
 
+    if (getFeatures().supportsPresentWait.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+        enabledDeviceExtensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+        vk::AddToPNextChain(&createInfo, &mPresentIdFeatures);
+        vk::AddToPNextChain(&createInfo, &mPresentWaitFeatures);
+    }
+
+    if (getFeatures().supportsTimelineSemaphore.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+        vk::AddToPNextChain(&createInfo, &mTimelineSemaphoreFeatures);
+    }
+
+    if (getFeatures().supportsImagelessFramebuffer.enabled)
+    {
+        enabledDeviceExtensions.push_back(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME);
+        vk::AddToPNextChain(&createInfo, &mImagelessFramebufferFeatures);
+    }
+
     if (getFeatures().logMemoryReportCallbacks.enabled ||
         getFeatures().logMemoryReportStats.enabled)
     {
@@ -1882,6 +2046,13 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     volkLoadDevice(mDevice);
 #endif  // defined(ANGLE_SHARED_LIBVULKAN)
 
+    if (getFeatures().supportsPresentWait.enabled)
+    {
+        mWaitForPresentKHR = reinterpret_cast<PFN_vkWaitForPresentKHR>(
+            vkGetDeviceProcAddr(mDevice, "vkWaitForPresentKHR"));
+        ASSERT(mWaitForPresentKHR != nullptr);
+    }
+
     vk::DeviceQueueMap graphicsQueueMap =
         queueFamily.initializeQueueMap(mDevice, queueFamily.supportsProtected(), 0, queueCount);
 
@@ -1894,6 +2065,11 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         ANGLE_TRY(mCommandQueue.init(displayVk, graphicsQueueMap));
     }
 
+    if (mFeatures.asyncGarbageCleanup.enabled)
+    {
+        mGarbageCleanupThread = std::thread(&RendererVk::garbageCleanupThreadLoop, this);
+    }
+
 #if defined(ANGLE_SHARED_LIBVULKAN)
     // Avoid compiler warnings on unused-but-set variables.
     ANGLE_UNUSED_VARIABLE(hasGetMemoryRequirements2KHR);
@@ -1919,6 +2095,10 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     {
         InitRenderPass2KHRFunctions(mDevice);
     }
+    if (getFeatures().supportsTimelineSemaphore.enabled)
+    {
+        InitTimelineSemaphoreKHRFunctions(mDevice);
+    }
 #endif  // !defined(ANGLE_SHARED_LIBVULKAN)
 
     if (getFeatures().forceMaxUniformBufferSize16KB.enabled)
@@ -2283,6 +2463,18 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
         &mFeatures, supportsIncrementalPresent,
         ExtensionFound(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME, deviceExtensionNames));
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsPresentWait,
+                            mPresentIdFeatures.presentId == VK_TRUE &&
+                                mPresentWaitFeatures.presentWait == VK_TRUE);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsTimelineSemaphore,
+                            mTimelineSemaphoreFeatures.timelineSemaphore == VK_TRUE);
+
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsImageExtendedUsage,
+        ExtensionFound(VK_KHR_MAINTENANCE2_EXTENSION_NAME, deviceExtensionNames) ||
+            mPhysicalDeviceProperties.apiVersion >= VK_API_VERSION_1_1);
+
 #if defined(ANGLE_PLATFORM_ANDROID)
     ANGLE_FEATURE_CONDITION(
         &mFeatures, supportsAndroidHardwareBuffer,
@@ -2439,6 +2631,8 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     // Currently disabled by default: http://anglebug.com/4324
     ANGLE_FEATURE_CONDITION(&mFeatures, asyncCommandQueue, false);
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncGarbageCleanup, false);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsYUVSamplerConversion,
                             mSamplerYcbcrConversionFeatures.samplerYcbcrConversion != VK_FALSE);
 
@@ -2476,6 +2670,12 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
         (ExtensionFound(VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME, deviceExtensionNames)) &&
             !isSwiftShader);
 
+    // VK_KHR_imageless_framebuffer depends on VK_KHR_image_format_list, as the framebuffer
+    // attachments are described with the list of formats their views may use.
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsImagelessFramebuffer,
+                            mImagelessFramebufferFeatures.imagelessFramebuffer == VK_TRUE &&
+                                mFeatures.supportsImageFormatList.enabled);
+
     // Feature disabled due to driver bugs:
     //
     // - Swiftshader on mac: http://anglebug.com/4937
@@ -2543,6 +2743,9 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     // descriptor counts for such immutable samplers
     ANGLE_FEATURE_CONDITION(&mFeatures, useMultipleDescriptorsForExternalFormats, true);
 
+    // Lower latency costs throughput, so it is left for applications to opt into.
+    ANGLE_FEATURE_CONDITION(&mFeatures, lowLatencyFramePacing, false);
+
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
     platform->overrideFeaturesVk(platform, &mFeatures);
 
@@ -2607,7 +2810,7 @@ const gl::Caps &RendererVk::getNativeCaps() const
 const gl::TextureCapsMap &RendererVk::getNativeTextureCaps() const
 {
     ensureCapsInitialized();
-    return mNativeTextureCaps;
+    return *mNativeTextureCaps;
 }
 
 const gl::Extensions &RendererVk::getNativeExtensions() const
@@ -2843,13 +3046,11 @@ VkFormatFeatureFlags RendererVk::getFormatFeatureBits(angle::FormatID formatID,
             return featureBits;
         }
 
-        VkFormat vkFormat = vk::GetVkFormatFromFormatID(formatID);
-
         // Otherwise query the format features and cache it.
-        vkGetPhysicalDeviceFormatProperties(mPhysicalDevice, vkFormat, &deviceProperties);
+        queryFormatProperties(formatID, &deviceProperties);
         // Workaround for some Android devices that don't indicate filtering
         // support on D16_UNORM and they should.
-        if (mFeatures.forceD16TexFilter.enabled && vkFormat == VK_FORMAT_D16_UNORM)
+        if (mFeatures.forceD16TexFilter.enabled && formatID == angle::FormatID::D16_UNORM)
         {
             deviceProperties.*features |= VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
         }
@@ -2858,6 +3059,41 @@ VkFormatFeatureFlags RendererVk::getFormatFeatureBits(angle::FormatID formatID,
     return deviceProperties.*features & featureBits;
 }
 
+void RendererVk::initFormatTable()
+{
+    ASSERT(mSharedFormatProperties != nullptr);
+    std::lock_guard<std::mutex> lock(mSharedFormatProperties->formatTablesMutex);
+
+    std::unique_ptr<SharedFormatProperties::FormatTable> &sharedTable =
+        mSharedFormatProperties->formatTables[GetFormatTableFeatureKey(mFeatures)];
+    if (!sharedTable)
+    {
+        sharedTable = std::make_unique<SharedFormatProperties::FormatTable>();
+        sharedTable->formatTable.initialize(this, &sharedTable->textureCaps,
+                                            &sharedTable->compressedTextureFormats);
+    }
+
+    mFormatTable                         = &sharedTable->formatTable;
+    mNativeTextureCaps                   = &sharedTable->textureCaps;
+    mNativeCaps.compressedTextureFormats = sharedTable->compressedTextureFormats;
+}
+
+void RendererVk::queryFormatProperties(angle::FormatID formatID,
+                                       VkFormatProperties *propertiesOut) const
+{
+    ASSERT(mSharedFormatProperties != nullptr);
+    std::lock_guard<std::mutex> lock(mSharedFormatProperties->mutex);
+
+    VkFormatProperties &sharedProperties = mSharedFormatProperties->properties[formatID];
+    if (sharedProperties.bufferFeatures == kInvalidFormatFeatureFlags)
+    {
+        VkFormat vkFormat = vk::GetVkFormatFromFormatID(formatID);
+        vkGetPhysicalDeviceFormatProperties(mPhysicalDevice, vkFormat, &sharedProperties);
+    }
+
+    *propertiesOut = sharedProperties;
+}
+
 template <VkFormatFeatureFlags VkFormatProperties::*features>
 bool RendererVk::hasFormatFeatureBits(angle::FormatID formatID,
                                       const VkFormatFeatureFlags featureBits) const
@@ -2890,11 +3126,20 @@ angle::Result RendererVk::cleanupGarbage(Serial lastCompletedQueueSerial)
 {
     std::lock_guard<std::mutex> lock(mGarbageMutex);
 
+    if (mGarbageCleanupThread.joinable())
+    {
+        mGarbageCleanupSerial    = std::max(mGarbageCleanupSerial, lastCompletedQueueSerial);
+        mGarbageCleanupRequested = true;
+        mGarbageCleanupCondition.notify_one();
+        return angle::Result::Continue;
+    }
+
+    vk::GarbageList garbageToDestroy;
     for (auto garbageIter = mSharedGarbage.begin(); garbageIter != mSharedGarbage.end();)
     {
         // Possibly 'counter' should be always zero when we add the object to garbage.
         vk::SharedGarbage &garbage = *garbageIter;
-        if (garbage.destroyIfComplete(this, lastCompletedQueueSerial))
+        if (garbage.releaseIfComplete(lastCompletedQueueSerial, &garbageToDestroy))
         {
             garbageIter = mSharedGarbage.erase(garbageIter);
         }
@@ -2904,6 +3149,13 @@ angle::Result RendererVk::cleanupGarbage(Serial lastCompletedQueueSerial)
         }
     }
 
+    mGarbageStats.destroyedObjects += garbageToDestroy.size();
+    mGarbageStats.destroyedBytes += vk::GetGarbageMemorySize(garbageToDestroy);
+    for (vk::GarbageObject &garbage : garbageToDestroy)
+    {
+        garbage.destroy(this);
+    }
+
     return angle::Result::Continue;
 }
 
@@ -2912,6 +3164,123 @@ void RendererVk::cleanupCompletedCommandsGarbage()
     (void)cleanupGarbage(getLastCompletedQueueSerial());
 }
 
+void RendererVk::collectCompletedGarbage(vk::GarbageList &&garbage)
+{
+    if (garbage.empty())
+    {
+        return;
+    }
+
+    VkDeviceSize size = vk::GetGarbageMemorySize(garbage);
+
+    std::lock_guard<std::mutex> lock(mGarbageMutex);
+    mGarbageStats.queuedObjects += garbage.size();
+    mGarbageStats.queuedBytes += size;
+
+    if (mGarbageCleanupThread.joinable())
+    {
+        for (vk::GarbageObject &object : garbage)
+        {
+            mCompletedGarbage.emplace_back(std::move(object));
+        }
+        mGarbageCleanupRequested = true;
+        mGarbageCleanupCondition.notify_one();
+        return;
+    }
+
+    mGarbageStats.destroyedObjects += garbage.size();
+    mGarbageStats.destroyedBytes += size;
+    for (vk::GarbageObject &object : garbage)
+    {
+        object.destroy(this);
+    }
+}
+
+vk::GarbageStats RendererVk::getGarbageStats()
+{
+    std::lock_guard<std::mutex> lock(mGarbageMutex);
+    return mGarbageStats;
+}
+
+void RendererVk::garbageCleanupThreadLoop()
+{
+    while (true)
+    {
+        vk::GarbageList garbageToDestroy;
+        {
+            std::unique_lock<std::mutex> lock(mGarbageMutex);
+            mGarbageCleanupCondition.wait(
+                lock, [this] { return mGarbageCleanupRequested || mGarbageCleanupThreadExit; });
+
+            // The remaining garbage is destroyed by onDestroy().
+            if (mGarbageCleanupThreadExit)
+            {
+                break;
+            }
+
+            while (!mCompletedGarbage.empty() &&
+                   garbageToDestroy.size() < kMaxGarbageObjectsPerTick)
+            {
+                garbageToDestroy.emplace_back(std::move(mCompletedGarbage.back()));
+                mCompletedGarbage.pop_back();
+            }
+
+            for (auto garbageIter = mSharedGarbage.begin();
+                 garbageIter != mSharedGarbage.end() &&
+                 garbageToDestroy.size() < kMaxGarbageObjectsPerTick;)
+            {
+                if (garbageIter->releaseIfComplete(mGarbageCleanupSerial, &garbageToDestroy))
+                {
+                    garbageIter = mSharedGarbage.erase(garbageIter);
+                }
+                else
+                {
+                    garbageIter++;
+                }
+            }
+
+            // If the tick is full, there may be more garbage to destroy.
+            mGarbageCleanupRequested = garbageToDestroy.size() >= kMaxGarbageObjectsPerTick;
+        }
+
+        ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::garbageCleanupThreadLoop");
+        VkDeviceSize size = vk::GetGarbageMemorySize(garbageToDestroy);
+        for (vk::GarbageObject &garbage : garbageToDestroy)
+        {
+            garbage.destroy(this);
+        }
+
+        std::lock_guard<std::mutex> lock(mGarbageMutex);
+        mGarbageStats.destroyedObjects += garbageToDestroy.size();
+        mGarbageStats.destroyedBytes += size;
+    }
+}
+
+void RendererVk::stopGarbageCleanupThread()
+{
+    if (!mGarbageCleanupThread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mGarbageMutex);
+        mGarbageCleanupThreadExit = true;
+        mGarbageCleanupCondition.notify_one();
+    }
+    mGarbageCleanupThread.join();
+
+    // Destroy the completed garbage the thread didn't get to.  The rest of the garbage is destroyed
+    // by cleanupGarbage() once the GPU is done with it.
+    mGarbageStats.destroyedObjects += mCompletedGarbage.size();
+    mGarbageStats.destroyedBytes += vk::GetGarbageMemorySize(mCompletedGarbage);
+    for (vk::GarbageObject &garbage : mCompletedGarbage)
+    {
+        garbage.destroy(this);
+    }
+    mCompletedGarbage.clear();
+}
+
 void RendererVk::onNewValidationMessage(const std::string &message)
 {
     mLastValidationMessage = message;
@@ -3214,6 +3583,15 @@ VkResult RendererVk::queuePresent(vk::Context *context,
     return result;
 }
 
+VkResult RendererVk::waitForPresent(VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::waitForPresent");
+    ASSERT(mWaitForPresentKHR != nullptr);
+
+    // The command queue lock is not taken, so other contexts can submit while this one waits.
+    return mWaitForPresentKHR(mDevice, swapchain, presentId, timeout);
+}
+
 vk::CommandBufferHelper *RendererVk::getCommandBufferHelper(bool hasRenderPass)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "RendererVk::getCommandBufferHelper");
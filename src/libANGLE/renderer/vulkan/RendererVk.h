@@ -182,10 +182,13 @@ class RendererVk : angle::NonCopyable
 
     const vk::Format &getFormat(GLenum internalFormat) const
     {
-        return mFormatTable[internalFormat];
+        return (*mFormatTable)[internalFormat];
     }
 
-    const vk::Format &getFormat(angle::FormatID formatID) const { return mFormatTable[formatID]; }
+    const vk::Format &getFormat(angle::FormatID formatID) const
+    {
+        return (*mFormatTable)[formatID];
+    }
 
     angle::Result getPipelineCacheSize(DisplayVk *displayVk, size_t *pipelineCacheSizeOut);
     angle::Result syncPipelineCacheVk(DisplayVk *displayVk, const gl::Context *context);
@@ -242,11 +245,22 @@ class RendererVk : angle::NonCopyable
 
     template <typename... ArgsT>
     void collectGarbageAndReinit(vk::SharedResourceUse *use, ArgsT... garbageIn)
+    {
+        collectMemoryGarbageAndReinit(use, 0, garbageIn...);
+    }
+
+    // Like collectGarbageAndReinit(), for a buffer or image followed by its memory.  The memory
+    // size is recorded with the buffer or image, for the garbage stats.
+    template <typename... ArgsT>
+    void collectMemoryGarbageAndReinit(vk::SharedResourceUse *use,
+                                       VkDeviceSize memorySize,
+                                       ArgsT... garbageIn)
     {
         std::vector<vk::GarbageObject> sharedGarbage;
         CollectGarbage(&sharedGarbage, garbageIn...);
         if (!sharedGarbage.empty())
         {
+            sharedGarbage.front().setMemorySize(memorySize);
             collectGarbage(std::move(*use), std::move(sharedGarbage));
         }
         else
@@ -262,11 +276,21 @@ class RendererVk : angle::NonCopyable
     {
         if (!sharedGarbage.empty())
         {
+            VkDeviceSize size = vk::GetGarbageMemorySize(sharedGarbage);
+
             std::lock_guard<std::mutex> lock(mGarbageMutex);
+            mGarbageStats.queuedObjects += sharedGarbage.size();
+            mGarbageStats.queuedBytes += size;
             mSharedGarbage.emplace_back(std::move(use), std::move(sharedGarbage));
         }
     }
 
+    // Destroys garbage the GPU is already done with.  With the asyncGarbageCleanup feature, this
+    // is left to the garbage cleanup thread.
+    void collectCompletedGarbage(vk::GarbageList &&garbage);
+
+    vk::GarbageStats getGarbageStats();
+
     angle::Result getPipelineCache(vk::PipelineCache **pipelineCache);
     void onNewGraphicsPipeline()
     {
@@ -342,6 +366,8 @@ class RendererVk : angle::NonCopyable
 
     bool haveSameFormatFeatureBits(angle::FormatID formatID1, angle::FormatID formatID2) const;
 
+    // Destroys the garbage that is no longer in use by |lastCompletedQueueSerial|.  With the
+    // asyncGarbageCleanup feature, this only wakes up the garbage cleanup thread.
     angle::Result cleanupGarbage(Serial lastCompletedQueueSerial);
     void cleanupCompletedCommandsGarbage();
 
@@ -375,6 +401,8 @@ class RendererVk : angle::NonCopyable
     VkResult queuePresent(vk::Context *context,
                           egl::ContextPriority priority,
                           const VkPresentInfoKHR &presentInfo);
+    // Waits until the present with |presentId| is displayed.  Requires supportsPresentWait.
+    VkResult waitForPresent(VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout);
 
     vk::CommandBufferHelper *getCommandBufferHelper(bool hasRenderPass);
     void recycleCommandBufferHelper(vk::CommandBufferHelper *commandBuffer);
@@ -391,6 +419,10 @@ class RendererVk : angle::NonCopyable
     {
         mVulkanCacheStats[cache].accumulate(stats);
     }
+    const CacheStats &getCacheStats(VulkanCacheType cache) const
+    {
+        return mVulkanCacheStats[cache];
+    }
     // Log cache stats for all caches
     void logCacheStats() const;
 
@@ -426,13 +458,24 @@ class RendererVk : angle::NonCopyable
     bool hasFormatFeatureBits(angle::FormatID formatID,
                               const VkFormatFeatureFlags featureBits) const;
 
+    void queryFormatProperties(angle::FormatID formatID, VkFormatProperties *propertiesOut) const;
+
+    struct SharedFormatProperties;
+    static SharedFormatProperties *GetSharedFormatProperties(
+        const VkPhysicalDeviceProperties &physicalDeviceProperties);
+    void initFormatTable();
+
+    void garbageCleanupThreadLoop();
+    void stopGarbageCleanupThread();
+
     egl::Display *mDisplay;
 
     std::unique_ptr<angle::Library> mLibVulkanLibrary;
 
     mutable bool mCapsInitialized;
     mutable gl::Caps mNativeCaps;
-    mutable gl::TextureCapsMap mNativeTextureCaps;
+    // Points into the format table shared by renderers with the same device and format features.
+    const gl::TextureCapsMap *mNativeTextureCaps;
     mutable gl::Extensions mNativeExtensions;
     mutable gl::Limitations mNativeLimitations;
     mutable angle::FeaturesVk mFeatures;
@@ -475,6 +518,12 @@ class RendererVk : angle::NonCopyable
     VkExternalFenceProperties mExternalFenceProperties;
     VkExternalSemaphoreProperties mExternalSemaphoreProperties;
     VkPhysicalDeviceSamplerYcbcrConversionFeatures mSamplerYcbcrConversionFeatures;
+    VkPhysicalDevicePresentIdFeaturesKHR mPresentIdFeatures;
+    VkPhysicalDevicePresentWaitFeaturesKHR mPresentWaitFeatures;
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR mTimelineSemaphoreFeatures;
+    VkPhysicalDeviceImagelessFramebufferFeaturesKHR mImagelessFramebufferFeatures;
+    // Loaded by hand, as volk does not know VK_KHR_present_wait yet.
+    PFN_vkWaitForPresentKHR mWaitForPresentKHR;
     std::vector<VkQueueFamilyProperties> mQueueFamilyProperties;
     uint32_t mMaxVertexAttribDivisor;
     uint32_t mCurrentQueueFamilyIndex;
@@ -488,9 +537,21 @@ class RendererVk : angle::NonCopyable
 
     std::mutex mGarbageMutex;
     vk::SharedGarbageList mSharedGarbage;
+    vk::GarbageStats mGarbageStats;
+
+    // With the asyncGarbageCleanup feature, garbage is destroyed by this thread.  Each tick it
+    // destroys at most kMaxGarbageObjectsPerTick objects of mCompletedGarbage and of the
+    // mSharedGarbage that's complete at mGarbageCleanupSerial, outside of mGarbageMutex.
+    // mGarbageCleanupRequested stays set while a tick leaves garbage behind.
+    std::thread mGarbageCleanupThread;
+    std::condition_variable mGarbageCleanupCondition;
+    bool mGarbageCleanupRequested;
+    bool mGarbageCleanupThreadExit;
+    Serial mGarbageCleanupSerial;
+    vk::GarbageList mCompletedGarbage;
 
     vk::MemoryProperties mMemoryProperties;
-    vk::FormatTable mFormatTable;
+    const vk::FormatTable *mFormatTable;
 
     // All access to the pipeline cache is done through EGL objects so it is thread safe to not use
     // a lock.
@@ -502,6 +563,8 @@ class RendererVk : angle::NonCopyable
 
     // A cache of VkFormatProperties as queried from the device over time.
     mutable angle::FormatMap<VkFormatProperties> mFormatProperties;
+    // Format properties queried by any renderer in the process for the same physical device.
+    SharedFormatProperties *mSharedFormatProperties;
 
     // Latest validation data for debug overlay.
     std::string mLastValidationMessage;
@@ -80,15 +80,16 @@ SharedGarbage &SharedGarbage::operator=(SharedGarbage &&rhs)
     return *this;
 }
 
-bool SharedGarbage::destroyIfComplete(RendererVk *renderer, Serial completedSerial)
+bool SharedGarbage::releaseIfComplete(Serial completedSerial, GarbageList *garbageOut)
 {
     if (mLifetime.isCurrentlyInUse(completedSerial))
         return false;
 
     for (GarbageObject &object : mGarbage)
     {
-        object.destroy(renderer);
+        garbageOut->emplace_back(std::move(object));
     }
+    mGarbage.clear();
 
     mLifetime.release();
 
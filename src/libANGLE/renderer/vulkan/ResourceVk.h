@@ -122,7 +122,9 @@ class SharedGarbage
     ~SharedGarbage();
     SharedGarbage &operator=(SharedGarbage &&rhs);
 
-    bool destroyIfComplete(RendererVk *renderer, Serial completedSerial);
+    // If the garbage is no longer in use, releases its use and moves its objects to |garbageOut|,
+    // so they can be destroyed without holding the garbage lock.
+    bool releaseIfComplete(Serial completedSerial, GarbageList *garbageOut);
 
   private:
     SharedResourceUse mLifetime;
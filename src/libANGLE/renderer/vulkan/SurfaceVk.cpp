@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/vulkan/SurfaceVk.h"
 
 #include "common/debug.h"
+#include "common/system_utils.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Overlay.h"
@@ -34,6 +35,12 @@ angle::SubjectIndex kAnySurfaceImageSubjectIndex = 0;
 // swapchain's extent. See VkSurfaceCapabilitiesKHR spec for more details.
 constexpr uint32_t kSurfaceSizedBySwapchain = 0xFFFFFFFFu;
 
+// The frame interval assumed for frame pacing until two frames are presented: one refresh of a
+// 60Hz display.
+constexpr uint64_t kDefaultFrameIntervalNs = 16666667;
+// A long frame doesn't make the pacing wait of the next frame longer than this.
+constexpr uint64_t kMaxFramePacingWaitNs = 100000000;
+
 GLint GetSampleCount(const egl::Config *config)
 {
     GLint samples = 1;
@@ -500,7 +507,14 @@ WindowSurfaceVk::WindowSurfaceVk(const egl::SurfaceState &surfaceState, EGLNativ
       mDepthStencilImageBinding(this, kAnySurfaceImageSubjectIndex),
       mColorImageMSBinding(this, kAnySurfaceImageSubjectIndex),
       mNeedToAcquireNextSwapchainImage(false),
-      mFrameCount(1)
+      mFrameCount(1),
+      mLowLatencyFramePacing(false),
+      mUsePresentWait(false),
+      mLastPresentId(0),
+      mLastPresentTime(0),
+      mFrameIntervalNs(kDefaultFrameIntervalNs),
+      mAcquireWaitTimeUs(0),
+      mPresentQueueTimeUs(0)
 {
     // Initialize the color render target with the multisampled targets.  If not multisampled, the
     // render target will be updated to refer to a swapchain image on every acquire.
@@ -575,6 +589,14 @@ angle::Result WindowSurfaceVk::initializeImpl(DisplayVk *displayVk)
 
     renderer->reloadVolkIfNeeded();
 
+    const angle::FeaturesVk &features = renderer->getFeatures();
+    mLowLatencyFramePacing            = features.lowLatencyFramePacing.enabled;
+
+    // With asyncCommandQueue, presents are queued by the worker thread and could be waited on
+    // before they are queued.
+    mUsePresentWait = mLowLatencyFramePacing && features.supportsPresentWait.enabled &&
+                      !features.asyncCommandQueue.enabled && canWaitForPresent();
+
     gl::Extents windowSize;
     ANGLE_TRY(createSurfaceVk(displayVk, &windowSize));
 
@@ -1074,6 +1096,7 @@ angle::Result WindowSurfaceVk::createSwapChain(vk::Context *context,
     ANGLE_VK_TRY(context, vkCreateSwapchainKHR(device, &swapchainInfo, nullptr, &newSwapChain));
     mSwapchain            = newSwapChain;
     mSwapchainPresentMode = mDesiredSwapchainPresentMode;
+    mLastPresentId        = 0;
 
     // Initialize the swapchain image views.
     uint32_t imageCount = 0;
@@ -1363,11 +1386,17 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
     ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVk::present");
     RendererVk *renderer = contextVk->getRenderer();
 
+    // The time of this present is shown by the overlay on the next one, as the overlay is drawn
+    // before the present is queued.
+    const double presentStartTime = angle::GetCurrentTime();
+    double throttleTime           = 0;
+
     // Throttle the submissions to avoid getting too far ahead of the GPU.
     Serial *swapSerial = &mSwapHistory[mCurrentSwapHistoryIndex];
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVk::present: Throttle CPU");
         ANGLE_TRY(renderer->finishToSerial(contextVk, *swapSerial));
+        throttleTime = angle::GetCurrentTime() - presentStartTime;
     }
 
     SwapchainImage &image               = mSwapchainImages[mCurrentSwapchainImageIndex];
@@ -1495,6 +1524,20 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
         presentInfo.pNext = &presentRegions;
     }
 
+    // Identify the present, so the next acquire can wait for it.
+    VkPresentIdKHR presentId = {};
+    if (mUsePresentWait)
+    {
+        mLastPresentId = mFrameCount;
+
+        presentId.sType          = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+        presentId.pNext          = presentInfo.pNext;
+        presentId.swapchainCount = 1;
+        presentId.pPresentIds    = &mLastPresentId;
+
+        presentInfo.pNext = &presentId;
+    }
+
     // TODO(jmadill): Fix potential serial race. b/172704839
     *swapSerial = renderer->getLastSubmittedQueueSerial();
     ASSERT(!mAcquireImageSemaphore.valid());
@@ -1503,7 +1546,18 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
     mCurrentSwapHistoryIndex =
         mCurrentSwapHistoryIndex == mSwapHistory.size() ? 0 : mCurrentSwapHistoryIndex;
 
+    const double queueStartTime = angle::GetCurrentTime();
     VkResult result = renderer->queuePresent(contextVk, contextVk->getPriority(), presentInfo);
+    onPresentQueued();
+    const double presentTime = angle::GetCurrentTime();
+    mPresentQueueTimeUs = static_cast<size_t>((throttleTime + presentTime - queueStartTime) * 1e6);
+
+    // The time between presents, which includes the pacing wait, bounds the next pacing wait.
+    if (mLastPresentTime > 0)
+    {
+        mFrameIntervalNs = static_cast<uint64_t>((presentTime - mLastPresentTime) * 1e9);
+    }
+    mLastPresentTime = presentTime;
 
     // Set FrameNumber for the presented image.
     mSwapchainImages[mCurrentSwapchainImageIndex].mFrameNumber = mFrameCount++;
@@ -1580,6 +1634,13 @@ angle::Result WindowSurfaceVk::doDeferredAcquireNextImage(const gl::Context *con
 
     ANGLE_TRY(checkForOutOfDateSwapchain(contextVk, presentOutOfDate));
 
+    const double acquireStartTime = angle::GetCurrentTime();
+    if (mLowLatencyFramePacing)
+    {
+        ANGLE_TRY(waitForPreviousFrame(contextVk));
+    }
+    waitForAvailableImage(mSwapchainImages.size());
+
     {
         // Note: TRACE_EVENT0 is put here instead of inside the function to workaround this issue:
         // http://anglebug.com/2927
@@ -1598,6 +1659,7 @@ angle::Result WindowSurfaceVk::doDeferredAcquireNextImage(const gl::Context *con
         }
         ANGLE_VK_TRY(contextVk, result);
     }
+    mAcquireWaitTimeUs = static_cast<size_t>((angle::GetCurrentTime() - acquireStartTime) * 1e6);
 
     RendererVk *renderer = contextVk->getRenderer();
     ANGLE_TRY(renderer->syncPipelineCacheVk(displayVk, context));
@@ -1605,6 +1667,42 @@ angle::Result WindowSurfaceVk::doDeferredAcquireNextImage(const gl::Context *con
     return angle::Result::Continue;
 }
 
+angle::Result WindowSurfaceVk::waitForPreviousFrame(ContextVk *contextVk)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVk::waitForPreviousFrame");
+    RendererVk *renderer = contextVk->getRenderer();
+
+    // Wait for about one frame.  If the previous frame takes longer than that, the frame is not
+    // paced, like without lowLatencyFramePacing.
+    const uint64_t timeout = std::min(mFrameIntervalNs, kMaxFramePacingWaitNs);
+
+    VkResult result = VK_SUCCESS;
+    if (mUsePresentWait && mLastPresentId != 0)
+    {
+        result = renderer->waitForPresent(mSwapchain, mLastPresentId, timeout);
+
+        // An out-of-date swapchain is recreated by the acquire.
+        if (result == VK_SUBOPTIMAL_KHR || result == VK_ERROR_OUT_OF_DATE_KHR)
+        {
+            return angle::Result::Continue;
+        }
+    }
+    else
+    {
+        // Otherwise, wait for the submission of the previous frame, which precedes its present.
+        const size_t previousSwapHistoryIndex =
+            (mCurrentSwapHistoryIndex + mSwapHistory.size() - 1) % mSwapHistory.size();
+        ANGLE_TRY(renderer->waitForSerialWithUserTimeout(
+            contextVk, mSwapHistory[previousSwapHistoryIndex], timeout, &result));
+    }
+
+    if (result != VK_TIMEOUT)
+    {
+        ANGLE_VK_TRY(contextVk, result);
+    }
+    return angle::Result::Continue;
+}
+
 VkResult WindowSurfaceVk::acquireNextSwapchainImage(vk::Context *context)
 {
     VkDevice device = context->getDevice();
@@ -1649,6 +1747,20 @@ VkResult WindowSurfaceVk::acquireNextSwapchainImage(vk::Context *context)
     return VK_SUCCESS;
 }
 
+bool WindowSurfaceVk::canWaitForPresent() const
+{
+    return true;
+}
+
+uint32_t WindowSurfaceVk::getDesiredSwapchainImageCount() const
+{
+    return 3;
+}
+
+void WindowSurfaceVk::onPresentQueued() {}
+
+void WindowSurfaceVk::waitForAvailableImage(size_t imageCount) {}
+
 egl::Error WindowSurfaceVk::postSubBuffer(const gl::Context *context,
                                           EGLint x,
                                           EGLint y,
@@ -1711,8 +1823,9 @@ void WindowSurfaceVk::setSwapInterval(EGLint interval)
     //   have one in the queue, and record in another.  Note: on certain configurations (windows +
     //   nvidia + windowed mode), we could get away with a smaller number.
     //
-    // For simplicity, we always allocate at least three images.
-    mMinImageCount = std::max(3u, mSurfaceCaps.minImageCount);
+    // For simplicity, we always allocate at least three images, unless the surface asks for a
+    // different count.
+    mMinImageCount = std::max(getDesiredSwapchainImageCount(), mSurfaceCaps.minImageCount);
 
     // Make sure we don't exceed maxImageCount.
     if (mSurfaceCaps.maxImageCount > 0 && mMinImageCount > mSurfaceCaps.maxImageCount)
@@ -1943,6 +2056,20 @@ void WindowSurfaceVk::updateOverlay(ContextVk *contextVk) const
             ->add(validationMessageCount);
     }
 
+    {
+        gl::RunningGraphWidget *acquireWaitTime =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanAcquireWaitTime);
+        acquireWaitTime->add(mAcquireWaitTimeUs);
+        acquireWaitTime->next();
+    }
+
+    {
+        gl::RunningGraphWidget *presentQueueTime =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanPresentQueueTime);
+        presentQueueTime->add(mPresentQueueTimeUs);
+        presentQueueTime->next();
+    }
+
     contextVk->updateOverlayOnPresent();
 }
 
@@ -254,6 +254,16 @@ class WindowSurfaceVk : public SurfaceVk
                            EGLint n_rects,
                            const void *pNextChain);
 
+    // Whether frames can be paced by waiting for their presents to be displayed, if the device
+    // supports VK_KHR_present_wait.
+    virtual bool canWaitForPresent() const;
+    // The number of swapchain images to request, before clamping to the surface capabilities.
+    virtual uint32_t getDesiredSwapchainImageCount() const;
+    // Called after every present is queued, and before every image is acquired with the number of
+    // swapchain images.  They let surfaces without a display model the presentation engine.
+    virtual void onPresentQueued();
+    virtual void waitForAvailableImage(size_t imageCount);
+
     EGLNativeWindowType mNativeWindowType;
     VkSurfaceKHR mSurface;
     VkSurfaceCapabilitiesKHR mSurfaceCaps;
@@ -284,6 +294,8 @@ class WindowSurfaceVk : public SurfaceVk
     // Called when a swapchain image whose acquisition was deferred must be acquired.  This method
     // will recreate the swapchain (if needed) and call the acquireNextSwapchainImage() method.
     angle::Result doDeferredAcquireNextImage(const gl::Context *context, bool presentOutOfDate);
+    // With lowLatencyFramePacing, waits for the previous frame before the next image is acquired.
+    angle::Result waitForPreviousFrame(ContextVk *contextVk);
     angle::Result computePresentOutOfDate(vk::Context *context,
                                           VkResult result,
                                           bool *presentOutOfDate);
@@ -349,6 +361,23 @@ class WindowSurfaceVk : public SurfaceVk
 
     // EGL_EXT_buffer_age: Track frame count.
     uint64_t mFrameCount;
+
+    // Frame pacing for lowLatencyFramePacing.  The previous frame is waited on before the next
+    // image is acquired: until its present is displayed if VK_KHR_present_wait is used, or else
+    // until its submission finishes.  The wait times out after about one frame interval.
+    bool mLowLatencyFramePacing;
+    bool mUsePresentWait;
+    // The ID of the last present to the current swapchain, or 0 if there is none.
+    uint64_t mLastPresentId;
+    // CPU time of the last present in seconds, or 0 if there is none, and the time between the
+    // last two presents.
+    double mLastPresentTime;
+    uint64_t mFrameIntervalNs;
+
+    // CPU time of the last acquire including the wait before it, and of the last present including
+    // the throttling, in microseconds.  Shown by the overlay.
+    size_t mAcquireWaitTimeUs;
+    size_t mPresentQueueTimeUs;
 };
 
 }  // namespace rx
@@ -186,11 +186,21 @@ bool CanGenerateMipmapWithCompute(RendererVk *renderer,
     }
 
     // Format must have STORAGE support.
-    const bool hasStorageSupport =
+    bool hasStorageSupport =
         renderer->hasImageFormatFeatureBits(formatID, VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT);
 
-    // No support for sRGB formats yet.
-    const bool isSRGB = angleFormat.isSRGB;
+    // sRGB formats are written through a view with the linear format, which must have STORAGE
+    // support instead.  If the sRGB format itself doesn't, the image must be created with
+    // VK_IMAGE_CREATE_EXTENDED_USAGE_BIT.  Only 8-bit sRGB formats exist.
+    if (angleFormat.isSRGB)
+    {
+        const angle::FormatID linearFormatID = ConvertToLinear(formatID);
+        hasStorageSupport =
+            (hasStorageSupport || renderer->getFeatures().supportsImageExtendedUsage.enabled) &&
+            linearFormatID != angle::FormatID::NONE &&
+            renderer->hasImageFormatFeatureBits(linearFormatID,
+                                                VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT);
+    }
 
     // No support for integer formats yet.
     const bool isInt = angleFormat.isInt();
@@ -204,7 +214,7 @@ bool CanGenerateMipmapWithCompute(RendererVk *renderer,
     // Only color formats are supported.
     const bool isColorFormat = !angleFormat.hasDepthOrStencilBits();
 
-    return hasStorageSupport && !isSRGB && !isInt && is2D && !isMultisampled && isColorFormat;
+    return hasStorageSupport && !isInt && is2D && !isMultisampled && isColorFormat;
 }
 
 void GetRenderTargetLayerCountAndIndex(vk::ImageHelper *image,
@@ -481,7 +491,9 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
 
     if (unpackBuffer)
     {
-        BufferVk *unpackBufferVk       = vk::GetImpl(unpackBuffer);
+        BufferVk *unpackBufferVk = vk::GetImpl(unpackBuffer);
+        ANGLE_TRY(unpackBufferVk->flushPendingPackPixels(contextVk));
+
         VkDeviceSize bufferOffset      = 0;
         vk::BufferHelper &bufferHelper = unpackBufferVk->getBufferAndOffset(&bufferOffset);
         uintptr_t offset               = reinterpret_cast<uintptr_t>(pixels);
@@ -1759,15 +1771,13 @@ angle::Result TextureVk::generateMipmapsWithCompute(ContextVk *contextVk)
 
     // Requires that the image:
     //
-    // - is not sRGB
     // - is not integer
     // - is 2D or 2D array
     // - is single sample
     // - is color image
     //
-    // Support for the first two can be added easily.  Supporting 3D textures, MSAA and
-    // depth/stencil would be more involved.
-    ASSERT(!mImage->getActualFormat().isSRGB);
+    // Support for the first can be added easily.  Supporting 3D textures, MSAA and depth/stencil
+    // would be more involved.  sRGB images are written through views with the linear format.
     ASSERT(!mImage->getActualFormat().isInt());
     ASSERT(mImage->getType() == VK_IMAGE_TYPE_2D);
     ASSERT(mImage->getSamples() == 1);
@@ -1787,18 +1797,35 @@ angle::Result TextureVk::generateMipmapsWithCompute(ContextVk *contextVk)
     vk::SamplerDesc samplerDesc(contextVk, samplerState, false, 0, static_cast<angle::FormatID>(0));
     ANGLE_TRY(renderer->getSamplerCache().getSampler(contextVk, samplerDesc, &sampler));
 
-    // If the image has more levels than supported, generate as many mips as possible at a time.
-    const vk::LevelIndex maxGenerateLevels(UtilsVk::GetGenerateMipmapMaxLevels(contextVk));
+    // Generate as many mips as possible at a time.  Up to the maximum supported levels can be
+    // generated in a single pass if the source is small enough, otherwise each pass is limited to
+    // the levels that a single workgroup can generate.
+    const uint32_t maxGenerateLevels = UtilsVk::GetGenerateMipmapMaxLevels(contextVk);
+
+    // sRGB images are written to through views with the linear format.
+    const gl::SrgbWriteControlMode destViewMode = mImage->getActualFormat().isSRGB
+                                                      ? gl::SrgbWriteControlMode::Linear
+                                                      : gl::SrgbWriteControlMode::Default;
+
     vk::LevelIndex destMaxLevelVk = mImage->toVkLevel(gl::LevelIndex(mState.getMipmapMaxLevel()));
-    for (vk::LevelIndex destBaseLevelVk =
-             mImage->toVkLevel(gl::LevelIndex(mState.getEffectiveBaseLevel() + 1));
-         destBaseLevelVk <= destMaxLevelVk;
-         destBaseLevelVk = destBaseLevelVk + maxGenerateLevels.get())
+    vk::LevelIndex destBaseLevelVk =
+        mImage->toVkLevel(gl::LevelIndex(mState.getEffectiveBaseLevel() + 1));
+    while (destBaseLevelVk <= destMaxLevelVk)
     {
-        vk::CommandBufferAccess access;
+        const vk::LevelIndex srcLevelVk = destBaseLevelVk - 1;
+        const gl::Extents srcExtents    = mImage->getLevelExtents(srcLevelVk);
+
+        uint32_t passMaxLevels = maxGenerateLevels;
+        if (static_cast<uint32_t>(std::max(srcExtents.width, srcExtents.height)) >
+            UtilsVk::kGenerateMipmapMaxAllLevelsSrcExtent)
+        {
+            passMaxLevels = std::min(passMaxLevels, UtilsVk::kGenerateMipmapWorkgroupLevels);
+        }
+
+        const uint32_t writeLevelCount =
+            std::min(passMaxLevels, destMaxLevelVk.get() + 1 - destBaseLevelVk.get());
 
-        uint32_t writeLevelCount =
-            std::min(maxGenerateLevels.get(), destMaxLevelVk.get() + 1 - destBaseLevelVk.get());
+        vk::CommandBufferAccess access;
         access.onImageComputeShaderWrite(mImage->toGLLevel(destBaseLevelVk), writeLevelCount, 0,
                                          mImage->getLayerCount(), VK_IMAGE_ASPECT_COLOR_BIT,
                                          mImage);
@@ -1809,48 +1836,40 @@ angle::Result TextureVk::generateMipmapsWithCompute(ContextVk *contextVk)
         // Generate mipmaps for every layer separately.
         for (uint32_t layer = 0; layer < mImage->getLayerCount(); ++layer)
         {
-            // Create the necessary views.
+            // Create the necessary views.  The source is sampled with its own format, so sRGB
+            // images are decoded before filtering.
             const vk::ImageView *srcView                         = nullptr;
             UtilsVk::GenerateMipmapDestLevelViews destLevelViews = {};
 
-            const vk::LevelIndex srcLevelVk = destBaseLevelVk - 1;
             ANGLE_TRY(getImageViews().getLevelLayerDrawImageView(
                 contextVk, *mImage, srcLevelVk, layer, gl::SrgbWriteControlMode::Default,
                 &srcView));
 
-            vk::LevelIndex destLevelCount = maxGenerateLevels;
-            for (vk::LevelIndex levelVk(0); levelVk < maxGenerateLevels; ++levelVk)
+            for (uint32_t levelOffset = 0; levelOffset < writeLevelCount; ++levelOffset)
             {
-                vk::LevelIndex destLevelVk = destBaseLevelVk + levelVk.get();
-
-                // If fewer levels left than maxGenerateLevels, cut the loop short.
-                if (destLevelVk > destMaxLevelVk)
-                {
-                    destLevelCount = levelVk;
-                    break;
-                }
-
                 ANGLE_TRY(getImageViews().getLevelLayerDrawImageView(
-                    contextVk, *mImage, destLevelVk, layer, gl::SrgbWriteControlMode::Default,
-                    &destLevelViews[levelVk.get()]));
+                    contextVk, *mImage, destBaseLevelVk + levelOffset, layer, destViewMode,
+                    &destLevelViews[levelOffset]));
             }
 
             // If the image has fewer than maximum levels, fill the last views with a unused view.
-            ASSERT(destLevelCount > vk::LevelIndex(0));
-            for (vk::LevelIndex levelVk = destLevelCount;
-                 levelVk < vk::LevelIndex(UtilsVk::kGenerateMipmapMaxLevels); ++levelVk)
+            ASSERT(writeLevelCount > 0);
+            for (uint32_t levelOffset = writeLevelCount;
+                 levelOffset < UtilsVk::kGenerateMipmapMaxLevels; ++levelOffset)
             {
-                destLevelViews[levelVk.get()] = destLevelViews[levelVk.get() - 1];
+                destLevelViews[levelOffset] = destLevelViews[levelOffset - 1];
             }
 
             // Generate mipmaps.
             UtilsVk::GenerateMipmapParameters params = {};
             params.srcLevel                          = srcLevelVk.get();
-            params.destLevelCount                    = destLevelCount.get();
+            params.destLevelCount                    = writeLevelCount;
 
             ANGLE_TRY(contextVk->getUtils().generateMipmap(
                 contextVk, mImage, srcView, mImage, destLevelViews, sampler.get().get(), params));
         }
+
+        destBaseLevelVk = destBaseLevelVk + writeLevelCount;
     }
 
     return angle::Result::Continue;
@@ -2554,11 +2573,23 @@ void TextureVk::prepareForGenerateMipmap(ContextVk *contextVk)
     const GLint samples                = baseLevelDesc.samples ? baseLevelDesc.samples : 1;
 
     // If the compute path is to be used to generate mipmaps, add the STORAGE usage.
-    if (CanGenerateMipmapWithCompute(contextVk->getRenderer(), imageType,
-                                     format.getActualImageFormatID(getRequiredImageAccess()),
-                                     samples))
+    RendererVk *renderer           = contextVk->getRenderer();
+    const angle::FormatID formatID = format.getActualImageFormatID(getRequiredImageAccess());
+    if (CanGenerateMipmapWithCompute(renderer, imageType, formatID, samples))
     {
         mImageUsageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
+
+        // sRGB images are written to through a view with the linear format.  If the sRGB format
+        // doesn't support STORAGE, allow the usage to be validated against the view format only.
+        if (angle::Format::Get(formatID).isSRGB)
+        {
+            mImageCreateFlags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
+            if (!renderer->hasImageFormatFeatureBits(formatID,
+                                                     VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT))
+            {
+                mImageCreateFlags |= VK_IMAGE_CREATE_EXTENDED_USAGE_BIT;
+            }
+        }
     }
 }
 
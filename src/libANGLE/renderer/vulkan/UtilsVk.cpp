@@ -62,6 +62,7 @@ constexpr uint32_t kOverlayDrawFontBinding          = 4;
 
 constexpr uint32_t kGenerateMipmapDestinationBinding = 0;
 constexpr uint32_t kGenerateMipmapSourceBinding      = 1;
+constexpr uint32_t kGenerateMipmapCounterBinding     = 2;
 
 bool ValidateFloatOneAsUint()
 {
@@ -74,6 +75,24 @@ bool ValidateFloatOneAsUint()
     return one.asFloat == 1.0f;
 }
 
+// Splits the offset of a buffer used by a conversion into the dynamic offset of its storage
+// buffer descriptor, which must be aligned to minStorageBufferOffsetAlignment, and the rest,
+// which is given to the shader in push constants.
+void SplitStorageBufferOffset(ContextVk *contextVk,
+                              VkDeviceSize offset,
+                              uint32_t *dynamicOffsetOut,
+                              uint32_t *shaderOffsetOut)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+    const VkDeviceSize alignment =
+        renderer->getPhysicalDeviceProperties().limits.minStorageBufferOffsetAlignment;
+    ASSERT(gl::isPow2(alignment));
+
+    const VkDeviceSize dynamicOffset = offset & ~(alignment - 1);
+    *dynamicOffsetOut                = static_cast<uint32_t>(dynamicOffset);
+    *shaderOffsetOut                 = static_cast<uint32_t>(offset - dynamicOffset);
+}
+
 uint32_t GetConvertVertexFlags(const UtilsVk::ConvertVertexParameters &params)
 {
     bool srcIsSint      = params.srcFormat->isSint();
@@ -279,7 +298,13 @@ uint32_t GetGenerateMipmapFlags(ContextVk *contextVk, const angle::Format &actua
     const bool hasShaderFloat16 =
         contextVk->getRenderer()->getFeatures().supportsShaderFloat16.enabled;
 
-    if (actualFormat.redBits <= 8)
+    if (actualFormat.isSRGB)
+    {
+        // sRGB images are written through a linear view, and encoded in the shader.
+        ASSERT(actualFormat.redBits == 8);
+        flags = GenerateMipmap_comp::kIsSRGBA8;
+    }
+    else if (actualFormat.redBits <= 8)
     {
         flags = hasShaderFloat16 ? GenerateMipmap_comp::kIsRGBA8_UseHalf
                                  : GenerateMipmap_comp::kIsRGBA8;
@@ -294,9 +319,18 @@ uint32_t GetGenerateMipmapFlags(ContextVk *contextVk, const angle::Format &actua
         flags = GenerateMipmap_comp::kIsRGBA32F;
     }
 
-    flags |= UtilsVk::GetGenerateMipmapMaxLevels(contextVk) == UtilsVk::kGenerateMipmapMaxLevels
-                 ? GenerateMipmap_comp::kDestSize6
-                 : GenerateMipmap_comp::kDestSize4;
+    switch (UtilsVk::GetGenerateMipmapMaxLevels(contextVk))
+    {
+        case UtilsVk::kGenerateMipmapMaxLevels:
+            flags |= GenerateMipmap_comp::kDestSize12;
+            break;
+        case UtilsVk::kGenerateMipmapWorkgroupLevels:
+            flags |= GenerateMipmap_comp::kDestSize6;
+            break;
+        default:
+            flags |= GenerateMipmap_comp::kDestSize4;
+            break;
+    }
 
     return flags;
 }
@@ -1000,6 +1034,8 @@ angle::Result GetUnresolveFrag(
 }  // namespace
 
 const uint32_t UtilsVk::kGenerateMipmapMaxLevels;
+const uint32_t UtilsVk::kGenerateMipmapWorkgroupLevels;
+const uint32_t UtilsVk::kGenerateMipmapMaxAllLevelsSrcExtent;
 
 UtilsVk::ConvertVertexShaderParams::ConvertVertexShaderParams() = default;
 
@@ -1016,11 +1052,15 @@ uint32_t UtilsVk::GetGenerateMipmapMaxLevels(ContextVk *contextVk)
     constexpr uint32_t kMinimumStorageImagesLimit = 4;
     ASSERT(maxPerStageDescriptorStorageImages >= kMinimumStorageImagesLimit);
 
-    // If fewer than max-levels are supported, use 4 levels (which is the minimum required number
-    // of storage image bindings).
-    return maxPerStageDescriptorStorageImages < kGenerateMipmapMaxLevels
+    // If fewer than max-levels are supported, fall back to the levels a single workgroup can
+    // generate, or 4 levels (which is the minimum required number of storage image bindings).
+    if (maxPerStageDescriptorStorageImages >= kGenerateMipmapMaxLevels)
+    {
+        return kGenerateMipmapMaxLevels;
+    }
+    return maxPerStageDescriptorStorageImages < kGenerateMipmapWorkgroupLevels
                ? kMinimumStorageImagesLimit
-               : kGenerateMipmapMaxLevels;
+               : kGenerateMipmapWorkgroupLevels;
 }
 
 UtilsVk::UtilsVk() : mPerfCounters{}, mCumulativePerfCounters{} {}
@@ -1033,6 +1073,8 @@ void UtilsVk::destroy(RendererVk *renderer)
 
     outputCumulativePerfCounters();
 
+    mPendingConversions.clear();
+
     for (Function f : angle::AllEnums<Function>())
     {
         for (auto &descriptorSetLayout : mDescriptorSetLayouts[f])
@@ -1105,6 +1147,8 @@ void UtilsVk::destroy(RendererVk *renderer)
 
     mPointSampler.destroy(device);
     mLinearSampler.destroy(device);
+
+    mGenerateMipmapCounterBuffer.release(renderer);
 }
 
 angle::Result UtilsVk::ensureResourcesInitialized(ContextVk *contextVk,
@@ -1181,8 +1225,8 @@ angle::Result UtilsVk::ensureConvertIndexResourcesInitialized(ContextVk *context
     }
 
     VkDescriptorPoolSize setSizes[2] = {
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1},
     };
 
     return ensureResourcesInitialized(contextVk, Function::ConvertIndexBuffer, setSizes,
@@ -1253,8 +1297,8 @@ angle::Result UtilsVk::ensureConvertVertexResourcesInitialized(ContextVk *contex
     }
 
     VkDescriptorPoolSize setSizes[2] = {
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
-        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1},
     };
 
     return ensureResourcesInitialized(contextVk, Function::ConvertVertexBuffer, setSizes,
@@ -1363,13 +1407,39 @@ angle::Result UtilsVk::ensureGenerateMipmapResourcesInitialized(ContextVk *conte
         return angle::Result::Continue;
     }
 
-    VkDescriptorPoolSize setSizes[2] = {
+    VkDescriptorPoolSize setSizes[3] = {
         {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, GetGenerateMipmapMaxLevels(contextVk)},
         {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
     };
 
-    return ensureResourcesInitialized(contextVk, Function::GenerateMipmap, setSizes,
-                                      ArraySize(setSizes), sizeof(GenerateMipmapShaderParams));
+    ANGLE_TRY(ensureResourcesInitialized(contextVk, Function::GenerateMipmap, setSizes,
+                                         ArraySize(setSizes), sizeof(GenerateMipmapShaderParams)));
+
+    // Create the atomic counter buffer and initialize it to zero.  The shader resets the counter
+    // after every dispatch, so it only needs to be cleared once.
+    constexpr VkBufferUsageFlags kCounterBufferUsage =
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    VkBufferCreateInfo counterBufferInfo    = {};
+    counterBufferInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    counterBufferInfo.flags                 = 0;
+    counterBufferInfo.size                  = sizeof(uint32_t);
+    counterBufferInfo.usage                 = kCounterBufferUsage;
+    counterBufferInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    counterBufferInfo.queueFamilyIndexCount = 0;
+    counterBufferInfo.pQueueFamilyIndices   = nullptr;
+    ANGLE_TRY(mGenerateMipmapCounterBuffer.init(contextVk, counterBufferInfo,
+                                                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+
+    vk::CommandBufferAccess access;
+    access.onBufferTransferWrite(&mGenerateMipmapCounterBuffer);
+
+    vk::CommandBuffer *commandBuffer;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
+
+    commandBuffer->fillBuffer(mGenerateMipmapCounterBuffer.getBuffer(), 0, VK_WHOLE_SIZE, 0);
+
+    return angle::Result::Continue;
 }
 
 angle::Result UtilsVk::ensureUnresolveResourcesInitialized(ContextVk *contextVk,
@@ -1520,34 +1590,14 @@ angle::Result UtilsVk::convertIndexBuffer(ContextVk *contextVk,
 {
     ANGLE_TRY(ensureConvertIndexResourcesInitialized(contextVk));
 
-    vk::CommandBufferAccess access;
-    access.onBufferComputeShaderRead(src);
-    access.onBufferComputeShaderWrite(dest);
-
-    vk::CommandBuffer *commandBuffer;
-    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
-
-    VkDescriptorSet descriptorSet;
-    vk::RefCountedDescriptorPoolBinding descriptorPoolBinding;
-    ANGLE_TRY(allocateDescriptorSet(contextVk, Function::ConvertIndexBuffer, &descriptorPoolBinding,
-                                    &descriptorSet));
-
-    std::array<VkDescriptorBufferInfo, 2> buffers = {{
-        {dest->getBuffer().getHandle(), 0, VK_WHOLE_SIZE},
-        {src->getBuffer().getHandle(), 0, VK_WHOLE_SIZE},
-    }};
+    uint32_t srcDynamicOffset  = 0;
+    uint32_t destDynamicOffset = 0;
+    uint32_t srcShaderOffset   = 0;
+    uint32_t destShaderOffset  = 0;
+    SplitStorageBufferOffset(contextVk, params.srcOffset, &srcDynamicOffset, &srcShaderOffset);
+    SplitStorageBufferOffset(contextVk, params.dstOffset, &destDynamicOffset, &destShaderOffset);
 
-    VkWriteDescriptorSet writeInfo = {};
-    writeInfo.sType                = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    writeInfo.dstSet               = descriptorSet;
-    writeInfo.dstBinding           = kConvertIndexDestinationBinding;
-    writeInfo.descriptorCount      = 2;
-    writeInfo.descriptorType       = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    writeInfo.pBufferInfo          = buffers.data();
-
-    vkUpdateDescriptorSets(contextVk->getDevice(), 1, &writeInfo, 0, nullptr);
-
-    ConvertIndexShaderParams shaderParams = {params.srcOffset, params.dstOffset >> 2,
+    ConvertIndexShaderParams shaderParams = {srcShaderOffset, destShaderOffset >> 2,
                                              params.maxIndex, 0};
 
     uint32_t flags = 0;
@@ -1556,21 +1606,15 @@ angle::Result UtilsVk::convertIndexBuffer(ContextVk *contextVk,
         flags |= vk::InternalShader::ConvertIndex_comp::kIsPrimitiveRestartEnabled;
     }
 
-    vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
-    ANGLE_TRY(contextVk->getShaderLibrary().getConvertIndex_comp(contextVk, flags, &shader));
-
-    ANGLE_TRY(setupProgram(contextVk, Function::ConvertIndexBuffer, shader, nullptr,
-                           &mConvertIndexPrograms[flags], nullptr, descriptorSet, &shaderParams,
-                           sizeof(ConvertIndexShaderParams), commandBuffer));
-
     constexpr uint32_t kInvocationsPerGroup = 64;
     constexpr uint32_t kInvocationsPerIndex = 2;
     const uint32_t kIndexCount              = params.maxIndex;
     const uint32_t kGroupCount =
         UnsignedCeilDivide(kIndexCount * kInvocationsPerIndex, kInvocationsPerGroup);
-    commandBuffer->dispatch(kGroupCount, 1, 1);
 
-    descriptorPoolBinding.reset();
+    queueConversion(Function::ConvertIndexBuffer, flags, dest, destDynamicOffset, src,
+                    srcDynamicOffset, kGroupCount, &shaderParams,
+                    sizeof(ConvertIndexShaderParams));
 
     return angle::Result::Continue;
 }
@@ -1773,12 +1817,7 @@ angle::Result UtilsVk::convertVertexBuffer(ContextVk *contextVk,
                                            vk::BufferHelper *src,
                                            const ConvertVertexParameters &params)
 {
-    vk::CommandBufferAccess access;
-    access.onBufferComputeShaderRead(src);
-    access.onBufferComputeShaderWrite(dest);
-
-    vk::CommandBuffer *commandBuffer;
-    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
+    ANGLE_TRY(ensureConvertVertexResourcesInitialized(contextVk));
 
     ConvertVertexShaderParams shaderParams;
     shaderParams.Ns = params.srcFormat->channelCount;
@@ -1798,8 +1837,13 @@ angle::Result UtilsVk::convertVertexBuffer(ContextVk *contextVk,
     // Total number of 4-byte outputs is the number of components divided by how many components can
     // fit in a 4-byte value.  Note that this value is also the invocation size of the shader.
     shaderParams.outputCount = UnsignedCeilDivide(shaderParams.componentCount, shaderParams.Ed);
-    shaderParams.srcOffset   = static_cast<uint32_t>(params.srcOffset);
-    shaderParams.destOffset  = static_cast<uint32_t>(params.destOffset);
+
+    uint32_t srcDynamicOffset  = 0;
+    uint32_t destDynamicOffset = 0;
+    SplitStorageBufferOffset(contextVk, params.srcOffset, &srcDynamicOffset,
+                             &shaderParams.srcOffset);
+    SplitStorageBufferOffset(contextVk, params.destOffset, &destDynamicOffset,
+                             &shaderParams.destOffset);
 
     bool isSrcA2BGR10 =
         params.srcFormat->vertexAttribType == gl::VertexAttribType::UnsignedInt2101010 ||
@@ -1875,7 +1919,203 @@ angle::Result UtilsVk::convertVertexBuffer(ContextVk *contextVk,
             UNREACHABLE();
     }
 
-    return convertVertexBufferImpl(contextVk, dest, src, flags, commandBuffer, shaderParams);
+    queueConversion(Function::ConvertVertexBuffer, flags, dest, destDynamicOffset, src,
+                    srcDynamicOffset, UnsignedCeilDivide(shaderParams.outputCount, 64),
+                    &shaderParams, sizeof(shaderParams));
+
+    return angle::Result::Continue;
+}
+
+void UtilsVk::queueConversion(Function function,
+                              uint32_t flags,
+                              vk::BufferHelper *dest,
+                              uint32_t destDynamicOffset,
+                              vk::BufferHelper *src,
+                              uint32_t srcDynamicOffset,
+                              uint32_t groupCount,
+                              const void *pushConstants,
+                              size_t pushConstantsSize)
+{
+    PendingConversion conversion;
+    conversion.function          = function;
+    conversion.flags             = flags;
+    conversion.dest              = dest;
+    conversion.destDynamicOffset = destDynamicOffset;
+    conversion.src               = src;
+    conversion.srcDynamicOffset  = srcDynamicOffset;
+    conversion.groupCount        = groupCount;
+    conversion.pushConstantsSize = static_cast<uint32_t>(pushConstantsSize);
+    ASSERT(pushConstantsSize <= conversion.pushConstants.size());
+    memcpy(conversion.pushConstants.data(), pushConstants, pushConstantsSize);
+
+    mPendingConversions.push_back(conversion);
+}
+
+angle::Result UtilsVk::flushPendingConversions(ContextVk *contextVk)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "UtilsVk::flushPendingConversions");
+
+    // Recording the conversions can flush the command buffers, so take the queue first.
+    std::vector<PendingConversion> conversions;
+    std::swap(conversions, mPendingConversions);
+
+    // Conversions that use the same pipeline are recorded one after the other.
+    std::stable_sort(conversions.begin(), conversions.end(),
+                     [](const PendingConversion &a, const PendingConversion &b) {
+                         return std::tie(a.function, a.flags) < std::tie(b.function, b.flags);
+                     });
+
+    // The barriers of all the conversions are recorded together, before their dispatches.  Buffers
+    // written by multiple conversions are written at different offsets, so they need no barrier in
+    // between.
+    std::vector<vk::BufferHelper *> readBuffers;
+    std::vector<vk::BufferHelper *> writeBuffers;
+    for (const PendingConversion &conversion : conversions)
+    {
+        if (std::find(writeBuffers.begin(), writeBuffers.end(), conversion.dest) ==
+            writeBuffers.end())
+        {
+            writeBuffers.push_back(conversion.dest);
+        }
+    }
+    for (const PendingConversion &conversion : conversions)
+    {
+        if (std::find(readBuffers.begin(), readBuffers.end(), conversion.src) ==
+                readBuffers.end() &&
+            std::find(writeBuffers.begin(), writeBuffers.end(), conversion.src) ==
+                writeBuffers.end())
+        {
+            readBuffers.push_back(conversion.src);
+        }
+    }
+
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBufferForComputeBuffers(
+        readBuffers, writeBuffers, &commandBuffer));
+
+    // Conversions of the same buffers at the same dynamic offsets use the same descriptor set,
+    // since the rest of the offsets are given in the push constants.  The range of a dynamic
+    // descriptor is fixed when the set is written, so each set is written for its dynamic offsets.
+    struct ConversionDescriptorSet
+    {
+        Function function;
+        const vk::BufferHelper *dest;
+        uint32_t destDynamicOffset;
+        const vk::BufferHelper *src;
+        uint32_t srcDynamicOffset;
+        VkDescriptorSet descriptorSet;
+    };
+    std::vector<ConversionDescriptorSet> descriptorSets;
+    vk::RefCountedDescriptorPoolBinding descriptorPoolBinding;
+
+    const PendingConversion *previous = nullptr;
+    for (const PendingConversion &conversion : conversions)
+    {
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+        for (const ConversionDescriptorSet &set : descriptorSets)
+        {
+            if (set.function == conversion.function && set.dest == conversion.dest &&
+                set.destDynamicOffset == conversion.destDynamicOffset &&
+                set.src == conversion.src && set.srcDynamicOffset == conversion.srcDynamicOffset)
+            {
+                descriptorSet = set.descriptorSet;
+                break;
+            }
+        }
+
+        if (descriptorSet == VK_NULL_HANDLE)
+        {
+            if (previous != nullptr && previous->function != conversion.function)
+            {
+                descriptorPoolBinding.reset();
+            }
+            ANGLE_TRY(allocateDescriptorSet(contextVk, conversion.function, &descriptorPoolBinding,
+                                            &descriptorSet));
+            writeConvertDescriptorSet(contextVk, descriptorSet, conversion.dest,
+                                      conversion.destDynamicOffset, conversion.src,
+                                      conversion.srcDynamicOffset);
+
+            descriptorSets.push_back({conversion.function, conversion.dest,
+                                      conversion.destDynamicOffset, conversion.src,
+                                      conversion.srcDynamicOffset, descriptorSet});
+        }
+
+        const vk::PipelineLayout &pipelineLayout = mPipelineLayouts[conversion.function].get();
+        if (previous == nullptr || previous->function != conversion.function ||
+            previous->flags != conversion.flags)
+        {
+            vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
+            vk::ShaderProgramHelper *program            = nullptr;
+            if (conversion.function == Function::ConvertIndexBuffer)
+            {
+                ANGLE_TRY(contextVk->getShaderLibrary().getConvertIndex_comp(
+                    contextVk, conversion.flags, &shader));
+                program = &mConvertIndexPrograms[conversion.flags];
+            }
+            else
+            {
+                ASSERT(conversion.function == Function::ConvertVertexBuffer);
+                ANGLE_TRY(contextVk->getShaderLibrary().getConvertVertex_comp(
+                    contextVk, conversion.flags, &shader));
+                program = &mConvertVertexPrograms[conversion.flags];
+            }
+
+            // The descriptor set is bound below, with the dynamic offsets of the conversion.
+            ANGLE_TRY(setupProgram(contextVk, conversion.function, shader, nullptr, program,
+                                   nullptr, VK_NULL_HANDLE, nullptr, 0, commandBuffer));
+            contextVk->invalidateComputeDescriptorSet(DescriptorSetIndex::Internal);
+        }
+
+        // The dynamic offsets are in the order of the bindings.
+        const uint32_t dynamicOffsets[2] = {conversion.destDynamicOffset,
+                                            conversion.srcDynamicOffset};
+        commandBuffer->bindDescriptorSets(pipelineLayout, VK_PIPELINE_BIND_POINT_COMPUTE,
+                                          DescriptorSetIndex::Internal, 1, &descriptorSet, 2,
+                                          dynamicOffsets);
+        commandBuffer->pushConstants(pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                     conversion.pushConstantsSize,
+                                     conversion.pushConstants.data());
+
+        commandBuffer->dispatch(conversion.groupCount, 1, 1);
+
+        previous = &conversion;
+    }
+
+    descriptorPoolBinding.reset();
+
+    return angle::Result::Continue;
+}
+
+void UtilsVk::writeConvertDescriptorSet(ContextVk *contextVk,
+                                        VkDescriptorSet descriptorSet,
+                                        const vk::BufferHelper *dest,
+                                        uint32_t destDynamicOffset,
+                                        const vk::BufferHelper *src,
+                                        uint32_t srcDynamicOffset)
+{
+    // The index and vertex conversions both take the destination and source buffers.
+    static_assert(kConvertIndexDestinationBinding == kConvertVertexDestinationBinding,
+                  "Update write info");
+    static_assert(kConvertVertexDestinationBinding + 1 == kConvertVertexSourceBinding,
+                  "Update write info");
+
+    // The dynamic offsets select the converted ranges, which extend to the end of the buffers.
+    // The descriptors must stay within the buffers when bound with the dynamic offsets.
+    ASSERT(destDynamicOffset < dest->getSize() && srcDynamicOffset < src->getSize());
+    VkDescriptorBufferInfo buffers[2] = {
+        {dest->getBuffer().getHandle(), 0, dest->getSize() - destDynamicOffset},
+        {src->getBuffer().getHandle(), 0, src->getSize() - srcDynamicOffset},
+    };
+
+    VkWriteDescriptorSet writeInfo = {};
+    writeInfo.sType                = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeInfo.dstSet               = descriptorSet;
+    writeInfo.dstBinding           = kConvertVertexDestinationBinding;
+    writeInfo.descriptorCount      = 2;
+    writeInfo.descriptorType       = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+    writeInfo.pBufferInfo          = buffers;
+
+    vkUpdateDescriptorSets(contextVk->getDevice(), 1, &writeInfo, 0, nullptr);
 }
 
 angle::Result UtilsVk::convertVertexBufferImpl(ContextVk *contextVk,
@@ -1892,30 +2132,22 @@ angle::Result UtilsVk::convertVertexBufferImpl(ContextVk *contextVk,
     ANGLE_TRY(allocateDescriptorSet(contextVk, Function::ConvertVertexBuffer,
                                     &descriptorPoolBinding, &descriptorSet));
 
-    VkWriteDescriptorSet writeInfo    = {};
-    VkDescriptorBufferInfo buffers[2] = {
-        {dest->getBuffer().getHandle(), 0, VK_WHOLE_SIZE},
-        {src->getBuffer().getHandle(), 0, VK_WHOLE_SIZE},
-    };
-    static_assert(kConvertVertexDestinationBinding + 1 == kConvertVertexSourceBinding,
-                  "Update write info");
-
-    writeInfo.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    writeInfo.dstSet          = descriptorSet;
-    writeInfo.dstBinding      = kConvertVertexDestinationBinding;
-    writeInfo.descriptorCount = 2;
-    writeInfo.descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    writeInfo.pBufferInfo     = buffers;
-
-    vkUpdateDescriptorSets(contextVk->getDevice(), 1, &writeInfo, 0, nullptr);
+    writeConvertDescriptorSet(contextVk, descriptorSet, dest, 0, src, 0);
 
     vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
     ANGLE_TRY(contextVk->getShaderLibrary().getConvertVertex_comp(contextVk, flags, &shader));
 
     ANGLE_TRY(setupProgram(contextVk, Function::ConvertVertexBuffer, shader, nullptr,
-                           &mConvertVertexPrograms[flags], nullptr, descriptorSet, &shaderParams,
+                           &mConvertVertexPrograms[flags], nullptr, VK_NULL_HANDLE, &shaderParams,
                            sizeof(shaderParams), commandBuffer));
 
+    // The offsets are all given in the push constants.
+    const uint32_t dynamicOffsets[2] = {0, 0};
+    commandBuffer->bindDescriptorSets(mPipelineLayouts[Function::ConvertVertexBuffer].get(),
+                                      VK_PIPELINE_BIND_POINT_COMPUTE, DescriptorSetIndex::Internal,
+                                      1, &descriptorSet, 2, dynamicOffsets);
+    contextVk->invalidateComputeDescriptorSet(DescriptorSetIndex::Internal);
+
     commandBuffer->dispatch(UnsignedCeilDivide(shaderParams.outputCount, 64), 1, 1);
 
     descriptorPoolBinding.reset();
@@ -1956,9 +2188,10 @@ angle::Result UtilsVk::startRenderPass(ContextVk *contextVk,
                                               vk::ImageLayout::ColorAttachment,
                                               vk::ImageLayout::ColorAttachment);
 
-    ANGLE_TRY(contextVk->beginNewRenderPass(
-        framebuffer, renderArea, renderPassDesc, renderPassAttachmentOps,
-        vk::PackedAttachmentCount(1), vk::kAttachmentIndexInvalid, clearValues, commandBufferOut));
+    ANGLE_TRY(contextVk->beginNewRenderPass(framebuffer, {}, renderArea, renderPassDesc,
+                                            renderPassAttachmentOps, vk::PackedAttachmentCount(1),
+                                            vk::kAttachmentIndexInvalid, clearValues,
+                                            commandBufferOut));
 
     contextVk->addGarbage(&framebuffer);
 
@@ -3058,7 +3291,12 @@ angle::Result UtilsVk::generateMipmap(ContextVk *contextVk,
     srcImageInfo.imageLayout           = src->getCurrentLayout();
     srcImageInfo.sampler               = sampler.getHandle();
 
-    VkWriteDescriptorSet writeInfos[2] = {};
+    VkDescriptorBufferInfo counterBufferInfo = {};
+    counterBufferInfo.buffer                 = mGenerateMipmapCounterBuffer.getBuffer().getHandle();
+    counterBufferInfo.offset                 = 0;
+    counterBufferInfo.range                  = VK_WHOLE_SIZE;
+
+    VkWriteDescriptorSet writeInfos[3] = {};
     writeInfos[0].sType                = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
     writeInfos[0].dstSet               = descriptorSet;
     writeInfos[0].dstBinding           = kGenerateMipmapDestinationBinding;
@@ -3073,15 +3311,31 @@ angle::Result UtilsVk::generateMipmap(ContextVk *contextVk,
     writeInfos[1].descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     writeInfos[1].pImageInfo      = &srcImageInfo;
 
-    vkUpdateDescriptorSets(contextVk->getDevice(), 2, writeInfos, 0, nullptr);
+    writeInfos[2].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeInfos[2].dstSet          = descriptorSet;
+    writeInfos[2].dstBinding      = kGenerateMipmapCounterBinding;
+    writeInfos[2].descriptorCount = 1;
+    writeInfos[2].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    writeInfos[2].pBufferInfo     = &counterBufferInfo;
+
+    vkUpdateDescriptorSets(contextVk->getDevice(), 3, writeInfos, 0, nullptr);
 
     vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
     ANGLE_TRY(contextVk->getShaderLibrary().getGenerateMipmap_comp(contextVk, flags, &shader));
 
     // Note: onImageRead/onImageWrite is expected to be called by the caller.  This avoids inserting
-    // barriers between calls for each layer of the image.
+    // barriers between calls for each layer of the image.  The atomic counter is only used if more
+    // levels are generated than a single workgroup can.
+    vk::CommandBufferAccess access;
+    if (params.destLevelCount > kGenerateMipmapWorkgroupLevels)
+    {
+        ASSERT(std::max(srcExtents.width, srcExtents.height) <=
+               static_cast<int>(kGenerateMipmapMaxAllLevelsSrcExtent));
+        access.onBufferComputeShaderWrite(&mGenerateMipmapCounterBuffer);
+    }
+
     vk::CommandBuffer *commandBuffer;
-    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer({}, &commandBuffer));
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
 
     ANGLE_TRY(setupProgram(contextVk, Function::GenerateMipmap, shader, nullptr,
                            &mGenerateMipmapPrograms[flags], nullptr, descriptorSet, &shaderParams,
@@ -12,6 +12,8 @@
 //    - Convert vertex buffer:
 //      * Used by VertexArrayVk::convertVertexBufferGPU() to convert vertex attributes from
 //        unsupported formats to their fallbacks.
+//    - Index and vertex buffer conversions are queued, and recorded together by
+//      flushPendingConversions() when the render pass of the draw that uses them starts.
 //    - Image clear: Used by FramebufferVk::clearWithDraw().
 //    - Image copy: Used by TextureVk::copySubImageImplWithDraw().
 //    - Image copy bits: Used by ImageHelper::CopyImageSubData() to perform bitwise copies between
@@ -189,7 +191,12 @@ class UtilsVk : angle::NonCopyable
     };
 
     // Based on the maximum number of levels in GenerateMipmap.comp.
-    static constexpr uint32_t kGenerateMipmapMaxLevels = 6;
+    static constexpr uint32_t kGenerateMipmapMaxLevels = 12;
+
+    // Levels beyond the first 6 are generated by the last workgroup to finish, which downsamples the
+    // 6th level.  That's only possible if the 6th level fits in a single workgroup's 64x64 tile.
+    static constexpr uint32_t kGenerateMipmapWorkgroupLevels      = 6;
+    static constexpr uint32_t kGenerateMipmapMaxAllLevelsSrcExtent = 4096;
     static uint32_t GetGenerateMipmapMaxLevels(ContextVk *contextVk);
 
     angle::Result convertIndexBuffer(ContextVk *contextVk,
@@ -223,6 +230,14 @@ class UtilsVk : angle::NonCopyable
                                       vk::BufferHelper *src,
                                       const ConvertVertexParameters &params);
 
+    // Records the queued index and vertex buffer conversions, behind a single barrier.  The
+    // conversions that use the same pipeline are dispatched one after the other, and those that
+    // use the same buffers share a descriptor set.  The queue is dropped if the draw that needs the
+    // conversions fails, since the buffers may not outlive the error.
+    bool hasPendingConversions() const { return !mPendingConversions.empty(); }
+    angle::Result flushPendingConversions(ContextVk *contextVk);
+    void clearPendingConversions() { mPendingConversions.clear(); }
+
     angle::Result clearFramebuffer(ContextVk *contextVk,
                                    FramebufferVk *framebuffer,
                                    const ClearFramebufferParameters &params);
@@ -466,6 +481,31 @@ class UtilsVk : angle::NonCopyable
         EnumCount   = 22,
     };
 
+    // An index or vertex buffer conversion waiting to be recorded.  The offsets of the buffers are
+    // split between the dynamic offsets of their descriptors and the push constants, which also
+    // give the size of the conversion.
+    struct PendingConversion
+    {
+        Function function;
+        uint32_t flags;
+        vk::BufferHelper *dest;
+        uint32_t destDynamicOffset;
+        vk::BufferHelper *src;
+        uint32_t srcDynamicOffset;
+        uint32_t groupCount;
+        uint32_t pushConstantsSize;
+        std::array<uint8_t, sizeof(ConvertVertexShaderParams)> pushConstants;
+    };
+    void queueConversion(Function function,
+                         uint32_t flags,
+                         vk::BufferHelper *dest,
+                         uint32_t destDynamicOffset,
+                         vk::BufferHelper *src,
+                         uint32_t srcDynamicOffset,
+                         uint32_t groupCount,
+                         const void *pushConstants,
+                         size_t pushConstantsSize);
+
     // Common function that creates the pipeline for the specified function, binds it and prepares
     // the draw/dispatch call.  If function >= ComputeStartIndex, fsCsShader is expected to be a
     // compute shader, vsShader and pipelineDesc should be nullptr, and this will set up a dispatch
@@ -520,6 +560,15 @@ class UtilsVk : angle::NonCopyable
                                   const gl::Rectangle &renderArea,
                                   vk::CommandBuffer **commandBufferOut);
 
+    // Writes the destination and source buffers of index or vertex conversions, for binding with
+    // the given dynamic offsets.
+    void writeConvertDescriptorSet(ContextVk *contextVk,
+                                   VkDescriptorSet descriptorSet,
+                                   const vk::BufferHelper *dest,
+                                   uint32_t destDynamicOffset,
+                                   const vk::BufferHelper *src,
+                                   uint32_t srcDynamicOffset);
+
     // Set up descriptor set and call dispatch.
     angle::Result convertVertexBufferImpl(ContextVk *contextVk,
                                           vk::BufferHelper *dest,
@@ -575,6 +624,11 @@ class UtilsVk : angle::NonCopyable
     vk::Sampler mPointSampler;
     vk::Sampler mLinearSampler;
 
+    // Global atomic counter used by GenerateMipmap.comp to find the last workgroup to finish.
+    vk::BufferHelper mGenerateMipmapCounterBuffer;
+
+    std::vector<PendingConversion> mPendingConversions;
+
     InternalShaderPerfCounters mPerfCounters;
     InternalShaderPerfCounters mCumulativePerfCounters;
 };
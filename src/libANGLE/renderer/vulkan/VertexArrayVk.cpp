@@ -188,6 +188,9 @@ angle::Result VertexArrayVk::convertIndexBufferGPU(ContextVk *contextVk,
                                                    BufferVk *bufferVk,
                                                    const void *indices)
 {
+    // Readbacks into the buffer must land before its indices are converted.
+    ANGLE_TRY(bufferVk->flushPendingPackPixels(contextVk));
+
     intptr_t offsetIntoSrcData = reinterpret_cast<intptr_t>(indices);
     size_t srcDataSize         = static_cast<size_t>(bufferVk->getSize()) - offsetIntoSrcData;
 
@@ -224,6 +227,10 @@ angle::Result VertexArrayVk::convertIndexBufferIndirectGPU(ContextVk *contextVk,
                                               ->getBufferAndOffset(&elementArrayBufferOffset));
     ASSERT(mCurrentElementArrayBufferOffset == elementArrayBufferOffset);
 
+    // Readbacks into the buffer must land before its indices are converted.
+    ANGLE_TRY(
+        vk::GetImpl(getState().getElementArrayBuffer())->flushPendingPackPixels(contextVk));
+
     mTranslatedByteIndexData.releaseInFlightBuffers(contextVk);
     mTranslatedByteIndirectData.releaseInFlightBuffers(contextVk);
 
@@ -399,6 +406,9 @@ angle::Result VertexArrayVk::convertVertexBufferGPU(ContextVk *contextVk,
 
     ASSERT(vertexFormat.getVertexInputAlignment(compressed) <= vk::kVertexBufferAlignment);
 
+    // Readbacks into the buffer must land before its vertices are converted.
+    ANGLE_TRY(srcBuffer->flushPendingPackPixels(contextVk));
+
     // Allocate buffer for results
     conversion->data.releaseInFlightBuffers(contextVk);
     ANGLE_TRY(conversion->data.allocate(contextVk, numVertices * destFormatSize, nullptr, nullptr,
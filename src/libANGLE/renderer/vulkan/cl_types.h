@@ -13,8 +13,11 @@
 namespace rx
 {
 
+class CLCommandQueueVk;
 class CLContextVk;
 class CLDeviceVk;
+class CLEventVk;
+class CLMemoryVk;
 class CLPlatformVk;
 
 }  // namespace rx
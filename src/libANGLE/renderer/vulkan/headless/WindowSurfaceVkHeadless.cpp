@@ -8,18 +8,58 @@
 //
 
 #include "WindowSurfaceVkHeadless.h"
+
+#include "common/system_utils.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
+#include "libANGLE/trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
 
 namespace rx
 {
 
+namespace
+{
+constexpr char kSwapchainImageCountVarName[] = "ANGLE_HEADLESS_SWAPCHAIN_IMAGE_COUNT";
+constexpr char kRefreshRateVarName[]         = "ANGLE_HEADLESS_REFRESH_RATE";
+
+uint32_t GetUintEnvironmentVar(const char *variableName)
+{
+    const std::string value = angle::GetEnvironmentVar(variableName);
+    return value.empty() ? 0 : static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+}
+}  // anonymous namespace
+
 WindowSurfaceVkHeadless::WindowSurfaceVkHeadless(const egl::SurfaceState &surfaceState,
                                                  EGLNativeWindowType window)
-    : WindowSurfaceVk(surfaceState, window)
-{}
+    : WindowSurfaceVk(surfaceState, window),
+      mSwapchainImageCount(GetUintEnvironmentVar(kSwapchainImageCountVarName)),
+      mRefreshPeriod(0),
+      mSwapInterval(1),
+      mFirstVblankTime(0),
+      mLastDisplayVblank(0)
+{
+    const uint32_t refreshRate = GetUintEnvironmentVar(kRefreshRateVarName);
+    if (refreshRate > 0)
+    {
+        mRefreshPeriod = 1.0 / refreshRate;
+    }
+}
 
 WindowSurfaceVkHeadless::~WindowSurfaceVkHeadless() {}
 
+void WindowSurfaceVkHeadless::setSwapInterval(EGLint interval)
+{
+    // A swap interval of 0 presents immediately, whichever present mode the swapchain falls back
+    // to.
+    mSwapInterval = interval;
+    WindowSurfaceVk::setSwapInterval(interval);
+}
+
 angle::Result WindowSurfaceVkHeadless::createSurfaceVk(vk::Context *context,
                                                        gl::Extents *extentsOut)
 {
@@ -60,4 +100,68 @@ angle::Result WindowSurfaceVkHeadless::getCurrentWindowSize(vk::Context *context
     return angle::Result::Continue;
 }
 
+bool WindowSurfaceVkHeadless::canWaitForPresent() const
+{
+    // Nothing is displayed, so the frames are paced by the submissions of the previous frames
+    // instead.  This runs the pacing logic of lowLatencyFramePacing without a display.
+    return false;
+}
+
+uint32_t WindowSurfaceVkHeadless::getDesiredSwapchainImageCount() const
+{
+    return mSwapchainImageCount > 0 ? mSwapchainImageCount
+                                    : WindowSurfaceVk::getDesiredSwapchainImageCount();
+}
+
+void WindowSurfaceVkHeadless::onPresentQueued()
+{
+    if (!isVblankPaced())
+    {
+        return;
+    }
+
+    const double now = angle::GetCurrentTime();
+    if (mQueuedDisplayTimes.empty() && mLastDisplayVblank == 0)
+    {
+        mFirstVblankTime = now;
+    }
+
+    // The present is shown on the first vblank after it's queued, and after the previous present
+    // is shown.  The vblanks are counted, so rounding can't show two presents on the same one.
+    const uint64_t currentVblank =
+        static_cast<uint64_t>(std::floor((now - mFirstVblankTime) / mRefreshPeriod));
+    mLastDisplayVblank = std::max(currentVblank, mLastDisplayVblank) + 1;
+    mQueuedDisplayTimes.push_back(mFirstVblankTime + mLastDisplayVblank * mRefreshPeriod);
+}
+
+void WindowSurfaceVkHeadless::waitForAvailableImage(size_t imageCount)
+{
+    if (!isVblankPaced())
+    {
+        mQueuedDisplayTimes.clear();
+        return;
+    }
+
+    // One image is shown and one more is needed for the acquire, so the rest of the images can be
+    // queued.  Wait for vblanks until enough of the queued presents are shown.
+    const size_t maxQueuedPresents = imageCount > 2 ? imageCount - 2 : 0;
+    double now                     = angle::GetCurrentTime();
+    while (!mQueuedDisplayTimes.empty())
+    {
+        const double displayTime = mQueuedDisplayTimes.front();
+        if (displayTime > now && mQueuedDisplayTimes.size() <= maxQueuedPresents)
+        {
+            break;
+        }
+
+        if (displayTime > now)
+        {
+            ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVkHeadless::waitForAvailableImage");
+            std::this_thread::sleep_for(std::chrono::duration<double>(displayTime - now));
+            now = angle::GetCurrentTime();
+        }
+        mQueuedDisplayTimes.pop_front();
+    }
+}
+
 }  // namespace rx
@@ -12,6 +12,8 @@
 
 #include "libANGLE/renderer/vulkan/SurfaceVk.h"
 
+#include <deque>
+
 namespace rx
 {
 
@@ -21,9 +23,29 @@ class WindowSurfaceVkHeadless final : public WindowSurfaceVk
     WindowSurfaceVkHeadless(const egl::SurfaceState &surfaceState, EGLNativeWindowType window);
     ~WindowSurfaceVkHeadless() final;
 
+    void setSwapInterval(EGLint interval) override;
+
   private:
     angle::Result createSurfaceVk(vk::Context *context, gl::Extents *extentsOut) override;
     angle::Result getCurrentWindowSize(vk::Context *context, gl::Extents *extentsOut) override;
+    bool canWaitForPresent() const override;
+    uint32_t getDesiredSwapchainImageCount() const override;
+    void onPresentQueued() override;
+    void waitForAvailableImage(size_t imageCount) override;
+
+    bool isVblankPaced() const { return mRefreshPeriod > 0 && mSwapInterval > 0; }
+
+    // Set through ANGLE_HEADLESS_SWAPCHAIN_IMAGE_COUNT, or 0 to use the default count.
+    uint32_t mSwapchainImageCount;
+    // Set through ANGLE_HEADLESS_REFRESH_RATE, or 0 to present immediately.
+    double mRefreshPeriod;
+    EGLint mSwapInterval;
+
+    // The simulated display shows one queued present per vblank, starting at the first present.
+    // Until a present is shown, its image and the image shown before it can't be acquired.
+    double mFirstVblankTime;
+    uint64_t mLastDisplayVblank;
+    std::deque<double> mQueuedDisplayTimes;
 };
 
 }  // namespace rx
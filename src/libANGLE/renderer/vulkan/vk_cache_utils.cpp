@@ -3075,6 +3075,103 @@ void FramebufferDesc::updateRenderToTexture(bool isRenderToTexture)
     SetBitField(mIsRenderToTexture, isRenderToTexture);
 }
 
+// ImagelessFramebufferDesc implementation.
+ImagelessFramebufferDesc::ImagelessFramebufferDesc()
+{
+    memset(this, 0, sizeof(ImagelessFramebufferDesc));
+}
+
+ImagelessFramebufferDesc::~ImagelessFramebufferDesc() = default;
+
+void ImagelessFramebufferDesc::reset(const RenderPass &compatibleRenderPass,
+                                     uint32_t width,
+                                     uint32_t height,
+                                     uint32_t layers)
+{
+    // Clear the unused attachments too, as they are included in hash() and operator==.
+    memset(this, 0, sizeof(ImagelessFramebufferDesc));
+
+    mRenderPass = compatibleRenderPass.getHandle();
+    mWidth      = width;
+    mHeight     = height;
+    mLayers     = layers;
+}
+
+void ImagelessFramebufferDesc::addAttachment(VkImageCreateFlags createFlags,
+                                             VkImageUsageFlags usage,
+                                             const gl::Extents &extents,
+                                             uint32_t layerCount,
+                                             const ImageViewFormats &viewFormats)
+{
+    ASSERT(mAttachmentCount < kMaxFramebufferAttachments);
+    AttachmentDesc &attachment = mAttachments[mAttachmentCount++];
+
+    attachment.createFlags     = createFlags;
+    attachment.usage           = usage;
+    attachment.width           = static_cast<uint32_t>(extents.width);
+    attachment.height          = static_cast<uint32_t>(extents.height);
+    attachment.layerCount      = layerCount;
+    attachment.viewFormatCount = static_cast<uint32_t>(viewFormats.size());
+    std::copy(viewFormats.begin(), viewFormats.end(), attachment.viewFormats.begin());
+}
+
+size_t ImagelessFramebufferDesc::getValidSize() const
+{
+    return offsetof(ImagelessFramebufferDesc, mAttachments) +
+           sizeof(mAttachments[0]) * mAttachmentCount;
+}
+
+size_t ImagelessFramebufferDesc::hash() const
+{
+    return angle::ComputeGenericHash(this, getValidSize());
+}
+
+bool ImagelessFramebufferDesc::operator==(const ImagelessFramebufferDesc &other) const
+{
+    return mAttachmentCount == other.mAttachmentCount &&
+           memcmp(this, &other, getValidSize()) == 0;
+}
+
+void ImagelessFramebufferDesc::getFramebufferCreateInfo(
+    FramebufferAttachmentsVector<VkFramebufferAttachmentImageInfoKHR> *attachmentImageInfosOut,
+    VkFramebufferAttachmentsCreateInfoKHR *attachmentsCreateInfoOut,
+    VkFramebufferCreateInfo *createInfoOut) const
+{
+    attachmentImageInfosOut->clear();
+    for (uint32_t index = 0; index < mAttachmentCount; ++index)
+    {
+        const AttachmentDesc &attachment = mAttachments[index];
+
+        VkFramebufferAttachmentImageInfoKHR imageInfo = {};
+        imageInfo.sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO_KHR;
+        imageInfo.flags           = attachment.createFlags;
+        imageInfo.usage           = attachment.usage;
+        imageInfo.width           = attachment.width;
+        imageInfo.height          = attachment.height;
+        imageInfo.layerCount      = attachment.layerCount;
+        imageInfo.viewFormatCount = attachment.viewFormatCount;
+        imageInfo.pViewFormats    = attachment.viewFormats.data();
+
+        attachmentImageInfosOut->push_back(imageInfo);
+    }
+
+    *attachmentsCreateInfoOut       = {};
+    attachmentsCreateInfoOut->sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO_KHR;
+    attachmentsCreateInfoOut->attachmentImageInfoCount = mAttachmentCount;
+    attachmentsCreateInfoOut->pAttachmentImageInfos    = attachmentImageInfosOut->data();
+
+    *createInfoOut                 = {};
+    createInfoOut->sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    createInfoOut->pNext           = attachmentsCreateInfoOut;
+    createInfoOut->flags           = VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT_KHR;
+    createInfoOut->renderPass      = mRenderPass;
+    createInfoOut->attachmentCount = mAttachmentCount;
+    createInfoOut->pAttachments    = nullptr;
+    createInfoOut->width           = mWidth;
+    createInfoOut->height          = mHeight;
+    createInfoOut->layers          = mLayers;
+}
+
 // SamplerDesc implementation.
 SamplerDesc::SamplerDesc()
 {
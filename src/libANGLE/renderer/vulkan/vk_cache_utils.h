@@ -1256,6 +1256,65 @@ class FramebufferDesc
 constexpr size_t kFramebufferDescSize = sizeof(FramebufferDesc);
 static_assert(kFramebufferDescSize == 148, "Size check failed");
 
+// An image can be viewed with its own format and, if it was created with a format list through
+// VK_KHR_image_format_list, with the format of the other colorspace.
+constexpr size_t kMaxImageViewFormats = 2;
+using ImageViewFormats                = angle::FixedVector<VkFormat, kMaxImageViewFormats>;
+
+// Imageless framebuffers (VK_KHR_imageless_framebuffer) are created from the properties of the
+// images their attachments are viewing, and the image views are only provided when the render
+// pass begins.  This description holds the compatible render pass, the framebuffer dimensions and
+// those properties, so that every set of attachments matching it can use the same framebuffer.
+class ImagelessFramebufferDesc
+{
+  public:
+    ImagelessFramebufferDesc();
+    ~ImagelessFramebufferDesc();
+
+    void reset(const RenderPass &compatibleRenderPass,
+               uint32_t width,
+               uint32_t height,
+               uint32_t layers);
+    void addAttachment(VkImageCreateFlags createFlags,
+                       VkImageUsageFlags usage,
+                       const gl::Extents &extents,
+                       uint32_t layerCount,
+                       const ImageViewFormats &viewFormats);
+
+    size_t hash() const;
+    bool operator==(const ImagelessFramebufferDesc &other) const;
+
+    uint32_t attachmentCount() const { return mAttachmentCount; }
+
+    // The attachment image infos point to the view formats stored in this description, which must
+    // thus outlive the framebuffer creation.
+    void getFramebufferCreateInfo(
+        FramebufferAttachmentsVector<VkFramebufferAttachmentImageInfoKHR> *attachmentImageInfosOut,
+        VkFramebufferAttachmentsCreateInfoKHR *attachmentsCreateInfoOut,
+        VkFramebufferCreateInfo *createInfoOut) const;
+
+  private:
+    struct AttachmentDesc
+    {
+        VkImageCreateFlags createFlags;
+        VkImageUsageFlags usage;
+        uint32_t width;
+        uint32_t height;
+        uint32_t layerCount;
+        uint32_t viewFormatCount;
+        std::array<VkFormat, kMaxImageViewFormats> viewFormats;
+    };
+
+    size_t getValidSize() const;
+
+    VkRenderPass mRenderPass;
+    uint32_t mWidth;
+    uint32_t mHeight;
+    uint32_t mLayers;
+    uint32_t mAttachmentCount;
+    FramebufferAttachmentArray<AttachmentDesc> mAttachments;
+};
+
 // Disable warnings about struct padding.
 ANGLE_DISABLE_STRUCT_PADDING_WARNINGS
 
@@ -1373,6 +1432,12 @@ struct hash<rx::vk::FramebufferDesc>
     size_t operator()(const rx::vk::FramebufferDesc &key) const { return key.hash(); }
 };
 
+template <>
+struct hash<rx::vk::ImagelessFramebufferDesc>
+{
+    size_t operator()(const rx::vk::ImagelessFramebufferDesc &key) const { return key.hash(); }
+};
+
 template <>
 struct hash<rx::vk::SamplerDesc>
 {
@@ -1504,6 +1569,16 @@ class RenderPassCache final : angle::NonCopyable
                                        const vk::AttachmentOpsArray &attachmentOps,
                                        vk::RenderPass **renderPassOut);
 
+    // The stats since the cache was created.  They are accumulated into the renderer's on destroy.
+    const CacheStats &getCompatibleRenderPassCacheStats() const
+    {
+        return mCompatibleRenderPassCacheStats;
+    }
+    const CacheStats &getRenderPassWithOpsCacheStats() const
+    {
+        return mRenderPassWithOpsCacheStats;
+    }
+
   private:
     angle::Result getRenderPassWithOpsImpl(ContextVk *contextVk,
                                            const vk::RenderPassDesc &desc,
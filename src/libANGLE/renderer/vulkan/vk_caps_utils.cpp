@@ -311,7 +311,7 @@ void RendererVk::ensureCapsInitialized() const
         mQueueFamilyProperties[mCurrentQueueFamilyIndex];
     const VkPhysicalDeviceLimits &limitsVk = mPhysicalDeviceProperties.limits;
 
-    mNativeExtensions.setTextureExtensionSupport(mNativeTextureCaps);
+    mNativeExtensions.setTextureExtensionSupport(*mNativeTextureCaps);
 
     // Enable GL_EXT_buffer_storage
     mNativeExtensions.bufferStorageEXT = true;
@@ -319,7 +319,7 @@ void RendererVk::ensureCapsInitialized() const
     // When ETC2/EAC formats are natively supported, enable ANGLE-specific extension string to
     // expose them to WebGL. In other case, mark potentially-available ETC1 extension as emulated.
     if ((mPhysicalDeviceFeatures.textureCompressionETC2 == VK_TRUE) &&
-        gl::DetermineCompressedTextureETCSupport(mNativeTextureCaps))
+        gl::DetermineCompressedTextureETCSupport(*mNativeTextureCaps))
     {
         mNativeExtensions.compressedTextureETC = true;
     }
@@ -1090,6 +1090,9 @@ void RendererVk::ensureCapsInitialized() const
 
     // GL_EXT_protected_textures
     mNativeExtensions.protectedTexturesEXT = mFeatures.supportsProtectedMemory.enabled;
+
+    // GL_AMD_performance_monitor
+    mNativeExtensions.performanceMonitorAMD = true;
 }
 
 namespace vk
@@ -48,6 +48,9 @@ constexpr VkBufferUsageFlags kLineLoopDynamicIndirectBufferUsage =
     VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
     VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 constexpr int kLineLoopDynamicIndirectBufferInitialSize = sizeof(VkDrawIndirectCommand) * 16;
+// Line loops with up to this many indices are converted on the CPU when the indices can be read
+// without waiting for the GPU, which avoids recording a copy for each of them.
+constexpr GLsizei kLineLoopMaxCPUConversionIndexCount = 256;
 
 constexpr angle::PackedEnumMap<PipelineStage, VkPipelineStageFlagBits> kPipelineStageFlagBitMap = {
     {PipelineStage::TopOfPipe, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT},
@@ -593,6 +596,115 @@ void HandlePrimitiveRestart(ContextVk *contextVk,
     }
 }
 
+uint32_t GetLineLoopIndexCount(ContextVk *contextVk,
+                               gl::DrawElementsType glIndexType,
+                               GLsizei indexCount,
+                               const uint8_t *srcPtr)
+{
+    if (contextVk->getState().isPrimitiveRestartEnabled())
+    {
+        return GetLineLoopWithRestartIndexCount(glIndexType, indexCount, srcPtr);
+    }
+    return indexCount + 1;
+}
+
+// Writes the indices of the line loops, each closed by its first index.
+void WriteLineLoopIndices(ContextVk *contextVk,
+                          gl::DrawElementsType glIndexType,
+                          GLsizei indexCount,
+                          const uint8_t *srcPtr,
+                          uint8_t *indices)
+{
+    if (contextVk->getState().isPrimitiveRestartEnabled())
+    {
+        HandlePrimitiveRestart(contextVk, glIndexType, indexCount, srcPtr, indices);
+    }
+    else if (contextVk->shouldConvertUint8VkIndexType(glIndexType))
+    {
+        // If vulkan doesn't support uint8 index types, we need to emulate it.
+        VkIndexType indexType = contextVk->getVkIndexType(glIndexType);
+        ASSERT(indexType == VK_INDEX_TYPE_UINT16);
+        uint16_t *indicesDst = reinterpret_cast<uint16_t *>(indices);
+        for (int i = 0; i < indexCount; i++)
+        {
+            indicesDst[i] = srcPtr[i];
+        }
+
+        indicesDst[indexCount] = srcPtr[0];
+    }
+    else
+    {
+        size_t unitSize = contextVk->getVkIndexTypeSize(glIndexType);
+        memcpy(indices, srcPtr, unitSize * indexCount);
+        memcpy(indices + unitSize * indexCount, srcPtr, unitSize);
+    }
+}
+
+angle::Result ConvertLineLoopIndicesOnCPU(ContextVk *contextVk,
+                                          BufferVk *elementArrayBufferVk,
+                                          const LineLoopConversionKey &key,
+                                          LineLoopConversion *conversionOut)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "LineLoopHelper::getIndexBufferForElementArrayBuffer");
+
+    gl::DrawElementsType glIndexType = key.getIndexType();
+    GLsizei indexCount               = static_cast<GLsizei>(key.indexCount);
+
+    void *srcDataMapping = nullptr;
+    ANGLE_TRY(elementArrayBufferVk->mapImpl(contextVk, &srcDataMapping));
+    const uint8_t *srcPtr = static_cast<const uint8_t *>(srcDataMapping) + key.offset;
+
+    uint32_t numOutIndices = GetLineLoopIndexCount(contextVk, glIndexType, indexCount, srcPtr);
+    size_t allocateBytes   = contextVk->getVkIndexTypeSize(glIndexType) * numOutIndices;
+
+    uint8_t *indices = nullptr;
+    ANGLE_TRY(elementArrayBufferVk->allocateLineLoopConversion(contextVk, key, allocateBytes,
+                                                               numOutIndices, &indices,
+                                                               conversionOut));
+    WriteLineLoopIndices(contextVk, glIndexType, indexCount, srcPtr, indices);
+
+    ANGLE_TRY(elementArrayBufferVk->unmapImpl(contextVk));
+    return elementArrayBufferVk->flushLineLoopConversions(contextVk);
+}
+
+angle::Result ConvertLineLoopIndicesOnGPU(ContextVk *contextVk,
+                                          BufferVk *elementArrayBufferVk,
+                                          const LineLoopConversionKey &key,
+                                          LineLoopConversion *conversionOut)
+{
+    size_t unitSize      = contextVk->getVkIndexTypeSize(key.getIndexType());
+    size_t allocateBytes = unitSize * (key.indexCount + 1) + 1;
+
+    ANGLE_TRY(elementArrayBufferVk->allocateLineLoopConversion(
+        contextVk, key, allocateBytes, key.indexCount + 1, nullptr, conversionOut));
+    BufferHelper *destBuffer = conversionOut->buffer;
+    VkDeviceSize destOffset  = conversionOut->offset;
+
+    VkDeviceSize sourceBufferOffset = 0;
+    BufferHelper *sourceBuffer = &elementArrayBufferVk->getBufferAndOffset(&sourceBufferOffset);
+
+    VkDeviceSize sourceOffset = key.offset + sourceBufferOffset;
+    uint64_t unitCount        = static_cast<VkDeviceSize>(key.indexCount);
+    angle::FixedVector<VkBufferCopy, 3> copies = {
+        {sourceOffset, destOffset, unitCount * unitSize},
+        {sourceOffset, destOffset + unitCount * unitSize, unitSize},
+    };
+    if (contextVk->getRenderer()->getFeatures().extraCopyBufferRegion.enabled)
+        copies.push_back({sourceOffset, destOffset + (unitCount + 1) * unitSize, 1});
+
+    vk::CommandBufferAccess access;
+    access.onBufferTransferWrite(destBuffer);
+    access.onBufferTransferRead(sourceBuffer);
+
+    vk::CommandBuffer *commandBuffer;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
+
+    commandBuffer->copyBuffer(sourceBuffer->getBuffer(), destBuffer->getBuffer(),
+                              static_cast<uint32_t>(copies.size()), copies.data());
+
+    return elementArrayBufferVk->flushLineLoopConversions(contextVk);
+}
+
 bool HasBothDepthAndStencilAspects(VkImageAspectFlags aspectFlags)
 {
     return IsMaskFlagSet(aspectFlags, kDepthStencilAspects);
@@ -951,6 +1063,7 @@ void CommandBufferHelper::reset()
         mColorImages.reset();
         mColorResolveImages.reset();
         mImageOptimizeForPresent = nullptr;
+        mImagelessAttachments.clear();
     }
     // This state should never change for non-renderPass command buffer
     ASSERT(mRenderPassStarted == false);
@@ -1578,14 +1691,16 @@ void CommandBufferHelper::finalizeDepthStencilImageLayoutAndLoadStore(Context *c
     mDepthStencilImage->resetRenderPassUsageFlags();
 }
 
-void CommandBufferHelper::beginRenderPass(const Framebuffer &framebuffer,
-                                          const gl::Rectangle &renderArea,
-                                          const RenderPassDesc &renderPassDesc,
-                                          const AttachmentOpsArray &renderPassAttachmentOps,
-                                          const vk::PackedAttachmentCount colorAttachmentCount,
-                                          const PackedAttachmentIndex depthStencilAttachmentIndex,
-                                          const PackedClearValuesArray &clearValues,
-                                          CommandBuffer **commandBufferOut)
+void CommandBufferHelper::beginRenderPass(
+    const Framebuffer &framebuffer,
+    const FramebufferAttachmentsVector<VkImageView> &imagelessAttachments,
+    const gl::Rectangle &renderArea,
+    const RenderPassDesc &renderPassDesc,
+    const AttachmentOpsArray &renderPassAttachmentOps,
+    const vk::PackedAttachmentCount colorAttachmentCount,
+    const PackedAttachmentIndex depthStencilAttachmentIndex,
+    const PackedClearValuesArray &clearValues,
+    CommandBuffer **commandBufferOut)
 {
     ASSERT(mIsRenderPassCommandBuffer);
     ASSERT(empty());
@@ -1595,7 +1710,8 @@ void CommandBufferHelper::beginRenderPass(const Framebuffer &framebuffer,
     mDepthStencilAttachmentIndex = depthStencilAttachmentIndex;
     mColorImagesCount            = colorAttachmentCount;
     mFramebuffer.setHandle(framebuffer.getHandle());
-    mRenderArea       = renderArea;
+    mImagelessAttachments = imagelessAttachments;
+    mRenderArea           = renderArea;
     mClearValues      = clearValues;
     *commandBufferOut = &mCommandBuffer;
 
@@ -1720,6 +1836,18 @@ angle::Result CommandBufferHelper::flushToPrimary(const angle::FeaturesVk &featu
         beginInfo.clearValueCount = static_cast<uint32_t>(mRenderPassDesc.attachmentCount());
         beginInfo.pClearValues    = mClearValues.data();
 
+        // Imageless framebuffers receive their attachments now.
+        VkRenderPassAttachmentBeginInfoKHR attachmentBeginInfo = {};
+        if (!mImagelessAttachments.empty())
+        {
+            attachmentBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO_KHR;
+            attachmentBeginInfo.attachmentCount =
+                static_cast<uint32_t>(mImagelessAttachments.size());
+            attachmentBeginInfo.pAttachments = mImagelessAttachments.data();
+
+            AddToPNextChain(&beginInfo, &attachmentBeginInfo);
+        }
+
         // Run commands inside the RenderPass.
         primary->beginRenderPass(beginInfo, VK_SUBPASS_CONTENTS_INLINE);
         mCommandBuffer.executeCommands(primary->getHandle());
@@ -1736,13 +1864,16 @@ angle::Result CommandBufferHelper::flushToPrimary(const angle::FeaturesVk &featu
     return angle::Result::Continue;
 }
 
-void CommandBufferHelper::updateRenderPassForResolve(ContextVk *contextVk,
-                                                     Framebuffer *newFramebuffer,
-                                                     const RenderPassDesc &renderPassDesc)
+void CommandBufferHelper::updateRenderPassForResolve(
+    ContextVk *contextVk,
+    Framebuffer *newFramebuffer,
+    const FramebufferAttachmentsVector<VkImageView> &newImagelessAttachments,
+    const RenderPassDesc &renderPassDesc)
 {
     ASSERT(newFramebuffer);
     mFramebuffer.setHandle(newFramebuffer->getHandle());
-    mRenderPassDesc = renderPassDesc;
+    mImagelessAttachments = newImagelessAttachments;
+    mRenderPassDesc       = renderPassDesc;
 }
 
 // Helper functions used below
@@ -3126,55 +3257,41 @@ angle::Result LineLoopHelper::getIndexBufferForElementArrayBuffer(ContextVk *con
                                                                   VkDeviceSize *bufferOffsetOut,
                                                                   uint32_t *indexCountOut)
 {
-    if (glIndexType == gl::DrawElementsType::UnsignedByte ||
-        contextVk->getState().isPrimitiveRestartEnabled())
-    {
-        ANGLE_TRACE_EVENT0("gpu.angle", "LineLoopHelper::getIndexBufferForElementArrayBuffer");
+    // Readbacks into the buffer must land before its indices are converted.
+    ANGLE_TRY(elementArrayBufferVk->flushPendingPackPixels(contextVk));
 
-        void *srcDataMapping = nullptr;
-        ANGLE_TRY(elementArrayBufferVk->mapImpl(contextVk, &srcDataMapping));
-        ANGLE_TRY(streamIndices(contextVk, glIndexType, indexCount,
-                                static_cast<const uint8_t *>(srcDataMapping) + elementArrayOffset,
-                                bufferOut, bufferOffsetOut, indexCountOut));
-        ANGLE_TRY(elementArrayBufferVk->unmapImpl(contextVk));
-        return angle::Result::Continue;
-    }
+    // The conversions are cached in the element array buffer until its indices change, so the same
+    // line loops drawn again are not converted again.
+    const bool primitiveRestart = contextVk->getState().isPrimitiveRestartEnabled();
+    const LineLoopConversionKey key(glIndexType, static_cast<uint32_t>(indexCount),
+                                    static_cast<VkDeviceSize>(elementArrayOffset),
+                                    primitiveRestart);
 
-    *indexCountOut = indexCount + 1;
-
-    uint32_t *indices    = nullptr;
-    size_t unitSize      = contextVk->getVkIndexTypeSize(glIndexType);
-    size_t allocateBytes = unitSize * (indexCount + 1) + 1;
-
-    mDynamicIndexBuffer.releaseInFlightBuffers(contextVk);
-    ANGLE_TRY(mDynamicIndexBuffer.allocate(contextVk, allocateBytes,
-                                           reinterpret_cast<uint8_t **>(&indices), nullptr,
-                                           bufferOffsetOut, nullptr));
-    *bufferOut = mDynamicIndexBuffer.getCurrentBuffer();
-
-    VkDeviceSize sourceBufferOffset = 0;
-    BufferHelper *sourceBuffer = &elementArrayBufferVk->getBufferAndOffset(&sourceBufferOffset);
-
-    VkDeviceSize sourceOffset = static_cast<VkDeviceSize>(elementArrayOffset) + sourceBufferOffset;
-    uint64_t unitCount        = static_cast<VkDeviceSize>(indexCount);
-    angle::FixedVector<VkBufferCopy, 3> copies = {
-        {sourceOffset, *bufferOffsetOut, unitCount * unitSize},
-        {sourceOffset, *bufferOffsetOut + unitCount * unitSize, unitSize},
-    };
-    if (contextVk->getRenderer()->getFeatures().extraCopyBufferRegion.enabled)
-        copies.push_back({sourceOffset, *bufferOffsetOut + (unitCount + 1) * unitSize, 1});
-
-    vk::CommandBufferAccess access;
-    access.onBufferTransferWrite(*bufferOut);
-    access.onBufferTransferRead(sourceBuffer);
-
-    vk::CommandBuffer *commandBuffer;
-    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
-
-    commandBuffer->copyBuffer(sourceBuffer->getBuffer(), (*bufferOut)->getBuffer(),
-                              static_cast<uint32_t>(copies.size()), copies.data());
+    const LineLoopConversion *cachedConversion = elementArrayBufferVk->getLineLoopConversion(key);
+    LineLoopConversion conversion;
+    if (cachedConversion != nullptr)
+    {
+        conversion = *cachedConversion;
+    }
+    else
+    {
+        if (glIndexType == gl::DrawElementsType::UnsignedByte || primitiveRestart ||
+            (indexCount <= kLineLoopMaxCPUConversionIndexCount &&
+             elementArrayBufferVk->isReadableWithoutWait(contextVk)))
+        {
+            ANGLE_TRY(ConvertLineLoopIndicesOnCPU(contextVk, elementArrayBufferVk, key,
+                                                  &conversion));
+        }
+        else
+        {
+            ANGLE_TRY(ConvertLineLoopIndicesOnGPU(contextVk, elementArrayBufferVk, key,
+                                                  &conversion));
+        }
+    }
 
-    ANGLE_TRY(mDynamicIndexBuffer.flush(contextVk));
+    *bufferOut       = conversion.buffer;
+    *bufferOffsetOut = conversion.offset;
+    *indexCountOut   = conversion.indexCount;
     return angle::Result::Continue;
 }
 
@@ -3190,43 +3307,15 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
 
     uint8_t *indices = nullptr;
 
-    uint32_t numOutIndices = indexCount + 1;
-    if (contextVk->getState().isPrimitiveRestartEnabled())
-    {
-        numOutIndices = GetLineLoopWithRestartIndexCount(glIndexType, indexCount, srcPtr);
-    }
-    *indexCountOut       = numOutIndices;
-    size_t allocateBytes = unitSize * numOutIndices;
+    uint32_t numOutIndices = GetLineLoopIndexCount(contextVk, glIndexType, indexCount, srcPtr);
+    *indexCountOut         = numOutIndices;
+    size_t allocateBytes   = unitSize * numOutIndices;
     ANGLE_TRY(mDynamicIndexBuffer.allocate(contextVk, allocateBytes,
                                            reinterpret_cast<uint8_t **>(&indices), nullptr,
                                            bufferOffsetOut, nullptr));
     *bufferOut = mDynamicIndexBuffer.getCurrentBuffer();
 
-    if (contextVk->getState().isPrimitiveRestartEnabled())
-    {
-        HandlePrimitiveRestart(contextVk, glIndexType, indexCount, srcPtr, indices);
-    }
-    else
-    {
-        if (contextVk->shouldConvertUint8VkIndexType(glIndexType))
-        {
-            // If vulkan doesn't support uint8 index types, we need to emulate it.
-            VkIndexType indexType = contextVk->getVkIndexType(glIndexType);
-            ASSERT(indexType == VK_INDEX_TYPE_UINT16);
-            uint16_t *indicesDst = reinterpret_cast<uint16_t *>(indices);
-            for (int i = 0; i < indexCount; i++)
-            {
-                indicesDst[i] = srcPtr[i];
-            }
-
-            indicesDst[indexCount] = srcPtr[0];
-        }
-        else
-        {
-            memcpy(indices, srcPtr, unitSize * indexCount);
-            memcpy(indices + unitSize * indexCount, srcPtr, unitSize);
-        }
-    }
+    WriteLineLoopIndices(contextVk, glIndexType, indexCount, srcPtr, indices);
 
     ANGLE_TRY(mDynamicIndexBuffer.flush(contextVk));
     return angle::Result::Continue;
@@ -3375,7 +3464,9 @@ BufferHelper::BufferHelper()
       mSerial()
 {}
 
-BufferMemory::BufferMemory() : mClientBuffer(nullptr), mMappedMemory(nullptr) {}
+BufferMemory::BufferMemory()
+    : mClientBuffer(nullptr), mHostMemory(nullptr), mMappedMemory(nullptr)
+{}
 
 BufferMemory::~BufferMemory() = default;
 
@@ -3386,15 +3477,24 @@ angle::Result BufferMemory::initExternal(GLeglClientBufferEXT clientBuffer)
     return angle::Result::Continue;
 }
 
+angle::Result BufferMemory::initExternalHost(void *hostPtr)
+{
+    ASSERT(hostPtr != nullptr);
+    mHostMemory   = static_cast<uint8_t *>(hostPtr);
+    mMappedMemory = mHostMemory;
+    return angle::Result::Continue;
+}
+
 angle::Result BufferMemory::init()
 {
-    ASSERT(mClientBuffer == nullptr);
+    ASSERT(mClientBuffer == nullptr && mHostMemory == nullptr);
     return angle::Result::Continue;
 }
 
 void BufferMemory::unmap(RendererVk *renderer)
 {
-    if (mMappedMemory != nullptr)
+    // Imported host memory isn't mapped through Vulkan.
+    if (mMappedMemory != nullptr && mHostMemory == nullptr)
     {
         if (isExternalBuffer())
         {
@@ -3404,9 +3504,8 @@ void BufferMemory::unmap(RendererVk *renderer)
         {
             mAllocation.unmap(renderer->getAllocator());
         }
-
-        mMappedMemory = nullptr;
     }
+    mMappedMemory = nullptr;
 }
 
 void BufferMemory::destroy(RendererVk *renderer)
@@ -3414,7 +3513,11 @@ void BufferMemory::destroy(RendererVk *renderer)
     if (isExternalBuffer())
     {
         mExternalMemory.destroy(renderer->getDevice());
-        ReleaseAndroidExternalMemory(renderer, mClientBuffer);
+        if (mClientBuffer != nullptr)
+        {
+            ReleaseAndroidExternalMemory(renderer, mClientBuffer);
+        }
+        mHostMemory = nullptr;
     }
     else
     {
@@ -3470,17 +3573,21 @@ void BufferMemory::invalidate(RendererVk *renderer,
     }
 }
 
-angle::Result BufferMemory::mapImpl(ContextVk *contextVk, VkDeviceSize size)
+angle::Result BufferMemory::mapImpl(Context *context, VkDeviceSize size)
 {
-    if (isExternalBuffer())
+    if (mHostMemory != nullptr)
+    {
+        mMappedMemory = mHostMemory;
+    }
+    else if (isExternalBuffer())
     {
-        ANGLE_VK_TRY(contextVk, mExternalMemory.map(contextVk->getRenderer()->getDevice(), 0, size,
-                                                    0, &mMappedMemory));
+        ANGLE_VK_TRY(context, mExternalMemory.map(context->getRenderer()->getDevice(), 0, size, 0,
+                                                  &mMappedMemory));
     }
     else
     {
-        ANGLE_VK_TRY(contextVk,
-                     mAllocation.map(contextVk->getRenderer()->getAllocator(), &mMappedMemory));
+        ANGLE_VK_TRY(context,
+                     mAllocation.map(context->getRenderer()->getAllocator(), &mMappedMemory));
     }
 
     return angle::Result::Continue;
@@ -3488,11 +3595,11 @@ angle::Result BufferMemory::mapImpl(ContextVk *contextVk, VkDeviceSize size)
 
 BufferHelper::~BufferHelper() = default;
 
-angle::Result BufferHelper::init(ContextVk *contextVk,
+angle::Result BufferHelper::init(Context *context,
                                  const VkBufferCreateInfo &requestedCreateInfo,
                                  VkMemoryPropertyFlags memoryPropertyFlags)
 {
-    RendererVk *renderer = contextVk->getRenderer();
+    RendererVk *renderer = context->getRenderer();
 
     mSerial = renderer->getResourceSerialFactory().generateBufferSerial();
     mSize   = requestedCreateInfo.size;
@@ -3519,18 +3626,18 @@ angle::Result BufferHelper::init(ContextVk *contextVk,
 
     // Check that the allocation is not too large.
     uint32_t memoryTypeIndex = 0;
-    ANGLE_VK_TRY(contextVk, allocator.findMemoryTypeIndexForBufferInfo(
-                                *createInfo, requiredFlags, preferredFlags, persistentlyMapped,
-                                &memoryTypeIndex));
+    ANGLE_VK_TRY(context, allocator.findMemoryTypeIndexForBufferInfo(
+                              *createInfo, requiredFlags, preferredFlags, persistentlyMapped,
+                              &memoryTypeIndex));
 
     VkDeviceSize heapSize =
         renderer->getMemoryProperties().getHeapSizeForMemoryType(memoryTypeIndex);
 
-    ANGLE_VK_CHECK(contextVk, createInfo->size <= heapSize, VK_ERROR_OUT_OF_DEVICE_MEMORY);
+    ANGLE_VK_CHECK(context, createInfo->size <= heapSize, VK_ERROR_OUT_OF_DEVICE_MEMORY);
 
-    ANGLE_VK_TRY(contextVk, allocator.createBuffer(*createInfo, requiredFlags, preferredFlags,
-                                                   persistentlyMapped, &memoryTypeIndex, &mBuffer,
-                                                   mMemory.getMemoryObject()));
+    ANGLE_VK_TRY(context, allocator.createBuffer(*createInfo, requiredFlags, preferredFlags,
+                                                 persistentlyMapped, &memoryTypeIndex, &mBuffer,
+                                                 mMemory.getMemoryObject()));
     allocator.getMemoryTypeProperties(memoryTypeIndex, &mMemoryPropertyFlags);
     mCurrentQueueFamilyIndex = renderer->getQueueFamilyIndex();
 
@@ -3542,14 +3649,14 @@ angle::Result BufferHelper::init(ContextVk *contextVk,
         if ((mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == 0 &&
             (requestedCreateInfo.usage & VK_BUFFER_USAGE_TRANSFER_DST_BIT) != 0)
         {
-            ANGLE_TRY(initializeNonZeroMemory(contextVk, createInfo->size));
+            ANGLE_TRY(initializeNonZeroMemory(context, createInfo->size));
         }
         else if ((mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0)
         {
             // Can map the memory.
             // Pick an arbitrary value to initialize non-zero memory for sanitization.
             constexpr int kNonZeroInitValue = 55;
-            ANGLE_TRY(InitMappableAllocation(contextVk, allocator, mMemory.getMemoryObject(), mSize,
+            ANGLE_TRY(InitMappableAllocation(context, allocator, mMemory.getMemoryObject(), mSize,
                                              kNonZeroInitValue, mMemoryPropertyFlags));
         }
     }
@@ -3591,6 +3698,63 @@ angle::Result BufferHelper::initExternal(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result BufferHelper::initExternalHost(Context *context,
+                                             VkMemoryPropertyFlags memoryProperties,
+                                             const VkBufferCreateInfo &requestedCreateInfo,
+                                             void *hostPtr)
+{
+    RendererVk *renderer = context->getRenderer();
+    VkDevice device      = renderer->getDevice();
+    ASSERT(renderer->getFeatures().supportsExternalMemoryHost.enabled);
+
+    const VkDeviceSize alignment = renderer->getMinImportedHostPointerAlignment();
+    ASSERT(reinterpret_cast<uintptr_t>(hostPtr) % alignment == 0);
+    ASSERT(requestedCreateInfo.size % alignment == 0);
+
+    mSerial = renderer->getResourceSerialFactory().generateBufferSerial();
+    mSize   = requestedCreateInfo.size;
+
+    VkBufferCreateInfo modifiedCreateInfo             = requestedCreateInfo;
+    VkExternalMemoryBufferCreateInfo externCreateInfo = {};
+    externCreateInfo.sType       = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+    externCreateInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+    externCreateInfo.pNext       = nullptr;
+    modifiedCreateInfo.pNext     = &externCreateInfo;
+
+    ANGLE_VK_TRY(context, mBuffer.init(device, modifiedCreateInfo));
+
+    VkMemoryHostPointerPropertiesEXT hostPointerProperties = {};
+    hostPointerProperties.sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
+    ANGLE_VK_TRY(context, vkGetMemoryHostPointerPropertiesEXT(
+                              device, VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT,
+                              hostPtr, &hostPointerProperties));
+
+    // The memory type has to suit both the buffer and the host pointer, and the whole allocation
+    // has to be backed by the host memory.
+    VkMemoryRequirements memoryRequirements;
+    mBuffer.getMemoryRequirements(device, &memoryRequirements);
+    memoryRequirements.memoryTypeBits &= hostPointerProperties.memoryTypeBits;
+    memoryRequirements.size = roundUp(memoryRequirements.size, alignment);
+    ANGLE_VK_CHECK(context, memoryRequirements.size <= requestedCreateInfo.size,
+                   VK_ERROR_INVALID_EXTERNAL_HANDLE);
+
+    VkImportMemoryHostPointerInfoEXT importMemoryHostPointerInfo = {};
+    importMemoryHostPointerInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
+    importMemoryHostPointerInfo.pNext = nullptr;
+    importMemoryHostPointerInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+    importMemoryHostPointerInfo.pHostPointer = hostPtr;
+
+    ANGLE_TRY(AllocateBufferMemoryWithRequirements(
+        context, memoryProperties, memoryRequirements, &importMemoryHostPointerInfo, &mBuffer,
+        &mMemoryPropertyFlags, mMemory.getExternalMemoryObject()));
+
+    ANGLE_TRY(mMemory.initExternalHost(hostPtr));
+
+    mCurrentQueueFamilyIndex = renderer->getQueueFamilyIndex();
+
+    return angle::Result::Continue;
+}
+
 angle::Result BufferHelper::initializeNonZeroMemory(Context *context, VkDeviceSize size)
 {
     // Staging buffer memory is non-zero-initialized in 'init'.
@@ -3636,10 +3800,11 @@ void BufferHelper::destroy(RendererVk *renderer)
 void BufferHelper::release(RendererVk *renderer)
 {
     unmap(renderer);
-    mSize = 0;
 
-    renderer->collectGarbageAndReinit(&mUse, &mBuffer, mMemory.getExternalMemoryObject(),
-                                      mMemory.getMemoryObject());
+    renderer->collectMemoryGarbageAndReinit(&mUse, mSize, &mBuffer,
+                                            mMemory.getExternalMemoryObject(),
+                                            mMemory.getMemoryObject());
+    mSize = 0;
 }
 
 angle::Result BufferHelper::copyFromBuffer(ContextVk *contextVk,
@@ -3797,10 +3962,12 @@ ImageHelper::ImageHelper(ImageHelper &&other)
     : Resource(std::move(other)),
       mImage(std::move(other.mImage)),
       mDeviceMemory(std::move(other.mDeviceMemory)),
+      mAllocationSize(other.mAllocationSize),
       mImageType(other.mImageType),
       mTilingMode(other.mTilingMode),
       mCreateFlags(other.mCreateFlags),
       mUsage(other.mUsage),
+      mViewFormats(other.mViewFormats),
       mExtents(other.mExtents),
       mRotatedAspectRatio(other.mRotatedAspectRatio),
       mIntendedFormatID(other.mIntendedFormatID),
@@ -3833,6 +4000,7 @@ ImageHelper::~ImageHelper()
 
 void ImageHelper::resetCachedProperties()
 {
+    mAllocationSize              = 0;
     mImageType                   = VK_IMAGE_TYPE_2D;
     mTilingMode                  = VK_IMAGE_TILING_OPTIMAL;
     mCreateFlags                 = kVkImageCreateFlagsNone;
@@ -3851,6 +4019,7 @@ void ImageHelper::resetCachedProperties()
     mLayerCount                  = 0;
     mLevelCount                  = 0;
     mExternalFormat              = 0;
+    mViewFormats.clear();
     mCurrentSingleClearValue.reset();
     mRenderPassUsageFlags.reset();
 
@@ -4021,6 +4190,7 @@ angle::Result ImageHelper::initExternal(Context *context,
     mLayerCount          = layerCount;
     mCreateFlags         = GetImageCreateFlags(textureType) | additionalCreateFlags;
     mUsage               = usage;
+    mViewFormats.clear();
 
     // Validate that mLayerCount is compatible with the texture type
     ASSERT(textureType != gl::TextureType::_3D || mLayerCount == 1);
@@ -4058,6 +4228,9 @@ angle::Result ImageHelper::initExternal(Context *context,
         imageFormatListInfo.pNext           = externalImageCreateInfo;
         imageFormatListInfo.viewFormatCount = kImageListFormatCount;
         imageFormatListInfo.pViewFormats    = imageListFormats;
+
+        mViewFormats.push_back(imageListFormats[0]);
+        mViewFormats.push_back(imageListFormats[1]);
     }
 
     if (imageFormatListEnabledOut)
@@ -4141,8 +4314,9 @@ angle::Result ImageHelper::initExternal(Context *context,
 
 void ImageHelper::releaseImage(RendererVk *renderer)
 {
-    renderer->collectGarbageAndReinit(&mUse, &mImage, &mDeviceMemory);
-    mImageSerial = kInvalidImageSerial;
+    renderer->collectMemoryGarbageAndReinit(&mUse, mAllocationSize, &mImage, &mDeviceMemory);
+    mAllocationSize = 0;
+    mImageSerial    = kInvalidImageSerial;
 
     setEntireContentUndefined();
 }
@@ -4313,6 +4487,7 @@ angle::Result ImageHelper::initMemory(Context *context,
         flags |= VK_MEMORY_PROPERTY_PROTECTED_BIT;
     }
     ANGLE_TRY(AllocateImageMemory(context, flags, &flags, nullptr, &mImage, &mDeviceMemory, &size));
+    mAllocationSize          = size;
     mCurrentQueueFamilyIndex = context->getRenderer()->getQueueFamilyIndex();
 
     RendererVk *renderer = context->getRenderer();
@@ -4340,6 +4515,7 @@ angle::Result ImageHelper::initExternalMemory(
     // TODO(jmadill): Memory sub-allocation. http://anglebug.com/2162
     ANGLE_TRY(AllocateImageMemoryWithRequirements(context, flags, memoryRequirements,
                                                   extraAllocationInfo, &mImage, &mDeviceMemory));
+    mAllocationSize          = memoryRequirements.size;
     mCurrentQueueFamilyIndex = currentQueueFamilyIndex;
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
@@ -4458,6 +4634,19 @@ angle::Result ImageHelper::initLayerImageViewImpl(
     viewInfo.subresourceRange.baseArrayLayer = baseArrayLayer;
     viewInfo.subresourceRange.layerCount     = layerCount;
 
+    // If the image was created with usages that its own format doesn't support, the view must be
+    // limited to the usages that the view format supports.
+    VkImageViewUsageCreateInfo extendedImageViewUsageCreateInfo = {};
+    if (imageViewUsageCreateInfo == nullptr &&
+        (mCreateFlags & VK_IMAGE_CREATE_EXTENDED_USAGE_BIT) != 0)
+    {
+        extendedImageViewUsageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO;
+        extendedImageViewUsageCreateInfo.usage =
+            mUsage & GetMaximalImageUsageFlags(context->getRenderer(),
+                                               GetFormatIDFromVkFormat(imageFormat));
+        imageViewUsageCreateInfo = &extendedImageViewUsageCreateInfo;
+    }
+
     viewInfo.pNext = imageViewUsageCreateInfo;
 
     VkSamplerYcbcrConversionInfo yuvConversionInfo = {};
@@ -4509,6 +4698,7 @@ void ImageHelper::destroy(RendererVk *renderer)
 
     mImage.destroy(device);
     mDeviceMemory.destroy(device);
+    mAllocationSize = 0;
     mStagingBuffer.destroy(renderer);
     mCurrentLayout = ImageLayout::Undefined;
     mImageType     = VK_IMAGE_TYPE_2D;
@@ -6138,8 +6328,10 @@ void ImageHelper::stageSelfAsSubresourceUpdates(ContextVk *contextVk,
     // object.
 
     // Vulkan objects
-    prevImage->get().mImage        = std::move(mImage);
-    prevImage->get().mDeviceMemory = std::move(mDeviceMemory);
+    prevImage->get().mImage          = std::move(mImage);
+    prevImage->get().mDeviceMemory   = std::move(mDeviceMemory);
+    prevImage->get().mAllocationSize = mAllocationSize;
+    mAllocationSize                  = 0;
 
     // Barrier information.  Note: mLevelCount is set to levelCount so that only the necessary
     // levels are transitioned when flushing the update.
@@ -6983,6 +7175,23 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
 
     ASSERT(!hasStagedUpdatesForSubresource(levelGL, layer, 1));
 
+    const angle::Format *readFormat = &getActualFormat();
+
+    if (copyAspectFlags != VK_IMAGE_ASPECT_COLOR_BIT)
+    {
+        readFormat = &GetDepthStencilImageToBufferFormat(*readFormat, copyAspectFlags);
+    }
+
+    // If PBO and if possible, the pixels are copied directly on the GPU.  The readbacks into the
+    // PBO that are pending conversion on the CPU must be packed before, so they don't overwrite
+    // the copy.
+    const bool copyToPackBuffer = packPixelsParams.packBuffer &&
+                                  canCopyWithTransformForReadPixels(packPixelsParams, readFormat);
+    if (copyToPackBuffer)
+    {
+        ANGLE_TRY(GetImpl(packPixelsParams.packBuffer)->flushPendingPackPixels(contextVk));
+    }
+
     if (isMultisampled)
     {
         ANGLE_TRY(resolvedImage.get().init2DStaging(
@@ -7006,13 +7215,6 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
     CommandBuffer *commandBuffer;
     ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
 
-    const angle::Format *readFormat = &getActualFormat();
-
-    if (copyAspectFlags != VK_IMAGE_ASPECT_COLOR_BIT)
-    {
-        readFormat = &GetDepthStencilImageToBufferFormat(*readFormat, copyAspectFlags);
-    }
-
     VkOffset3D srcOffset = {area.x, area.y, 0};
 
     VkImageSubresourceLayers srcSubresource = {};
@@ -7060,9 +7262,7 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
         srcSubresource.mipLevel       = 0;
     }
 
-    // If PBO and if possible, copy directly on the GPU.
-    if (packPixelsParams.packBuffer &&
-        canCopyWithTransformForReadPixels(packPixelsParams, readFormat))
+    if (copyToPackBuffer)
     {
         VkDeviceSize packBufferOffset = 0;
         BufferHelper &packBuffer =
@@ -7096,17 +7296,42 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
     VkDeviceSize stagingOffset = 0;
     size_t allocationSize      = readFormat->pixelBytes * area.width * area.height;
 
-    ANGLE_TRY(stagingBuffer->allocate(contextVk, allocationSize, &readPixelBuffer, &bufferHandle,
-                                      &stagingOffset, nullptr));
-
     VkBufferImageCopy region = {};
     region.bufferImageHeight = srcExtent.height;
-    region.bufferOffset      = stagingOffset;
     region.bufferRowLength   = srcExtent.width;
     region.imageExtent       = srcExtent;
     region.imageOffset       = srcOffset;
     region.imageSubresource  = srcSubresource;
 
+    if (packPixelsParams.packBuffer)
+    {
+        // The pixels need a conversion on the CPU.  Copy them into staging memory owned by the PBO
+        // without waiting for the GPU, and pack them once the PBO is next accessed.
+        BufferHelper *packStagingBuffer = nullptr;
+        ANGLE_TRY(GetImpl(packPixelsParams.packBuffer)
+                      ->deferPackPixels(contextVk, allocationSize, packPixelsParams, *readFormat,
+                                        area.width * readFormat->pixelBytes,
+                                        reinterpret_cast<ptrdiff_t>(pixels), &packStagingBuffer,
+                                        &region.bufferOffset));
+
+        CommandBufferAccess packStagingAccess;
+        packStagingAccess.onBufferTransferWrite(packStagingBuffer);
+
+        CommandBuffer *packStagingCommandBuffer;
+        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(packStagingAccess,
+                                                               &packStagingCommandBuffer));
+
+        packStagingCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(),
+                                                    packStagingBuffer->getBuffer().getHandle(), 1,
+                                                    &region);
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(stagingBuffer->allocate(contextVk, allocationSize, &readPixelBuffer, &bufferHandle,
+                                      &stagingOffset, nullptr));
+
+    region.bufferOffset = stagingOffset;
+
     CommandBufferAccess readbackAccess;
     readbackAccess.onBufferTransferWrite(stagingBuffer->getCurrentBuffer());
 
@@ -7127,22 +7352,8 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
     // created with the host coherent bit.
     ANGLE_TRY(stagingBuffer->invalidate(contextVk));
 
-    if (packPixelsParams.packBuffer)
-    {
-        // Must map the PBO in order to read its contents (and then unmap it later)
-        BufferVk *packBufferVk = GetImpl(packPixelsParams.packBuffer);
-        void *mapPtr           = nullptr;
-        ANGLE_TRY(packBufferVk->mapImpl(contextVk, &mapPtr));
-        uint8_t *dest = static_cast<uint8_t *>(mapPtr) + reinterpret_cast<ptrdiff_t>(pixels);
-        PackPixels(packPixelsParams, *readFormat, area.width * readFormat->pixelBytes,
-                   readPixelBuffer, static_cast<uint8_t *>(dest));
-        ANGLE_TRY(packBufferVk->unmapImpl(contextVk));
-    }
-    else
-    {
-        PackPixels(packPixelsParams, *readFormat, area.width * readFormat->pixelBytes,
-                   readPixelBuffer, static_cast<uint8_t *>(pixels));
-    }
+    PackPixels(packPixelsParams, *readFormat, area.width * readFormat->pixelBytes, readPixelBuffer,
+               static_cast<uint8_t *>(pixels));
 
     return angle::Result::Continue;
 }
@@ -7374,6 +7585,7 @@ angle::Result FramebufferHelper::init(ContextVk *contextVk,
                                       const VkFramebufferCreateInfo &createInfo)
 {
     ANGLE_VK_TRY(contextVk, mFramebuffer.init(contextVk->getDevice(), createInfo));
+    contextVk->getPerfCounters().framebufferCreations++;
     return angle::Result::Continue;
 }
 
@@ -14,6 +14,8 @@
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
 
+#include <atomic>
+
 namespace gl
 {
 class ImageIndex;
@@ -806,15 +808,17 @@ class BufferMemory : angle::NonCopyable
     BufferMemory();
     ~BufferMemory();
     angle::Result initExternal(GLeglClientBufferEXT clientBuffer);
+    // Imported host memory belongs to the application, and is mapped at its own address.
+    angle::Result initExternalHost(void *hostPtr);
     angle::Result init();
 
     void destroy(RendererVk *renderer);
 
-    angle::Result map(ContextVk *contextVk, VkDeviceSize size, uint8_t **ptrOut)
+    angle::Result map(Context *context, VkDeviceSize size, uint8_t **ptrOut)
     {
         if (mMappedMemory == nullptr)
         {
-            ANGLE_TRY(mapImpl(contextVk, size));
+            ANGLE_TRY(mapImpl(context, size));
         }
         *ptrOut = mMappedMemory;
         return angle::Result::Continue;
@@ -829,19 +833,20 @@ class BufferMemory : angle::NonCopyable
                     VkDeviceSize offset,
                     VkDeviceSize size);
 
-    bool isExternalBuffer() const { return mClientBuffer != nullptr; }
+    bool isExternalBuffer() const { return mClientBuffer != nullptr || mHostMemory != nullptr; }
 
     uint8_t *getMappedMemory() const { return mMappedMemory; }
     DeviceMemory *getExternalMemoryObject() { return &mExternalMemory; }
     Allocation *getMemoryObject() { return &mAllocation; }
 
   private:
-    angle::Result mapImpl(ContextVk *contextVk, VkDeviceSize size);
+    angle::Result mapImpl(Context *context, VkDeviceSize size);
 
     Allocation mAllocation;        // use mAllocation if isExternalBuffer() is false
     DeviceMemory mExternalMemory;  // use mExternalMemory if isExternalBuffer() is true
 
     GLeglClientBufferEXT mClientBuffer;
+    uint8_t *mHostMemory;
     uint8_t *mMappedMemory;
 };
 
@@ -851,13 +856,19 @@ class BufferHelper final : public Resource
     BufferHelper();
     ~BufferHelper() override;
 
-    angle::Result init(ContextVk *contextVk,
+    angle::Result init(Context *context,
                        const VkBufferCreateInfo &createInfo,
                        VkMemoryPropertyFlags memoryPropertyFlags);
     angle::Result initExternal(ContextVk *contextVk,
                                VkMemoryPropertyFlags memoryProperties,
                                const VkBufferCreateInfo &requestedCreateInfo,
                                GLeglClientBufferEXT clientBuffer);
+    // Imports host memory of at least the size of the buffer with VK_EXT_external_memory_host. The
+    // pointer and the size have to be aligned to the minimum imported host pointer alignment.
+    angle::Result initExternalHost(Context *context,
+                                   VkMemoryPropertyFlags memoryProperties,
+                                   const VkBufferCreateInfo &requestedCreateInfo,
+                                   void *hostPtr);
     void destroy(RendererVk *renderer);
 
     void release(RendererVk *renderer);
@@ -889,15 +900,15 @@ class BufferHelper final : public Resource
                                  uint32_t regionCount,
                                  const VkBufferCopy *copyRegions);
 
-    angle::Result map(ContextVk *contextVk, uint8_t **ptrOut)
+    angle::Result map(Context *context, uint8_t **ptrOut)
     {
-        return mMemory.map(contextVk, mSize, ptrOut);
+        return mMemory.map(context, mSize, ptrOut);
     }
 
-    angle::Result mapWithOffset(ContextVk *contextVk, uint8_t **ptrOut, size_t offset)
+    angle::Result mapWithOffset(Context *context, uint8_t **ptrOut, size_t offset)
     {
         uint8_t *mapBufPointer;
-        ANGLE_TRY(mMemory.map(contextVk, mSize, &mapBufPointer));
+        ANGLE_TRY(mMemory.map(context, mSize, &mapBufPointer));
         *ptrOut = mapBufPointer + offset;
         return angle::Result::Continue;
     }
@@ -1101,7 +1112,10 @@ class CommandBufferHelper : angle::NonCopyable
     // Finalize the layout if image has any deferred layout transition.
     void finalizeImageLayout(Context *context, const ImageHelper *image);
 
+    // |imagelessAttachments| are the image views of the attachments if |framebuffer| is imageless,
+    // and is empty otherwise.
     void beginRenderPass(const Framebuffer &framebuffer,
+                         const FramebufferAttachmentsVector<VkImageView> &imagelessAttachments,
                          const gl::Rectangle &renderArea,
                          const RenderPassDesc &renderPassDesc,
                          const AttachmentOpsArray &renderPassAttachmentOps,
@@ -1185,9 +1199,11 @@ class CommandBufferHelper : angle::NonCopyable
     void onDepthAccess(ResourceAccess access);
     void onStencilAccess(ResourceAccess access);
 
-    void updateRenderPassForResolve(ContextVk *contextVk,
-                                    Framebuffer *newFramebuffer,
-                                    const RenderPassDesc &renderPassDesc);
+    void updateRenderPassForResolve(
+        ContextVk *contextVk,
+        Framebuffer *newFramebuffer,
+        const FramebufferAttachmentsVector<VkImageView> &newImagelessAttachments,
+        const RenderPassDesc &renderPassDesc);
 
     bool hasDepthStencilWriteOrClear() const
     {
@@ -1255,6 +1271,7 @@ class CommandBufferHelper : angle::NonCopyable
     RenderPassDesc mRenderPassDesc;
     AttachmentOpsArray mAttachmentOps;
     Framebuffer mFramebuffer;
+    FramebufferAttachmentsVector<VkImageView> mImagelessAttachments;
     gl::Rectangle mRenderArea;
     PackedClearValuesArray mClearValues;
     bool mRenderPassStarted;
@@ -1585,6 +1602,8 @@ class ImageHelper final : public Resource, public angle::Subject
     VkImageTiling getTilingMode() const { return mTilingMode; }
     VkImageCreateFlags getCreateFlags() const { return mCreateFlags; }
     VkImageUsageFlags getUsage() const { return mUsage; }
+    // The formats given to VkImageFormatListCreateInfo when the image was created, if any.
+    const ImageViewFormats &getViewFormats() const { return mViewFormats; }
     VkImageType getType() const { return mImageType; }
     const VkExtent3D &getExtents() const { return mExtents; }
     const VkExtent3D getRotatedExtents() const;
@@ -2097,12 +2116,15 @@ class ImageHelper final : public Resource, public angle::Subject
     // Vulkan objects.
     Image mImage;
     DeviceMemory mDeviceMemory;
+    // The size of mDeviceMemory, recorded with the garbage when the image is released.
+    VkDeviceSize mAllocationSize;
 
     // Image properties.
     VkImageType mImageType;
     VkImageTiling mTilingMode;
     VkImageCreateFlags mCreateFlags;
     VkImageUsageFlags mUsage;
+    ImageViewFormats mViewFormats;
     // For Android swapchain images, the Vulkan VkImage must be "rotated".  However, most of ANGLE
     // uses non-rotated extents (i.e. the way the application views the extents--see "Introduction
     // to Android rotation and pre-rotation" in "SurfaceVk.cpp").  Thus, mExtents are non-rotated.
@@ -2575,7 +2597,8 @@ class ShaderProgramHelper : angle::NonCopyable
 };
 
 // Tracks current handle allocation counts in the back-end. Useful for debugging and profiling.
-// Note: not all handle types are currently implemented.
+// Note: not all handle types are currently implemented.  The counts are atomic, since garbage is
+// deallocated by the garbage cleanup thread with the asyncGarbageCleanup feature.
 class ActiveHandleCounter final : angle::NonCopyable
 {
   public:
@@ -2584,18 +2607,27 @@ class ActiveHandleCounter final : angle::NonCopyable
 
     void onAllocate(HandleType handleType)
     {
-        mActiveCounts[handleType]++;
-        mAllocatedCounts[handleType]++;
+        mActiveCounts[handleType].fetch_add(1, std::memory_order_relaxed);
+        mAllocatedCounts[handleType].fetch_add(1, std::memory_order_relaxed);
     }
 
-    void onDeallocate(HandleType handleType) { mActiveCounts[handleType]--; }
+    void onDeallocate(HandleType handleType)
+    {
+        mActiveCounts[handleType].fetch_sub(1, std::memory_order_relaxed);
+    }
 
-    uint32_t getActive(HandleType handleType) const { return mActiveCounts[handleType]; }
-    uint32_t getAllocated(HandleType handleType) const { return mAllocatedCounts[handleType]; }
+    uint32_t getActive(HandleType handleType) const
+    {
+        return mActiveCounts[handleType].load(std::memory_order_relaxed);
+    }
+    uint32_t getAllocated(HandleType handleType) const
+    {
+        return mAllocatedCounts[handleType].load(std::memory_order_relaxed);
+    }
 
   private:
-    angle::PackedEnumMap<HandleType, uint32_t> mActiveCounts;
-    angle::PackedEnumMap<HandleType, uint32_t> mAllocatedCounts;
+    angle::PackedEnumMap<HandleType, std::atomic<uint32_t>> mActiveCounts;
+    angle::PackedEnumMap<HandleType, std::atomic<uint32_t>> mAllocatedCounts;
 };
 
 ANGLE_INLINE bool CommandBufferHelper::usesImageInRenderPass(const ImageHelper &image) const
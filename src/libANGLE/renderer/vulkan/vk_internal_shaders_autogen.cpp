@@ -70,10 +70,18 @@ namespace
 #include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000003.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000004.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000005.inc"
-#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000006.inc"
-#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000007.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000008.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000009.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.0000000A.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.0000000B.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.0000000C.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.0000000D.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000010.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000011.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000012.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000013.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000014.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/GenerateMipmap.comp.00000015.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ImageClear.frag.00000000.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ImageClear.frag.00000001.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ImageClear.frag.00000002.inc"
@@ -234,10 +242,22 @@ constexpr CompressedShaderBlob kGenerateMipmap_comp_shaders[] = {
     {kGenerateMipmap_comp_00000003, sizeof(kGenerateMipmap_comp_00000003)},
     {kGenerateMipmap_comp_00000004, sizeof(kGenerateMipmap_comp_00000004)},
     {kGenerateMipmap_comp_00000005, sizeof(kGenerateMipmap_comp_00000005)},
-    {kGenerateMipmap_comp_00000006, sizeof(kGenerateMipmap_comp_00000006)},
-    {kGenerateMipmap_comp_00000007, sizeof(kGenerateMipmap_comp_00000007)},
+    {nullptr, 0},  // 0x00000006
+    {nullptr, 0},  // 0x00000007
     {kGenerateMipmap_comp_00000008, sizeof(kGenerateMipmap_comp_00000008)},
     {kGenerateMipmap_comp_00000009, sizeof(kGenerateMipmap_comp_00000009)},
+    {kGenerateMipmap_comp_0000000A, sizeof(kGenerateMipmap_comp_0000000A)},
+    {kGenerateMipmap_comp_0000000B, sizeof(kGenerateMipmap_comp_0000000B)},
+    {kGenerateMipmap_comp_0000000C, sizeof(kGenerateMipmap_comp_0000000C)},
+    {kGenerateMipmap_comp_0000000D, sizeof(kGenerateMipmap_comp_0000000D)},
+    {nullptr, 0},  // 0x0000000E
+    {nullptr, 0},  // 0x0000000F
+    {kGenerateMipmap_comp_00000010, sizeof(kGenerateMipmap_comp_00000010)},
+    {kGenerateMipmap_comp_00000011, sizeof(kGenerateMipmap_comp_00000011)},
+    {kGenerateMipmap_comp_00000012, sizeof(kGenerateMipmap_comp_00000012)},
+    {kGenerateMipmap_comp_00000013, sizeof(kGenerateMipmap_comp_00000013)},
+    {kGenerateMipmap_comp_00000014, sizeof(kGenerateMipmap_comp_00000014)},
+    {kGenerateMipmap_comp_00000015, sizeof(kGenerateMipmap_comp_00000015)},
 };
 constexpr CompressedShaderBlob kImageClear_frag_shaders[] = {
     {kImageClear_frag_00000000, sizeof(kImageClear_frag_00000000)},
@@ -97,20 +97,22 @@ constexpr size_t kArrayLen = 0x00000001;
 
 namespace GenerateMipmap_comp
 {
-enum MaxSupportedDest
-{
-    kDestSize4 = 0x00000000,
-    kDestSize6 = 0x00000001,
-};
 enum Format
 {
     kIsRGBA8          = 0x00000000,
-    kIsRGBA8_UseHalf  = 0x00000002,
-    kIsRGBA16         = 0x00000004,
-    kIsRGBA16_UseHalf = 0x00000006,
-    kIsRGBA32F        = 0x00000008,
+    kIsRGBA8_UseHalf  = 0x00000001,
+    kIsRGBA16         = 0x00000002,
+    kIsRGBA16_UseHalf = 0x00000003,
+    kIsRGBA32F        = 0x00000004,
+    kIsSRGBA8         = 0x00000005,
+};
+enum MaxSupportedDest
+{
+    kDestSize4  = 0x00000000,
+    kDestSize6  = 0x00000008,
+    kDestSize12 = 0x00000010,
 };
-constexpr size_t kArrayLen = 0x0000000A;
+constexpr size_t kArrayLen = 0x00000016;
 }  // namespace GenerateMipmap_comp
 
 namespace ImageClear_frag
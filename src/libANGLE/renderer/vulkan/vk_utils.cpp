@@ -102,9 +102,10 @@ angle::Result FindAndAllocateCompatibleMemory(vk::Context *context,
     ANGLE_VK_TRY(context, deviceMemoryOut->allocate(device, allocInfo));
 
     // Wipe memory to an invalid value when the 'allocateNonZeroMemory' feature is enabled. The
-    // invalid values ensures our testing doesn't assume zero-initialized memory.
+    // invalid values ensures our testing doesn't assume zero-initialized memory. Imported memory
+    // keeps its contents.
     RendererVk *renderer = context->getRenderer();
-    if (renderer->getFeatures().allocateNonZeroMemory.enabled)
+    if (renderer->getFeatures().allocateNonZeroMemory.enabled && extraAllocationInfo == nullptr)
     {
         if ((*memoryPropertyFlagsOut & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0)
         {
@@ -484,6 +485,7 @@ void StagingBuffer::collectGarbage(RendererVk *renderer, Serial serial)
 {
     GarbageList garbageList;
     garbageList.emplace_back(GetGarbage(&mBuffer));
+    garbageList.back().setMemorySize(mSize);
     garbageList.emplace_back(GetGarbage(&mAllocation));
 
     SharedResourceUse sharedUse;
@@ -633,10 +635,12 @@ gl::TextureType Get2DTextureType(uint32_t layerCount, GLint samples)
     }
 }
 
-GarbageObject::GarbageObject() : mHandleType(HandleType::Invalid), mHandle(VK_NULL_HANDLE) {}
+GarbageObject::GarbageObject()
+    : mHandleType(HandleType::Invalid), mHandle(VK_NULL_HANDLE), mMemorySize(0)
+{}
 
 GarbageObject::GarbageObject(HandleType handleType, GarbageHandle handle)
-    : mHandleType(handleType), mHandle(handle)
+    : mHandleType(handleType), mHandle(handle), mMemorySize(0)
 {}
 
 GarbageObject::GarbageObject(GarbageObject &&other) : GarbageObject()
@@ -648,6 +652,7 @@ GarbageObject &GarbageObject::operator=(GarbageObject &&rhs)
 {
     std::swap(mHandle, rhs.mHandle);
     std::swap(mHandleType, rhs.mHandleType);
+    std::swap(mMemorySize, rhs.mMemorySize);
     return *this;
 }
 
@@ -729,6 +734,16 @@ void GarbageObject::destroy(RendererVk *renderer)
     renderer->getActiveHandleCounts().onDeallocate(mHandleType);
 }
 
+VkDeviceSize GetGarbageMemorySize(const GarbageList &garbage)
+{
+    VkDeviceSize size = 0;
+    for (const GarbageObject &object : garbage)
+    {
+        size += object.getMemorySize();
+    }
+    return size;
+}
+
 void MakeDebugUtilsLabel(GLenum source, const char *marker, VkDebugUtilsLabelEXT *label)
 {
     static constexpr angle::ColorF kLabelColors[6] = {
@@ -888,6 +903,10 @@ PFN_vkDestroySamplerYcbcrConversionKHR vkDestroySamplerYcbcrConversionKHR = null
 // VK_KHR_create_renderpass2
 PFN_vkCreateRenderPass2KHR vkCreateRenderPass2KHR = nullptr;
 
+// VK_KHR_timeline_semaphore
+PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueKHR = nullptr;
+PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR                     = nullptr;
+
 #    if defined(ANGLE_PLATFORM_FUCHSIA)
 // VK_FUCHSIA_imagepipe_surface
 PFN_vkCreateImagePipeSurfaceFUCHSIA vkCreateImagePipeSurfaceFUCHSIA = nullptr;
@@ -962,6 +981,13 @@ void InitRenderPass2KHRFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkCreateRenderPass2KHR);
 }
 
+// VK_KHR_timeline_semaphore
+void InitTimelineSemaphoreKHRFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetSemaphoreCounterValueKHR);
+    GET_DEVICE_FUNC(vkWaitSemaphoresKHR);
+}
+
 #    if defined(ANGLE_PLATFORM_FUCHSIA)
 void InitImagePipeSurfaceFUCHSIAFunctions(VkInstance instance)
 {
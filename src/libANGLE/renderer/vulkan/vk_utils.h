@@ -296,6 +296,11 @@ class GarbageObject
     bool valid() const { return mHandle != VK_NULL_HANDLE; }
     void destroy(RendererVk *renderer);
 
+    // The size of the memory of a buffer or image, recorded when it's released, so the garbage
+    // stats don't query memory requirements.  Zero for other objects.
+    VkDeviceSize getMemorySize() const { return mMemorySize; }
+    void setMemorySize(VkDeviceSize memorySize) { mMemorySize = memorySize; }
+
     template <typename DerivedT, typename HandleT>
     static GarbageObject Get(WrappedObject<DerivedT, HandleT> *object)
     {
@@ -311,6 +316,7 @@ class GarbageObject
 
     HandleType mHandleType;
     GarbageHandle mHandle;
+    VkDeviceSize mMemorySize;
 };
 
 template <typename T>
@@ -329,6 +335,18 @@ using GarbageAndSerial = ObjectAndSerial<GarbageList>;
 // sorted such that later-living garbage is ordered later in the list.
 using GarbageQueue = std::vector<GarbageAndSerial>;
 
+// Running totals of the garbage objects handed to the renderer and destroyed by it.  The bytes are
+// the memory sizes of the buffers and images among them.
+struct GarbageStats
+{
+    uint64_t queuedObjects;
+    uint64_t queuedBytes;
+    uint64_t destroyedObjects;
+    uint64_t destroyedBytes;
+};
+
+VkDeviceSize GetGarbageMemorySize(const GarbageList &garbage);
+
 class MemoryProperties final : angle::NonCopyable
 {
   public:
@@ -857,31 +875,51 @@ struct RenderPassPerfCounters
     uint8_t readOnlyDepthStencil;
 };
 
+// The list of the perf counters, so they can be enumerated, e.g. by GL_AMD_performance_monitor.
+#define ANGLE_VK_PERF_COUNTERS_X(FN)           \
+    FN(primaryBuffers)                         \
+    FN(renderPasses)                           \
+    FN(writeDescriptorSets)                    \
+    FN(flushedOutsideRenderPassCommandBuffers) \
+    FN(resolveImageCommands)                   \
+    FN(depthClears)                            \
+    FN(depthLoads)                             \
+    FN(depthStores)                            \
+    FN(stencilClears)                          \
+    FN(stencilLoads)                           \
+    FN(stencilStores)                          \
+    FN(colorAttachmentUnresolves)              \
+    FN(depthAttachmentUnresolves)              \
+    FN(stencilAttachmentUnresolves)            \
+    FN(colorAttachmentResolves)                \
+    FN(depthAttachmentResolves)                \
+    FN(stencilAttachmentResolves)              \
+    FN(readOnlyDepthStencilRenderPasses)       \
+    FN(descriptorSetAllocations)               \
+    FN(shaderBuffersDescriptorSetCacheHits)    \
+    FN(shaderBuffersDescriptorSetCacheMisses)  \
+    FN(framebufferCreations)
+
+#define ANGLE_DECLARE_PERF_COUNTER(COUNTER) uint32_t COUNTER;
+
 struct PerfCounters
 {
-    uint32_t primaryBuffers;
-    uint32_t renderPasses;
-    uint32_t writeDescriptorSets;
-    uint32_t flushedOutsideRenderPassCommandBuffers;
-    uint32_t resolveImageCommands;
-    uint32_t depthClears;
-    uint32_t depthLoads;
-    uint32_t depthStores;
-    uint32_t stencilClears;
-    uint32_t stencilLoads;
-    uint32_t stencilStores;
-    uint32_t colorAttachmentUnresolves;
-    uint32_t depthAttachmentUnresolves;
-    uint32_t stencilAttachmentUnresolves;
-    uint32_t colorAttachmentResolves;
-    uint32_t depthAttachmentResolves;
-    uint32_t stencilAttachmentResolves;
-    uint32_t readOnlyDepthStencilRenderPasses;
-    uint32_t descriptorSetAllocations;
-    uint32_t shaderBuffersDescriptorSetCacheHits;
-    uint32_t shaderBuffersDescriptorSetCacheMisses;
+    ANGLE_VK_PERF_COUNTERS_X(ANGLE_DECLARE_PERF_COUNTER)
 };
 
+#undef ANGLE_DECLARE_PERF_COUNTER
+
+// Some of the perf counters are reset every frame or submission.  These are their running totals
+// from before the resets.
+#define ANGLE_DECLARE_PERF_COUNTER_TOTAL(COUNTER) uint64_t COUNTER;
+
+struct PerfCounterTotals
+{
+    ANGLE_VK_PERF_COUNTERS_X(ANGLE_DECLARE_PERF_COUNTER_TOTAL)
+};
+
+#undef ANGLE_DECLARE_PERF_COUNTER_TOTAL
+
 // A Vulkan image level index.
 using LevelIndex = gl::LevelIndexWrapper<uint32_t>;
 
@@ -898,6 +936,7 @@ void InitGetPhysicalDeviceProperties2KHRFunctions(VkInstance instance);
 void InitTransformFeedbackEXTFunctions(VkDevice device);
 void InitSamplerYcbcrKHRFunctions(VkDevice device);
 void InitRenderPass2KHRFunctions(VkDevice device);
+void InitTimelineSemaphoreKHRFunctions(VkDevice device);
 
 #    if defined(ANGLE_PLATFORM_FUCHSIA)
 // VK_FUCHSIA_imagepipe_surface
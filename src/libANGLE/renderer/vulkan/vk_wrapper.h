@@ -437,6 +437,10 @@ class Semaphore final : public WrappedObject<Semaphore, VkSemaphore>
     VkResult init(VkDevice device);
     VkResult init(VkDevice device, const VkSemaphoreCreateInfo &createInfo);
     VkResult importFd(VkDevice device, const VkImportSemaphoreFdInfoKHR &importFdInfo) const;
+
+    // Timeline semaphore queries.  Require VK_KHR_timeline_semaphore.
+    VkResult getCounterValue(VkDevice device, uint64_t *valueOut) const;
+    VkResult wait(VkDevice device, uint64_t value, uint64_t timeout) const;
 };
 
 class Framebuffer final : public WrappedObject<Framebuffer, VkFramebuffer>
@@ -1352,7 +1356,7 @@ ANGLE_INLINE VkResult Semaphore::init(VkDevice device)
 
 ANGLE_INLINE VkResult Semaphore::init(VkDevice device, const VkSemaphoreCreateInfo &createInfo)
 {
-    ASSERT(valid());
+    ASSERT(!valid());
     return vkCreateSemaphore(device, &createInfo, nullptr, &mHandle);
 }
 
@@ -1363,6 +1367,25 @@ ANGLE_INLINE VkResult Semaphore::importFd(VkDevice device,
     return vkImportSemaphoreFdKHR(device, &importFdInfo);
 }
 
+ANGLE_INLINE VkResult Semaphore::getCounterValue(VkDevice device, uint64_t *valueOut) const
+{
+    ASSERT(valid());
+    return vkGetSemaphoreCounterValueKHR(device, mHandle, valueOut);
+}
+
+ANGLE_INLINE VkResult Semaphore::wait(VkDevice device, uint64_t value, uint64_t timeout) const
+{
+    ASSERT(valid());
+
+    VkSemaphoreWaitInfoKHR waitInfo = {};
+    waitInfo.sType                  = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+    waitInfo.semaphoreCount         = 1;
+    waitInfo.pSemaphores            = &mHandle;
+    waitInfo.pValues                = &value;
+
+    return vkWaitSemaphoresKHR(device, &waitInfo, timeout);
+}
+
 // Framebuffer implementation.
 ANGLE_INLINE void Framebuffer::destroy(VkDevice device)
 {
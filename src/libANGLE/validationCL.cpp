@@ -1284,79 +1284,44 @@ cl_int ValidateSetKernelArg(cl_kernel kernel,
 
     if (arg_size == sizeof(cl_mem) && arg_value != nullptr)
     {
-        const std::string &typeName = krnl.getInfo().args[arg_index].typeName;
-
-        // CL_INVALID_MEM_OBJECT for an argument declared to be a memory object
-        // when the specified arg_value is not a valid memory object.
-        if (typeName == "image1d_t")
-        {
-            const cl_mem image = *static_cast<const cl_mem *>(arg_value);
-            if (!Image::IsValid(image) || image->cast<Image>().getType() != MemObjectType::Image1D)
-            {
-                return CL_INVALID_MEM_OBJECT;
-            }
-        }
-        else if (typeName == "image2d_t")
-        {
-            const cl_mem image = *static_cast<const cl_mem *>(arg_value);
-            if (!Image::IsValid(image) || image->cast<Image>().getType() != MemObjectType::Image2D)
-            {
-                return CL_INVALID_MEM_OBJECT;
-            }
-        }
-        else if (typeName == "image3d_t")
-        {
-            const cl_mem image = *static_cast<const cl_mem *>(arg_value);
-            if (!Image::IsValid(image) || image->cast<Image>().getType() != MemObjectType::Image3D)
-            {
-                return CL_INVALID_MEM_OBJECT;
-            }
-        }
-        else if (typeName == "image1d_array_t")
-        {
-            const cl_mem image = *static_cast<const cl_mem *>(arg_value);
-            if (!Image::IsValid(image) ||
-                image->cast<Image>().getType() != MemObjectType::Image1D_Array)
-            {
-                return CL_INVALID_MEM_OBJECT;
-            }
-        }
-        else if (typeName == "image2d_array_t")
+        switch (krnl.getArgType(arg_index))
         {
-            const cl_mem image = *static_cast<const cl_mem *>(arg_value);
-            if (!Image::IsValid(image) ||
-                image->cast<Image>().getType() != MemObjectType::Image2D_Array)
+            // CL_INVALID_MEM_OBJECT for an argument declared to be a memory object
+            // when the specified arg_value is not a valid memory object.
+            case Kernel::ArgType::Image:
             {
-                return CL_INVALID_MEM_OBJECT;
-            }
-        }
-        else if (typeName == "image1d_buffer_t")
-        {
-            const cl_mem image = *static_cast<const cl_mem *>(arg_value);
-            if (!Image::IsValid(image) ||
-                image->cast<Image>().getType() != MemObjectType::Image1D_Buffer)
-            {
-                return CL_INVALID_MEM_OBJECT;
-            }
-        }
-        // CL_INVALID_SAMPLER for an argument declared to be of type sampler_t
-        // when the specified arg_value is not a valid sampler object.
-        else if (typeName == "sampler_t")
-        {
-            if (!Sampler::IsValid(*static_cast<const cl_sampler *>(arg_value)))
-            {
-                return CL_INVALID_SAMPLER;
+                const cl_mem image = *static_cast<const cl_mem *>(arg_value);
+                if (!Image::IsValid(image) ||
+                    image->cast<Image>().getType() != krnl.getArgImageType(arg_index))
+                {
+                    return CL_INVALID_MEM_OBJECT;
+                }
+                break;
             }
-        }
-        // CL_INVALID_DEVICE_QUEUE for an argument declared to be of type queue_t
-        // when the specified arg_value is not a valid device queue object.
-        else if (typeName == "queue_t")
-        {
-            const cl_command_queue queue = *static_cast<const cl_command_queue *>(arg_value);
-            if (!CommandQueue::IsValid(queue) || !queue->cast<CommandQueue>().isOnDevice())
+
+            // CL_INVALID_SAMPLER for an argument declared to be of type sampler_t
+            // when the specified arg_value is not a valid sampler object.
+            case Kernel::ArgType::Sampler:
+                if (!Sampler::IsValid(*static_cast<const cl_sampler *>(arg_value)))
+                {
+                    return CL_INVALID_SAMPLER;
+                }
+                break;
+
+            // CL_INVALID_DEVICE_QUEUE for an argument declared to be of type queue_t
+            // when the specified arg_value is not a valid device queue object.
+            case Kernel::ArgType::DeviceQueue:
             {
-                return CL_INVALID_DEVICE_QUEUE;
+                const cl_command_queue queue = *static_cast<const cl_command_queue *>(arg_value);
+                if (!CommandQueue::IsValid(queue) || !queue->cast<CommandQueue>().isOnDevice())
+                {
+                    return CL_INVALID_DEVICE_QUEUE;
+                }
+                break;
             }
+
+            default:
+                break;
         }
     }
 
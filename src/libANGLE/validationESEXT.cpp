@@ -220,6 +220,73 @@ bool ValidateObjectIdentifierAndName(const Context *context, GLenum identifier,
             return false;
     }
 }
+
+bool ValidatePerfMonitorExtensionAndGroup(const Context *context, GLuint group)
+{
+    if (!context->getExtensions().performanceMonitorAMD)
+    {
+        context->validationError(GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    if (group >= context->getPerfMonitorCounterGroups().size())
+    {
+        context->validationError(GL_INVALID_VALUE, kInvalidPerfMonitorGroup);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidatePerfMonitorCounter(const Context *context, GLuint group, GLuint counter)
+{
+    if (!ValidatePerfMonitorExtensionAndGroup(context, group))
+    {
+        return false;
+    }
+
+    if (counter >= context->getPerfMonitorCounterGroups()[group].counters.size())
+    {
+        context->validationError(GL_INVALID_VALUE, kInvalidPerfMonitorCounter);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidatePerfMonitor(const Context *context, GLuint monitor)
+{
+    if (!context->getExtensions().performanceMonitorAMD)
+    {
+        context->validationError(GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    if (!context->isPerfMonitorGenerated(monitor))
+    {
+        context->validationError(GL_INVALID_VALUE, kInvalidPerfMonitor);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateGenOrDeletePerfMonitors(const Context *context, GLsizei n)
+{
+    if (!context->getExtensions().performanceMonitorAMD)
+    {
+        context->validationError(GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    if (n < 0)
+    {
+        context->validationError(GL_INVALID_VALUE, kNegativeCount);
+        return false;
+    }
+
+    return true;
+}
 }  // namespace
 
 bool ValidateGetTexImageANGLE(const Context *context,
@@ -2226,6 +2293,224 @@ bool ValidateLabelObjectEXT(const Context *context,
     return ValidateObjectIdentifierAndName(context, type, object);
 }
 
+// GL_AMD_performance_monitor
+bool ValidateBeginPerfMonitorAMD(const Context *context, GLuint monitor)
+{
+    if (!ValidatePerfMonitor(context, monitor))
+    {
+        return false;
+    }
+
+    if (context->isPerfMonitorActive(monitor))
+    {
+        context->validationError(GL_INVALID_OPERATION, kPerfMonitorActive);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateDeletePerfMonitorsAMD(const Context *context, GLsizei n, const GLuint *monitors)
+{
+    return ValidateGenOrDeletePerfMonitors(context, n);
+}
+
+bool ValidateEndPerfMonitorAMD(const Context *context, GLuint monitor)
+{
+    if (!ValidatePerfMonitor(context, monitor))
+    {
+        return false;
+    }
+
+    if (!context->isPerfMonitorActive(monitor))
+    {
+        context->validationError(GL_INVALID_OPERATION, kPerfMonitorNotActive);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateGenPerfMonitorsAMD(const Context *context, GLsizei n, const GLuint *monitors)
+{
+    return ValidateGenOrDeletePerfMonitors(context, n);
+}
+
+bool ValidateGetPerfMonitorCounterDataAMD(const Context *context,
+                                          GLuint monitor,
+                                          GLenum pname,
+                                          GLsizei dataSize,
+                                          const GLuint *data,
+                                          const GLint *bytesWritten)
+{
+    if (!ValidatePerfMonitor(context, monitor))
+    {
+        return false;
+    }
+
+    if (dataSize < 0)
+    {
+        context->validationError(GL_INVALID_VALUE, kNegativeBufferSize);
+        return false;
+    }
+
+    switch (pname)
+    {
+        case GL_PERFMON_RESULT_AVAILABLE_AMD:
+        case GL_PERFMON_RESULT_SIZE_AMD:
+        case GL_PERFMON_RESULT_AMD:
+            return true;
+
+        default:
+            context->validationError(GL_INVALID_ENUM, kInvalidPname);
+            return false;
+    }
+}
+
+bool ValidateGetPerfMonitorCounterInfoAMD(const Context *context,
+                                          GLuint group,
+                                          GLuint counter,
+                                          GLenum pname,
+                                          const void *data)
+{
+    if (!ValidatePerfMonitorCounter(context, group, counter))
+    {
+        return false;
+    }
+
+    switch (pname)
+    {
+        case GL_COUNTER_TYPE_AMD:
+        case GL_COUNTER_RANGE_AMD:
+            return true;
+
+        default:
+            context->validationError(GL_INVALID_ENUM, kInvalidPname);
+            return false;
+    }
+}
+
+bool ValidateGetPerfMonitorCounterStringAMD(const Context *context,
+                                            GLuint group,
+                                            GLuint counter,
+                                            GLsizei bufSize,
+                                            const GLsizei *length,
+                                            const GLchar *counterString)
+{
+    if (!ValidatePerfMonitorCounter(context, group, counter))
+    {
+        return false;
+    }
+
+    if (bufSize < 0)
+    {
+        context->validationError(GL_INVALID_VALUE, kNegativeBufferSize);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateGetPerfMonitorCountersAMD(const Context *context,
+                                       GLuint group,
+                                       const GLint *numCounters,
+                                       const GLint *maxActiveCounters,
+                                       GLsizei counterSize,
+                                       const GLuint *counters)
+{
+    if (!ValidatePerfMonitorExtensionAndGroup(context, group))
+    {
+        return false;
+    }
+
+    if (counterSize < 0)
+    {
+        context->validationError(GL_INVALID_VALUE, kNegativeBufferSize);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateGetPerfMonitorGroupStringAMD(const Context *context,
+                                          GLuint group,
+                                          GLsizei bufSize,
+                                          const GLsizei *length,
+                                          const GLchar *groupString)
+{
+    if (!ValidatePerfMonitorExtensionAndGroup(context, group))
+    {
+        return false;
+    }
+
+    if (bufSize < 0)
+    {
+        context->validationError(GL_INVALID_VALUE, kNegativeBufferSize);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateGetPerfMonitorGroupsAMD(const Context *context,
+                                     const GLint *numGroups,
+                                     GLsizei groupsSize,
+                                     const GLuint *groups)
+{
+    if (!context->getExtensions().performanceMonitorAMD)
+    {
+        context->validationError(GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    if (groupsSize < 0)
+    {
+        context->validationError(GL_INVALID_VALUE, kNegativeBufferSize);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateSelectPerfMonitorCountersAMD(const Context *context,
+                                          GLuint monitor,
+                                          GLboolean enable,
+                                          GLuint group,
+                                          GLint numCounters,
+                                          const GLuint *counterList)
+{
+    if (!ValidatePerfMonitor(context, monitor) ||
+        !ValidatePerfMonitorExtensionAndGroup(context, group))
+    {
+        return false;
+    }
+
+    if (context->isPerfMonitorActive(monitor))
+    {
+        context->validationError(GL_INVALID_OPERATION, kPerfMonitorActive);
+        return false;
+    }
+
+    if (numCounters < 0)
+    {
+        context->validationError(GL_INVALID_VALUE, kNegativeCount);
+        return false;
+    }
+
+    const angle::PerfMonitorCounters &counters =
+        context->getPerfMonitorCounterGroups()[group].counters;
+    for (GLint counterIndex = 0; counterIndex < numCounters; ++counterIndex)
+    {
+        if (counterList[counterIndex] >= counters.size())
+        {
+            context->validationError(GL_INVALID_VALUE, kInvalidPerfMonitorCounter);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool ValidateEGLImageTargetTextureStorageEXT(const Context *context,
                                              GLuint texture,
                                              GLeglImageOES image,
@@ -17,6 +17,50 @@ namespace gl
 {
 class Context;
 
+// GL_AMD_performance_monitor
+bool ValidateBeginPerfMonitorAMD(const Context *context, GLuint monitor);
+bool ValidateDeletePerfMonitorsAMD(const Context *context, GLsizei n, const GLuint *monitors);
+bool ValidateEndPerfMonitorAMD(const Context *context, GLuint monitor);
+bool ValidateGenPerfMonitorsAMD(const Context *context, GLsizei n, const GLuint *monitors);
+bool ValidateGetPerfMonitorCounterDataAMD(const Context *context,
+                                          GLuint monitor,
+                                          GLenum pname,
+                                          GLsizei dataSize,
+                                          const GLuint *data,
+                                          const GLint *bytesWritten);
+bool ValidateGetPerfMonitorCounterInfoAMD(const Context *context,
+                                          GLuint group,
+                                          GLuint counter,
+                                          GLenum pname,
+                                          const void *data);
+bool ValidateGetPerfMonitorCounterStringAMD(const Context *context,
+                                            GLuint group,
+                                            GLuint counter,
+                                            GLsizei bufSize,
+                                            const GLsizei *length,
+                                            const GLchar *counterString);
+bool ValidateGetPerfMonitorCountersAMD(const Context *context,
+                                       GLuint group,
+                                       const GLint *numCounters,
+                                       const GLint *maxActiveCounters,
+                                       GLsizei counterSize,
+                                       const GLuint *counters);
+bool ValidateGetPerfMonitorGroupStringAMD(const Context *context,
+                                          GLuint group,
+                                          GLsizei bufSize,
+                                          const GLsizei *length,
+                                          const GLchar *groupString);
+bool ValidateGetPerfMonitorGroupsAMD(const Context *context,
+                                     const GLint *numGroups,
+                                     GLsizei groupsSize,
+                                     const GLuint *groups);
+bool ValidateSelectPerfMonitorCountersAMD(const Context *context,
+                                          GLuint monitor,
+                                          GLboolean enable,
+                                          GLuint group,
+                                          GLint numCounters,
+                                          const GLuint *counterList);
+
 // GL_ANGLE_base_vertex_base_instance
 bool ValidateDrawArraysInstancedBaseInstanceANGLE(const Context *context,
                                                   PrimitiveMode modePacked,
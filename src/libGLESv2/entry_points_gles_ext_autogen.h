@@ -20,6 +20,43 @@
 
 extern "C" {
 
+// GL_AMD_performance_monitor
+ANGLE_EXPORT void GL_APIENTRY GL_BeginPerfMonitorAMD(GLuint monitor);
+ANGLE_EXPORT void GL_APIENTRY GL_DeletePerfMonitorsAMD(GLsizei n, GLuint *monitors);
+ANGLE_EXPORT void GL_APIENTRY GL_EndPerfMonitorAMD(GLuint monitor);
+ANGLE_EXPORT void GL_APIENTRY GL_GenPerfMonitorsAMD(GLsizei n, GLuint *monitors);
+ANGLE_EXPORT void GL_APIENTRY GL_GetPerfMonitorCounterDataAMD(GLuint monitor,
+                                                              GLenum pname,
+                                                              GLsizei dataSize,
+                                                              GLuint *data,
+                                                              GLint *bytesWritten);
+ANGLE_EXPORT void GL_APIENTRY GL_GetPerfMonitorCounterInfoAMD(GLuint group,
+                                                              GLuint counter,
+                                                              GLenum pname,
+                                                              void *data);
+ANGLE_EXPORT void GL_APIENTRY GL_GetPerfMonitorCounterStringAMD(GLuint group,
+                                                                GLuint counter,
+                                                                GLsizei bufSize,
+                                                                GLsizei *length,
+                                                                GLchar *counterString);
+ANGLE_EXPORT void GL_APIENTRY GL_GetPerfMonitorCountersAMD(GLuint group,
+                                                           GLint *numCounters,
+                                                           GLint *maxActiveCounters,
+                                                           GLsizei counterSize,
+                                                           GLuint *counters);
+ANGLE_EXPORT void GL_APIENTRY GL_GetPerfMonitorGroupStringAMD(GLuint group,
+                                                              GLsizei bufSize,
+                                                              GLsizei *length,
+                                                              GLchar *groupString);
+ANGLE_EXPORT void GL_APIENTRY GL_GetPerfMonitorGroupsAMD(GLint *numGroups,
+                                                         GLsizei groupsSize,
+                                                         GLuint *groups);
+ANGLE_EXPORT void GL_APIENTRY GL_SelectPerfMonitorCountersAMD(GLuint monitor,
+                                                              GLboolean enable,
+                                                              GLuint group,
+                                                              GLint numCounters,
+                                                              GLuint *counterList);
+
 // GL_ANGLE_base_vertex_base_instance
 ANGLE_EXPORT void GL_APIENTRY GL_DrawArraysInstancedBaseInstanceANGLE(GLenum mode,
                                                                       GLint first,
@@ -0,0 +1,485 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CLCommandQueueTest:
+//   Tests of the buffers and command queues of the OpenCL implementation of the Vulkan back end.
+//
+
+#include <gtest/gtest.h>
+
+#include "common/aligned_memory.h"
+#include "test_utils/cl_test_utils.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr size_t kBufferSize = 1024;
+// Host memory can be imported in whole pages.
+constexpr size_t kHostMemoryAlignment = 4096;
+
+std::vector<uint8_t> MakePattern(size_t size, uint8_t first)
+{
+    std::vector<uint8_t> pattern(size);
+    std::iota(pattern.begin(), pattern.end(), first);
+    return pattern;
+}
+
+class CLCommandQueueTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mDevice = FindCLDevice(kVulkanCLPlatformName, &mPlatform);
+        if (mDevice == nullptr)
+        {
+            GTEST_SKIP() << "No OpenCL device available.";
+        }
+
+        char platformName[64] = {};
+        cl::clGetPlatformInfo(mPlatform, CL_PLATFORM_NAME, sizeof(platformName) - 1,
+                              platformName, nullptr);
+        if (std::strcmp(platformName, kVulkanCLPlatformName) != 0)
+        {
+            GTEST_SKIP() << "The Vulkan back end has no OpenCL device.";
+        }
+
+        const cl_context_properties contextProperties[] = {
+            CL_CONTEXT_PLATFORM, reinterpret_cast<cl_context_properties>(mPlatform), 0};
+        cl_int errorCode = CL_SUCCESS;
+        mContext =
+            cl::clCreateContext(contextProperties, 1, &mDevice, nullptr, nullptr, &errorCode);
+        ASSERT_EQ(CL_SUCCESS, errorCode);
+
+        mQueue = createQueue(0);
+        ASSERT_NE(nullptr, mQueue);
+    }
+
+    void TearDown() override
+    {
+        for (cl_mem buffer : mBuffers)
+        {
+            cl::clReleaseMemObject(buffer);
+        }
+        for (cl_command_queue queue : mQueues)
+        {
+            cl::clReleaseCommandQueue(queue);
+        }
+        if (mContext != nullptr)
+        {
+            cl::clReleaseContext(mContext);
+        }
+        // The memory of CL_MEM_USE_HOST_PTR buffers is freed after the buffers.
+        if (mHostMemory != nullptr)
+        {
+            angle::AlignedFree(mHostMemory);
+        }
+    }
+
+    cl_mem createBuffer(cl_mem_flags flags, size_t size, void *hostPtr)
+    {
+        cl_int errorCode = CL_SUCCESS;
+        cl_mem buffer    = cl::clCreateBuffer(mContext, flags, size, hostPtr, &errorCode);
+        EXPECT_EQ(CL_SUCCESS, errorCode);
+        if (buffer != nullptr)
+        {
+            mBuffers.push_back(buffer);
+        }
+        return buffer;
+    }
+
+    cl_command_queue createQueue(cl_command_queue_properties properties)
+    {
+        cl_int errorCode       = CL_SUCCESS;
+        cl_command_queue queue =
+            cl::clCreateCommandQueue(mContext, mDevice, properties, &errorCode);
+        EXPECT_EQ(CL_SUCCESS, errorCode);
+        if (queue != nullptr)
+        {
+            mQueues.push_back(queue);
+        }
+        return queue;
+    }
+
+    // Checks that the device sees the host writes to a mapped CL_MEM_USE_HOST_PTR buffer after
+    // the unmap, and that the host memory holds the device writes after a map.
+    void testUseHostPtrCoherence(uint8_t *hostMemory, size_t size)
+    {
+        const std::vector<uint8_t> initialData = MakePattern(size, 0);
+        std::copy(initialData.begin(), initialData.end(), hostMemory);
+
+        const cl_mem_flags flags = CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR;
+        cl_mem buffer            = createBuffer(flags, size, hostMemory);
+        cl_mem destination       = createBuffer(CL_MEM_READ_WRITE, size, nullptr);
+        ASSERT_NE(nullptr, buffer);
+        ASSERT_NE(nullptr, destination);
+
+        // Host writes through the mapped pointer reach the device after the unmap.
+        cl_int errorCode = CL_SUCCESS;
+        uint8_t *mapped  = static_cast<uint8_t *>(cl::clEnqueueMapBuffer(
+            mQueue, buffer, CL_TRUE, CL_MAP_WRITE, 0, size, 0, nullptr, nullptr, &errorCode));
+        ASSERT_EQ(CL_SUCCESS, errorCode);
+        EXPECT_EQ(hostMemory, mapped);
+        const std::vector<uint8_t> hostData = MakePattern(size, 50);
+        std::copy(hostData.begin(), hostData.end(), mapped);
+        ASSERT_EQ(CL_SUCCESS,
+                  cl::clEnqueueUnmapMemObject(mQueue, buffer, mapped, 0, nullptr, nullptr));
+
+        ASSERT_EQ(CL_SUCCESS, cl::clEnqueueCopyBuffer(mQueue, buffer, destination, 0, 0, size, 0,
+                                                      nullptr, nullptr));
+        std::vector<uint8_t> readData(size);
+        ASSERT_EQ(CL_SUCCESS, cl::clEnqueueReadBuffer(mQueue, destination, CL_TRUE, 0, size,
+                                                      readData.data(), 0, nullptr, nullptr));
+        EXPECT_EQ(hostData, readData);
+
+        // Device writes are in the host memory once the buffer is mapped again.
+        const std::vector<uint8_t> deviceData = MakePattern(size, 150);
+        ASSERT_EQ(CL_SUCCESS, cl::clEnqueueWriteBuffer(mQueue, destination, CL_FALSE, 0, size,
+                                                       deviceData.data(), 0, nullptr, nullptr));
+        ASSERT_EQ(CL_SUCCESS, cl::clEnqueueCopyBuffer(mQueue, destination, buffer, 0, 0, size, 0,
+                                                      nullptr, nullptr));
+        mapped = static_cast<uint8_t *>(cl::clEnqueueMapBuffer(
+            mQueue, buffer, CL_TRUE, CL_MAP_READ, 0, size, 0, nullptr, nullptr, &errorCode));
+        ASSERT_EQ(CL_SUCCESS, errorCode);
+        EXPECT_EQ(hostMemory, mapped);
+        EXPECT_EQ(deviceData, std::vector<uint8_t>(hostMemory, hostMemory + size));
+        ASSERT_EQ(CL_SUCCESS,
+                  cl::clEnqueueUnmapMemObject(mQueue, buffer, mapped, 0, nullptr, nullptr));
+        ASSERT_EQ(CL_SUCCESS, cl::clFinish(mQueue));
+    }
+
+    cl_platform_id mPlatform = nullptr;
+    cl_device_id mDevice     = nullptr;
+    cl_context mContext      = nullptr;
+    cl_command_queue mQueue  = nullptr;
+    std::vector<cl_mem> mBuffers;
+    std::vector<cl_command_queue> mQueues;
+    void *mHostMemory = nullptr;
+};
+
+// Tests that the device reports a version, extensions and the limits the front end validates with.
+TEST_F(CLCommandQueueTest, DeviceInfo)
+{
+    char version[64] = {};
+    ASSERT_EQ(CL_SUCCESS, cl::clGetDeviceInfo(mDevice, CL_DEVICE_VERSION, sizeof(version) - 1,
+                                              version, nullptr));
+    EXPECT_EQ(0, std::strncmp(version, "OpenCL 1.2 ", 11)) << version;
+
+    size_t extensionsSize = 0;
+    ASSERT_EQ(CL_SUCCESS,
+              cl::clGetDeviceInfo(mDevice, CL_DEVICE_EXTENSIONS, 0, nullptr, &extensionsSize));
+    std::string extensions(extensionsSize, '\0');
+    ASSERT_EQ(CL_SUCCESS, cl::clGetDeviceInfo(mDevice, CL_DEVICE_EXTENSIONS, extensionsSize,
+                                              &extensions[0], nullptr));
+    EXPECT_NE(std::string::npos, extensions.find("cl_khr_extended_versioning"));
+
+    cl_device_type type = 0;
+    ASSERT_EQ(CL_SUCCESS,
+              cl::clGetDeviceInfo(mDevice, CL_DEVICE_TYPE, sizeof(type), &type, nullptr));
+    EXPECT_NE(0u, type & CL_DEVICE_TYPE_DEFAULT);
+
+    size_t maxWorkItemSizes[3] = {};
+    ASSERT_EQ(CL_SUCCESS, cl::clGetDeviceInfo(mDevice, CL_DEVICE_MAX_WORK_ITEM_SIZES,
+                                              sizeof(maxWorkItemSizes), maxWorkItemSizes, nullptr));
+    for (size_t size : maxWorkItemSizes)
+    {
+        EXPECT_NE(0u, size);
+    }
+
+    cl_ulong maxMemAllocSize = 0;
+    ASSERT_EQ(CL_SUCCESS, cl::clGetDeviceInfo(mDevice, CL_DEVICE_MAX_MEM_ALLOC_SIZE,
+                                              sizeof(maxMemAllocSize), &maxMemAllocSize, nullptr));
+    EXPECT_GE(maxMemAllocSize, kBufferSize);
+
+    cl_ulong globalMemSize = 0;
+    ASSERT_EQ(CL_SUCCESS, cl::clGetDeviceInfo(mDevice, CL_DEVICE_GLOBAL_MEM_SIZE,
+                                              sizeof(globalMemSize), &globalMemSize, nullptr));
+    EXPECT_GE(globalMemSize, maxMemAllocSize);
+
+    cl_uint memBaseAddrAlign = 0;
+    ASSERT_EQ(CL_SUCCESS,
+              cl::clGetDeviceInfo(mDevice, CL_DEVICE_MEM_BASE_ADDR_ALIGN, sizeof(memBaseAddrAlign),
+                                  &memBaseAddrAlign, nullptr));
+    EXPECT_GE(memBaseAddrAlign, 1024u);
+
+    char name[256] = {};
+    ASSERT_EQ(CL_SUCCESS,
+              cl::clGetDeviceInfo(mDevice, CL_DEVICE_NAME, sizeof(name) - 1, name, nullptr));
+    EXPECT_NE(0u, std::strlen(name));
+}
+
+// Tests that data written to a buffer, copied to another buffer and read back is unchanged.
+TEST_F(CLCommandQueueTest, WriteCopyRead)
+{
+    cl_mem source      = createBuffer(CL_MEM_READ_WRITE, kBufferSize, nullptr);
+    cl_mem destination = createBuffer(CL_MEM_READ_WRITE, kBufferSize, nullptr);
+    ASSERT_NE(nullptr, source);
+    ASSERT_NE(nullptr, destination);
+
+    const std::vector<uint8_t> writeData = MakePattern(kBufferSize, 7);
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueWriteBuffer(mQueue, source, CL_FALSE, 0, kBufferSize,
+                                                   writeData.data(), 0, nullptr, nullptr));
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueCopyBuffer(mQueue, source, destination, 0, 0, kBufferSize,
+                                                  0, nullptr, nullptr));
+
+    std::vector<uint8_t> readData(kBufferSize);
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueReadBuffer(mQueue, destination, CL_TRUE, 0, kBufferSize,
+                                                  readData.data(), 0, nullptr, nullptr));
+    EXPECT_EQ(writeData, readData);
+}
+
+// Tests that a copy between ranges of buffers and a non-blocking read complete by clFinish.
+TEST_F(CLCommandQueueTest, PartialCopyNonBlockingRead)
+{
+    constexpr size_t kOffset   = 256;
+    constexpr size_t kCopySize = 128;
+
+    const std::vector<uint8_t> sourceData = MakePattern(kBufferSize, 1);
+    std::vector<uint8_t> destinationData(kBufferSize, 0);
+
+    cl_mem source = createBuffer(CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, kBufferSize,
+                                 const_cast<uint8_t *>(sourceData.data()));
+    cl_mem destination = createBuffer(CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, kBufferSize,
+                                      destinationData.data());
+    ASSERT_NE(nullptr, source);
+    ASSERT_NE(nullptr, destination);
+
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueCopyBuffer(mQueue, source, destination, kOffset, 0,
+                                                  kCopySize, 0, nullptr, nullptr));
+
+    std::vector<uint8_t> readData(kBufferSize, 0xff);
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueReadBuffer(mQueue, destination, CL_FALSE, 0, kBufferSize,
+                                                  readData.data(), 0, nullptr, nullptr));
+    ASSERT_EQ(CL_SUCCESS, cl::clFinish(mQueue));
+
+    std::vector<uint8_t> expectedData(kBufferSize, 0);
+    std::copy(sourceData.begin() + kOffset, sourceData.begin() + kOffset + kCopySize,
+              expectedData.begin());
+    EXPECT_EQ(expectedData, readData);
+}
+
+// Tests that commands of an out-of-order queue run in the order of their event dependencies,
+// including a write after a read, and that a command of another queue can wait for them.
+TEST_F(CLCommandQueueTest, EventOrderedExecution)
+{
+    cl_command_queue outOfOrderQueue = createQueue(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    ASSERT_NE(nullptr, outOfOrderQueue);
+
+    cl_mem first  = createBuffer(CL_MEM_READ_WRITE, kBufferSize, nullptr);
+    cl_mem second = createBuffer(CL_MEM_READ_WRITE, kBufferSize, nullptr);
+    cl_mem third  = createBuffer(CL_MEM_READ_WRITE, kBufferSize, nullptr);
+    cl_mem fourth = createBuffer(CL_MEM_READ_WRITE, kBufferSize, nullptr);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_NE(nullptr, third);
+    ASSERT_NE(nullptr, fourth);
+
+    const std::vector<uint8_t> firstData  = MakePattern(kBufferSize, 3);
+    const std::vector<uint8_t> secondData = MakePattern(kBufferSize, 101);
+
+    // first -> second -> third in the out-of-order queue, then first is overwritten after it has
+    // been copied.
+    cl_event writeEvent = nullptr;
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueWriteBuffer(outOfOrderQueue, first, CL_FALSE, 0,
+                                                   kBufferSize, firstData.data(), 0, nullptr,
+                                                   &writeEvent));
+    cl_event copyEvent = nullptr;
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueCopyBuffer(outOfOrderQueue, first, second, 0, 0,
+                                                  kBufferSize, 1, &writeEvent, &copyEvent));
+    cl_event overwriteEvent = nullptr;
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueWriteBuffer(outOfOrderQueue, first, CL_FALSE, 0,
+                                                   kBufferSize, secondData.data(), 1, &copyEvent,
+                                                   &overwriteEvent));
+    cl_event chainEvent = nullptr;
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueCopyBuffer(outOfOrderQueue, second, third, 0, 0,
+                                                  kBufferSize, 1, &copyEvent, &chainEvent));
+
+    // A completed user event doesn't hold back the command that waits for it.
+    cl_int errorCode   = CL_SUCCESS;
+    cl_event userEvent = cl::clCreateUserEvent(mContext, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+    ASSERT_EQ(CL_SUCCESS, cl::clSetUserEventStatus(userEvent, CL_COMPLETE));
+
+    // The in-order queue copies third -> fourth after the chain of the other queue.
+    const cl_event crossQueueEvents[] = {chainEvent, userEvent};
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueCopyBuffer(mQueue, third, fourth, 0, 0, kBufferSize, 2,
+                                                  crossQueueEvents, nullptr));
+
+    std::vector<uint8_t> fourthReadData(kBufferSize);
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueReadBuffer(mQueue, fourth, CL_TRUE, 0, kBufferSize,
+                                                  fourthReadData.data(), 0, nullptr, nullptr));
+    EXPECT_EQ(firstData, fourthReadData);
+
+    std::vector<uint8_t> firstReadData(kBufferSize);
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueReadBuffer(outOfOrderQueue, first, CL_TRUE, 0, kBufferSize,
+                                                  firstReadData.data(), 1, &overwriteEvent,
+                                                  nullptr));
+    EXPECT_EQ(secondData, firstReadData);
+
+    // Every command has completed once its result has been read.
+    for (cl_event event : {writeEvent, copyEvent, overwriteEvent, chainEvent})
+    {
+        cl_int status = CL_QUEUED;
+        EXPECT_EQ(CL_SUCCESS, cl::clGetEventInfo(event, CL_EVENT_COMMAND_EXECUTION_STATUS,
+                                                 sizeof(status), &status, nullptr));
+        EXPECT_EQ(CL_COMPLETE, status);
+        cl::clReleaseEvent(event);
+    }
+    cl::clReleaseEvent(userEvent);
+}
+
+// Tests that commands waiting for a user event are held without blocking the enqueue, also in
+// another queue, and run once the status of the event is set.
+TEST_F(CLCommandQueueTest, UserEventSetAfterEnqueue)
+{
+    cl_command_queue otherQueue = createQueue(0);
+    ASSERT_NE(nullptr, otherQueue);
+
+    const std::vector<uint8_t> sourceData = MakePattern(kBufferSize, 9);
+    cl_mem source = createBuffer(CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, kBufferSize,
+                                 const_cast<uint8_t *>(sourceData.data()));
+    cl_mem middle      = createBuffer(CL_MEM_READ_WRITE, kBufferSize, nullptr);
+    cl_mem destination = createBuffer(CL_MEM_READ_WRITE, kBufferSize, nullptr);
+    ASSERT_NE(nullptr, source);
+    ASSERT_NE(nullptr, middle);
+    ASSERT_NE(nullptr, destination);
+
+    cl_int errorCode   = CL_SUCCESS;
+    cl_event userEvent = cl::clCreateUserEvent(mContext, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+
+    cl_event copyEvent = nullptr;
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueCopyBuffer(mQueue, source, middle, 0, 0, kBufferSize, 1,
+                                                  &userEvent, &copyEvent));
+    cl_event otherCopyEvent = nullptr;
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueCopyBuffer(otherQueue, middle, destination, 0, 0,
+                                                  kBufferSize, 1, &copyEvent, &otherCopyEvent));
+    ASSERT_EQ(CL_SUCCESS, cl::clFlush(mQueue));
+    ASSERT_EQ(CL_SUCCESS, cl::clFlush(otherQueue));
+
+    // Neither copy can run before the status of the user event is set.
+    for (cl_event event : {copyEvent, otherCopyEvent})
+    {
+        cl_int status = CL_COMPLETE;
+        EXPECT_EQ(CL_SUCCESS, cl::clGetEventInfo(event, CL_EVENT_COMMAND_EXECUTION_STATUS,
+                                                 sizeof(status), &status, nullptr));
+        EXPECT_EQ(CL_QUEUED, status);
+    }
+
+    ASSERT_EQ(CL_SUCCESS, cl::clSetUserEventStatus(userEvent, CL_COMPLETE));
+
+    std::vector<uint8_t> readData(kBufferSize);
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueReadBuffer(otherQueue, destination, CL_TRUE, 0,
+                                                  kBufferSize, readData.data(), 0, nullptr,
+                                                  nullptr));
+    EXPECT_EQ(sourceData, readData);
+
+    for (cl_event event : {copyEvent, otherCopyEvent})
+    {
+        cl_int status = CL_QUEUED;
+        EXPECT_EQ(CL_SUCCESS, cl::clGetEventInfo(event, CL_EVENT_COMMAND_EXECUTION_STATUS,
+                                                 sizeof(status), &status, nullptr));
+        EXPECT_EQ(CL_COMPLETE, status);
+        cl::clReleaseEvent(event);
+    }
+    cl::clReleaseEvent(userEvent);
+}
+
+// Tests that a failed user event terminates the commands waiting for it, and that the queue runs
+// the commands enqueued after them.
+TEST_F(CLCommandQueueTest, UserEventFailure)
+{
+    cl_mem buffer = createBuffer(CL_MEM_READ_WRITE, kBufferSize, nullptr);
+    ASSERT_NE(nullptr, buffer);
+
+    cl_int errorCode   = CL_SUCCESS;
+    cl_event userEvent = cl::clCreateUserEvent(mContext, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+
+    const std::vector<uint8_t> heldData = MakePattern(kBufferSize, 1);
+    cl_event heldEvent                  = nullptr;
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueWriteBuffer(mQueue, buffer, CL_FALSE, 0, kBufferSize,
+                                                   heldData.data(), 1, &userEvent, &heldEvent));
+    ASSERT_EQ(CL_SUCCESS, cl::clSetUserEventStatus(userEvent, -1));
+
+    cl_int status = CL_COMPLETE;
+    EXPECT_EQ(CL_SUCCESS, cl::clGetEventInfo(heldEvent, CL_EVENT_COMMAND_EXECUTION_STATUS,
+                                             sizeof(status), &status, nullptr));
+    EXPECT_EQ(CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST, status);
+
+    const std::vector<uint8_t> writeData = MakePattern(kBufferSize, 60);
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueWriteBuffer(mQueue, buffer, CL_FALSE, 0, kBufferSize,
+                                                   writeData.data(), 0, nullptr, nullptr));
+    std::vector<uint8_t> readData(kBufferSize);
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueReadBuffer(mQueue, buffer, CL_TRUE, 0, kBufferSize,
+                                                  readData.data(), 0, nullptr, nullptr));
+    EXPECT_EQ(writeData, readData);
+
+    cl::clReleaseEvent(heldEvent);
+    cl::clReleaseEvent(userEvent);
+}
+
+// Tests that the CL_COMPLETE callback of a flushed command is called without waiting on the queue.
+TEST_F(CLCommandQueueTest, CallbackAfterFlush)
+{
+    cl_mem buffer = createBuffer(CL_MEM_READ_WRITE, kBufferSize, nullptr);
+    ASSERT_NE(nullptr, buffer);
+
+    struct CallbackState
+    {
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool called = false;
+    } state;
+
+    const std::vector<uint8_t> writeData = MakePattern(kBufferSize, 30);
+    cl_event writeEvent                  = nullptr;
+    ASSERT_EQ(CL_SUCCESS, cl::clEnqueueWriteBuffer(mQueue, buffer, CL_FALSE, 0, kBufferSize,
+                                                   writeData.data(), 0, nullptr, &writeEvent));
+    ASSERT_EQ(CL_SUCCESS, cl::clSetEventCallback(
+                              writeEvent, CL_COMPLETE,
+                              [](cl_event event, cl_int status, void *userData) {
+                                  CallbackState *state = static_cast<CallbackState *>(userData);
+                                  std::lock_guard<std::mutex> lock(state->mutex);
+                                  state->called = true;
+                                  state->condition.notify_one();
+                              },
+                              &state));
+    ASSERT_EQ(CL_SUCCESS, cl::clFlush(mQueue));
+
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        EXPECT_TRUE(state.condition.wait_for(lock, std::chrono::seconds(10),
+                                             [&state] { return state.called; }));
+    }
+
+    // The queue is finished before |state| goes out of scope, in case the callback wasn't called.
+    ASSERT_EQ(CL_SUCCESS, cl::clFinish(mQueue));
+    cl::clReleaseEvent(writeEvent);
+}
+
+// Tests the coherence of a CL_MEM_USE_HOST_PTR buffer whose memory can be imported by the device.
+TEST_F(CLCommandQueueTest, UseHostPtrMapCoherence)
+{
+    mHostMemory = angle::AlignedAlloc(kHostMemoryAlignment, kHostMemoryAlignment);
+    ASSERT_NE(nullptr, mHostMemory);
+    testUseHostPtrCoherence(static_cast<uint8_t *>(mHostMemory), kHostMemoryAlignment);
+}
+
+// Tests the coherence of a CL_MEM_USE_HOST_PTR buffer whose memory is misaligned for an import, so
+// its maps are staged.
+TEST_F(CLCommandQueueTest, UseHostPtrMapCoherenceUnaligned)
+{
+    mHostMemory = angle::AlignedAlloc(kHostMemoryAlignment, kHostMemoryAlignment);
+    ASSERT_NE(nullptr, mHostMemory);
+    testUseHostPtrCoherence(static_cast<uint8_t *>(mHostMemory) + 16, kBufferSize);
+}
+}  // anonymous namespace
@@ -9,7 +9,10 @@
 // Must be included first to prevent errors with "None".
 #include "test_utils/ANGLETest.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <map>
+#include <mutex>
 #include <vector>
 
 #include "common/PackedEnums.h"
@@ -46,11 +49,17 @@ std::ostream &operator<<(std::ostream &os, CacheOpResult result)
 
 namespace
 {
+// Programs are stored in the cache by worker threads.
+std::mutex gApplicationCacheMutex;
+std::condition_variable gApplicationCacheCondition;
 std::map<std::vector<uint8_t>, std::vector<uint8_t>> gApplicationCache;
 CacheOpResult gLastCacheOpResult = CacheOpResult::ValueNotSet;
+angle::PackedEnumMap<CacheOpResult, size_t> gCacheOpCounts;
+std::vector<uint8_t> gLastSetKey;
 
 void SetBlob(const void *key, EGLsizeiANDROID keySize, const void *value, EGLsizeiANDROID valueSize)
 {
+    std::lock_guard<std::mutex> lock(gApplicationCacheMutex);
     std::vector<uint8_t> keyVec(keySize);
     memcpy(keyVec.data(), key, keySize);
 
@@ -58,8 +67,11 @@ void SetBlob(const void *key, EGLsizeiANDROID keySize, const void *value, EGLsiz
     memcpy(valueVec.data(), value, valueSize);
 
     gApplicationCache[keyVec] = valueVec;
+    gLastSetKey               = keyVec;
 
     gLastCacheOpResult = CacheOpResult::SetSuccess;
+    gCacheOpCounts[gLastCacheOpResult]++;
+    gApplicationCacheCondition.notify_all();
 }
 
 EGLsizeiANDROID GetBlob(const void *key,
@@ -67,6 +79,7 @@ EGLsizeiANDROID GetBlob(const void *key,
                         void *value,
                         EGLsizeiANDROID valueSize)
 {
+    std::lock_guard<std::mutex> lock(gApplicationCacheMutex);
     std::vector<uint8_t> keyVec(keySize);
     memcpy(keyVec.data(), key, keySize);
 
@@ -74,6 +87,7 @@ EGLsizeiANDROID GetBlob(const void *key,
     if (entry == gApplicationCache.end())
     {
         gLastCacheOpResult = CacheOpResult::GetNotFound;
+        gCacheOpCounts[gLastCacheOpResult]++;
         return 0;
     }
 
@@ -86,9 +100,38 @@ EGLsizeiANDROID GetBlob(const void *key,
     {
         gLastCacheOpResult = CacheOpResult::GetMemoryTooSmall;
     }
+    gCacheOpCounts[gLastCacheOpResult]++;
 
     return entry->second.size();
 }
+
+// Waits for a program to be stored in the cache, and returns the result of the last operation.
+CacheOpResult WaitForCacheSet()
+{
+    std::unique_lock<std::mutex> lock(gApplicationCacheMutex);
+    gApplicationCacheCondition.wait_for(lock, std::chrono::seconds(10), [] {
+        return gLastCacheOpResult == CacheOpResult::SetSuccess;
+    });
+    return gLastCacheOpResult;
+}
+
+// Waits for the cache to hold |count| entries.
+bool WaitForCacheEntries(size_t count)
+{
+    std::unique_lock<std::mutex> lock(gApplicationCacheMutex);
+    return gApplicationCacheCondition.wait_for(lock, std::chrono::seconds(10), [count] {
+        return gApplicationCache.size() >= count;
+    });
+}
+
+void ResetCacheOpCounts()
+{
+    std::lock_guard<std::mutex> lock(gApplicationCacheMutex);
+    for (size_t &count : gCacheOpCounts)
+    {
+        count = 0;
+    }
+}
 }  // anonymous namespace
 
 class EGLBlobCacheTest : public ANGLETest
@@ -106,7 +149,11 @@ class EGLBlobCacheTest : public ANGLETest
         mHasBlobCache      = IsEGLDisplayExtensionEnabled(display, kEGLExtName);
     }
 
-    void testTearDown() override { gApplicationCache.clear(); }
+    void testTearDown() override
+    {
+        gApplicationCache.clear();
+        ResetCacheOpCounts();
+    }
 
     bool programBinaryAvailable() { return IsGLExtensionEnabled("GL_OES_get_program_binary"); }
 
@@ -160,7 +207,7 @@ void main()
     if (programBinaryAvailable())
     {
         ANGLE_GL_PROGRAM(program, kVertexShaderSrc, kFragmentShaderSrc);
-        EXPECT_EQ(CacheOpResult::SetSuccess, gLastCacheOpResult);
+        EXPECT_EQ(CacheOpResult::SetSuccess, WaitForCacheSet());
         gLastCacheOpResult = CacheOpResult::ValueNotSet;
 
         // Compile the same shader again, so it would try to retrieve it from the cache
@@ -172,7 +219,7 @@ void main()
         // Compile another shader, which should create a new entry
         program.makeRaster(kVertexShaderSrc2, kFragmentShaderSrc2);
         ASSERT_TRUE(program.valid());
-        EXPECT_EQ(CacheOpResult::SetSuccess, gLastCacheOpResult);
+        EXPECT_EQ(CacheOpResult::SetSuccess, WaitForCacheSet());
         gLastCacheOpResult = CacheOpResult::ValueNotSet;
 
         // Compile the first shader again, which should still reside in the cache
@@ -267,7 +314,7 @@ void main() {
             glBindFragDataLocationIndexedEXT(p, 0, 1, "SecondaryFragData[0]");
         });
         ASSERT_NE(0u, program);
-        EXPECT_EQ(CacheOpResult::SetSuccess, gLastCacheOpResult);
+        EXPECT_EQ(CacheOpResult::SetSuccess, WaitForCacheSet());
         gLastCacheOpResult = CacheOpResult::ValueNotSet;
 
         // Re-link the program with different fragment output bindings
@@ -276,9 +323,101 @@ void main() {
             glBindFragDataLocationIndexedEXT(p, 0, 1, "SecondaryFragData");
         });
         ASSERT_NE(0u, program);
-        EXPECT_EQ(CacheOpResult::SetSuccess, gLastCacheOpResult);
+        EXPECT_EQ(CacheOpResult::SetSuccess, WaitForCacheSet());
         gLastCacheOpResult = CacheOpResult::ValueNotSet;
     }
 }
 
+class EGLBlobCacheTestES31 : public EGLBlobCacheTest
+{};
+
+// Tests that the OpenGL backends cache native program binaries of the programs the frontend
+// program cache doesn't apply to.
+TEST_P(EGLBlobCacheTestES31, NativeProgramBinary)
+{
+    ANGLE_SKIP_TEST_IF(!IsOpenGL() && !IsOpenGLES());
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    EXPECT_TRUE(mHasBlobCache);
+    eglSetBlobCacheFuncsANDROID(display, SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    ANGLE_SKIP_TEST_IF(!programBinaryAvailable());
+
+    auto makeSeparable = [](GLuint program) {
+        glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+    };
+
+    // Separable programs are not stored in the frontend program cache, so the only entry is the
+    // native binary.
+    GLuint program =
+        CompileProgram(essl31_shaders::vs::Simple(), essl31_shaders::fs::Red(), makeSeparable);
+    ASSERT_NE(0u, program);
+    EXPECT_EQ(CacheOpResult::SetSuccess, WaitForCacheSet());
+    EXPECT_EQ(1u, gApplicationCache.size());
+    gLastCacheOpResult = CacheOpResult::ValueNotSet;
+    glDeleteProgram(program);
+
+    // Linking the same program again loads the native binary.
+    program =
+        CompileProgram(essl31_shaders::vs::Simple(), essl31_shaders::fs::Red(), makeSeparable);
+    ASSERT_NE(0u, program);
+    EXPECT_EQ(CacheOpResult::GetSuccess, gLastCacheOpResult);
+    EXPECT_EQ(1u, gApplicationCache.size());
+    gLastCacheOpResult = CacheOpResult::ValueNotSet;
+
+    drawQuad(program, essl31_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+
+    glDeleteProgram(program);
+}
+
+// Tests that the OpenGL backends cache the native binaries of the programs in the frontend program
+// cache too, and load them when the frontend cache misses, as it does after an ANGLE update.
+TEST_P(EGLBlobCacheTestES31, NativeProgramBinaryAfterFrontendMiss)
+{
+    ANGLE_SKIP_TEST_IF(!IsOpenGL() && !IsOpenGLES());
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    EXPECT_TRUE(mHasBlobCache);
+    eglSetBlobCacheFuncsANDROID(display, SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    ANGLE_SKIP_TEST_IF(!programBinaryAvailable());
+
+    // The native binary is stored by the link, and the frontend program after it.
+    GLuint program = CompileProgram(essl31_shaders::vs::Simple(), essl31_shaders::fs::Red());
+    ASSERT_NE(0u, program);
+    ASSERT_TRUE(WaitForCacheEntries(2));
+    glDeleteProgram(program);
+
+    // Linking the same program again loads it from the frontend program cache.
+    ResetCacheOpCounts();
+    program = CompileProgram(essl31_shaders::vs::Simple(), essl31_shaders::fs::Red());
+    ASSERT_NE(0u, program);
+    EXPECT_EQ(1u, gCacheOpCounts[CacheOpResult::GetSuccess]);
+    EXPECT_EQ(2u, gApplicationCache.size());
+    glDeleteProgram(program);
+
+    // Without the frontend program, the native binary is loaded.
+    gApplicationCache.erase(gLastSetKey);
+    ResetCacheOpCounts();
+    program = CompileProgram(essl31_shaders::vs::Simple(), essl31_shaders::fs::Red());
+    ASSERT_NE(0u, program);
+    EXPECT_EQ(1u, gCacheOpCounts[CacheOpResult::GetNotFound]);
+    EXPECT_EQ(1u, gCacheOpCounts[CacheOpResult::GetSuccess]);
+
+    drawQuad(program, essl31_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+
+    glDeleteProgram(program);
+}
+
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(EGLBlobCacheTest);
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLBlobCacheTestES31);
+ANGLE_INSTANTIATE_TEST_ES31(EGLBlobCacheTestES31);
@@ -0,0 +1,171 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLFramePacingTest:
+//   Tests the lowLatencyFramePacing feature of the Vulkan back end.  The window surfaces of the
+//   headless Vulkan display simulate a display that shows one queued present per vblank, set
+//   through ANGLE_HEADLESS_REFRESH_RATE.  Other displays don't, so the tests skip on them.
+//
+
+#include "test_utils/ANGLETest.h"
+
+#include <algorithm>
+
+#include "common/system_utils.h"
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr char kImageCountVarName[]  = "ANGLE_HEADLESS_SWAPCHAIN_IMAGE_COUNT";
+constexpr char kRefreshRateVarName[] = "ANGLE_HEADLESS_REFRESH_RATE";
+constexpr char kImageCount[]         = "3";
+constexpr char kRefreshRate[]        = "60";
+constexpr double kRefreshPeriod      = 1.0 / 60.0;
+
+#if defined(ANGLE_USE_VULKAN_DISPLAY) && defined(ANGLE_VULKAN_DISPLAY_MODE_HEADLESS)
+constexpr bool kHasSimulatedVblanks = true;
+#else
+constexpr bool kHasSimulatedVblanks = false;
+#endif
+
+class EGLFramePacingTest : public ANGLETest
+{
+  protected:
+    EGLFramePacingTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+
+        // The surface is created in SetUp(), and reads the variables when it's created.
+        SetEnvironmentVar(kImageCountVarName, kImageCount);
+        SetEnvironmentVar(kRefreshRateVarName, kRefreshRate);
+    }
+
+    ~EGLFramePacingTest() override
+    {
+        UnsetEnvironmentVar(kImageCountVarName);
+        UnsetEnvironmentVar(kRefreshRateVarName);
+    }
+
+    // Clears the default framebuffer and swaps.  Returns the CPU time of the frame in seconds.
+    double clearAndSwap(const GLColor &color)
+    {
+        const double startTime = GetCurrentTime();
+        glClearColor(color.R / 255.0f, color.G / 255.0f, color.B / 255.0f, color.A / 255.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        swapBuffers();
+        return GetCurrentTime() - startTime;
+    }
+};
+
+// Tests that paced frames are still shown at the refresh rate, and that no frame waits much longer
+// than one frame interval.
+TEST_P(EGLFramePacingTest, FramesKeepRefreshRate)
+{
+    ANGLE_SKIP_TEST_IF(!kHasSimulatedVblanks);
+
+    constexpr uint32_t kWarmUpFrames = 5;
+    constexpr uint32_t kFrames       = 30;
+
+    for (uint32_t frame = 0; frame < kWarmUpFrames; ++frame)
+    {
+        clearAndSwap(GLColor::blue);
+    }
+
+    const double startTime = GetCurrentTime();
+    double longestFrame    = 0;
+    for (uint32_t frame = 0; frame < kFrames; ++frame)
+    {
+        longestFrame =
+            std::max(longestFrame, clearAndSwap(frame % 2 == 0 ? GLColor::red : GLColor::green));
+    }
+    const double elapsedTime = GetCurrentTime() - startTime;
+
+    // The simulated display can't show the frames faster than the refresh rate, and the pacing
+    // shouldn't make them miss vblanks.  The bounds are loose, since test machines are busy.
+    EXPECT_GE(elapsedTime, (kFrames - 3) * kRefreshPeriod);
+    EXPECT_LE(elapsedTime, 2 * kFrames * kRefreshPeriod);
+    EXPECT_LE(longestFrame, 6 * kRefreshPeriod);
+
+    // The image acquired after the paced frames is rendered to.
+    glClearColor(1, 1, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::yellow);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that a frame whose GPU work takes much longer than the frame interval doesn't block the
+// next frame until the work is done.  The pacing wait times out after about one frame interval.
+TEST_P(EGLFramePacingTest, SlowFrameDoesNotBlockNextFrame)
+{
+    ANGLE_SKIP_TEST_IF(!kHasSimulatedVblanks);
+
+    constexpr char kSlowFS[] = R"(precision highp float;
+uniform float seed;
+void main()
+{
+    float value = seed;
+    for (int i = 0; i < 4096; ++i)
+    {
+        value = fract(value * 1.0001 + 0.1);
+    }
+    gl_FragColor = vec4(value, 0.0, 0.0, 1.0);
+})";
+
+    ANGLE_GL_PROGRAM(slowProgram, essl1_shaders::vs::Simple(), kSlowFS);
+    glUseProgram(slowProgram);
+    glUniform1f(glGetUniformLocation(slowProgram, "seed"), 0.5f);
+
+    // Find a number of draws that keeps the GPU busy for a long time.
+    constexpr double kMinSlowFrameTime = 0.3;
+    constexpr uint32_t kMaxDraws       = 64;
+    uint32_t drawCount                 = 1;
+    double slowFrameTime               = 0;
+    while (true)
+    {
+        const double startTime = GetCurrentTime();
+        for (uint32_t draw = 0; draw < drawCount; ++draw)
+        {
+            drawQuad(slowProgram, essl1_shaders::PositionAttrib(), 0.5f);
+        }
+        glFinish();
+        slowFrameTime = GetCurrentTime() - startTime;
+        if (slowFrameTime >= kMinSlowFrameTime || drawCount >= kMaxDraws)
+        {
+            break;
+        }
+        drawCount *= 2;
+    }
+    ANGLE_SKIP_TEST_IF(slowFrameTime < kMinSlowFrameTime);
+    swapBuffers();
+
+    // Pace a few fast frames, so the frame interval is one refresh again.
+    for (uint32_t frame = 0; frame < 5; ++frame)
+    {
+        clearAndSwap(GLColor::blue);
+    }
+
+    for (uint32_t draw = 0; draw < drawCount; ++draw)
+    {
+        drawQuad(slowProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    }
+    swapBuffers();
+
+    // The next frame waits for the slow frame for at most about one frame interval.
+    EXPECT_LT(clearAndSwap(GLColor::green), slowFrameTime / 2);
+    ASSERT_GL_NO_ERROR();
+}
+}  // anonymous namespace
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLFramePacingTest);
+ANGLE_INSTANTIATE_TEST(EGLFramePacingTest,
+                       WithLowLatencyFramePacing(ES2_VULKAN()),
+                       WithLowLatencyFramePacing(ES2_VULKAN_SWIFTSHADER()));
@@ -219,6 +219,35 @@ TEST_P(LineLoopTest, LineLoopUIntIndexBuffer)
     runTest(GL_UNSIGNED_INT, buf, reinterpret_cast<const void *>(sizeof(GLuint)));
 }
 
+// Test that line loops drawn from an index buffer are converted again after the indices change.
+TEST_P(LineLoopTest, LineLoopIndexBufferUpdatedBetweenDraws)
+{
+    // Disable D3D11 SDK Layers warnings checks, see ANGLE issue 667 for details
+    ignoreD3D11SDKLayersWarnings();
+
+    static const GLfloat degeneratePositions[10] = {};
+    static const GLushort degenerateIndices[]    = {0, 1, 2, 3, 4, 0};
+    static const GLushort indices[]              = {0, 7, 6, 9, 8, 0};
+
+    GLBuffer buf;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(degenerateIndices), degenerateIndices,
+                 GL_STATIC_DRAW);
+
+    // Draw a degenerate loop from the same range of the buffer first.
+    glUseProgram(mProgram);
+    glEnableVertexAttribArray(mPositionLocation);
+    glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, degeneratePositions);
+    glDrawElements(GL_LINE_LOOP, 4, GL_UNSIGNED_SHORT,
+                   reinterpret_cast<const void *>(sizeof(GLushort)));
+    ASSERT_GL_NO_ERROR();
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(indices), indices);
+
+    runTest(GL_UNSIGNED_SHORT, buf, reinterpret_cast<const void *>(sizeof(GLushort)));
+}
+
 class LineLoopTestES3 : public LineLoopTest
 {};
 
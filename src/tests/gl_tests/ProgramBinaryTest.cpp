@@ -7,6 +7,7 @@
 #include "test_utils/ANGLETest.h"
 
 #include <stdint.h>
+#include <algorithm>
 #include <memory>
 
 #include "common/string_utils.h"
@@ -996,6 +997,121 @@ void main() {
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that buffer variable reflection is intact when loading a program from binary.  Buffer
+// variables are only parsed from the binary when first queried.
+TEST_P(ProgramBinaryES31Test, BufferVariableResourceQueries)
+{
+    // We can't run the test if no program binary formats are supported.
+    GLint binaryFormatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+    ANGLE_SKIP_TEST_IF(binaryFormatCount == 0);
+
+    constexpr char kComputeShader[] = R"(#version 310 es
+layout(local_size_x=1, local_size_y=1, local_size_z=1) in;
+layout(std430, binding = 0) buffer Block
+{
+    uint first;
+    uvec4 second[2];
+} instance;
+void main() {
+    instance.first = instance.second[1].x;
+})";
+
+    ANGLE_GL_COMPUTE_PROGRAM(program, kComputeShader);
+
+    GLint programLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &programLength);
+    ASSERT_GL_NO_ERROR();
+
+    GLsizei readLength  = 0;
+    GLenum binaryFormat = GL_NONE;
+    std::vector<uint8_t> binary(programLength);
+    glGetProgramBinary(program, programLength, &readLength, &binaryFormat, binary.data());
+    ASSERT_GL_NO_ERROR();
+
+    ANGLE_GL_BINARY_ES3_PROGRAM(binaryProgram, binary, binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    for (GLuint queriedProgram : {program.get(), binaryProgram.get()})
+    {
+        GLint activeBufferVariables = 0;
+        glGetProgramInterfaceiv(queriedProgram, GL_BUFFER_VARIABLE, GL_ACTIVE_RESOURCES,
+                                &activeBufferVariables);
+        EXPECT_EQ(2, activeBufferVariables);
+
+        GLuint index =
+            glGetProgramResourceIndex(queriedProgram, GL_BUFFER_VARIABLE, "Block.second[0]");
+        EXPECT_NE(GL_INVALID_INDEX, index);
+
+        constexpr GLenum kProps[] = {GL_OFFSET, GL_ARRAY_SIZE};
+        GLint params[2]           = {};
+        glGetProgramResourceiv(queriedProgram, GL_BUFFER_VARIABLE, index, 2, kProps, 2, nullptr,
+                               params);
+        EXPECT_EQ(16, params[0]);
+        EXPECT_EQ(2, params[1]);
+        ASSERT_GL_NO_ERROR();
+    }
+}
+
+// Tests that a binary with corrupt buffer variables fails to load, even though buffer variables
+// are only parsed from the binary when first queried.
+TEST_P(ProgramBinaryES31Test, CorruptBufferVariablesFailToLoad)
+{
+    // We can't run the test if no program binary formats are supported.
+    GLint binaryFormatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+    ANGLE_SKIP_TEST_IF(binaryFormatCount == 0);
+
+    constexpr char kComputeShader[] = R"(#version 310 es
+layout(local_size_x=1, local_size_y=1, local_size_z=1) in;
+layout(std430, binding = 0) buffer Block
+{
+    uint first;
+    uvec4 second[2];
+} instance;
+void main() {
+    instance.first = instance.second[1].x;
+})";
+
+    ANGLE_GL_COMPUTE_PROGRAM(program, kComputeShader);
+
+    GLint programLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &programLength);
+    ASSERT_GL_NO_ERROR();
+
+    GLsizei readLength  = 0;
+    GLenum binaryFormat = GL_NONE;
+    std::vector<uint8_t> binary(programLength);
+    glGetProgramBinary(program, programLength, &readLength, &binaryFormat, binary.data());
+    ASSERT_GL_NO_ERROR();
+
+    // Find the serialized name of a buffer variable: its length followed by its characters.
+    const std::string kName = "Block.second";
+    std::vector<uint8_t> serializedName(sizeof(size_t) + kName.size());
+    const size_t nameLength = kName.size();
+    memcpy(serializedName.data(), &nameLength, sizeof(size_t));
+    memcpy(serializedName.data() + sizeof(size_t), kName.data(), kName.size());
+
+    auto nameIter =
+        std::search(binary.begin(), binary.end(), serializedName.begin(), serializedName.end());
+    ASSERT_NE(binary.end(), nameIter);
+
+    // Make the name run past the end of the binary.
+    std::vector<uint8_t> corruptBinary = binary;
+    const size_t corruptLength         = binary.size();
+    memcpy(corruptBinary.data() + (nameIter - binary.begin()), &corruptLength, sizeof(size_t));
+
+    GLuint corruptProgram = glCreateProgram();
+    glProgramBinary(corruptProgram, binaryFormat, corruptBinary.data(),
+                    static_cast<GLsizei>(corruptBinary.size()));
+
+    GLint linkStatus = GL_TRUE;
+    glGetProgramiv(corruptProgram, GL_LINK_STATUS, &linkStatus);
+    EXPECT_EQ(GL_FALSE, linkStatus);
+    glDeleteProgram(corruptProgram);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Tests that image texture works correctly when loading a program from binary.
 TEST_P(ProgramBinaryES31Test, ImageTextureBinding)
 {
@@ -658,6 +658,92 @@ TEST_P(ReadPixelsPBODrawTest, DrawWithPBO)
     EXPECT_EQ(GLColor(1, 2, 3, 4), color);
 }
 
+// Test that a readback of the window into a PBO lands before the PBO is used as vertex data.  The
+// readback is flipped, which the Vulkan back end packs on the CPU after the GPU copy.
+TEST_P(ReadPixelsPBODrawTest, DrawWithWindowReadbackAsVertexData)
+{
+    constexpr char kVS[] = R"(attribute vec4 position;
+attribute vec3 color;
+varying vec3 vColor;
+void main()
+{
+    vColor      = color;
+    gl_Position = position;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec3 vColor;
+void main()
+{
+    gl_FragColor = vec4(vColor, 1.0);
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+
+    const GLColor kColor(64, 128, 192, 255);
+    glClearColor(kColor.R / 255.0f, kColor.G / 255.0f, kColor.B / 255.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // One pixel per vertex of the quad.
+    constexpr GLsizei kQuadVertexCount = 6;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mPBO);
+    glReadPixels(0, 0, kQuadVertexCount, 1, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    ASSERT_GL_NO_ERROR();
+
+    // Three unsigned bytes per vertex are converted by some back ends.
+    GLint colorLocation = glGetAttribLocation(program, "color");
+    ASSERT_NE(-1, colorLocation);
+    glBindBuffer(GL_ARRAY_BUFFER, mPBO);
+    glVertexAttribPointer(colorLocation, 3, GL_UNSIGNED_BYTE, GL_TRUE, 4, nullptr);
+    glEnableVertexAttribArray(colorLocation);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawQuad(program, "position", 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_NEAR(getWindowWidth() / 2, getWindowHeight() / 2, kColor, 1);
+}
+
+// Test that a readback of the window into a PBO lands before the PBO is used as index data.  The
+// unsigned byte indices are converted by some back ends.
+TEST_P(ReadPixelsPBODrawTest, DrawWithWindowReadbackAsIndexData)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+
+    // The red, green and blue channels of the readback are the indices of a triangle that covers
+    // the window.  If the readback was missed, the triangle is degenerate.
+    glClearColor(0.0f, 1.0f / 255.0f, 2.0f / 255.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mPBO);
+    glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    ASSERT_GL_NO_ERROR();
+
+    constexpr std::array<GLfloat, 6> kPositions = {-1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f};
+    GLBuffer positionBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, positionBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kPositions), kPositions.data(), GL_STATIC_DRAW);
+
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mPBO);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_BYTE, nullptr);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::red);
+}
+
 class ReadPixelsMultisampleTest : public ReadPixelsTest
 {
   protected:
@@ -6949,6 +6949,264 @@ TEST_P(SimpleStateChangeTestES31, PrimitiveBoundingBoxNegativeTest)
     glGetFloatv(GL_PRIMITIVE_BOUNDING_BOX_EXT, boundingBox);
     EXPECT_GL_ERROR(GL_INVALID_ENUM);
 }
+
+// Runs with the GL back end's batchDrawCallsWithMultiDraw feature, which holds back consecutive
+// draws and submits them as one native multi-draw call.
+class BatchedDrawStateChangeTestES3 : public ANGLETest
+{
+  protected:
+    static constexpr int kGridSize  = 8;
+    static constexpr int kCellCount = kGridSize * kGridSize;
+
+    BatchedDrawStateChangeTestES3()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void testSetUp() override
+    {
+        constexpr char kVS[] = R"(#version 300 es
+in vec2 position;
+void main()
+{
+    gl_Position = vec4(position, 0, 1);
+})";
+
+        constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+uniform vec4 color;
+out vec4 colorOut;
+void main()
+{
+    colorOut = color;
+})";
+
+        mProgram = CompileProgram(kVS, kFS);
+        ASSERT_NE(0u, mProgram);
+        glUseProgram(mProgram);
+        mColorLocation = glGetUniformLocation(mProgram, "color");
+        ASSERT_NE(-1, mColorLocation);
+
+        // Two triangles per grid cell, drawn with glDrawArrays(first = 6 * cell) or with
+        // glDrawElements from the matching range of a sequential index buffer.
+        std::vector<GLfloat> vertices;
+        std::vector<GLushort> indices;
+        for (int cell = 0; cell < kCellCount; ++cell)
+        {
+            const GLfloat x0 = -1.0f + 2.0f * (cell % kGridSize) / kGridSize;
+            const GLfloat y0 = -1.0f + 2.0f * (cell / kGridSize) / kGridSize;
+            const GLfloat x1 = x0 + 2.0f / kGridSize;
+            const GLfloat y1 = y0 + 2.0f / kGridSize;
+            vertices.insert(vertices.end(), {x0, y0, x1, y0, x1, y1, x0, y0, x1, y1, x0, y1});
+        }
+        for (GLushort index = 0; index < kCellCount * 6; ++index)
+        {
+            indices.push_back(index);
+        }
+
+        glBindVertexArray(mVertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(vertices[0]), vertices.data(),
+                     GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(indices[0]), indices.data(),
+                     GL_STATIC_DRAW);
+
+        const GLint positionLocation = glGetAttribLocation(mProgram, "position");
+        ASSERT_NE(-1, positionLocation);
+        glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(positionLocation);
+
+        glClearColor(0, 0, 0, 0);
+        glClear(GL_COLOR_BUFFER_BIT);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void testTearDown() override { glDeleteProgram(mProgram); }
+
+    void setColor(const GLColor &color)
+    {
+        const Vector4 colorF = color.toNormalizedVector();
+        glUniform4f(mColorLocation, colorF[0], colorF[1], colorF[2], colorF[3]);
+    }
+
+    void drawCellArrays(int cell) { glDrawArrays(GL_TRIANGLES, cell * 6, 6); }
+
+    void drawCellElements(int cell)
+    {
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT,
+                       reinterpret_cast<const void *>(cell * 6 * sizeof(GLushort)));
+    }
+
+    void expectCellColor(int cell, const GLColor &color)
+    {
+        const int cellSize = getWindowWidth() / kGridSize;
+        EXPECT_PIXEL_COLOR_EQ((cell % kGridSize) * cellSize + cellSize / 2,
+                              (cell / kGridSize) * cellSize + cellSize / 2, color);
+    }
+
+    GLuint mProgram      = 0;
+    GLint mColorLocation = -1;
+    GLVertexArray mVertexArray;
+    GLBuffer mVertexBuffer;
+    GLBuffer mIndexBuffer;
+};
+
+// Tests that runs of draws separated by uniform, buffer and draw type changes each render with the
+// state they were issued with.
+TEST_P(BatchedDrawStateChangeTestES3, DrawsAroundStateChanges)
+{
+    const GLColor kColors[] = {
+        GLColor::red,  GLColor::green,   GLColor::blue,  GLColor::yellow,
+        GLColor::cyan, GLColor::magenta, GLColor::white, GLColor(255, 128, 0, 255)};
+    constexpr int kCellsPerColor = kCellCount / static_cast<int>(ArraySize(kColors));
+
+    // The first half of the grid is drawn with glDrawArrays and the second with glDrawElements.
+    // The color changes every few cells.
+    for (int cell = 0; cell < kCellCount; ++cell)
+    {
+        if (cell % kCellsPerColor == 0)
+        {
+            setColor(kColors[cell / kCellsPerColor]);
+        }
+
+        if (cell < kCellCount / 2)
+        {
+            drawCellArrays(cell);
+        }
+        else
+        {
+            drawCellElements(cell);
+        }
+
+        // Collapse the cells drawn so far with the current color.  The draws that are held back
+        // must have read the vertices before this update.
+        if (cell % kCellsPerColor == kCellsPerColor - 1)
+        {
+            const int firstCell = cell + 1 - kCellsPerColor;
+            std::vector<GLfloat> zeros(kCellsPerColor * 6 * 2, 0.0f);
+            glBufferSubData(GL_ARRAY_BUFFER, firstCell * 6 * 2 * sizeof(GLfloat),
+                            zeros.size() * sizeof(GLfloat), zeros.data());
+        }
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (int cell = 0; cell < kCellCount; ++cell)
+    {
+        expectCellColor(cell, kColors[cell / kCellsPerColor]);
+    }
+}
+
+// Tests that draws held back for batching are submitted before the framebuffer is read or
+// cleared.
+TEST_P(BatchedDrawStateChangeTestES3, DrawsBeforeReadAndClear)
+{
+    setColor(GLColor::green);
+    for (int cell = 0; cell < kCellCount; ++cell)
+    {
+        drawCellArrays(cell);
+    }
+    for (int cell = 0; cell < kCellCount; ++cell)
+    {
+        expectCellColor(cell, GLColor::green);
+    }
+
+    // Clear a region that was just drawn to, then draw over half of it again.
+    for (int cell = 0; cell < kCellCount; ++cell)
+    {
+        drawCellElements(cell);
+    }
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, getWindowWidth(), getWindowHeight() / 2);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDisable(GL_SCISSOR_TEST);
+    setColor(GLColor::blue);
+    for (int cell = 0; cell < kCellCount / 4; ++cell)
+    {
+        drawCellElements(cell);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (int cell = 0; cell < kCellCount; ++cell)
+    {
+        const GLColor expected = cell < kCellCount / 4   ? GLColor::blue
+                                 : cell < kCellCount / 2 ? GLColor::transparentBlack
+                                                         : GLColor::green;
+        expectCellColor(cell, expected);
+    }
+}
+
+// Tests that the draws merged into native multi-draw calls are counted by the
+// GL_AMD_performance_monitor counters.
+TEST_P(BatchedDrawStateChangeTestES3, PerfMonitorCountsBatchedDraws)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_AMD_performance_monitor"));
+    // glMultiDrawArrays is only guaranteed on desktop GL.
+    ANGLE_SKIP_TEST_IF(!IsDesktopOpenGL());
+
+    GLint numGroups = 0;
+    glGetPerfMonitorGroupsAMD(&numGroups, 0, nullptr);
+    std::vector<GLuint> groups(numGroups);
+    glGetPerfMonitorGroupsAMD(nullptr, numGroups, groups.data());
+
+    GLuint batchingGroup = 0;
+    bool foundGroup      = false;
+    for (GLuint group : groups)
+    {
+        char name[64] = {};
+        glGetPerfMonitorGroupStringAMD(group, sizeof(name), nullptr, name);
+        if (std::string(name) == "gl_draw_batching")
+        {
+            batchingGroup = group;
+            foundGroup    = true;
+        }
+    }
+    ASSERT_TRUE(foundGroup);
+
+    // Counter 1 is nativeDrawCallsSaved.
+    GLuint savedDrawsCounter = 1;
+    char counterName[64]     = {};
+    glGetPerfMonitorCounterStringAMD(batchingGroup, savedDrawsCounter, sizeof(counterName),
+                                     nullptr, counterName);
+    ASSERT_EQ(std::string("nativeDrawCallsSaved"), counterName);
+
+    GLuint monitor = 0;
+    glGenPerfMonitorsAMD(1, &monitor);
+    glSelectPerfMonitorCountersAMD(monitor, GL_TRUE, batchingGroup, 1, &savedDrawsCounter);
+    glBeginPerfMonitorAMD(monitor);
+
+    // Sixteen draws without state changes in between are submitted as one multi-draw call.
+    setColor(GLColor::red);
+    for (int cell = 0; cell < 16; ++cell)
+    {
+        drawCellArrays(cell);
+    }
+    glFlush();
+
+    glEndPerfMonitorAMD(monitor);
+    ASSERT_GL_NO_ERROR();
+
+    GLuint result[4] = {};
+    glGetPerfMonitorCounterDataAMD(monitor, GL_PERFMON_RESULT_AMD, sizeof(result), result,
+                                   nullptr);
+    ASSERT_GL_NO_ERROR();
+
+    uint64_t savedDraws = 0;
+    memcpy(&savedDraws, &result[2], sizeof(savedDraws));
+    EXPECT_EQ(15u, savedDraws);
+
+    glDeletePerfMonitorsAMD(1, &monitor);
+
+    for (int cell = 0; cell < 16; ++cell)
+    {
+        expectCellColor(cell, GLColor::red);
+    }
+}
 }  // anonymous namespace
 
 ANGLE_INSTANTIATE_TEST_ES2(StateChangeTest);
@@ -6992,3 +7250,8 @@ ANGLE_INSTANTIATE_TEST_ES31(ValidationStateChangeTestES31);
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(WebGLComputeValidationStateChangeTest);
 ANGLE_INSTANTIATE_TEST_ES31(WebGLComputeValidationStateChangeTest);
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BatchedDrawStateChangeTestES3);
+ANGLE_INSTANTIATE_TEST(BatchedDrawStateChangeTestES3,
+                       WithBatchDrawCalls(ES3_OPENGL()),
+                       WithBatchDrawCalls(ES3_OPENGLES()));
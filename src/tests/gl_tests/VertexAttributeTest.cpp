@@ -1733,6 +1733,93 @@ void main()
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::yellow);
 }
 
+// Tests that many consecutive draws from client memory each see their own data.  The client data
+// of every draw is large enough for the streamed data of the draws to wrap around the backend's
+// streaming buffers several times.
+TEST_P(VertexAttributeTest, ManyDrawsFromClientMemory)
+{
+    constexpr char kVS[] = R"(attribute vec4 a_position;
+attribute vec4 a_color;
+varying vec4 v_color;
+void main()
+{
+    v_color = a_color;
+    gl_Position = a_position;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec4 v_color;
+void main()
+{
+    gl_FragColor = v_color;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, "a_position");
+    GLint colorLocation    = glGetAttribLocation(program, "a_color");
+    ASSERT_NE(-1, positionLocation);
+    ASSERT_NE(-1, colorLocation);
+
+    // Only the first 6 vertices and indices form a quad, the rest are degenerate.  The sizes are
+    // chosen so that the data of a draw doesn't evenly divide any power of two.
+    constexpr GLsizei kVertexCount = 601;
+    constexpr GLsizei kIndexCount  = 3003;
+    constexpr GLint kCellSize      = 8;
+    const GLint cellsPerRow        = getWindowWidth() / kCellSize;
+    const GLint cellCount          = cellsPerRow * (getWindowHeight() / kCellSize);
+
+    std::vector<Vector4> positions(kVertexCount, Vector4(0.0f, 0.0f, 0.0f, 1.0f));
+    const std::array<Vector3, 6> &quadVertices = GetQuadVertices();
+    for (size_t vertex = 0; vertex < quadVertices.size(); ++vertex)
+    {
+        positions[vertex] = Vector4(quadVertices[vertex], 1.0f);
+    }
+
+    std::vector<GLushort> indices(kIndexCount, 0);
+    for (GLushort index = 0; index < 6; ++index)
+    {
+        indices[index] = index;
+    }
+
+    glVertexAttribPointer(positionLocation, 4, GL_FLOAT, GL_FALSE, 0, positions.data());
+    glEnableVertexAttribArray(positionLocation);
+    glEnable(GL_SCISSOR_TEST);
+
+    std::vector<GLColor> cellColors(cellCount);
+    std::vector<Vector4> colors(kVertexCount);
+    for (GLint cell = 0; cell < cellCount; ++cell)
+    {
+        cellColors[cell] = GLColor(static_cast<GLubyte>(cell), static_cast<GLubyte>(255 - cell),
+                                   static_cast<GLubyte>(cell * 7), 255);
+        std::fill(colors.begin(), colors.end(), cellColors[cell].toNormalizedVector());
+        glVertexAttribPointer(colorLocation, 4, GL_FLOAT, GL_FALSE, 0, colors.data());
+        glEnableVertexAttribArray(colorLocation);
+
+        glScissor((cell % cellsPerRow) * kCellSize, (cell / cellsPerRow) * kCellSize, kCellSize,
+                  kCellSize);
+        if (cell % 2 == 0)
+        {
+            glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+        }
+        else
+        {
+            glDrawElements(GL_TRIANGLES, kIndexCount, GL_UNSIGNED_SHORT, indices.data());
+        }
+
+        // Overwrite the client data, which must have been copied by the draw call.
+        std::fill(colors.begin(), colors.end(), Vector4(1.0f, 0.0f, 0.0f, 1.0f));
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (GLint cell = 0; cell < cellCount; ++cell)
+    {
+        EXPECT_PIXEL_COLOR_NEAR((cell % cellsPerRow) * kCellSize + kCellSize / 2,
+                                (cell / cellsPerRow) * kCellSize + kCellSize / 2,
+                                cellColors[cell], 1);
+    }
+}
+
 // Tests that rendering is fine if GL_ANGLE_relaxed_vertex_attribute_type is enabled
 // and mismatched integer signedness between the program's attribute type and the
 // attribute type specified by VertexAttribIPointer are used.
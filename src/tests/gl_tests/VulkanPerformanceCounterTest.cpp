@@ -19,7 +19,9 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
 #include "test_utils/gl_raii.h"
+#include "util/test_utils.h"
 
 using namespace angle;
 
@@ -49,6 +51,12 @@ class VulkanPerformanceCounterTest : public ANGLETest
         return contextVk->getPerfCounters();
     }
 
+    const angle::FeaturesVk &hackANGLEFeatures() const
+    {
+        const gl::Context *context = static_cast<const gl::Context *>(getEGLWindow()->getContext());
+        return rx::GetImplAs<rx::ContextVk>(context)->getFeatures();
+    }
+
     static constexpr GLsizei kInvalidateTestSize = 16;
 
     void setupClearAndDrawForInvalidateTest(GLProgram *program,
@@ -170,11 +178,168 @@ class VulkanPerformanceCounterTest : public ANGLETest
         EXPECT_EQ(expected.depthAttachmentResolves, counters.depthAttachmentResolves);
         EXPECT_EQ(expected.stencilAttachmentResolves, counters.stencilAttachmentResolves);
     }
+
+    // Finds the GL_AMD_performance_monitor group named |groupName|, and its counters.
+    bool findPerfMonitorGroup(const std::string &groupName,
+                              GLuint *groupOut,
+                              std::vector<GLuint> *countersOut)
+    {
+        GLint numGroups = 0;
+        glGetPerfMonitorGroupsAMD(&numGroups, 0, nullptr);
+        std::vector<GLuint> groups(numGroups);
+        glGetPerfMonitorGroupsAMD(nullptr, numGroups, groups.data());
+
+        for (GLuint group : groups)
+        {
+            char name[64] = {};
+            glGetPerfMonitorGroupStringAMD(group, sizeof(name), nullptr, name);
+            if (groupName == name)
+            {
+                GLint numCounters = 0;
+                glGetPerfMonitorCountersAMD(group, &numCounters, nullptr, 0, nullptr);
+                countersOut->resize(numCounters);
+                glGetPerfMonitorCountersAMD(group, nullptr, nullptr, numCounters,
+                                            countersOut->data());
+                *groupOut = group;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Finds the GL_AMD_performance_monitor counter named |counterName|, and its group.
+    bool findPerfMonitorCounter(const std::string &counterName,
+                                GLuint *groupOut,
+                                GLuint *counterOut)
+    {
+        GLint numGroups = 0;
+        glGetPerfMonitorGroupsAMD(&numGroups, 0, nullptr);
+        std::vector<GLuint> groups(numGroups);
+        glGetPerfMonitorGroupsAMD(nullptr, numGroups, groups.data());
+
+        for (GLuint group : groups)
+        {
+            GLint numCounters = 0;
+            glGetPerfMonitorCountersAMD(group, &numCounters, nullptr, 0, nullptr);
+            std::vector<GLuint> counters(numCounters);
+            glGetPerfMonitorCountersAMD(group, nullptr, nullptr, numCounters, counters.data());
+
+            for (GLuint counter : counters)
+            {
+                char name[64] = {};
+                glGetPerfMonitorCounterStringAMD(group, counter, sizeof(name), nullptr, name);
+                if (counterName == name)
+                {
+                    *groupOut   = group;
+                    *counterOut = counter;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Generates a monitor of |counters| of |group|, and begins it.
+    GLuint beginPerfMonitor(GLuint group, std::vector<GLuint> counters)
+    {
+        GLuint monitor = 0;
+        glGenPerfMonitorsAMD(1, &monitor);
+        glSelectPerfMonitorCountersAMD(monitor, GL_TRUE, group,
+                                       static_cast<GLint>(counters.size()), counters.data());
+        glBeginPerfMonitorAMD(monitor);
+        return monitor;
+    }
+
+    // Ends |monitor| and returns the values of its counters, in the order they were selected.
+    std::vector<uint64_t> endPerfMonitor(GLuint monitor,
+                                         GLuint group,
+                                         const std::vector<GLuint> &counters)
+    {
+        glEndPerfMonitorAMD(monitor);
+
+        GLuint available = GL_FALSE;
+        glGetPerfMonitorCounterDataAMD(monitor, GL_PERFMON_RESULT_AVAILABLE_AMD,
+                                       sizeof(available), &available, nullptr);
+        EXPECT_EQ(static_cast<GLuint>(GL_TRUE), available);
+
+        // Each counter's result is its group, its index and its 64-bit value.
+        std::vector<GLuint> result(4 * counters.size());
+        const GLsizei resultSize = static_cast<GLsizei>(result.size() * sizeof(GLuint));
+        GLint bytesWritten       = 0;
+        glGetPerfMonitorCounterDataAMD(monitor, GL_PERFMON_RESULT_AMD, resultSize, result.data(),
+                                       &bytesWritten);
+        EXPECT_EQ(resultSize, bytesWritten);
+
+        std::vector<uint64_t> values(counters.size());
+        for (size_t index = 0; index < counters.size(); ++index)
+        {
+            EXPECT_EQ(group, result[4 * index]);
+            EXPECT_EQ(counters[index], result[4 * index + 1]);
+            memcpy(&values[index], &result[4 * index + 2], sizeof(uint64_t));
+        }
+        return values;
+    }
+
+    // Uses a buffer in a draw, then deletes it while the GPU may still be using it.
+    void drawAndDeleteBuffer()
+    {
+        ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+        std::vector<GLfloat> vertices(6 * 3, 0.0f);
+        GLBuffer buffer;
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GLfloat), vertices.data(),
+                     GL_STATIC_DRAW);
+        GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+        glUseProgram(program);
+        glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(positionLocation);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // Waits for the garbage queued so far to be destroyed, which the garbage cleanup thread of
+    // the asyncGarbageCleanup feature does some time after the GPU is done with it.
+    void waitForGarbageCleanup()
+    {
+        const gl::Context *context = static_cast<const gl::Context *>(getEGLWindow()->getContext());
+        rx::RendererVk *renderer   = rx::GetImplAs<rx::ContextVk>(context)->getRenderer();
+
+        constexpr unsigned int kMaxWaitMs = 5000;
+        for (unsigned int waitMs = 0; waitMs < kMaxWaitMs; ++waitMs)
+        {
+            const rx::vk::GarbageStats stats = renderer->getGarbageStats();
+            if (stats.destroyedObjects == stats.queuedObjects)
+            {
+                return;
+            }
+            angle::Sleep(1);
+        }
+    }
+
+    // Attaches |texture| to the bound framebuffer, draws |color| to it and checks that the draw
+    // rendered to the texture.
+    void drawToAttachment(GLuint program, GLuint texture, const GLColor &color)
+    {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+        ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+        glUseProgram(program);
+        GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+        glUniform4fv(colorLocation, 1, color.toNormalizedVector().data());
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, color);
+    }
 };
 
 class VulkanPerformanceCounterTest_ES31 : public VulkanPerformanceCounterTest
 {};
 
+class VulkanPerformanceCounterTest_AsyncGarbageCleanup : public VulkanPerformanceCounterTest
+{};
+
+class VulkanPerformanceCounterTest_NoImagelessFramebuffer : public VulkanPerformanceCounterTest
+{};
+
 // Tests that texture updates to unused textures don't break the RP.
 TEST_P(VulkanPerformanceCounterTest, NewTextureDoesNotBreakRenderPass)
 {
@@ -3046,7 +3211,307 @@ void main()
     EXPECT_EQ(descriptorSetAllocationsAfter, 0u);
 }
 
+// Tests that the vertex and index conversions of draws in the same render pass are recorded
+// without breaking the render pass, and that the draws use the converted data.  GL_FIXED vertices
+// are always converted, and the second draw's vertices are at an offset in their buffer.
+TEST_P(VulkanPerformanceCounterTest, ConversionsDoNotBreakRenderPass)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    GLint colorLocation    = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, positionLocation);
+    ASSERT_NE(-1, colorLocation);
+
+    // The left and right halves of the window, in 16.16 fixed point.  The right half follows a
+    // few unused vertices.
+    constexpr GLfixed kOne                   = 0x10000;
+    constexpr std::array<GLfixed, 8> kLeft   = {-kOne, -kOne, 0, -kOne, 0, kOne, -kOne, kOne};
+    constexpr std::array<GLfixed, 16> kRight = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, -kOne, kOne, -kOne, kOne, kOne, 0, kOne,
+    };
+    constexpr GLsizei kRightOffset = 8 * sizeof(GLfixed);
+
+    constexpr std::array<GLubyte, 6> kIndices = {0, 1, 2, 0, 2, 3};
+
+    GLBuffer leftBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, leftBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kLeft), kLeft.data(), GL_STATIC_DRAW);
+
+    GLBuffer rightBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, rightBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kRight), kRight.data(), GL_STATIC_DRAW);
+
+    GLBuffer indexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kIndices), kIndices.data(), GL_STATIC_DRAW);
+
+    glEnableVertexAttribArray(positionLocation);
+    ASSERT_GL_NO_ERROR();
+
+    uint32_t expectedRenderPassCount = hackANGLE().renderPasses + 1;
+
+    glClearColor(0, 0, 1, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glBindBuffer(GL_ARRAY_BUFFER, leftBuffer);
+    glVertexAttribPointer(positionLocation, 2, GL_FIXED, GL_FALSE, 0, nullptr);
+    glUniform4f(colorLocation, 1, 0, 0, 1);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, nullptr);
+
+    glBindBuffer(GL_ARRAY_BUFFER, rightBuffer);
+    glVertexAttribPointer(positionLocation, 2, GL_FIXED, GL_FALSE, 0,
+                          reinterpret_cast<const void *>(kRightOffset));
+    glUniform4f(colorLocation, 0, 1, 0, 1);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, nullptr);
+    ASSERT_GL_NO_ERROR();
+
+    uint32_t actualRenderPassCount = hackANGLE().renderPasses;
+    EXPECT_EQ(expectedRenderPassCount, actualRenderPassCount);
+
+    const int w = getWindowWidth();
+    const int h = getWindowHeight();
+    EXPECT_PIXEL_RECT_EQ(0, 0, w / 2, h, GLColor::red);
+    EXPECT_PIXEL_RECT_EQ(w / 2, 0, w - w / 2, h, GLColor::green);
+}
+
+// Tests that vertices and indices converted from the end of their buffers, at offsets that are not
+// aligned to the storage buffer offset alignment, are drawn correctly.
+TEST_P(VulkanPerformanceCounterTest, ConversionsAtUnalignedOffsets)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+
+    // The whole window, in 16.16 fixed point, after padding that is not a multiple of any storage
+    // buffer offset alignment.  The vertices end the buffer.
+    constexpr GLfixed kOne                 = 0x10000;
+    constexpr size_t kVertexPadding        = 1001;
+    constexpr std::array<GLfixed, 8> kQuad = {-kOne, -kOne, kOne, -kOne, kOne, kOne, -kOne, kOne};
+    std::vector<GLfixed> vertices(kVertexPadding, 0);
+    vertices.insert(vertices.end(), kQuad.begin(), kQuad.end());
+    constexpr GLsizei kVertexOffset = kVertexPadding * sizeof(GLfixed);
+
+    // The indices also end their buffer, after an odd number of bytes.
+    constexpr size_t kIndexPadding = 1001;
+    std::vector<GLubyte> indices(kIndexPadding, 0);
+    indices.insert(indices.end(), {0, 1, 2, 0, 2, 3});
+
+    GLBuffer vertexBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GLfixed), vertices.data(),
+                 GL_STATIC_DRAW);
+
+    GLBuffer indexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size(), indices.data(), GL_STATIC_DRAW);
+
+    glVertexAttribPointer(positionLocation, 2, GL_FIXED, GL_FALSE, 0,
+                          reinterpret_cast<const void *>(kVertexOffset));
+    glEnableVertexAttribArray(positionLocation);
+    ASSERT_GL_NO_ERROR();
+
+    glClearColor(1, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE,
+                   reinterpret_cast<const void *>(kIndexPadding));
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::green);
+}
+
+// Tests that attaching compatible textures to a framebuffer in turn creates a single imageless
+// VkFramebuffer, which each render pass begins with the image views of the current texture.
+TEST_P(VulkanPerformanceCounterTest, ImagelessFramebufferIsSharedByCompatibleAttachments)
+{
+    ANGLE_SKIP_TEST_IF(!hackANGLEFeatures().supportsImagelessFramebuffer.enabled);
+
+    constexpr size_t kTextureCount = 8;
+
+    const std::array<GLColor, 4> kColors = {GLColor::red, GLColor::green, GLColor::blue,
+                                            GLColor::yellow};
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+
+    GLTexture textures[kTextureCount];
+    for (GLTexture &texture : textures)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 16, 16, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    }
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    ASSERT_GL_NO_ERROR();
+
+    uint32_t expectedFramebufferCreations = hackANGLE().framebufferCreations + 1;
+
+    for (size_t index = 0; index < kTextureCount; ++index)
+    {
+        drawToAttachment(program, textures[index], kColors[index % kColors.size()]);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedFramebufferCreations, hackANGLE().framebufferCreations);
+}
+
+// Tests that a framebuffer whose attachment changes between more textures than its VkFramebuffer
+// cache holds keeps evicting the least recently used VkFramebuffers, and still renders correctly.
+TEST_P(VulkanPerformanceCounterTest_NoImagelessFramebuffer, FramebufferCacheIsBounded)
+{
+    ANGLE_SKIP_TEST_IF(hackANGLEFeatures().supportsImagelessFramebuffer.enabled);
+
+    // The number of VkFramebuffers a FramebufferVk caches, kMaxFramebufferCacheSize.
+    constexpr size_t kCacheSize    = 32;
+    constexpr size_t kTextureCount = kCacheSize + 8;
+
+    const std::array<GLColor, 4> kColors = {GLColor::red, GLColor::green, GLColor::blue,
+                                            GLColor::yellow};
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+
+    GLTexture textures[kTextureCount];
+    for (GLTexture &texture : textures)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 16, 16, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    }
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    ASSERT_GL_NO_ERROR();
+
+    // Every texture needs its own VkFramebuffer.
+    uint32_t expectedFramebufferCreations = hackANGLE().framebufferCreations + kTextureCount;
+    for (size_t index = 0; index < kTextureCount; ++index)
+    {
+        drawToAttachment(program, textures[index], kColors[index % kColors.size()]);
+    }
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(expectedFramebufferCreations, hackANGLE().framebufferCreations);
+
+    // The VkFramebuffers of the most recently used textures are still cached.
+    for (size_t index = kTextureCount; index > kTextureCount - kCacheSize; --index)
+    {
+        drawToAttachment(program, textures[index - 1], kColors[index % kColors.size()]);
+    }
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(expectedFramebufferCreations, hackANGLE().framebufferCreations);
+
+    // The VkFramebuffers of the least recently used textures were evicted.
+    ++expectedFramebufferCreations;
+    drawToAttachment(program, textures[0], kColors[1]);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(expectedFramebufferCreations, hackANGLE().framebufferCreations);
+}
+
+// Tests that the perf counters are exposed through GL_AMD_performance_monitor, and that a monitor
+// counts the render passes started between its begin and end.
+TEST_P(VulkanPerformanceCounterTest, PerfMonitorCountsRenderPasses)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_AMD_performance_monitor"));
+
+    GLuint renderPassGroup   = 0;
+    GLuint renderPassCounter = 0;
+    ASSERT_TRUE(findPerfMonitorCounter("renderPasses", &renderPassGroup, &renderPassCounter));
+
+    GLenum counterType = GL_NONE;
+    glGetPerfMonitorCounterInfoAMD(renderPassGroup, renderPassCounter, GL_COUNTER_TYPE_AMD,
+                                   &counterType);
+    EXPECT_GLENUM_EQ(GL_UNSIGNED_INT64_AMD, counterType);
+    ASSERT_GL_NO_ERROR();
+
+    GLuint monitor = beginPerfMonitor(renderPassGroup, {renderPassCounter});
+
+    // Draw into two framebuffers, which takes two render passes.
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    GLTexture textures[2];
+    GLFramebuffer framebuffers[2];
+    for (int index = 0; index < 2; ++index)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[index]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                               textures[index], 0);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    }
+
+    std::vector<uint64_t> values = endPerfMonitor(monitor, renderPassGroup, {renderPassCounter});
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(2u, values[0]);
+
+    // A monitor can't begin twice, or end without beginning.
+    glBeginPerfMonitorAMD(monitor);
+    glBeginPerfMonitorAMD(monitor);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+    glEndPerfMonitorAMD(monitor);
+    glEndPerfMonitorAMD(monitor);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glDeletePerfMonitorsAMD(1, &monitor);
+    glBeginPerfMonitorAMD(monitor);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+}
+
+// Tests that the garbage stats count the buffers released by the application.
+TEST_P(VulkanPerformanceCounterTest, PerfMonitorCountsGarbage)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_AMD_performance_monitor"));
+
+    // The garbage group's counters are queued objects and bytes, followed by destroyed objects and
+    // bytes.
+    GLuint garbageGroup = 0;
+    std::vector<GLuint> garbageCounters;
+    ASSERT_TRUE(findPerfMonitorGroup("vulkan_garbage", &garbageGroup, &garbageCounters));
+    ASSERT_EQ(4u, garbageCounters.size());
+
+    GLuint monitor = beginPerfMonitor(garbageGroup, garbageCounters);
+    drawAndDeleteBuffer();
+    glFinish();
+    std::vector<uint64_t> values = endPerfMonitor(monitor, garbageGroup, garbageCounters);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_GT(values[0], 0u);
+    EXPECT_GT(values[1], 0u);
+
+    glDeletePerfMonitorsAMD(1, &monitor);
+}
+
+// Tests that the garbage cleanup thread destroys the garbage queued before glFinish().
+TEST_P(VulkanPerformanceCounterTest_AsyncGarbageCleanup, PerfMonitorCountsGarbage)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_AMD_performance_monitor"));
+
+    GLuint garbageGroup = 0;
+    std::vector<GLuint> garbageCounters;
+    ASSERT_TRUE(findPerfMonitorGroup("vulkan_garbage", &garbageGroup, &garbageCounters));
+    ASSERT_EQ(4u, garbageCounters.size());
+
+    // Start without garbage left to destroy, so the monitor only counts the garbage of the draw.
+    glFinish();
+    waitForGarbageCleanup();
+
+    GLuint monitor = beginPerfMonitor(garbageGroup, garbageCounters);
+    drawAndDeleteBuffer();
+    glFinish();
+    waitForGarbageCleanup();
+    std::vector<uint64_t> values = endPerfMonitor(monitor, garbageGroup, garbageCounters);
+    ASSERT_GL_NO_ERROR();
+
+    // The destroyed objects and bytes caught up with the queued ones.
+    EXPECT_GT(values[0], 0u);
+    EXPECT_GT(values[1], 0u);
+    EXPECT_EQ(values[0], values[2]);
+    EXPECT_EQ(values[1], values[3]);
+
+    glDeletePerfMonitorsAMD(1, &monitor);
+}
+
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest, ES3_VULKAN());
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_ES31, ES31_VULKAN());
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_AsyncGarbageCleanup,
+                       WithAsyncGarbageCleanup(ES3_VULKAN()));
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_NoImagelessFramebuffer,
+                       WithNoImagelessFramebuffer(ES3_VULKAN()));
 
 }  // anonymous namespace
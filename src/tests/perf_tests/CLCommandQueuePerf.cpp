@@ -0,0 +1,363 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CLCommandQueuePerf:
+//   Performance tests for many small OpenCL commands. The throughput tests measure enqueueing and
+//   executing independent writes. The latency tests measure a write, a dependent copy and a
+//   blocking read of the copy, from the first enqueue to the read result. The map tests measure
+//   blocking maps and unmaps of buffers with different kinds of storage.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "common/aligned_memory.h"
+#include "test_utils/cl_test_utils.h"
+
+#include <array>
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 64;
+constexpr size_t kTransferSize            = 256;
+constexpr size_t kBufferCount             = 8;
+constexpr size_t kMapSize                 = 64 * 1024;
+// Host memory can be imported in whole pages.
+constexpr size_t kHostMemoryAlignment = 4096;
+
+enum class Measurement
+{
+    Throughput,
+    Latency,
+};
+
+struct CLCommandQueuePerfParams
+{
+    Measurement measurement;
+    bool outOfOrder;
+};
+
+std::string GetStory(const CLCommandQueuePerfParams &params)
+{
+    std::string story = params.measurement == Measurement::Throughput ? "_throughput" : "_latency";
+    story += params.outOfOrder ? "_out_of_order" : "_in_order";
+    return story;
+}
+
+std::ostream &operator<<(std::ostream &os, const CLCommandQueuePerfParams &params)
+{
+    return os << GetStory(params).substr(1);
+}
+
+class CLCommandQueuePerfTest : public ANGLEPerfTest,
+                               public ::testing::WithParamInterface<CLCommandQueuePerfParams>
+{
+  public:
+    CLCommandQueuePerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+    void finishTest() override;
+
+  private:
+    void stepThroughput();
+    void stepLatency();
+
+    cl_context mContext                       = nullptr;
+    cl_command_queue mQueue                   = nullptr;
+    std::array<cl_mem, kBufferCount> mBuffers = {};
+    std::vector<uint8_t> mWriteData;
+    std::vector<uint8_t> mReadData;
+};
+
+CLCommandQueuePerfTest::CLCommandQueuePerfTest()
+    : ANGLEPerfTest("CLCommandQueuePerf", "", GetStory(GetParam()), kIterationsPerStep),
+      mWriteData(kTransferSize, 0x5a),
+      mReadData(kTransferSize)
+{}
+
+void CLCommandQueuePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    // Prefers the Vulkan back end, which schedules the commands itself.
+    cl_platform_id platform = nullptr;
+    cl_device_id device     = FindCLDevice(kVulkanCLPlatformName, &platform);
+    if (device == nullptr)
+    {
+        std::cout << "No OpenCL device available. Skipping test." << std::endl;
+        mSkipTest = true;
+        return;
+    }
+
+    const cl_context_properties contextProperties[] = {
+        CL_CONTEXT_PLATFORM, reinterpret_cast<cl_context_properties>(platform), 0};
+    cl_int errorCode = CL_SUCCESS;
+    mContext = cl::clCreateContext(contextProperties, 1, &device, nullptr, nullptr, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+
+    const cl_command_queue_properties queueProperties =
+        GetParam().outOfOrder ? CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE : 0;
+    mQueue = cl::clCreateCommandQueue(mContext, device, queueProperties, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+
+    for (cl_mem &buffer : mBuffers)
+    {
+        buffer = cl::clCreateBuffer(mContext, CL_MEM_READ_WRITE, kTransferSize, nullptr,
+                                    &errorCode);
+        ASSERT_EQ(CL_SUCCESS, errorCode);
+    }
+}
+
+void CLCommandQueuePerfTest::TearDown()
+{
+    for (cl_mem buffer : mBuffers)
+    {
+        if (buffer != nullptr)
+        {
+            cl::clReleaseMemObject(buffer);
+        }
+    }
+    if (mQueue != nullptr)
+    {
+        cl::clReleaseCommandQueue(mQueue);
+    }
+    if (mContext != nullptr)
+    {
+        cl::clReleaseContext(mContext);
+    }
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CLCommandQueuePerfTest::step()
+{
+    if (GetParam().measurement == Measurement::Throughput)
+    {
+        stepThroughput();
+    }
+    else
+    {
+        stepLatency();
+    }
+}
+
+void CLCommandQueuePerfTest::finishTest()
+{
+    if (mQueue != nullptr)
+    {
+        cl::clFinish(mQueue);
+    }
+}
+
+void CLCommandQueuePerfTest::stepThroughput()
+{
+    // The writes are independent, so an out-of-order queue may execute them concurrently.
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        cl_int errorCode =
+            cl::clEnqueueWriteBuffer(mQueue, mBuffers[iteration % kBufferCount], CL_FALSE, 0,
+                                     kTransferSize, mWriteData.data(), 0, nullptr, nullptr);
+        if (errorCode != CL_SUCCESS)
+        {
+            FAIL() << "clEnqueueWriteBuffer failed with " << errorCode;
+        }
+    }
+    cl::clFlush(mQueue);
+}
+
+void CLCommandQueuePerfTest::stepLatency()
+{
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        cl_mem srcBuffer = mBuffers[0];
+        cl_mem dstBuffer = mBuffers[1 + iteration % (kBufferCount - 1)];
+
+        // Events order the commands in an out-of-order queue.
+        cl_event writeEvent = nullptr;
+        cl_event copyEvent  = nullptr;
+        cl_int errorCode = cl::clEnqueueWriteBuffer(mQueue, srcBuffer, CL_FALSE, 0, kTransferSize,
+                                                    mWriteData.data(), 0, nullptr, &writeEvent);
+        if (errorCode == CL_SUCCESS)
+        {
+            errorCode = cl::clEnqueueCopyBuffer(mQueue, srcBuffer, dstBuffer, 0, 0, kTransferSize,
+                                                1, &writeEvent, &copyEvent);
+            cl::clReleaseEvent(writeEvent);
+        }
+        if (errorCode == CL_SUCCESS)
+        {
+            errorCode = cl::clEnqueueReadBuffer(mQueue, dstBuffer, CL_TRUE, 0, kTransferSize,
+                                                mReadData.data(), 1, &copyEvent, nullptr);
+            cl::clReleaseEvent(copyEvent);
+        }
+        if (errorCode != CL_SUCCESS)
+        {
+            FAIL() << "Command failed with " << errorCode;
+        }
+    }
+}
+
+enum class BufferStorage
+{
+    Device,
+    AllocHostPtr,
+    UseHostPtr,
+};
+
+std::string GetStory(BufferStorage storage)
+{
+    switch (storage)
+    {
+        case BufferStorage::Device:
+            return "_map_device";
+        case BufferStorage::AllocHostPtr:
+            return "_map_alloc_host_ptr";
+        case BufferStorage::UseHostPtr:
+            return "_map_use_host_ptr";
+    }
+    return "";
+}
+
+std::ostream &operator<<(std::ostream &os, BufferStorage storage)
+{
+    return os << GetStory(storage).substr(1);
+}
+
+class CLMapBufferPerfTest : public ANGLEPerfTest,
+                            public ::testing::WithParamInterface<BufferStorage>
+{
+  public:
+    CLMapBufferPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+    void finishTest() override;
+
+  private:
+    cl_context mContext     = nullptr;
+    cl_command_queue mQueue = nullptr;
+    cl_mem mBuffer          = nullptr;
+    void *mHostMemory       = nullptr;
+};
+
+CLMapBufferPerfTest::CLMapBufferPerfTest()
+    : ANGLEPerfTest("CLMapBufferPerf", "", GetStory(GetParam()), kIterationsPerStep)
+{}
+
+void CLMapBufferPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    cl_platform_id platform = nullptr;
+    cl_device_id device     = FindCLDevice(kVulkanCLPlatformName, &platform);
+    if (device == nullptr)
+    {
+        std::cout << "No OpenCL device available. Skipping test." << std::endl;
+        mSkipTest = true;
+        return;
+    }
+
+    const cl_context_properties contextProperties[] = {
+        CL_CONTEXT_PLATFORM, reinterpret_cast<cl_context_properties>(platform), 0};
+    cl_int errorCode = CL_SUCCESS;
+    mContext = cl::clCreateContext(contextProperties, 1, &device, nullptr, nullptr, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+
+    mQueue = cl::clCreateCommandQueue(mContext, device, 0, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+
+    cl_mem_flags flags = CL_MEM_READ_WRITE;
+    if (GetParam() == BufferStorage::AllocHostPtr)
+    {
+        flags |= CL_MEM_ALLOC_HOST_PTR;
+    }
+    else if (GetParam() == BufferStorage::UseHostPtr)
+    {
+        flags |= CL_MEM_USE_HOST_PTR;
+        mHostMemory = angle::AlignedAlloc(kMapSize, kHostMemoryAlignment);
+        ASSERT_NE(nullptr, mHostMemory);
+    }
+    mBuffer = cl::clCreateBuffer(mContext, flags, kMapSize, mHostMemory, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+}
+
+void CLMapBufferPerfTest::TearDown()
+{
+    if (mBuffer != nullptr)
+    {
+        cl::clReleaseMemObject(mBuffer);
+    }
+    if (mQueue != nullptr)
+    {
+        cl::clReleaseCommandQueue(mQueue);
+    }
+    if (mContext != nullptr)
+    {
+        cl::clReleaseContext(mContext);
+    }
+    if (mHostMemory != nullptr)
+    {
+        angle::AlignedFree(mHostMemory);
+    }
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CLMapBufferPerfTest::step()
+{
+    // Each map reads the buffer and each unmap writes it back, unless the buffer is mapped without
+    // copies.
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        cl_int errorCode = CL_SUCCESS;
+        void *ptr = cl::clEnqueueMapBuffer(mQueue, mBuffer, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0,
+                                           kMapSize, 0, nullptr, nullptr, &errorCode);
+        if (errorCode == CL_SUCCESS)
+        {
+            static_cast<uint8_t *>(ptr)[iteration % kMapSize] = static_cast<uint8_t>(iteration);
+            errorCode = cl::clEnqueueUnmapMemObject(mQueue, mBuffer, ptr, 0, nullptr, nullptr);
+        }
+        if (errorCode != CL_SUCCESS)
+        {
+            FAIL() << "Map or unmap failed with " << errorCode;
+        }
+    }
+}
+
+void CLMapBufferPerfTest::finishTest()
+{
+    if (mQueue != nullptr)
+    {
+        cl::clFinish(mQueue);
+    }
+}
+
+TEST_P(CLCommandQueuePerfTest, Run)
+{
+    run();
+}
+
+TEST_P(CLMapBufferPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CLCommandQueuePerfTest,
+                         ::testing::Values(
+                             CLCommandQueuePerfParams{Measurement::Throughput, false},
+                             CLCommandQueuePerfParams{Measurement::Throughput, true},
+                             CLCommandQueuePerfParams{Measurement::Latency, false},
+                             CLCommandQueuePerfParams{Measurement::Latency, true}),
+                         ::testing::PrintToStringParamName());
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CLMapBufferPerfTest,
+                         ::testing::Values(BufferStorage::Device,
+                                           BufferStorage::AllocHostPtr,
+                                           BufferStorage::UseHostPtr),
+                         ::testing::PrintToStringParamName());
+}  // anonymous namespace
@@ -0,0 +1,258 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CLKernelPerf:
+//   Performance tests for the entry point overhead of small OpenCL kernels. The set_arg tests
+//   measure setting buffer and value arguments. The enqueue tests measure enqueueing kernels which
+//   wait for the last few kernels enqueued before them. The stream tests also set an argument
+//   before each enqueue, like a stream of small kernels.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "test_utils/cl_test_utils.h"
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 256;
+constexpr size_t kWorkSize                = 64;
+constexpr size_t kWaitListSize            = 4;
+
+constexpr char kKernelSource[] = R"(
+__kernel void scale(__global float *data, float factor, ulong count)
+{
+    size_t id = get_global_id(0);
+    if (id < count)
+    {
+        data[id] *= factor;
+    }
+})";
+
+enum class KernelCall
+{
+    SetArg,
+    Enqueue,
+    Stream,
+};
+
+std::string GetStory(KernelCall call)
+{
+    switch (call)
+    {
+        case KernelCall::SetArg:
+            return "_set_arg";
+        case KernelCall::Enqueue:
+            return "_enqueue";
+        case KernelCall::Stream:
+            return "_stream";
+    }
+    return "";
+}
+
+std::ostream &operator<<(std::ostream &os, KernelCall call)
+{
+    return os << GetStory(call).substr(1);
+}
+
+class CLKernelPerfTest : public ANGLEPerfTest, public ::testing::WithParamInterface<KernelCall>
+{
+  public:
+    CLKernelPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+    void finishTest() override;
+
+  private:
+    void stepSetArg();
+    void stepEnqueue(bool setArg);
+
+    cl_context mContext     = nullptr;
+    cl_command_queue mQueue = nullptr;
+    cl_program mProgram     = nullptr;
+    cl_kernel mKernel       = nullptr;
+    cl_mem mBuffer          = nullptr;
+    // The events of the last kernels, in the order they were enqueued in.
+    std::array<cl_event, kWaitListSize> mEvents = {};
+};
+
+CLKernelPerfTest::CLKernelPerfTest()
+    : ANGLEPerfTest("CLKernelPerf", "", GetStory(GetParam()), kIterationsPerStep)
+{}
+
+void CLKernelPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    cl_platform_id platform = nullptr;
+    cl_device_id device     = FindCLDevice(nullptr, &platform);
+    if (device == nullptr)
+    {
+        std::cout << "No OpenCL device available. Skipping test." << std::endl;
+        mSkipTest = true;
+        return;
+    }
+
+    const cl_context_properties contextProperties[] = {
+        CL_CONTEXT_PLATFORM, reinterpret_cast<cl_context_properties>(platform), 0};
+    cl_int errorCode = CL_SUCCESS;
+    mContext = cl::clCreateContext(contextProperties, 1, &device, nullptr, nullptr, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+
+    mQueue = cl::clCreateCommandQueue(mContext, device, 0, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+
+    // The argument info lets the arguments be classified by their types.
+    const char *source = kKernelSource;
+    mProgram = cl::clCreateProgramWithSource(mContext, 1, &source, nullptr, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+    if (cl::clBuildProgram(mProgram, 1, &device, "-cl-kernel-arg-info", nullptr, nullptr) !=
+        CL_SUCCESS)
+    {
+        std::cout << "OpenCL device can't build kernels. Skipping test." << std::endl;
+        mSkipTest = true;
+        return;
+    }
+
+    mKernel = cl::clCreateKernel(mProgram, "scale", &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+
+    mBuffer = cl::clCreateBuffer(mContext, CL_MEM_READ_WRITE, kWorkSize * sizeof(cl_float),
+                                 nullptr, &errorCode);
+    ASSERT_EQ(CL_SUCCESS, errorCode);
+
+    const cl_float factor = 1.0f;
+    const cl_ulong count  = kWorkSize;
+    ASSERT_EQ(CL_SUCCESS, cl::clSetKernelArg(mKernel, 0, sizeof(cl_mem), &mBuffer));
+    ASSERT_EQ(CL_SUCCESS, cl::clSetKernelArg(mKernel, 1, sizeof(factor), &factor));
+    ASSERT_EQ(CL_SUCCESS, cl::clSetKernelArg(mKernel, 2, sizeof(count), &count));
+}
+
+void CLKernelPerfTest::TearDown()
+{
+    for (cl_event event : mEvents)
+    {
+        if (event != nullptr)
+        {
+            cl::clReleaseEvent(event);
+        }
+    }
+    if (mBuffer != nullptr)
+    {
+        cl::clReleaseMemObject(mBuffer);
+    }
+    if (mKernel != nullptr)
+    {
+        cl::clReleaseKernel(mKernel);
+    }
+    if (mProgram != nullptr)
+    {
+        cl::clReleaseProgram(mProgram);
+    }
+    if (mQueue != nullptr)
+    {
+        cl::clReleaseCommandQueue(mQueue);
+    }
+    if (mContext != nullptr)
+    {
+        cl::clReleaseContext(mContext);
+    }
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CLKernelPerfTest::step()
+{
+    if (GetParam() == KernelCall::SetArg)
+    {
+        stepSetArg();
+    }
+    else
+    {
+        stepEnqueue(GetParam() == KernelCall::Stream);
+    }
+}
+
+void CLKernelPerfTest::finishTest()
+{
+    if (mQueue != nullptr)
+    {
+        cl::clFinish(mQueue);
+    }
+}
+
+void CLKernelPerfTest::stepSetArg()
+{
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        // The value argument has the size of a handle, so it could be taken for an object.
+        const cl_ulong count = kWorkSize - iteration % kWorkSize;
+        cl_int errorCode     = cl::clSetKernelArg(mKernel, 0, sizeof(cl_mem), &mBuffer);
+        if (errorCode == CL_SUCCESS)
+        {
+            errorCode = cl::clSetKernelArg(mKernel, 2, sizeof(count), &count);
+        }
+        if (errorCode != CL_SUCCESS)
+        {
+            FAIL() << "clSetKernelArg failed with " << errorCode;
+        }
+    }
+}
+
+void CLKernelPerfTest::stepEnqueue(bool setArg)
+{
+    const size_t globalWorkSize = kWorkSize;
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        if (setArg)
+        {
+            // The factors alternate, so each enqueue must capture the arguments set before it.
+            const cl_float factor = iteration % 2 != 0 ? 2.0f : 0.5f;
+            cl_int errorCode      = cl::clSetKernelArg(mKernel, 1, sizeof(factor), &factor);
+            if (errorCode != CL_SUCCESS)
+            {
+                FAIL() << "clSetKernelArg failed with " << errorCode;
+            }
+        }
+
+        // Until the wait list is full, it starts at the first event.
+        const cl_uint numEvents = static_cast<cl_uint>(std::count_if(
+            mEvents.begin(), mEvents.end(), [](cl_event event) { return event != nullptr; }));
+        const cl_event *waitList = numEvents != 0 ? &mEvents[kWaitListSize - numEvents] : nullptr;
+
+        cl_event event   = nullptr;
+        cl_int errorCode = cl::clEnqueueNDRangeKernel(mQueue, mKernel, 1, nullptr, &globalWorkSize,
+                                                      nullptr, numEvents, waitList, &event);
+        if (errorCode != CL_SUCCESS)
+        {
+            FAIL() << "clEnqueueNDRangeKernel failed with " << errorCode;
+        }
+
+        if (mEvents[0] != nullptr)
+        {
+            cl::clReleaseEvent(mEvents[0]);
+        }
+        std::rotate(mEvents.begin(), mEvents.begin() + 1, mEvents.end());
+        mEvents[kWaitListSize - 1] = event;
+    }
+    cl::clFlush(mQueue);
+}
+
+TEST_P(CLKernelPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CLKernelPerfTest,
+                         ::testing::Values(KernelCall::SetArg,
+                                           KernelCall::Enqueue,
+                                           KernelCall::Stream),
+                         ::testing::PrintToStringParamName());
+}  // anonymous namespace
@@ -25,6 +25,8 @@ enum class StateChange
     Program,
     VertexBufferCycle,
     Scissor,
+    ClientArrays,
+    ClientIndexedArrays,
     InvalidEnum,
     EnumCount = InvalidEnum,
 };
@@ -70,6 +72,12 @@ std::string DrawArraysPerfParams::story() const
         case StateChange::Scissor:
             strstr << "_scissor_change";
             break;
+        case StateChange::ClientArrays:
+            strstr << "_client_arrays";
+            break;
+        case StateChange::ClientIndexedArrays:
+            strstr << "_client_indexed_arrays";
+            break;
         default:
             break;
     }
@@ -135,6 +143,8 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     int mNumTris       = GetParam().numTris;
     std::vector<GLuint> mVBOPool;
     size_t mCurrentVBO = 0;
+    std::vector<GLfloat> mClientVertexData;
+    std::vector<GLushort> mClientIndexData;
 };
 
 DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam()) {}
@@ -222,7 +232,23 @@ void main()
     mBuffer1 = Create2DTriangleBuffer(mNumTris, GL_STATIC_DRAW);
     mBuffer2 = Create2DTriangleBuffer(mNumTris, GL_STATIC_DRAW);
 
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    if (params.stateChange == StateChange::ClientArrays ||
+        params.stateChange == StateChange::ClientIndexedArrays)
+    {
+        // Every draw call streams the vertex (and index) data from client memory.
+        Generate2DTriangleData(mNumTris, &mClientVertexData);
+        for (int index = 0; index < mNumTris * 3; ++index)
+        {
+            mClientIndexData.push_back(static_cast<GLushort>(index));
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, mClientVertexData.data());
+    }
+    else
+    {
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    }
     glEnableVertexAttribArray(0);
 
     // Set the viewport
@@ -383,6 +409,14 @@ void CycleVertexBufferThenDraw(unsigned int iterations,
     }
 }
 
+void DrawClientElements(unsigned int iterations, GLsizei numElements, const GLushort *indices)
+{
+    for (unsigned int it = 0; it < iterations; it++)
+    {
+        glDrawElements(GL_TRIANGLES, numElements, GL_UNSIGNED_SHORT, indices);
+    }
+}
+
 void ChangeScissorThenDraw(unsigned int iterations,
                            GLsizei numElements,
                            unsigned int windowWidth,
@@ -515,6 +549,12 @@ void DrawCallPerfBenchmark::drawBenchmark()
             ChangeScissorThenDraw(params.iterationsPerStep, numElements, getWindow()->getWidth(),
                                   getWindow()->getHeight());
             break;
+        case StateChange::ClientArrays:
+            JustDraw(params.iterationsPerStep, numElements);
+            break;
+        case StateChange::ClientIndexedArrays:
+            DrawClientElements(params.iterationsPerStep, numElements, mClientIndexData.data());
+            break;
         case StateChange::InvalidEnum:
             ADD_FAILURE() << "Invalid state change.";
             break;
@@ -0,0 +1,164 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLCreateContextPerfTest:
+//   Performance test for creating a context, making it current for the first time and destroying
+//   it.
+//
+
+#include "ANGLEPerfTest.h"
+#include "common/platform.h"
+#include "common/system_utils.h"
+#include "platform/PlatformMethods.h"
+#include "test_utils/angle_test_configs.h"
+#include "test_utils/angle_test_instantiate.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10;
+
+class EGLCreateContextPerfTest : public ANGLEPerfTest,
+                                 public WithParamInterface<angle::PlatformParameters>
+{
+  public:
+    EGLCreateContextPerfTest();
+    ~EGLCreateContextPerfTest() override;
+
+    void step() override;
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    OSWindow *mOSWindow;
+    EGLDisplay mDisplay;
+    EGLSurface mSurface;
+    EGLConfig mConfig;
+    std::unique_ptr<angle::Library> mEGLLibrary;
+};
+
+EGLCreateContextPerfTest::EGLCreateContextPerfTest()
+    : ANGLEPerfTest("EGLCreateContext", "", "_run", kIterationsPerStep),
+      mOSWindow(nullptr),
+      mDisplay(EGL_NO_DISPLAY),
+      mSurface(EGL_NO_SURFACE),
+      mConfig(nullptr)
+{
+    auto platform = GetParam().eglParameters;
+
+    std::vector<EGLint> displayAttributes;
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.renderer);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MAJOR_ANGLE);
+    displayAttributes.push_back(platform.majorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MINOR_ANGLE);
+    displayAttributes.push_back(platform.minorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.deviceType);
+    displayAttributes.push_back(EGL_NONE);
+
+    mOSWindow = OSWindow::New();
+    mOSWindow->initialize("EGLCreateContext Test", 64, 64);
+
+    mEGLLibrary.reset(
+        angle::OpenSharedLibrary(ANGLE_EGL_LIBRARY_NAME, angle::SearchType::ModuleDir));
+
+    angle::LoadProc getProc =
+        reinterpret_cast<angle::LoadProc>(mEGLLibrary->getSymbol("eglGetProcAddress"));
+
+    if (!getProc)
+    {
+        abortTest();
+    }
+    else
+    {
+        angle::LoadEGL(getProc);
+
+        if (!eglGetPlatformDisplayEXT)
+        {
+            abortTest();
+        }
+        else
+        {
+            mDisplay = eglGetPlatformDisplayEXT(
+                EGL_PLATFORM_ANGLE_ANGLE, reinterpret_cast<void *>(mOSWindow->getNativeDisplay()),
+                &displayAttributes[0]);
+        }
+    }
+}
+
+EGLCreateContextPerfTest::~EGLCreateContextPerfTest()
+{
+    OSWindow::Delete(&mOSWindow);
+}
+
+void EGLCreateContextPerfTest::SetUp()
+{
+    ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+    EGLint majorVersion, minorVersion;
+    ASSERT_TRUE(eglInitialize(mDisplay, &majorVersion, &minorVersion));
+
+    EGLint numConfigs;
+    EGLint configAttrs[] = {EGL_RED_SIZE,
+                            8,
+                            EGL_GREEN_SIZE,
+                            8,
+                            EGL_BLUE_SIZE,
+                            8,
+                            EGL_RENDERABLE_TYPE,
+                            GetParam().majorVersion == 3 ? EGL_OPENGL_ES3_BIT : EGL_OPENGL_ES2_BIT,
+                            EGL_SURFACE_TYPE,
+                            EGL_PBUFFER_BIT,
+                            EGL_NONE};
+
+    ASSERT_TRUE(eglChooseConfig(mDisplay, configAttrs, &mConfig, 1, &numConfigs));
+    ASSERT_EQ(1, numConfigs);
+
+    EGLint surfaceAttrs[] = {EGL_WIDTH, 64, EGL_HEIGHT, 64, EGL_NONE};
+    mSurface              = eglCreatePbufferSurface(mDisplay, mConfig, surfaceAttrs);
+    ASSERT_NE(EGL_NO_SURFACE, mSurface);
+}
+
+void EGLCreateContextPerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+    eglDestroySurface(mDisplay, mSurface);
+    eglTerminate(mDisplay);
+}
+
+void EGLCreateContextPerfTest::step()
+{
+    EGLint contextAttrs[] = {EGL_CONTEXT_MAJOR_VERSION, GetParam().majorVersion,
+                             EGL_CONTEXT_MINOR_VERSION, GetParam().minorVersion, EGL_NONE};
+
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        EGLContext context = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, contextAttrs);
+        ASSERT_NE(EGL_NO_CONTEXT, context);
+        ASSERT_TRUE(eglMakeCurrent(mDisplay, mSurface, mSurface, context));
+        ASSERT_TRUE(eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+        ASSERT_TRUE(eglDestroyContext(mDisplay, context));
+    }
+}
+
+TEST_P(EGLCreateContextPerfTest, Run)
+{
+    run();
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLCreateContextPerfTest);
+// We want to run this test on GL(ES) and Vulkan everywhere except Android
+#if !defined(ANGLE_PLATFORM_ANDROID)
+ANGLE_INSTANTIATE_TEST(EGLCreateContextPerfTest,
+                       angle::ES2_D3D11(),
+                       angle::ES2_OPENGL(),
+                       angle::ES2_OPENGLES(),
+                       angle::ES2_VULKAN(),
+                       angle::ES3_VULKAN(),
+                       angle::ES2_VULKAN_SWIFTSHADER());
+#endif
+
+}  // namespace
@@ -17,13 +17,14 @@ using namespace testing;
 
 namespace
 {
-// Only applies to D3D11
+// Only applies to D3D11, except for initFormatTableMS which only applies to Vulkan.
 struct Captures final : private angle::NonCopyable
 {
     Timer timer;
-    size_t loadDLLsMS      = 0;
-    size_t createDeviceMS  = 0;
-    size_t initResourcesMS = 0;
+    size_t loadDLLsMS        = 0;
+    size_t createDeviceMS    = 0;
+    size_t initResourcesMS   = 0;
+    size_t initFormatTableMS = 0;
 };
 
 double CapturePlatform_currentTime(angle::PlatformMethods *platformMethods)
@@ -55,6 +56,10 @@ void CapturePlatform_histogramCustomCounts(angle::PlatformMethods *platformMetho
     {
         captures->initResourcesMS += static_cast<size_t>(sample);
     }
+    else if (strcmp(name, "GPU.ANGLE.RendererVkInitializeFormatTableMS") == 0)
+    {
+        captures->initFormatTableMS += static_cast<size_t>(sample);
+    }
 }
 
 class EGLInitializePerfTest : public ANGLEPerfTest,
@@ -125,6 +130,7 @@ void EGLInitializePerfTest::SetUp()
     mReporter->RegisterImportantMetric(".LoadDLLs", "ms");
     mReporter->RegisterImportantMetric(".D3D11CreateDevice", "ms");
     mReporter->RegisterImportantMetric(".InitResources", "ms");
+    mReporter->RegisterImportantMetric(".InitFormatTable", "ms");
 }
 
 EGLInitializePerfTest::~EGLInitializePerfTest()
@@ -148,6 +154,7 @@ void EGLInitializePerfTest::TearDown()
     mReporter->AddResult(".LoadDLLs", normalizedTime(mCaptures.loadDLLsMS));
     mReporter->AddResult(".D3D11CreateDevice", normalizedTime(mCaptures.createDeviceMS));
     mReporter->AddResult(".InitResources", normalizedTime(mCaptures.initResourcesMS));
+    mReporter->AddResult(".InitFormatTable", normalizedTime(mCaptures.initFormatTableMS));
 
     ANGLEResetDisplayPlatform(mDisplay);
 }
@@ -157,6 +164,9 @@ TEST_P(EGLInitializePerfTest, Run)
     run();
 }
 
-ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest, angle::ES2_D3D11(), angle::ES2_VULKAN());
+ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest,
+                       angle::ES2_D3D11(),
+                       angle::ES2_VULKAN(),
+                       angle::ES2_VULKAN_SWIFTSHADER());
 
 }  // namespace
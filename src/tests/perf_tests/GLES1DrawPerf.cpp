@@ -0,0 +1,225 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GLES1DrawPerf:
+//   Performance tests for draw call overhead with the GLES1 fixed-function emulation.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 100;
+
+enum class GLES1StateChange
+{
+    // No state changes between draws.
+    None,
+    // The modelview matrix changes for every draw, as with a scene graph of small objects.
+    Modelview,
+    // The modelview matrix and the current color change for every draw.
+    ModelviewAndColor,
+};
+
+struct GLES1DrawParams final : public RenderTestParams
+{
+    GLES1DrawParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        majorVersion = 1;
+        minorVersion = 0;
+        windowWidth  = 256;
+        windowHeight = 256;
+    }
+
+    std::string story() const override;
+
+    GLES1StateChange stateChange = GLES1StateChange::None;
+    bool lighting                = false;
+    bool texturing               = false;
+};
+
+std::string GLES1DrawParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+
+    switch (stateChange)
+    {
+        case GLES1StateChange::None:
+            break;
+        case GLES1StateChange::Modelview:
+            strstr << "_modelview_change";
+            break;
+        case GLES1StateChange::ModelviewAndColor:
+            strstr << "_modelview_and_color_change";
+            break;
+    }
+
+    if (lighting)
+    {
+        strstr << "_lighting";
+    }
+
+    if (texturing)
+    {
+        strstr << "_texturing";
+    }
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const GLES1DrawParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class GLES1DrawBenchmark : public ANGLERenderTest,
+                           public ::testing::WithParamInterface<GLES1DrawParams>
+{
+  public:
+    GLES1DrawBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mBuffer  = 0;
+    GLuint mTexture = 0;
+};
+
+GLES1DrawBenchmark::GLES1DrawBenchmark() : ANGLERenderTest("GLES1Draw", GetParam()) {}
+
+void GLES1DrawBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    // A small triangle, so that the draws are bound by the CPU overhead.
+    constexpr GLfloat kVertices[] = {
+        -0.1f, -0.1f, 0.0f, 0.0f, 0.1f, -0.1f, 1.0f, 0.0f, 0.0f, 0.1f, 0.5f, 1.0f,
+    };
+
+    glGenBuffers(1, &mBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices), kVertices, GL_STATIC_DRAW);
+
+    constexpr GLsizei kStride = 4 * sizeof(GLfloat);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(2, GL_FLOAT, kStride, nullptr);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glTexCoordPointer(2, GL_FLOAT, kStride, reinterpret_cast<const void *>(2 * sizeof(GLfloat)));
+
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+
+    if (params.lighting)
+    {
+        constexpr GLfloat kLightPosition[] = {0.0f, 0.0f, 1.0f, 0.0f};
+        glEnable(GL_LIGHTING);
+        glEnable(GL_LIGHT0);
+        glLightfv(GL_LIGHT0, GL_POSITION, kLightPosition);
+        glEnable(GL_COLOR_MATERIAL);
+    }
+
+    if (params.texturing)
+    {
+        constexpr GLubyte kTexel[] = {255, 255, 255, 255};
+        glGenTextures(1, &mTexture);
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, kTexel);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glEnable(GL_TEXTURE_2D);
+    }
+
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void GLES1DrawBenchmark::destroyBenchmark()
+{
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteTextures(1, &mTexture);
+}
+
+void GLES1DrawBenchmark::drawBenchmark()
+{
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    const auto &params = GetParam();
+
+    for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+    {
+        if (params.stateChange == GLES1StateChange::None)
+        {
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+            continue;
+        }
+
+        const GLfloat offset = static_cast<GLfloat>(it % 10) * 0.1f - 0.5f;
+
+        glPushMatrix();
+        glTranslatef(offset, -offset, 0.0f);
+        if (params.stateChange == GLES1StateChange::ModelviewAndColor)
+        {
+            glColor4f(1.0f, offset + 0.5f, 0.0f, 1.0f);
+        }
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glPopMatrix();
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+GLES1DrawParams GLES1DrawParamsForBackend(const EGLPlatformParameters &eglParameters,
+                                          GLES1StateChange stateChange,
+                                          bool lighting,
+                                          bool texturing)
+{
+    GLES1DrawParams params;
+    params.eglParameters = eglParameters;
+    params.stateChange   = stateChange;
+    params.lighting      = lighting;
+    params.texturing     = texturing;
+    return params;
+}
+
+}  // namespace
+
+TEST_P(GLES1DrawBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(
+    GLES1DrawBenchmark,
+    GLES1DrawParamsForBackend(egl_platform::OPENGL_OR_GLES(), GLES1StateChange::None, false, false),
+    GLES1DrawParamsForBackend(egl_platform::OPENGL_OR_GLES(),
+                              GLES1StateChange::Modelview,
+                              false,
+                              false),
+    GLES1DrawParamsForBackend(egl_platform::OPENGL_OR_GLES(),
+                              GLES1StateChange::ModelviewAndColor,
+                              true,
+                              true),
+    GLES1DrawParamsForBackend(egl_platform::VULKAN(), GLES1StateChange::None, false, false),
+    GLES1DrawParamsForBackend(egl_platform::VULKAN(), GLES1StateChange::Modelview, false, false),
+    GLES1DrawParamsForBackend(egl_platform::VULKAN(),
+                              GLES1StateChange::ModelviewAndColor,
+                              true,
+                              true),
+    GLES1DrawParamsForBackend(egl_platform::VULKAN_NULL(), GLES1StateChange::Modelview, true, true));
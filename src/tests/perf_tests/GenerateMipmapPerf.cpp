@@ -21,6 +21,7 @@ using namespace angle;
 namespace
 {
 constexpr unsigned int kIterationsPerStep = 5;
+constexpr GLsizei kLargeTextureSize      = 4096;
 
 struct GenerateMipmapParams final : public RenderTestParams
 {
@@ -33,6 +34,7 @@ struct GenerateMipmapParams final : public RenderTestParams
         textureHeight = 1080;
 
         internalFormat = GL_RGBA;
+        format         = GL_RGBA;
 
         webgl = false;
     }
@@ -43,6 +45,7 @@ struct GenerateMipmapParams final : public RenderTestParams
     GLsizei textureHeight;
 
     GLenum internalFormat;
+    GLenum format;
 
     bool webgl;
 };
@@ -67,6 +70,15 @@ std::string GenerateMipmapParams::story() const
     {
         strstr << "_rgb";
     }
+    else if (internalFormat == GL_SRGB8_ALPHA8)
+    {
+        strstr << "_srgb";
+    }
+
+    if (textureWidth == kLargeTextureSize && textureHeight == kLargeTextureSize)
+    {
+        strstr << "_4k";
+    }
 
     return strstr.str();
 }
@@ -163,7 +175,7 @@ void GenerateMipmapBenchmarkBase::initializeBenchmark()
     FillWithRandomData(&mTextureData);
 
     glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
-                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+                 0, params.format, GL_UNSIGNED_BYTE, mTextureData.data());
 
     // Perform a draw so the image data is flushed.
     glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -253,7 +265,7 @@ void GenerateMipmapWithRedefineBenchmark::drawBenchmark()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
-                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+                 0, params.format, GL_UNSIGNED_BYTE, mTextureData.data());
 
     // Perform a draw so the image data is flushed.
     glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -315,6 +327,7 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     if (emulatedFormat)
     {
         params.internalFormat = GL_RGB;
+        params.format         = GL_RGB;
     }
     if (singleIteration)
     {
@@ -323,6 +336,21 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     return params;
 }
 
+GenerateMipmapParams SRGB(GenerateMipmapParams params)
+{
+    params.internalFormat = GL_SRGB8_ALPHA8;
+    params.format         = GL_RGBA;
+    return params;
+}
+
+// A 4096x4096 texture has 13 levels, all of which can be generated in a single compute dispatch.
+GenerateMipmapParams Large(GenerateMipmapParams params)
+{
+    params.textureWidth  = kLargeTextureSize;
+    params.textureHeight = kLargeTextureSize;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(GenerateMipmapBenchmark, Run)
@@ -345,7 +373,10 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
                        VulkanParams(false, false, false),
                        VulkanParams(true, false, false),
                        VulkanParams(false, false, true),
-                       VulkanParams(true, false, true));
+                       VulkanParams(true, false, true),
+                       SRGB(VulkanParams(false, false, false)),
+                       Large(VulkanParams(false, false, false)),
+                       Large(SRGB(VulkanParams(false, false, false))));
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        D3D11Params(false, true),
@@ -355,4 +386,7 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        VulkanParams(false, true, false),
                        VulkanParams(true, true, false),
                        VulkanParams(false, true, true),
-                       VulkanParams(true, true, true));
+                       VulkanParams(true, true, true),
+                       SRGB(VulkanParams(false, true, false)),
+                       Large(VulkanParams(false, true, false)),
+                       Large(SRGB(VulkanParams(false, true, false))));
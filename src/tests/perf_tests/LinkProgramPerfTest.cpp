@@ -10,6 +10,7 @@
 #include "ANGLEPerfTest.h"
 
 #include <array>
+#include <sstream>
 
 #include "common/vector_utils.h"
 #include "util/shader_utils.h"
@@ -18,11 +19,96 @@ using namespace angle;
 
 namespace
 {
+// Size of the padding added to the shaders of the relink test, to make the cost of hashing the
+// sources for the program cache visible.
+constexpr size_t kLargeShaderPaddingBytes = 100 * 1024;
+
+std::string MakeLargeShaderSource(const char *body)
+{
+    constexpr char kPaddingLine[] =
+        "// Padding to emulate the size of application shaders with large uber-shader bodies.\n";
+
+    std::string source;
+    source.reserve(kLargeShaderPaddingBytes + strlen(body) + sizeof(kPaddingLine));
+    while (source.size() < kLargeShaderPaddingBytes)
+    {
+        source += kPaddingLine;
+    }
+    source += body;
+    return source;
+}
+
+// Shaders with many uniforms and varyings, whose reflection data dominates the cost of loading the
+// program from the cache.
+constexpr size_t kManyResourcesUniformCount = 64;
+constexpr size_t kManyResourcesVaryingCount = 7;
+
+std::string MakeManyResourcesVertexShaderSource()
+{
+    std::stringstream shader;
+    shader << "attribute vec2 position;\n";
+    for (size_t index = 0; index < kManyResourcesUniformCount; ++index)
+    {
+        shader << "uniform vec4 u" << index << ";\n";
+    }
+    for (size_t index = 0; index < kManyResourcesVaryingCount; ++index)
+    {
+        shader << "varying vec4 v" << index << ";\n";
+    }
+    shader << "void main() {\n"
+              "    vec4 sum = vec4(0);\n";
+    for (size_t index = 0; index < kManyResourcesUniformCount; ++index)
+    {
+        shader << "    sum += u" << index << ";\n";
+    }
+    for (size_t index = 0; index < kManyResourcesVaryingCount; ++index)
+    {
+        shader << "    v" << index << " = sum * " << index << ".0;\n";
+    }
+    shader << "    gl_Position = vec4(position, 0, 1);\n"
+              "}";
+    return shader.str();
+}
+
+std::string MakeManyResourcesFragmentShaderSource()
+{
+    std::stringstream shader;
+    shader << "precision mediump float;\n";
+    for (size_t index = 0; index < kManyResourcesVaryingCount; ++index)
+    {
+        shader << "varying vec4 v" << index << ";\n";
+    }
+    shader << "void main() {\n"
+              "    gl_FragColor = vec4(0)";
+    for (size_t index = 0; index < kManyResourcesVaryingCount; ++index)
+    {
+        shader << " + v" << index;
+    }
+    shader << ";\n"
+              "}";
+    return shader.str();
+}
+
+constexpr char kVertexShader[] =
+    "attribute vec2 position;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(position, 0, 1);\n"
+    "}";
+constexpr char kFragmentShader[] =
+    "precision mediump float;\n"
+    "void main() {\n"
+    "    gl_FragColor = vec4(1, 0, 0, 1);\n"
+    "}";
 
 enum class TaskOption
 {
     CompileOnly,
     CompileAndLink,
+    // Compile large shaders once and repeatedly link programs from them, which after the first
+    // iteration are served from the program cache.
+    RelinkLargeShaders,
+    // Same as above, with shaders that have many uniforms and varyings.
+    RelinkManyResources,
 
     Unspecified
 };
@@ -62,6 +148,14 @@ struct LinkProgramParams final : public RenderTestParams
         {
             strstr << "_compile_and_link";
         }
+        else if (taskOption == TaskOption::RelinkLargeShaders)
+        {
+            strstr << "_relink_large_shaders";
+        }
+        else if (taskOption == TaskOption::RelinkManyResources)
+        {
+            strstr << "_relink_many_resources";
+        }
 
         if (threadOption == ThreadOption::SingleThread)
         {
@@ -101,7 +195,11 @@ class LinkProgramBenchmark : public ANGLERenderTest,
     void drawBenchmark() override;
 
   protected:
+    void drawRelinkBenchmark();
+
     GLuint mVertexBuffer = 0;
+    GLuint mLargeVertexShader   = 0;
+    GLuint mLargeFragmentShader = 0;
 };
 
 LinkProgramBenchmark::LinkProgramBenchmark() : ANGLERenderTest("LinkProgram", GetParam()) {}
@@ -121,27 +219,64 @@ void LinkProgramBenchmark::initializeBenchmark()
     glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
     glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vector3), vertices.data(),
                  GL_STATIC_DRAW);
+
+    if (GetParam().taskOption == TaskOption::RelinkLargeShaders)
+    {
+        mLargeVertexShader =
+            CompileShader(GL_VERTEX_SHADER, MakeLargeShaderSource(kVertexShader).c_str());
+        mLargeFragmentShader =
+            CompileShader(GL_FRAGMENT_SHADER, MakeLargeShaderSource(kFragmentShader).c_str());
+        ASSERT_NE(0u, mLargeVertexShader);
+        ASSERT_NE(0u, mLargeFragmentShader);
+    }
+    else if (GetParam().taskOption == TaskOption::RelinkManyResources)
+    {
+        mLargeVertexShader =
+            CompileShader(GL_VERTEX_SHADER, MakeManyResourcesVertexShaderSource().c_str());
+        mLargeFragmentShader =
+            CompileShader(GL_FRAGMENT_SHADER, MakeManyResourcesFragmentShaderSource().c_str());
+        ASSERT_NE(0u, mLargeVertexShader);
+        ASSERT_NE(0u, mLargeFragmentShader);
+    }
 }
 
 void LinkProgramBenchmark::destroyBenchmark()
 {
     glDeleteBuffers(1, &mVertexBuffer);
+    glDeleteShader(mLargeVertexShader);
+    glDeleteShader(mLargeFragmentShader);
+}
+
+void LinkProgramBenchmark::drawRelinkBenchmark()
+{
+    GLuint program = glCreateProgram();
+    ASSERT_NE(0u, program);
+
+    glAttachShader(program, mLargeVertexShader);
+    glAttachShader(program, mLargeFragmentShader);
+    glLinkProgram(program);
+    glUseProgram(program);
+
+    GLint positionLoc = glGetAttribLocation(program, "position");
+    glVertexAttribPointer(positionLoc, 2, GL_FLOAT, GL_FALSE, 8, nullptr);
+    glEnableVertexAttribArray(positionLoc);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    glDeleteProgram(program);
 }
 
 void LinkProgramBenchmark::drawBenchmark()
 {
-    static const char *vertexShader =
-        "attribute vec2 position;\n"
-        "void main() {\n"
-        "    gl_Position = vec4(position, 0, 1);\n"
-        "}";
-    static const char *fragmentShader =
-        "precision mediump float;\n"
-        "void main() {\n"
-        "    gl_FragColor = vec4(1, 0, 0, 1);\n"
-        "}";
-    GLuint vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
-    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+    if (GetParam().taskOption == TaskOption::RelinkLargeShaders ||
+        GetParam().taskOption == TaskOption::RelinkManyResources)
+    {
+        drawRelinkBenchmark();
+        return;
+    }
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, kVertexShader);
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, kFragmentShader);
 
     ASSERT_NE(0u, vs);
     ASSERT_NE(0u, fs);
@@ -213,6 +348,12 @@ ANGLE_INSTANTIATE_TEST(
     LinkProgramVulkanParams(TaskOption::CompileOnly, ThreadOption::SingleThread),
     LinkProgramD3D11Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
-    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread));
+    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
+    LinkProgramD3D11Params(TaskOption::RelinkLargeShaders, ThreadOption::SingleThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::RelinkLargeShaders, ThreadOption::SingleThread),
+    LinkProgramVulkanParams(TaskOption::RelinkLargeShaders, ThreadOption::SingleThread),
+    LinkProgramD3D11Params(TaskOption::RelinkManyResources, ThreadOption::SingleThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::RelinkManyResources, ThreadOption::SingleThread),
+    LinkProgramVulkanParams(TaskOption::RelinkManyResources, ThreadOption::SingleThread));
 
 }  // anonymous namespace
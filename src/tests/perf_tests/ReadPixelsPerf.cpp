@@ -0,0 +1,196 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReadPixelsPerf:
+//   Performance test for reading back the default framebuffer every frame, like a video encoder
+//   would. The client memory tests read into client memory, which waits for the GPU. The pack
+//   buffer tests read into a ring of pixel pack buffers, and map the oldest buffer of the ring.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <array>
+#include <sstream>
+
+#include "util/gles_loader_autogen.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 4;
+constexpr size_t kPackBufferCount         = 3;
+
+enum class ReadbackDestination
+{
+    ClientMemory,
+    PackBuffer,
+};
+
+struct ReadPixelsParams final : public RenderTestParams
+{
+    ReadPixelsParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 256;
+        windowHeight      = 256;
+    }
+
+    std::string story() const override;
+
+    ReadbackDestination destination = ReadbackDestination::ClientMemory;
+};
+
+std::ostream &operator<<(std::ostream &os, const ReadPixelsParams &params)
+{
+    return os << params.backendAndStory().substr(1);
+}
+
+std::string ReadPixelsParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+    strstr << (destination == ReadbackDestination::PackBuffer ? "_pack_buffer"
+                                                              : "_client_memory");
+
+    return strstr.str();
+}
+
+class ReadPixelsBenchmark : public ANGLERenderTest,
+                            public ::testing::WithParamInterface<ReadPixelsParams>
+{
+  public:
+    ReadPixelsBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void readIntoClientMemory();
+    void readIntoPackBuffer();
+
+    std::vector<GLubyte> mPixels;
+    std::array<GLuint, kPackBufferCount> mPackBuffers = {};
+    // The number of frames read into the pack buffers, and the sum of the bytes read back.
+    size_t mFrameCount = 0;
+    uint32_t mChecksum = 0;
+};
+
+ReadPixelsBenchmark::ReadPixelsBenchmark() : ANGLERenderTest("ReadPixels", GetParam()) {}
+
+void ReadPixelsBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+    const size_t size  = params.windowWidth * params.windowHeight * 4;
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    if (params.destination == ReadbackDestination::ClientMemory)
+    {
+        mPixels.resize(size);
+    }
+    else
+    {
+        glGenBuffers(kPackBufferCount, mPackBuffers.data());
+        for (GLuint buffer : mPackBuffers)
+        {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ReadPixelsBenchmark::destroyBenchmark()
+{
+    glDeleteBuffers(kPackBufferCount, mPackBuffers.data());
+}
+
+void ReadPixelsBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        // Alternate the colors, so consecutive frames differ.
+        const float color = (iteration % 2 != 0) ? 1.0f : 0.0f;
+        glClearColor(color, 0.0f, 1.0f - color, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        if (params.destination == ReadbackDestination::ClientMemory)
+        {
+            readIntoClientMemory();
+        }
+        else
+        {
+            readIntoPackBuffer();
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ReadPixelsBenchmark::readIntoClientMemory()
+{
+    const auto &params = GetParam();
+
+    glReadPixels(0, 0, params.windowWidth, params.windowHeight, GL_RGBA, GL_UNSIGNED_BYTE,
+                 mPixels.data());
+    mChecksum += mPixels[0];
+}
+
+void ReadPixelsBenchmark::readIntoPackBuffer()
+{
+    const auto &params = GetParam();
+    const size_t size  = params.windowWidth * params.windowHeight * 4;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mPackBuffers[mFrameCount % kPackBufferCount]);
+    glReadPixels(0, 0, params.windowWidth, params.windowHeight, GL_RGBA, GL_UNSIGNED_BYTE,
+                 nullptr);
+    ++mFrameCount;
+
+    // Once the ring is full, map the oldest frame, which the GPU has likely finished.
+    if (mFrameCount >= kPackBufferCount)
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, mPackBuffers[mFrameCount % kPackBufferCount]);
+        const GLubyte *pixels = static_cast<const GLubyte *>(
+            glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT));
+        if (pixels != nullptr)
+        {
+            mChecksum += pixels[0];
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+ReadPixelsParams VulkanParams(ReadbackDestination destination)
+{
+    ReadPixelsParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    params.destination   = destination;
+    return params;
+}
+
+}  // anonymous namespace
+
+TEST_P(ReadPixelsBenchmark, Run)
+{
+    run();
+}
+
+using namespace params;
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ReadPixelsBenchmark);
+ANGLE_INSTANTIATE_TEST(ReadPixelsBenchmark,
+                       VulkanParams(ReadbackDestination::ClientMemory),
+                       VulkanParams(ReadbackDestination::PackBuffer));
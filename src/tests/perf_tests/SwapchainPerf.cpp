@@ -0,0 +1,138 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SwapchainPerf:
+//   Performance test for the frame rate of small frames with different swapchain image counts.
+//   On the Vulkan headless display, the image count is set through
+//   ANGLE_HEADLESS_SWAPCHAIN_IMAGE_COUNT, and the vsync tests present on a simulated 60Hz display
+//   set through ANGLE_HEADLESS_REFRESH_RATE.  Other displays ignore both variables.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "common/system_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10;
+constexpr char kImageCountVarName[]       = "ANGLE_HEADLESS_SWAPCHAIN_IMAGE_COUNT";
+constexpr char kRefreshRateVarName[]      = "ANGLE_HEADLESS_REFRESH_RATE";
+constexpr char kRefreshRate[]             = "60";
+
+struct SwapchainParams final : public RenderTestParams
+{
+    SwapchainParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        imageCount = 3;
+    }
+
+    std::string story() const override;
+
+    uint32_t imageCount;
+};
+
+std::ostream &operator<<(std::ostream &os, const SwapchainParams &params)
+{
+    return os << params.backendAndStory().substr(1);
+}
+
+std::string SwapchainParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+    strstr << "_" << imageCount << "_images";
+
+    return strstr.str();
+}
+
+class SwapchainBenchmark : public ANGLERenderTest,
+                           public ::testing::WithParamInterface<SwapchainParams>
+{
+  public:
+    SwapchainBenchmark();
+    ~SwapchainBenchmark() override;
+
+    void initializeBenchmark() override;
+
+    void drawBenchmark() override;
+};
+
+SwapchainBenchmark::SwapchainBenchmark() : ANGLERenderTest("Swapchain", GetParam())
+{
+    // The surface is created after the test, and reads the variables when it's created.
+    const SwapchainParams &params = GetParam();
+    SetEnvironmentVar(kImageCountVarName, std::to_string(params.imageCount).c_str());
+    if (params.surfaceType == SurfaceType::WindowWithVSync)
+    {
+        SetEnvironmentVar(kRefreshRateVarName, kRefreshRate);
+    }
+
+    // Each iteration is a frame.
+    disableTestHarnessSwap();
+}
+
+SwapchainBenchmark::~SwapchainBenchmark()
+{
+    UnsetEnvironmentVar(kImageCountVarName);
+    UnsetEnvironmentVar(kRefreshRateVarName);
+}
+
+void SwapchainBenchmark::initializeBenchmark()
+{
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void SwapchainBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        // Alternate the colors, so consecutive frames differ.
+        const float color = (iteration % 2 != 0) ? 1.0f : 0.0f;
+        glClearColor(color, 0.0f, 1.0f - color, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        getGLWindow()->swap();
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+SwapchainParams VulkanParams(uint32_t imageCount, bool vsync)
+{
+    SwapchainParams params;
+    params.eglParameters = egl_platform::VULKAN_SWIFTSHADER();
+    params.imageCount    = imageCount;
+    params.surfaceType   = vsync ? SurfaceType::WindowWithVSync : SurfaceType::Window;
+    return params;
+}
+
+}  // anonymous namespace
+
+TEST_P(SwapchainBenchmark, Run)
+{
+    run();
+}
+
+using namespace params;
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SwapchainBenchmark);
+ANGLE_INSTANTIATE_TEST(SwapchainBenchmark,
+                       VulkanParams(2, false),
+                       VulkanParams(3, false),
+                       VulkanParams(4, false),
+                       VulkanParams(2, true),
+                       VulkanParams(3, true),
+                       VulkanParams(4, true));
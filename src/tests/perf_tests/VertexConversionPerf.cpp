@@ -0,0 +1,154 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VertexConversionPerf:
+//   Performance tests for draws whose vertex data is converted on the GPU.  Each draw of a step
+//   uses a different GL_FIXED vertex buffer, which is updated every step so it's converted again.
+//   The Vulkan back end records the conversions of a render pass's draws with a single barrier.
+//
+
+#include "ANGLEPerfTest.h"
+#include "tests/test_utils/draw_call_perf_utils.h"
+
+#include <sstream>
+
+using namespace angle;
+
+namespace
+{
+struct VertexConversionPerfParams final : public RenderTestParams
+{
+    std::string story() const override
+    {
+        std::stringstream strstr;
+
+        strstr << "_" << numBuffers << "_buffers";
+        strstr << RenderTestParams::story();
+
+        return strstr.str();
+    }
+
+    unsigned int numBuffers;
+    unsigned int numTris;
+};
+
+// Provide a custom gtest parameter name function for VertexConversionPerfParams.
+std::ostream &operator<<(std::ostream &stream, const VertexConversionPerfParams &param)
+{
+    stream << param.backendAndStory().substr(1);
+    return stream;
+}
+
+class VertexConversionPerfTest : public ANGLERenderTest,
+                                 public ::testing::WithParamInterface<VertexConversionPerfParams>
+{
+  public:
+    VertexConversionPerfTest();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram;
+    std::vector<GLuint> mVertexBuffers;
+    std::vector<GLfixed> mVertexData;
+};
+
+VertexConversionPerfTest::VertexConversionPerfTest()
+    : ANGLERenderTest("VertexConversionPerfTest", GetParam()), mProgram(0)
+{}
+
+void VertexConversionPerfTest::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    ASSERT_LT(0u, params.iterationsPerStep);
+    ASSERT_LT(0u, params.numBuffers);
+    ASSERT_LT(0u, params.numTris);
+
+    mProgram = SetupSimpleScaleAndOffsetProgram();
+    ASSERT_NE(0u, mProgram);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+    // Initialize the vertex data in 16.16 fixed point, which is always converted.
+    std::vector<float> floatData;
+    Generate2DTriangleData(params.numTris, &floatData);
+    for (float value : floatData)
+    {
+        mVertexData.push_back(static_cast<GLfixed>(value * 65536.0f));
+    }
+
+    mVertexBuffers.resize(params.numBuffers);
+    glGenBuffers(params.numBuffers, mVertexBuffers.data());
+    for (GLuint buffer : mVertexBuffers)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, mVertexData.size() * sizeof(mVertexData[0]),
+                     mVertexData.data(), GL_DYNAMIC_DRAW);
+    }
+
+    glEnableVertexAttribArray(0);
+
+    // Set the viewport
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void VertexConversionPerfTest::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(static_cast<GLsizei>(mVertexBuffers.size()), mVertexBuffers.data());
+}
+
+void VertexConversionPerfTest::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+    {
+        for (GLuint buffer : mVertexBuffers)
+        {
+            // Trigger an update to ensure every draw converts its vertices.
+            glBindBuffer(GL_ARRAY_BUFFER, buffer);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(mVertexData[0]), mVertexData.data());
+            glVertexAttribPointer(0, 2, GL_FIXED, GL_FALSE, 0, nullptr);
+            glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(params.numTris * 3));
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+VertexConversionPerfParams VertexConversionPerfVulkanParams(unsigned int numBuffers)
+{
+    VertexConversionPerfParams params;
+    params.eglParameters     = egl_platform::VULKAN();
+    params.majorVersion      = 2;
+    params.minorVersion      = 0;
+    params.windowWidth       = 256;
+    params.windowHeight      = 256;
+    params.iterationsPerStep = 4;
+    params.numBuffers        = numBuffers;
+    params.numTris           = 3000;
+    return params;
+}
+
+TEST_P(VertexConversionPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(VertexConversionPerfTest,
+                       VertexConversionPerfVulkanParams(1),
+                       VertexConversionPerfVulkanParams(16));
+
+// This test suite is not instantiated on some OSes.
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VertexConversionPerfTest);
+}  // namespace
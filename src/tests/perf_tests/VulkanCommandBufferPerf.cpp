@@ -12,6 +12,9 @@
 #include "common/platform.h"
 #include "test_utils/third_party/vulkan_command_buffer_utils.h"
 
+#include <algorithm>
+#include <cstring>
+
 #if defined(ANDROID)
 #    define NUM_CMD_BUFFERS 1000
 // Android devices tend to be slower so only do 10 frames to avoid timeout
@@ -62,6 +65,8 @@ struct CommandBufferTestParams
     std::string story;
     int frames  = NUM_FRAMES;
     int buffers = NUM_CMD_BUFFERS;
+    // Track the submissions with a timeline semaphore instead of a fence.
+    bool timelineSemaphore = false;
 };
 
 class VulkanCommandBufferPerfTest : public ANGLEPerfTest,
@@ -115,6 +120,27 @@ void VulkanCommandBufferPerfTest::SetUp()
     init_device_extension_names(mInfo);
     init_instance(mInfo, mSampleTitle.c_str());
     init_enumerate_device(mInfo);
+
+    if (GetParam().timelineSemaphore)
+    {
+        uint32_t extensionCount = 0;
+        vkEnumerateDeviceExtensionProperties(mInfo.gpus[0], nullptr, &extensionCount, nullptr);
+        std::vector<VkExtensionProperties> extensions(extensionCount);
+        vkEnumerateDeviceExtensionProperties(mInfo.gpus[0], nullptr, &extensionCount,
+                                             extensions.data());
+
+        mInfo.use_timeline_semaphore =
+            std::any_of(extensions.begin(), extensions.end(), [](const VkExtensionProperties &e) {
+                return strcmp(e.extensionName, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME) == 0;
+            });
+        if (!mInfo.use_timeline_semaphore)
+        {
+            destroy_instance(mInfo);
+            mSkipTest = true;
+            return;
+        }
+    }
+
     init_window_size(mInfo, 500, 500);
     init_connection(mInfo);
     init_window(mInfo);
@@ -209,6 +235,59 @@ void VulkanCommandBufferPerfTest::TearDown()
     ANGLEPerfTest::TearDown();
 }
 
+// Common code to submit the command buffers used by all tests.  The submission signals either
+// |drawFence| or the next value of the timeline semaphore.
+void Submit(sample_info &info, VkSubmitInfo *submitInfo, VkFence drawFence)
+{
+    VkResult res;
+    if (info.use_timeline_semaphore)
+    {
+        const uint64_t signalValue = ++info.timeline_value;
+
+        VkTimelineSemaphoreSubmitInfoKHR timelineInfo = {};
+        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timelineInfo.signalSemaphoreValueCount = 1;
+        timelineInfo.pSignalSemaphoreValues    = &signalValue;
+
+        submitInfo->pNext                = &timelineInfo;
+        submitInfo->signalSemaphoreCount = 1;
+        submitInfo->pSignalSemaphores    = &info.timeline_semaphore;
+
+        res = vkQueueSubmit(info.graphics_queue, 1, submitInfo, VK_NULL_HANDLE);
+    }
+    else
+    {
+        res = vkQueueSubmit(info.graphics_queue, 1, submitInfo, drawFence);
+    }
+    ASSERT_EQ(VK_SUCCESS, res);
+}
+
+// Common code to wait for the last submission used by all tests
+VkResult WaitForSubmission(sample_info &info, VkFence drawFence)
+{
+    VkResult res;
+    if (info.use_timeline_semaphore)
+    {
+        VkSemaphoreWaitInfoKHR waitInfo = {};
+        waitInfo.sType                  = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        waitInfo.semaphoreCount         = 1;
+        waitInfo.pSemaphores            = &info.timeline_semaphore;
+        waitInfo.pValues                = &info.timeline_value;
+        do
+        {
+            res = info.fpWaitSemaphoresKHR(info.device, &waitInfo, FENCE_TIMEOUT);
+        } while (res == VK_TIMEOUT);
+        return res;
+    }
+
+    do
+    {
+        res = vkWaitForFences(info.device, 1, &drawFence, VK_TRUE, FENCE_TIMEOUT);
+    } while (res == VK_TIMEOUT);
+    vkResetFences(info.device, 1, &drawFence);
+    return res;
+}
+
 // Common code to present image used by all tests
 void Present(sample_info &info, VkFence drawFence)
 {
@@ -225,12 +304,7 @@ void Present(sample_info &info, VkFence drawFence)
     present.pResults           = NULL;
 
     // Make sure command buffer is finished before presenting
-    VkResult res;
-    do
-    {
-        res = vkWaitForFences(info.device, 1, &drawFence, VK_TRUE, FENCE_TIMEOUT);
-    } while (res == VK_TIMEOUT);
-    vkResetFences(info.device, 1, &drawFence);
+    VkResult res = WaitForSubmission(info, drawFence);
 
     ASSERT_EQ(VK_SUCCESS, res);
     res = vkQueuePresentKHR(info.present_queue, &present);
@@ -297,8 +371,7 @@ void PrimaryCommandBufferBenchmarkHundredIndividual(sample_info &info,
     submitInfo[0].pSignalSemaphores       = NULL;
 
     // Queue the command buffer for execution
-    res = vkQueueSubmit(info.graphics_queue, 1, submitInfo, drawFence);
-    ASSERT_EQ(VK_SUCCESS, res);
+    Submit(info, submitInfo, drawFence);
 
     Present(info, drawFence);
 }
@@ -364,8 +437,7 @@ void PrimaryCommandBufferBenchmarkOneWithOneHundred(sample_info &info,
     submitInfo[0].pSignalSemaphores       = NULL;
 
     // Queue the command buffer for execution
-    res = vkQueueSubmit(info.graphics_queue, 1, submitInfo, drawFence);
-    ASSERT_EQ(VK_SUCCESS, res);
+    Submit(info, submitInfo, drawFence);
 
     Present(info, drawFence);
 }
@@ -456,8 +528,7 @@ void SecondaryCommandBufferBenchmark(sample_info &info,
     submitInfo[0].pSignalSemaphores       = NULL;
 
     // Queue the command buffer for execution
-    res = vkQueueSubmit(info.graphics_queue, 1, submitInfo, drawFence);
-    ASSERT_EQ(VK_SUCCESS, res);
+    Submit(info, submitInfo, drawFence);
 
     Present(info, drawFence);
 }
@@ -632,6 +703,22 @@ CommandBufferTestParams CommandBufferImplicitResetParams()
     return params;
 }
 
+CommandBufferTestParams PrimaryCBHundredIndividualTimelineSemaphoreParams()
+{
+    CommandBufferTestParams params = PrimaryCBHundredIndividualParams();
+    params.story += "_Timeline_Semaphore";
+    params.timelineSemaphore = true;
+    return params;
+}
+
+CommandBufferTestParams SecondaryCBTimelineSemaphoreParams()
+{
+    CommandBufferTestParams params = SecondaryCBParams();
+    params.story += "_Timeline_Semaphore";
+    params.timelineSemaphore = true;
+    return params;
+}
+
 TEST_P(VulkanCommandBufferPerfTest, Run)
 {
     run();
@@ -647,4 +734,6 @@ INSTANTIATE_TEST_SUITE_P(,
                                            CommandPoolSoftResetParams(),
                                            CommandBufferExplicitHardResetParams(),
                                            CommandBufferExplicitSoftResetParams(),
-                                           CommandBufferImplicitResetParams()));
+                                           CommandBufferImplicitResetParams(),
+                                           PrimaryCBHundredIndividualTimelineSemaphoreParams(),
+                                           SecondaryCBTimelineSemaphoreParams()));
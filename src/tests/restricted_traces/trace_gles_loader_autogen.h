@@ -461,6 +461,17 @@
 #define glTexBuffer t_glTexBuffer
 #define glTexBufferRange t_glTexBufferRange
 #define glTexStorage3DMultisample t_glTexStorage3DMultisample
+#define glBeginPerfMonitorAMD t_glBeginPerfMonitorAMD
+#define glDeletePerfMonitorsAMD t_glDeletePerfMonitorsAMD
+#define glEndPerfMonitorAMD t_glEndPerfMonitorAMD
+#define glGenPerfMonitorsAMD t_glGenPerfMonitorsAMD
+#define glGetPerfMonitorCounterDataAMD t_glGetPerfMonitorCounterDataAMD
+#define glGetPerfMonitorCounterInfoAMD t_glGetPerfMonitorCounterInfoAMD
+#define glGetPerfMonitorCounterStringAMD t_glGetPerfMonitorCounterStringAMD
+#define glGetPerfMonitorCountersAMD t_glGetPerfMonitorCountersAMD
+#define glGetPerfMonitorGroupStringAMD t_glGetPerfMonitorGroupStringAMD
+#define glGetPerfMonitorGroupsAMD t_glGetPerfMonitorGroupsAMD
+#define glSelectPerfMonitorCountersAMD t_glSelectPerfMonitorCountersAMD
 #define glDrawArraysInstancedBaseInstanceANGLE t_glDrawArraysInstancedBaseInstanceANGLE
 #define glDrawElementsInstancedBaseVertexBaseInstanceANGLE \
     t_glDrawElementsInstancedBaseVertexBaseInstanceANGLE
@@ -1253,6 +1264,22 @@ ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETSAMPLERPARAMETERIUIVPROC t_glGetSampler
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLTEXBUFFERPROC t_glTexBuffer;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLTEXBUFFERRANGEPROC t_glTexBufferRange;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC t_glTexStorage3DMultisample;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLBEGINPERFMONITORAMDPROC t_glBeginPerfMonitorAMD;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLDELETEPERFMONITORSAMDPROC t_glDeletePerfMonitorsAMD;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLENDPERFMONITORAMDPROC t_glEndPerfMonitorAMD;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLGENPERFMONITORSAMDPROC t_glGenPerfMonitorsAMD;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETPERFMONITORCOUNTERDATAAMDPROC
+    t_glGetPerfMonitorCounterDataAMD;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETPERFMONITORCOUNTERINFOAMDPROC
+    t_glGetPerfMonitorCounterInfoAMD;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC
+    t_glGetPerfMonitorCounterStringAMD;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETPERFMONITORCOUNTERSAMDPROC t_glGetPerfMonitorCountersAMD;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETPERFMONITORGROUPSTRINGAMDPROC
+    t_glGetPerfMonitorGroupStringAMD;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETPERFMONITORGROUPSAMDPROC t_glGetPerfMonitorGroupsAMD;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLSELECTPERFMONITORCOUNTERSAMDPROC
+    t_glSelectPerfMonitorCountersAMD;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEANGLEPROC
     t_glDrawArraysInstancedBaseInstanceANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEANGLEPROC
@@ -298,6 +298,26 @@ std::ostream &operator<<(std::ostream &stream, const PlatformParameters &pp)
         stream << "_InitShaderVars";
     }
 
+    if (pp.eglParameters.batchDrawCallsFeatureGL == EGL_TRUE)
+    {
+        stream << "_BatchDrawCalls";
+    }
+
+    if (pp.eglParameters.lowLatencyFramePacingFeatureVulkan == EGL_TRUE)
+    {
+        stream << "_LowLatencyFramePacing";
+    }
+
+    if (pp.eglParameters.asyncGarbageCleanupFeatureVulkan == EGL_TRUE)
+    {
+        stream << "_AsyncGarbageCleanup";
+    }
+
+    if (pp.eglParameters.imagelessFramebufferFeatureVulkan == EGL_FALSE)
+    {
+        stream << "_NoImagelessFramebuffer";
+    }
+
     return stream;
 }
 
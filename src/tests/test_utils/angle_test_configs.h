@@ -319,6 +319,34 @@ inline PlatformParameters WithInitShaderVariables(const PlatformParameters &para
     initShaderVariables.eglParameters.forceInitShaderVariables = EGL_TRUE;
     return initShaderVariables;
 }
+
+inline PlatformParameters WithBatchDrawCalls(const PlatformParameters &params)
+{
+    PlatformParameters batchDrawCalls                    = params;
+    batchDrawCalls.eglParameters.batchDrawCallsFeatureGL = EGL_TRUE;
+    return batchDrawCalls;
+}
+
+inline PlatformParameters WithLowLatencyFramePacing(const PlatformParameters &params)
+{
+    PlatformParameters lowLatencyFramePacing                               = params;
+    lowLatencyFramePacing.eglParameters.lowLatencyFramePacingFeatureVulkan = EGL_TRUE;
+    return lowLatencyFramePacing;
+}
+
+inline PlatformParameters WithAsyncGarbageCleanup(const PlatformParameters &params)
+{
+    PlatformParameters asyncGarbageCleanup                             = params;
+    asyncGarbageCleanup.eglParameters.asyncGarbageCleanupFeatureVulkan = EGL_TRUE;
+    return asyncGarbageCleanup;
+}
+
+inline PlatformParameters WithNoImagelessFramebuffer(const PlatformParameters &params)
+{
+    PlatformParameters withoutImagelessFramebuffer                              = params;
+    withoutImagelessFramebuffer.eglParameters.imagelessFramebufferFeatureVulkan = EGL_FALSE;
+    return withoutImagelessFramebuffer;
+}
 }  // namespace angle
 
 #endif  // ANGLE_TEST_CONFIGS_H_
@@ -0,0 +1,50 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// cl_test_utils.cpp:
+//   Common utilities for OpenCL tests, which call the CL entry points of ANGLE directly.
+//
+
+#include "cl_test_utils.h"
+
+#include <cstring>
+#include <vector>
+
+cl_device_id FindCLDevice(const char *preferredPlatformName, cl_platform_id *platformOut)
+{
+    cl_uint numPlatforms = 0;
+    if (cl::clGetPlatformIDs(0, nullptr, &numPlatforms) != CL_SUCCESS || numPlatforms == 0)
+    {
+        return nullptr;
+    }
+    std::vector<cl_platform_id> platforms(numPlatforms);
+    cl::clGetPlatformIDs(numPlatforms, platforms.data(), nullptr);
+
+    cl_device_id device = nullptr;
+    for (cl_platform_id platform : platforms)
+    {
+        cl_device_id platformDevice = nullptr;
+        if (cl::clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 1, &platformDevice, nullptr) !=
+            CL_SUCCESS)
+        {
+            continue;
+        }
+
+        char name[64] = {};
+        cl::clGetPlatformInfo(platform, CL_PLATFORM_NAME, sizeof(name) - 1, name, nullptr);
+        const bool isPreferred =
+            preferredPlatformName != nullptr && std::strcmp(name, preferredPlatformName) == 0;
+        if (device == nullptr || isPreferred)
+        {
+            *platformOut = platform;
+            device       = platformDevice;
+        }
+        if (isPreferred)
+        {
+            break;
+        }
+    }
+    return device;
+}
@@ -0,0 +1,22 @@
+//
+// Copyright 2021 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// cl_test_utils.h:
+//   Common utilities for OpenCL tests, which call the CL entry points of ANGLE directly.
+//
+
+#ifndef TESTS_TEST_UTILS_CL_TEST_UTILS_H_
+#define TESTS_TEST_UTILS_CL_TEST_UTILS_H_
+
+#include "libGLESv2/entry_points_cl_autogen.h"
+
+// The name of the platform of the Vulkan back end.
+constexpr char kVulkanCLPlatformName[] = "ANGLE Vulkan";
+
+// Returns a device of the platform named |preferredPlatformName| if it has one, or else of the
+// first platform with a device. Returns null if there is no device.
+cl_device_id FindCLDevice(const char *preferredPlatformName, cl_platform_id *platformOut);
+
+#endif  // TESTS_TEST_UTILS_CL_TEST_UTILS_H_
@@ -63,6 +63,8 @@ void main()
     gl_FragColor = texture2D(tex1, texCoord) + texture2D(tex2, texCoord);
 })";
 
+}  // anonymous namespace
+
 void Generate2DTriangleData(size_t numTris, std::vector<float> *floatData)
 {
     for (size_t triIndex = 0; triIndex < numTris; ++triIndex)
@@ -78,8 +80,6 @@ void Generate2DTriangleData(size_t numTris, std::vector<float> *floatData)
     }
 }
 
-}  // anonymous namespace
-
 GLuint SetupSimpleScaleAndOffsetProgram()
 {
     GLuint program = CompileProgram(kSimpleScaleAndOffsetVS, kSimpleFS);
@@ -11,6 +11,7 @@
 #define TESTS_TEST_UTILS_DRAW_CALL_PERF_UTILS_H_
 
 #include <stddef.h>
+#include <vector>
 
 #include "util/gles_loader_autogen.h"
 
@@ -35,6 +36,10 @@ GLuint SetupSimpleScaleAndOffsetProgram();
 // B-----C
 GLuint Create2DTriangleBuffer(size_t numTris, GLenum usage);
 
+// Appends the 2-component triangle coordinates used by Create2DTriangleBuffer to floatData, for
+// tests that draw from client-side arrays.
+void Generate2DTriangleData(size_t numTris, std::vector<float> *floatData);
+
 // Creates an FBO with a texture color attachment. The texture is GL_RGBA and has dimensions
 // width/height. The FBO and texture ids are written to the out parameters.
 void CreateColorFBO(GLsizei width, GLsizei height, GLuint *fbo, GLuint *texture);
@@ -707,12 +707,42 @@ VkResult init_device(struct sample_info &info)
         device_info.enabledExtensionCount ? info.device_extension_names.data() : NULL;
     device_info.pEnabledFeatures = NULL;
 
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timeline_features = {};
+    timeline_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+    timeline_features.timelineSemaphore = VK_TRUE;
+    if (info.use_timeline_semaphore)
+    {
+        info.device_extension_names.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+        device_info.enabledExtensionCount   = info.device_extension_names.size();
+        device_info.ppEnabledExtensionNames = info.device_extension_names.data();
+        device_info.pNext                   = &timeline_features;
+    }
+
     res = vkCreateDevice(info.gpus[0], &device_info, NULL, &info.device);
     ASSERT(res == VK_SUCCESS);
 #if ANGLE_SHARED_LIBVULKAN
     volkLoadDevice(info.device);
 #endif  // ANGLE_SHARED_LIBVULKAN
 
+    if (info.use_timeline_semaphore)
+    {
+        VkSemaphoreTypeCreateInfoKHR type_info = {};
+        type_info.sType                        = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        type_info.semaphoreType                = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        type_info.initialValue                 = 0;
+
+        VkSemaphoreCreateInfo semaphore_info = {};
+        semaphore_info.sType                 = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphore_info.pNext                 = &type_info;
+
+        res = vkCreateSemaphore(info.device, &semaphore_info, NULL, &info.timeline_semaphore);
+        ASSERT(res == VK_SUCCESS);
+        info.timeline_value      = 0;
+        info.fpWaitSemaphoresKHR = reinterpret_cast<PFN_vkWaitSemaphoresKHR>(
+            vkGetDeviceProcAddr(info.device, "vkWaitSemaphoresKHR"));
+        ASSERT(info.fpWaitSemaphoresKHR != NULL);
+    }
+
     return res;
 }
 
@@ -1920,6 +1950,10 @@ void destroy_renderpass(struct sample_info &info)
 void destroy_device(struct sample_info &info)
 {
     vkDeviceWaitIdle(info.device);
+    if (info.timeline_semaphore != VK_NULL_HANDLE)
+    {
+        vkDestroySemaphore(info.device, info.timeline_semaphore, NULL);
+    }
     vkDestroyDevice(info.device, NULL);
 }
 
@@ -165,6 +165,13 @@ struct sample_info
     uint32_t present_queue_family_index;
     VkPhysicalDeviceProperties gpu_props;
     std::vector<VkQueueFamilyProperties> queue_props;
+
+    // When set before init_device(), submissions are tracked with a VK_KHR_timeline_semaphore
+    // signaled with an increasing value instead of a fence.
+    bool use_timeline_semaphore;
+    VkSemaphore timeline_semaphore;
+    uint64_t timeline_value;
+    PFN_vkWaitSemaphoresKHR fpWaitSemaphoresKHR;
     VkPhysicalDeviceMemoryProperties memory_properties;
 
     VkFramebuffer *framebuffers;
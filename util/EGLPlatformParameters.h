@@ -66,7 +66,9 @@ struct EGLPlatformParameters
                         hasExplicitMemBarrierFeatureMtl, hasCheapRenderPassFeatureMtl,
                         forceBufferGPUStorageFeatureMtl, supportsVulkanViewportFlip, emulatedVAOs,
                         directSPIRVGeneration, captureLimits, forceRobustResourceInit,
-                        directMetalGeneration, forceInitShaderVariables);
+                        directMetalGeneration, forceInitShaderVariables, batchDrawCallsFeatureGL,
+                        lowLatencyFramePacingFeatureVulkan, asyncGarbageCleanupFeatureVulkan,
+                        imagelessFramebufferFeatureVulkan);
     }
 
     EGLint renderer                               = EGL_PLATFORM_ANGLE_TYPE_DEFAULT_ANGLE;
@@ -94,6 +96,10 @@ struct EGLPlatformParameters
     EGLint forceRobustResourceInit                = EGL_DONT_CARE;
     EGLint directMetalGeneration                  = EGL_DONT_CARE;
     EGLint forceInitShaderVariables               = EGL_DONT_CARE;
+    EGLint batchDrawCallsFeatureGL                = EGL_DONT_CARE;
+    EGLint lowLatencyFramePacingFeatureVulkan     = EGL_DONT_CARE;
+    EGLint asyncGarbageCleanupFeatureVulkan       = EGL_DONT_CARE;
+    EGLint imagelessFramebufferFeatureVulkan      = EGL_DONT_CARE;
 
     angle::PlatformMethods *platformMethods = nullptr;
 };
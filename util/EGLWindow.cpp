@@ -306,6 +306,26 @@ bool EGLWindow::initializeDisplay(OSWindow *osWindow,
         enabledFeatureOverrides.push_back("forceInitShaderVariables");
     }
 
+    if (params.batchDrawCallsFeatureGL == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("batch_draw_calls_with_multi_draw");
+    }
+
+    if (params.lowLatencyFramePacingFeatureVulkan == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("lowLatencyFramePacing");
+    }
+
+    if (params.asyncGarbageCleanupFeatureVulkan == EGL_TRUE)
+    {
+        enabledFeatureOverrides.push_back("asyncGarbageCleanup");
+    }
+
+    if (params.imagelessFramebufferFeatureVulkan == EGL_FALSE)
+    {
+        disabledFeatureOverrides.push_back("supportsImagelessFramebuffer");
+    }
+
     const bool hasFeatureControlANGLE =
         strstr(extensionString, "EGL_ANGLE_feature_control") != nullptr;
 
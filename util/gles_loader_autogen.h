@@ -461,6 +461,17 @@
 #define glTexBuffer l_glTexBuffer
 #define glTexBufferRange l_glTexBufferRange
 #define glTexStorage3DMultisample l_glTexStorage3DMultisample
+#define glBeginPerfMonitorAMD l_glBeginPerfMonitorAMD
+#define glDeletePerfMonitorsAMD l_glDeletePerfMonitorsAMD
+#define glEndPerfMonitorAMD l_glEndPerfMonitorAMD
+#define glGenPerfMonitorsAMD l_glGenPerfMonitorsAMD
+#define glGetPerfMonitorCounterDataAMD l_glGetPerfMonitorCounterDataAMD
+#define glGetPerfMonitorCounterInfoAMD l_glGetPerfMonitorCounterInfoAMD
+#define glGetPerfMonitorCounterStringAMD l_glGetPerfMonitorCounterStringAMD
+#define glGetPerfMonitorCountersAMD l_glGetPerfMonitorCountersAMD
+#define glGetPerfMonitorGroupStringAMD l_glGetPerfMonitorGroupStringAMD
+#define glGetPerfMonitorGroupsAMD l_glGetPerfMonitorGroupsAMD
+#define glSelectPerfMonitorCountersAMD l_glSelectPerfMonitorCountersAMD
 #define glDrawArraysInstancedBaseInstanceANGLE l_glDrawArraysInstancedBaseInstanceANGLE
 #define glDrawElementsInstancedBaseVertexBaseInstanceANGLE \
     l_glDrawElementsInstancedBaseVertexBaseInstanceANGLE
@@ -1250,6 +1261,17 @@ ANGLE_UTIL_EXPORT extern PFNGLGETSAMPLERPARAMETERIUIVPROC l_glGetSamplerParamete
 ANGLE_UTIL_EXPORT extern PFNGLTEXBUFFERPROC l_glTexBuffer;
 ANGLE_UTIL_EXPORT extern PFNGLTEXBUFFERRANGEPROC l_glTexBufferRange;
 ANGLE_UTIL_EXPORT extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC l_glTexStorage3DMultisample;
+ANGLE_UTIL_EXPORT extern PFNGLBEGINPERFMONITORAMDPROC l_glBeginPerfMonitorAMD;
+ANGLE_UTIL_EXPORT extern PFNGLDELETEPERFMONITORSAMDPROC l_glDeletePerfMonitorsAMD;
+ANGLE_UTIL_EXPORT extern PFNGLENDPERFMONITORAMDPROC l_glEndPerfMonitorAMD;
+ANGLE_UTIL_EXPORT extern PFNGLGENPERFMONITORSAMDPROC l_glGenPerfMonitorsAMD;
+ANGLE_UTIL_EXPORT extern PFNGLGETPERFMONITORCOUNTERDATAAMDPROC l_glGetPerfMonitorCounterDataAMD;
+ANGLE_UTIL_EXPORT extern PFNGLGETPERFMONITORCOUNTERINFOAMDPROC l_glGetPerfMonitorCounterInfoAMD;
+ANGLE_UTIL_EXPORT extern PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC l_glGetPerfMonitorCounterStringAMD;
+ANGLE_UTIL_EXPORT extern PFNGLGETPERFMONITORCOUNTERSAMDPROC l_glGetPerfMonitorCountersAMD;
+ANGLE_UTIL_EXPORT extern PFNGLGETPERFMONITORGROUPSTRINGAMDPROC l_glGetPerfMonitorGroupStringAMD;
+ANGLE_UTIL_EXPORT extern PFNGLGETPERFMONITORGROUPSAMDPROC l_glGetPerfMonitorGroupsAMD;
+ANGLE_UTIL_EXPORT extern PFNGLSELECTPERFMONITORCOUNTERSAMDPROC l_glSelectPerfMonitorCountersAMD;
 ANGLE_UTIL_EXPORT extern PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEANGLEPROC
     l_glDrawArraysInstancedBaseInstanceANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEANGLEPROC